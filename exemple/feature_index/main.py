@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+"""
+Build a sidecar feature index for a GeoJSON FeatureCollection and extract subsets from it.
+
+	main.py build   communes.geojson                    -> writes communes.geojson.ogfi
+	main.py extract communes.geojson --bbox 2 48 3 49   -> prints a FeatureCollection of the hits
+	main.py extract communes.geojson --id 75056 --out paris.geojson
+
+Extractions only read the selected features from the memory-mapped file.
+"""
+from __future__ import annotations
+
+import argparse
+import sys
+
+import pygeoflow
+from pygeoflow import io as gio
+
+
+def sidecar_path(path: str) -> str:
+	return path + ".ogfi"
+
+
+def build(args) -> int:
+	index = gio.Feature_Index()
+	err = index.Build(args.geojson)
+	if err != gio.Error.NO_ERROR:
+		print(f"indexing failed: {err}", file=sys.stderr)
+		return 1
+	err = index.Save(sidecar_path(args.geojson))
+	if err != gio.Error.NO_ERROR:
+		print(f"cannot write index: {err}", file=sys.stderr)
+		return 1
+	print(f"{index.Size()} features indexed in {sidecar_path(args.geojson)}")
+	return 0
+
+
+def extract(args) -> int:
+	index = gio.Feature_Index()
+	err = index.Load(sidecar_path(args.geojson))
+	if err != gio.Error.NO_ERROR:
+		print(f"cannot read index (run build first): {err}", file=sys.stderr)
+		return 1
+
+	if args.bbox:
+		selection = index.Query(args.bbox)
+	elif args.id is not None:
+		selection = index.Find(args.id)
+	else:
+		selection = range(args.range[0], min(args.range[1], index.Size()))
+
+	reader = gio.Indexed_Reader()
+	err = reader.Open(args.geojson, index)
+	if err != gio.Error.NO_ERROR:
+		print(f"cannot open {args.geojson}: {err}", file=sys.stderr)
+		return 1
+
+	out = open(args.out, "w", encoding="utf-8") if args.out else sys.stdout
+	out.write('{"type":"FeatureCollection","features":[\n')
+	out.write(",\n".join(reader.Feature_Text(i) for i in selection))
+	out.write('\n]}\n')
+	if args.out:
+		out.close()
+	return 0
+
+
+def main() -> int:
+	parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+	sub = parser.add_subparsers(dest="command", required=True)
+
+	p_build = sub.add_parser("build", help="scan the file once and write its sidecar index")
+	p_build.add_argument("geojson")
+	p_build.set_defaults(func=build)
+
+	p_extract = sub.add_parser("extract", help="extract features using the sidecar index")
+	p_extract.add_argument("geojson")
+	group = p_extract.add_mutually_exclusive_group(required=True)
+	group.add_argument("--bbox", type=float, nargs=4, metavar=("MINX", "MINY", "MAXX", "MAXY"))
+	group.add_argument("--id", type=str)
+	group.add_argument("--range", type=int, nargs=2, metavar=("FIRST", "LAST"))
+	p_extract.add_argument("--out", type=str, default=None)
+	p_extract.set_defaults(func=extract)
+
+	args = parser.parse_args()
+	return args.func(args)
+
+
+if __name__ == "__main__":
+	sys.exit(main())
@@ -16,15 +16,28 @@
 
 namespace O::DCEL::Builder
 {
+	/// @brief how ``From_GeoJSON`` links the half edges while the rings are read
+	enum class Build_Mode
+	{
+		INCREMENTAL, ///< every ring is inserted in the stars of its vertices and linked right away
+		BULK,        ///< rings only create vertices and twin pairs, the stars are sorted and linked once in ``Get_Dcel``
+	};
+
 	/**
 	 * @brief Builder is a GeoJSON reciever (from ``IO::Full_Parser``or ``IO::Feature_Parser``) that build a DCEL Structure from the input GeoJSON data
+	 * @tparam Policy storage policy of the built ``DCEL::Storage``
 	 */
-	template<class Vertex, class Half_Edge, class Face>
+	template<class Vertex, class Half_Edge, class Face, class Policy = Vector_Policy<>>
 	class From_GeoJSON
 	{
 	public:
 
-		From_GeoJSON(const O::Configuration::DCEL& config);
+		/**
+		 * @param config configuration of the built ``DCEL::Storage``
+		 * @param mode ``INCREMENTAL`` links every ring when it is read, ``BULK`` defers the linking to ``Get_Dcel``
+		 * @param thread_count number of workers linking the stars in ``BULK`` mode, 0 for ``std::thread::hardware_concurrency``
+		 */
+		From_GeoJSON(const O::Configuration::DCEL& config, Build_Mode mode = Build_Mode::INCREMENTAL, std::size_t thread_count = 0);
 		/**
 		 * @brief Create the DCEL structure from a Fully parsed GeoJSON (from IO::Full_Parser for exemple)
 		 * @param geojson the full GeoJSON to parse from
@@ -37,7 +50,7 @@ namespace O::DCEL::Builder
 		/// @brief implementation of the O::GeoJSON::IO::Feature_Parser functions.
 		/// @{
 		bool On_Full_Feature(O::GeoJSON::Feature&& feature);
-		bool On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id);
+		bool On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id);
 		/// @}
 
 		/**
@@ -45,7 +58,7 @@ namespace O::DCEL::Builder
 		 * @return DCEL::Storage Object, std::nullopt if the parsing went bad or if already been called. 
 		 * @warning this function must only be called once since the ``DCEL::Storage`` is moved to the caller
 		 */
-		std::optional<Storage<Vertex, Half_Edge, Face>> Get_Dcel();
+		std::optional<Storage<Vertex, Half_Edge, Face, Policy>> Get_Dcel();
 
 		/**
 		 * @brief retirve the fully parsed ``DCEL::Feature_Info`` Object if parsing went well
@@ -100,15 +113,35 @@ namespace O::DCEL::Builder
 		 */
 		Face& Link_Face(std::vector<O::Unowned_Ptr<Half_Edge>>& ring_edge, O::Unowned_Ptr<Face> outer_face);
 
+		/**
+		 * @brief ``BULK`` counterpart of ``Link_Face``: create the face of a ring with its representative half edge, its cycle is walked in ``Link_Pending_Faces``
+		 * @param ring_edge  List of half-edge forming the ring.
+		 * @param outer_face the outer face that contains this ring.
+		 * @return the newly created face.
+		 */
+		Face& Defer_Face(std::vector<O::Unowned_Ptr<Half_Edge>>& ring_edge, O::Unowned_Ptr<Face> outer_face);
+
+		/**
+		 * @brief ``BULK`` mode: sort the star of every vertex by pseudo-angle and link the ``next``/``prev`` around it.
+		 *        Vertices are split in contiguous ranges handled by ``m_thread_count`` workers, each half edge is written by the vertex it points to only.
+		 */
+		void Link_Stars();
+
+		/// @brief ``BULK`` mode: walk the cycle of every ring face in reading order and set the ``face`` of its half edges
+		void Link_Pending_Faces();
+
 		void Link_Outer_Bound_Face();
 
 
 	private:
 
-		Storage<Vertex, Half_Edge, Face> m_dcel;    ///< Storage for the DCEL
+		Storage<Vertex, Half_Edge, Face, Policy> m_dcel;    ///< Storage for the DCEL
 		bool m_valid_dcel = true;         ///< runonce for the Get_Dcel() function
 		bool m_valid_feature_info = true; ///< runonce for the Get_Feature_Info function
 		Feature_Info<Face> m_feature_info;      ///< Feature_Info to retain the parsed GeoJSON meta data
+		Build_Mode m_mode;                ///< linking strategy
+		std::size_t m_thread_count;       ///< workers of ``Link_Stars``
+		std::vector<O::Unowned_Ptr<Face>> m_pending_faces; ///< ``BULK`` mode: ring faces whose cycle is not walked yet
 	};
 }
 
@@ -7,22 +7,29 @@
 #include <cassert>
 #include <algorithm>
 #include <ranges>
+#include <thread>
 
 // UTILS
 #include <utils/zip.h>
 
-template<class Vertex, class Half_Edge, class Face>
-O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::From_GeoJSON(const O::Configuration::DCEL& config) :
+// DCEL
+#include "dcel/ring_orientation.h"
+
+template<class Vertex, class Half_Edge, class Face, class Policy>
+O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::From_GeoJSON(const O::Configuration::DCEL& config, Build_Mode mode, std::size_t thread_count) :
 	m_dcel(config),
 	m_valid_dcel(true),
 	m_valid_feature_info(true),
-	m_feature_info()
+	m_feature_info(),
+	m_mode(mode),
+	m_thread_count(thread_count),
+	m_pending_faces()
 {
 
 }
 
-template<class Vertex, class Half_Edge, class Face>
-bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::Parse(GeoJSON::Root&& geojson)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::Parse(GeoJSON::Root&& geojson)
 {
 	return std::visit([&](auto&& val) {
 		using T = std::decay_t<decltype(val)>;
@@ -41,8 +48,8 @@ bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::Parse(GeoJSON::Roo
 
 }
 
-template<class Vertex, class Half_Edge, class Face>
-bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::On_Full_Feature(GeoJSON::Feature&& feature)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::On_Full_Feature(GeoJSON::Feature&& feature)
 {
 	if (!feature.geometry) return true;
 	m_feature_info.feature_properties.emplace_back(std::move(feature.properties));
@@ -57,8 +64,8 @@ bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::On_Full_Feature(Ge
 	return true;
 }
 
-template<class Vertex, class Half_Edge, class Face>
-bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::On_Root(std::optional<GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::On_Root(std::optional<GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id)
 {
 	m_feature_info.root_bbox = std::move(bbox);
 	m_feature_info.root_id = std::move(id);
@@ -66,14 +73,14 @@ bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::On_Root(std::optio
 	return true;
 }
 
-template<class Vertex, class Half_Edge, class Face>
-void O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::Link_Outer_Bound_Face()
+template<class Vertex, class Half_Edge, class Face, class Policy>
+void O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::Link_Outer_Bound_Face()
 {
 	for (Half_Edge& half_edge: m_dcel.half_edges)
 	{
 		if (half_edge.face)
 			continue;
-		if(m_dcel.faces.size() + 1 > m_dcel.config.max_faces) [[unlikely]] throw Exception{Exception::FACES_OVERFLOW};
+		if(Policy::RESERVED && m_dcel.faces.size() + 1 > m_dcel.config.max_faces) [[unlikely]] throw Exception{Exception::FACES_OVERFLOW};
 		m_dcel.faces.emplace_back( &half_edge );
 		O::Unowned_Ptr<Half_Edge> e(&half_edge);
 		do {
@@ -84,9 +91,15 @@ void O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::Link_Outer_Bound_F
 	}
 }
 
-template<class Vertex, class Half_Edge, class Face>
-std::optional<O::DCEL::Storage<Vertex, Half_Edge, Face>> O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::Get_Dcel()
+template<class Vertex, class Half_Edge, class Face, class Policy>
+std::optional<O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>> O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::Get_Dcel()
 {
+	// link the stars and the ring faces deferred by the bulk mode
+	if (m_mode == Build_Mode::BULK && m_valid_dcel)
+	{
+		Link_Stars();
+		Link_Pending_Faces();
+	}
 
 	// finish face for outer bound
 	Link_Outer_Bound_Face();
@@ -94,13 +107,13 @@ std::optional<O::DCEL::Storage<Vertex, Half_Edge, Face>> O::DCEL::Builder::From_
 	if(m_valid_dcel)
 	{
 		m_valid_dcel = false;
-		return static_cast<Storage<Vertex, Half_Edge, Face>>(std::move(m_dcel));
+		return static_cast<Storage<Vertex, Half_Edge, Face, Policy>>(std::move(m_dcel));
 	}
 	return std::nullopt;
 }
 
-template<class Vertex, class Half_Edge, class Face>
-std::optional<O::DCEL::Feature_Info<Face>> O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::Get_Feature_Info()
+template<class Vertex, class Half_Edge, class Face, class Policy>
+std::optional<O::DCEL::Feature_Info<Face>> O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::Get_Feature_Info()
 {
 	if(m_valid_feature_info)
 	{
@@ -110,8 +123,8 @@ std::optional<O::DCEL::Feature_Info<Face>> O::DCEL::Builder::From_GeoJSON<Vertex
 	return std::nullopt;
 }
 
-template<class Vertex, class Half_Edge, class Face>
-bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::On_Polygon(const GeoJSON::Polygon& poly)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::On_Polygon(const GeoJSON::Polygon& poly)
 {
     if (poly.rings.empty()) return true;
     auto faces = Build_Face_From_Rings(poly.rings);
@@ -120,8 +133,8 @@ bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::On_Polygon(const G
     return true;
 }
 
-template<class Vertex, class Half_Edge, class Face>
-bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::On_MultiPolygon(const GeoJSON::Multi_Polygon& mp)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::On_MultiPolygon(const GeoJSON::Multi_Polygon& mp)
 {
 	m_feature_info.faces.push_back({});
 	for (auto const& poly : mp.polygons)
@@ -133,49 +146,57 @@ bool O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::On_MultiPolygon(co
     return true;
 }
 
-template<class Vertex, class Half_Edge, class Face>
-std::vector<O::Unowned_Ptr<Vertex>> O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::Create_Vertex(const std::vector<GeoJSON::Position>& ring)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+std::vector<O::Unowned_Ptr<Vertex>> O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::Create_Vertex(const std::vector<GeoJSON::Position>& ring)
 {
 	std::vector<Unowned_Ptr<Vertex>> ring_vertices;
 	ring_vertices.reserve(ring.size());
 
 	// create/get vertices
-	double area = 0;
 	for (auto&& [ring_i, ring_i_1] : O::Zip_Adjacent(ring))
 	{
 		double lon = ring_i.longitude;
 		double lat = ring_i.latitude;
 		Vertex& vid = m_dcel.Get_Or_Create_Vertex(lon, lat);
 		ring_vertices.emplace_back(&vid);
-		area = ring_i.longitude * ring_i_1.latitude - ring_i.latitude + ring_i_1.longitude;
 	}
 
-	if (area > 0) // reverse so ring circle are always counter clock wise
+	if (Double_Signed_Area(ring) < 0) // reverse clockwise rings so ring circle are always counter clock wise
 		std::ranges::reverse(ring_vertices);
 	return ring_vertices;
 }
 
-template<class Vertex, class Half_Edge, class Face>
-std::vector<O::Unowned_Ptr<Half_Edge>> O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::Create_Forward_Half_Edge(const std::vector<O::Unowned_Ptr<Vertex>>& ring_vertex)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+std::vector<O::Unowned_Ptr<Half_Edge>> O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::Create_Forward_Half_Edge(const std::vector<O::Unowned_Ptr<Vertex>>& ring_vertex)
 {
 	std::vector<Unowned_Ptr<Half_Edge>> ring_edges;
 	ring_edges.reserve(ring_vertex.size());
 	for (auto&& [origin, head] : O::Zip_Adjacent_Circular(ring_vertex))
 	{
 		// ensure halfedge origin->head exists
+		const std::size_t half_edge_count = m_dcel.half_edges.size();
 		Half_Edge& half_edge = m_dcel.Get_Or_Create_Half_Edge(*origin, *head);
 		Half_Edge& half_edge_twin = m_dcel.Get_Or_Create_Half_Edge(*head, *origin);
 		m_dcel.Links_twins(half_edge, half_edge_twin);
-		m_dcel.Insert_Edge_Sorted(*origin, half_edge);
-		m_dcel.Insert_Edge_Sorted(*head, half_edge_twin);
+		if (m_mode == Build_Mode::INCREMENTAL)
+		{
+			m_dcel.Insert_Edge_Sorted(*origin, half_edge);
+			m_dcel.Insert_Edge_Sorted(*head, half_edge_twin);
+		}
+		else if (Policy::EDGE_LOOKUP && m_dcel.half_edges.size() != half_edge_count)
+		{
+			// new twin pair, the stars are only sorted once in Link_Stars
+			origin->outgoing_edges.push_back(&half_edge);
+			head->outgoing_edges.push_back(&half_edge_twin);
+		}
 		ring_edges.emplace_back(&half_edge);
 		ring_edges.emplace_back(&half_edge_twin);
 	}
 	return ring_edges;
 }
 
-template<class Vertex, class Half_Edge, class Face>
-void O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::Link_Next_Prev(const std::vector<O::Unowned_Ptr<Half_Edge>>& ring_edges)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+void O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::Link_Next_Prev(const std::vector<O::Unowned_Ptr<Half_Edge>>& ring_edges)
 {
 	for (size_t i : std::views::iota(0ul, ring_edges.size()))
 	{
@@ -187,12 +208,12 @@ void O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::Link_Next_Prev(con
 	}
 }
 
-template<class Vertex, class Half_Edge, class Face>
-Face& O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::Link_Face(std::vector<O::Unowned_Ptr<Half_Edge>>& ring_edge, O::Unowned_Ptr<Face> outer_face)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+Face& O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::Link_Face(std::vector<O::Unowned_Ptr<Half_Edge>>& ring_edge, O::Unowned_Ptr<Face> outer_face)
 {
 	Half_Edge& valid_start = (outer_face == nullptr) ? *ring_edge[0] : *ring_edge[1];
 	O::Unowned_Ptr<Half_Edge> current(&valid_start);
-	if(m_dcel.faces.size() + 1 > m_dcel.config.max_faces) [[unlikely]] throw Exception{Exception::FACES_OVERFLOW};
+	if(Policy::RESERVED && m_dcel.faces.size() + 1 > m_dcel.config.max_faces) [[unlikely]] throw Exception{Exception::FACES_OVERFLOW};
 	m_dcel.faces.emplace_back(&valid_start);
 	do {
 		current->face = &m_dcel.faces.back();
@@ -202,8 +223,62 @@ Face& O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::Link_Face(std::ve
 	return m_dcel.faces.back();
 }
 
-template<class Vertex, class Half_Edge, class Face>
-std::vector<O::Unowned_Ptr<Face>> O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face>::Build_Face_From_Rings(const std::vector<std::vector<GeoJSON::Position>>& rings)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+Face& O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::Defer_Face(std::vector<O::Unowned_Ptr<Half_Edge>>& ring_edge, O::Unowned_Ptr<Face> outer_face)
+{
+	Half_Edge& valid_start = (outer_face == nullptr) ? *ring_edge[0] : *ring_edge[1];
+	if(Policy::RESERVED && m_dcel.faces.size() + 1 > m_dcel.config.max_faces) [[unlikely]] throw Exception{Exception::FACES_OVERFLOW};
+	m_dcel.faces.emplace_back(&valid_start);
+	m_pending_faces.emplace_back(&m_dcel.faces.back());
+	return m_dcel.faces.back();
+}
+
+template<class Vertex, class Half_Edge, class Face, class Policy>
+void O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::Link_Stars()
+{
+	const std::size_t vertex_count = m_dcel.vertices.size();
+	auto link_range = [this](std::size_t begin, std::size_t end) {
+		for (std::size_t i = begin; i < end; ++i)
+		{
+			m_dcel.Sort_Around_Vertex(m_dcel.vertices[i]);
+			m_dcel.Update_Around_Vertex(m_dcel.vertices[i]);
+		}
+	};
+
+	std::size_t thread_count = m_thread_count;
+	if (thread_count == 0)
+		thread_count = std::max(1u, std::thread::hardware_concurrency());
+	thread_count = std::min(thread_count, vertex_count);
+	if (thread_count <= 1)
+		return link_range(0, vertex_count);
+
+	// every worker writes the next of the half edges pointing to its vertices and the prev of the ones leaving them, the ranges never share a write
+	std::vector<std::thread> workers;
+	workers.reserve(thread_count);
+	for (std::size_t i = 0; i < thread_count; ++i)
+		workers.emplace_back(link_range, vertex_count * i / thread_count, vertex_count * (i + 1) / thread_count);
+	for (std::thread& worker : workers)
+		worker.join();
+}
+
+template<class Vertex, class Half_Edge, class Face, class Policy>
+void O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::Link_Pending_Faces()
+{
+	for (O::Unowned_Ptr<Face> face : m_pending_faces)
+	{
+		O::Unowned_Ptr<Half_Edge> current = face->edge;
+		do {
+			current->face = face;
+			current = current->next;
+			assert(current);
+		}
+		while(current != face->edge);
+	}
+	m_pending_faces.clear();
+}
+
+template<class Vertex, class Half_Edge, class Face, class Policy>
+std::vector<O::Unowned_Ptr<Face>> O::DCEL::Builder::From_GeoJSON<Vertex, Half_Edge, Face, Policy>::Build_Face_From_Rings(const std::vector<std::vector<GeoJSON::Position>>& rings)
 {
 	assert(!rings.empty());
 
@@ -219,6 +294,15 @@ std::vector<O::Unowned_Ptr<Face>> O::DCEL::Builder::From_GeoJSON<Vertex, Half_Ed
 
 		std::vector<Unowned_Ptr<Vertex>> ring_vertices = Create_Vertex(ring);
 		std::vector<Unowned_Ptr<Half_Edge>> ring_edges = Create_Forward_Half_Edge(ring_vertices);
+		if (m_mode == Build_Mode::BULK)
+		{
+			Face& face = Defer_Face(ring_edges, outer_face);
+			if (ring_index == 0)
+				outer_face = &face;
+			created_faces.emplace_back(&face);
+			continue;
+		}
+
 		Link_Next_Prev(ring_edges);
 		for (Unowned_Ptr<Vertex> vid : ring_vertices)
 			m_dcel.Update_Around_Vertex(*vid);
@@ -0,0 +1,138 @@
+#ifndef DCEL_COORDINATE_KERNELS_H
+#define DCEL_COORDINATE_KERNELS_H
+
+// STL
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define O_DCEL_KERNEL_SSE2
+#include <emmintrin.h>
+#endif
+
+// CONFIGURATION
+#include "configuration/dcel.h"
+
+// DCEL
+#include "vertex_key.h"
+
+namespace O::DCEL
+{
+	/**
+	 * @brief Coordinates of a set of vertices stored as two contiguous arrays (structure of arrays): ``x[i], y[i]`` is the position of vertex ``i``.
+	 *        Whole dataset passes then stream through plain ``double`` arrays, see the ``Kernel`` functions.
+	 */
+	struct Coordinates
+	{
+		std::vector<double> x; ///< x coordinate of every vertex
+		std::vector<double> y; ///< y coordinate of every vertex
+	};
+
+	/// @brief axis aligned bounding box of a set of positions, empty (``min > max``) when there is none
+	struct Envelope
+	{
+		double min_x = std::numeric_limits<double>::infinity();
+		double min_y = std::numeric_limits<double>::infinity();
+		double max_x = -std::numeric_limits<double>::infinity();
+		double max_y = -std::numeric_limits<double>::infinity();
+	};
+
+	/**
+	 * @brief Bulk operations over coordinate arrays.
+	 *        The loops work on one array at a time without dependencies between iterations so the compiler vectorizes them, the envelope uses SSE2 when available.
+	 * @note the ``x`` and ``y`` spans of a call must have the same size
+	 */
+	namespace Kernel
+	{
+		/// @brief ``x += dx, y += dy``
+		inline void Translate(std::span<double> x, std::span<double> y, double dx, double dy)
+		{
+			assert(x.size() == y.size());
+			for (double& value : x) value += dx;
+			for (double& value : y) value += dy;
+		}
+
+		/// @brief ``x *= sx, y *= sy``
+		inline void Scale(std::span<double> x, std::span<double> y, double sx, double sy)
+		{
+			assert(x.size() == y.size());
+			for (double& value : x) value *= sx;
+			for (double& value : y) value *= sy;
+		}
+
+		/// @brief ``(x, y) = (a * x + b * y + c, d * x + e * y + f)``
+		inline void Affine(std::span<double> x, std::span<double> y, double a, double b, double c, double d, double e, double f)
+		{
+			assert(x.size() == y.size());
+			double* __restrict px = x.data();
+			double* __restrict py = y.data();
+			for (std::size_t i = 0; i < x.size(); ++i)
+			{
+				const double old_x = px[i];
+				const double old_y = py[i];
+				px[i] = a * old_x + b * old_y + c;
+				py[i] = d * old_x + e * old_y + f;
+			}
+		}
+
+		/// @brief bounding box of the positions
+		inline Envelope Compute_Envelope(std::span<const double> x, std::span<const double> y)
+		{
+			assert(x.size() == y.size());
+			Envelope envelope;
+			std::size_t i = 0;
+#ifdef O_DCEL_KERNEL_SSE2
+			// two lanes per register, each lane keeps its own bounds until the final reduction
+			__m128d min_x = _mm_set1_pd(envelope.min_x), max_x = _mm_set1_pd(envelope.max_x);
+			__m128d min_y = _mm_set1_pd(envelope.min_y), max_y = _mm_set1_pd(envelope.max_y);
+			for (; i + 2 <= x.size(); i += 2)
+			{
+				const __m128d vx = _mm_loadu_pd(x.data() + i);
+				const __m128d vy = _mm_loadu_pd(y.data() + i);
+				// the new values go first: a NaN one is skipped like with std::fmin
+				min_x = _mm_min_pd(vx, min_x);
+				max_x = _mm_max_pd(vx, max_x);
+				min_y = _mm_min_pd(vy, min_y);
+				max_y = _mm_max_pd(vy, max_y);
+			}
+			double lanes[2];
+			_mm_storeu_pd(lanes, min_x); envelope.min_x = std::fmin(lanes[0], lanes[1]);
+			_mm_storeu_pd(lanes, max_x); envelope.max_x = std::fmax(lanes[0], lanes[1]);
+			_mm_storeu_pd(lanes, min_y); envelope.min_y = std::fmin(lanes[0], lanes[1]);
+			_mm_storeu_pd(lanes, max_y); envelope.max_y = std::fmax(lanes[0], lanes[1]);
+#endif
+			for (; i < x.size(); ++i)
+			{
+				envelope.min_x = std::fmin(envelope.min_x, x[i]);
+				envelope.max_x = std::fmax(envelope.max_x, x[i]);
+				envelope.min_y = std::fmin(envelope.min_y, y[i]);
+				envelope.max_y = std::fmax(envelope.max_y, y[i]);
+			}
+			return envelope;
+		}
+
+		/// @brief move every position to the nearest node of a grid of step ``cell_size`` (halfway cases away from zero, as ``Vertex_Key``)
+		inline void Snap_To_Grid(std::span<double> x, std::span<double> y, double cell_size)
+		{
+			assert(x.size() == y.size());
+			for (double& value : x) value = std::round(value / cell_size) * cell_size;
+			for (double& value : y) value = std::round(value / cell_size) * cell_size;
+		}
+
+		/// @brief ``keys[i] = Vertex_Key(x[i], y[i], config)``
+		inline void Compute_Vertex_Keys(std::span<const double> x, std::span<const double> y, const O::Configuration::DCEL& config, std::vector<Vertex_Key>& keys)
+		{
+			assert(x.size() == y.size());
+			keys.clear();
+			keys.reserve(x.size());
+			for (std::size_t i = 0; i < x.size(); ++i)
+				keys.emplace_back(x[i], y[i], config);
+		}
+	} // namespace Kernel
+} // namespace O::DCEL
+
+#endif // DCEL_COORDINATE_KERNELS_H
@@ -29,6 +29,14 @@ namespace O::DCEL::Exporter
 		 */
 		static O::GeoJSON::Root Convert(const Feature_Info<Face>& info);
 
+		/**
+		 * @brief Reconstruct a single feature
+		 * @param info the Feature_INFO
+		 * @param feature_index index of the feature inside the ``Feature_Info``
+		 * @return O::GeoJSON::Feature the reconstructed feature
+		 */
+		static O::GeoJSON::Feature Convert_Feature(const Feature_Info<Face>& info, std::size_t feature_index);
+
 	private:
 	
 		/**
@@ -8,9 +8,6 @@
 #include <cassert>
 #include <map>
 
-// UTILS
-#include <utils/zip.h>
-
 // DCEL
 #include "dcel/face.h"
 
@@ -45,38 +42,43 @@ O::GeoJSON::Polygon O::DCEL::Exporter::To_GeoJSON<Vertex, Half_Edge, Face>::Crea
 }
 
 template<class Vertex, class Half_Edge, class Face>
-O::GeoJSON::Root O::DCEL::Exporter::To_GeoJSON<Vertex, Half_Edge, Face>::Convert(const O::DCEL::Feature_Info<Face>& info)
+O::GeoJSON::Feature O::DCEL::Exporter::To_GeoJSON<Vertex, Half_Edge, Face>::Convert_Feature(const O::DCEL::Feature_Info<Face>& info, std::size_t i)
 {
-	GeoJSON::Feature_Collection featureCollection;
+	const auto& polygons_faces = info.faces[i];
+	GeoJSON::Geometry geometry;
 
-	for ( auto&& [ polygons_faces, i] : O::Zip_Index(info.faces))
+	// Create the Geometry (Polygon or multiPolygon)
+	if(polygons_faces.size() == 1)
+		geometry.value = Create_Polygones(polygons_faces.front());
+	else
 	{
-		GeoJSON::Geometry geometry;
-
-		// Create the Geometry (Polygon or multiPolygon)
-		if(polygons_faces.size() == 1)
-			geometry.value = Create_Polygones(polygons_faces.front());
-		else
-		{
-			GeoJSON::Multi_Polygon multipolygon;
-			for(auto& polygon_faces : polygons_faces)
-				multipolygon.polygons.emplace_back(std::move(Create_Polygones(polygon_faces).rings));
-			geometry.value = std::move(multipolygon);
-		}
-
-		// Create the feature
-		GeoJSON::Feature feature;
-		feature.geometry = std::move(geometry);
-		feature.properties = info.feature_properties[i];
-
-		if (i < info.ids.size())
-			feature.id = info.ids[i];
-		if (i < info.bboxes.size())
-			feature.bbox = info.bboxes[i];
-
-		featureCollection.features.emplace_back(std::move(feature));
+		GeoJSON::Multi_Polygon multipolygon;
+		for(auto& polygon_faces : polygons_faces)
+			multipolygon.polygons.emplace_back(std::move(Create_Polygones(polygon_faces).rings));
+		geometry.value = std::move(multipolygon);
 	}
 
+	// Create the feature
+	GeoJSON::Feature feature;
+	feature.geometry = std::move(geometry);
+	feature.properties = info.feature_properties[i];
+
+	if (i < info.ids.size())
+		feature.id = info.ids[i];
+	if (i < info.bboxes.size())
+		feature.bbox = info.bboxes[i];
+	return feature;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+O::GeoJSON::Root O::DCEL::Exporter::To_GeoJSON<Vertex, Half_Edge, Face>::Convert(const O::DCEL::Feature_Info<Face>& info)
+{
+	GeoJSON::Feature_Collection featureCollection;
+	featureCollection.features.reserve(info.faces.size());
+
+	for (std::size_t i = 0; i < info.faces.size(); ++i)
+		featureCollection.features.emplace_back(Convert_Feature(info, i));
+
 	if (info.has_root)
 	{
 		featureCollection.id = info.root_id;
@@ -0,0 +1,38 @@
+#ifndef DCEL_TO_FLAT_GEOBUF_H
+#define DCEL_TO_FLAT_GEOBUF_H
+
+// STL
+#include <cstdint>
+#include <filesystem>
+
+// DCEL
+#include "exporter.h"
+#include "feature_info.h"
+
+// IO
+#include "io/flat_geobuf.h"
+
+namespace O::DCEL::Exporter
+{
+	/**
+	 * @brief To_Flat_Geobuf saves a DCEL as a FlatGeobuf file (see ``O::GeoJSON::IO::Flat_Geobuf_Writer``).
+	 *        Features are reconstructed with ``To_GeoJSON::Convert_Feature``.
+	 */
+	template<class Vertex, class Half_Edge, class Face>
+	class To_Flat_Geobuf
+	{
+	public:
+		/**
+		 * @brief Save the DCEL Storage and Feature_Info
+		 * @param info the Feature_INFO
+		 * @param path destination file
+		 * @param node_size R-tree node size, 0 to write no spatial index
+		 * @return the writer error
+		 */
+		static O::GeoJSON::IO::Error Save(const Feature_Info<Face>& info, const std::filesystem::path& path, std::uint16_t node_size = O::GeoJSON::IO::Packed_RTree::DEFAULT_NODE_SIZE);
+	};
+}
+
+#include "flat_geobuf_exporter.hpp"
+
+#endif // DCEL_TO_FLAT_GEOBUF_H
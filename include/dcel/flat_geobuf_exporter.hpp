@@ -0,0 +1,19 @@
+#ifndef DCEL_FLAT_GEOBUF_EXPORTER_HPP
+#define DCEL_FLAT_GEOBUF_EXPORTER_HPP
+
+#include "dcel/flat_geobuf_exporter.h"
+
+// STL
+#include <vector>
+
+template<class Vertex, class Half_Edge, class Face>
+O::GeoJSON::IO::Error O::DCEL::Exporter::To_Flat_Geobuf<Vertex, Half_Edge, Face>::Save(const O::DCEL::Feature_Info<Face>& info, const std::filesystem::path& path, std::uint16_t node_size)
+{
+	std::vector<O::GeoJSON::Feature> features;
+	features.reserve(info.faces.size());
+	for (std::size_t i = 0; i < info.faces.size(); ++i)
+		features.push_back(To_GeoJSON<Vertex, Half_Edge, Face>::Convert_Feature(info, i));
+	return O::GeoJSON::IO::Flat_Geobuf_Writer::Save(features, path, {}, node_size);
+}
+
+#endif //DCEL_FLAT_GEOBUF_EXPORTER_HPP
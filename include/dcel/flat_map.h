@@ -0,0 +1,354 @@
+#ifndef DCEL_FLAT_MAP_H
+#define DCEL_FLAT_MAP_H
+
+// STL
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define O_DCEL_FLAT_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace O::DCEL
+{
+	/**
+	 * @brief Open addressing hash map in the Swiss table layout, used for the lookups of ``DCEL::Storage``.
+	 *        Entries are stored inline in one array, next to an array of control bytes holding 7 bits of the hash of each slot (or an empty / deleted marker).
+	 *        A probe compares the 16 control bytes of a group at once (SSE2, or a scalar loop on other targets) and only looks at the slots whose bits match.
+	 *        It offers the part of the ``std::unordered_map`` interface used by the DCEL: ``find``, ``emplace``, ``operator[]``, ``erase``, ``reserve`` and forward iteration.
+	 * @note inserting may move the entries, references and iterators are invalidated by ``emplace``, ``operator[]`` and ``reserve``
+	 * @tparam Key key type
+	 * @tparam Value mapped type
+	 * @tparam Hash hash function of the keys, its result is mixed again so an identity hash is fine
+	 */
+	template<class Key, class Value, class Hash = std::hash<Key>>
+	class Flat_Map
+	{
+		static constexpr std::size_t GROUP_SIZE = 16;
+
+		/// @brief control byte values, a full slot holds the 7 low bits of its hash
+		enum Control : std::int8_t
+		{
+			EMPTY = -128,  ///< 0x80, never used: ends a probe
+			DELETED = -2,  ///< 0xFE, erased: the probe goes on
+		};
+
+		/// @brief bit ``i`` is set when the control byte ``i`` of a group matches
+		class Mask
+		{
+		public:
+			explicit Mask(std::uint32_t bits) : m_bits(bits) {}
+			explicit operator bool() const { return m_bits != 0; }
+			std::size_t Lowest() const { return static_cast<std::size_t>(std::countr_zero(m_bits)); }
+			void Clear_Lowest() { m_bits &= m_bits - 1; }
+
+		private:
+			std::uint32_t m_bits;
+		};
+
+		/// @brief the 16 control bytes of a group
+		class Group
+		{
+		public:
+			explicit Group(const std::int8_t* control)
+			{
+#ifdef O_DCEL_FLAT_MAP_SSE2
+				m_control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+#else
+				std::memcpy(m_control, control, GROUP_SIZE);
+#endif
+			}
+
+			/// @brief full slots whose control byte is ``h2``
+			Mask Match(std::int8_t h2) const
+			{
+#ifdef O_DCEL_FLAT_MAP_SSE2
+				return Mask(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(m_control, _mm_set1_epi8(h2)))));
+#else
+				std::uint32_t bits = 0;
+				for (std::size_t i = 0; i < GROUP_SIZE; ++i)
+					bits |= static_cast<std::uint32_t>(m_control[i] == h2) << i;
+				return Mask(bits);
+#endif
+			}
+
+			Mask Match_Empty() const { return Match(EMPTY); }
+
+			/// @brief empty and deleted slots, the control bytes with their high bit set
+			Mask Match_Free() const
+			{
+#ifdef O_DCEL_FLAT_MAP_SSE2
+				return Mask(static_cast<std::uint32_t>(_mm_movemask_epi8(m_control)));
+#else
+				std::uint32_t bits = 0;
+				for (std::size_t i = 0; i < GROUP_SIZE; ++i)
+					bits |= static_cast<std::uint32_t>(m_control[i] < 0) << i;
+				return Mask(bits);
+#endif
+			}
+
+		private:
+#ifdef O_DCEL_FLAT_MAP_SSE2
+			__m128i m_control;
+#else
+			std::int8_t m_control[GROUP_SIZE];
+#endif
+		};
+
+		template<bool CONST>
+		class Basic_Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = std::pair<const Key, Value>;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<CONST, const value_type*, value_type*>;
+			using reference = std::conditional_t<CONST, const value_type&, value_type&>;
+			using Container = std::conditional_t<CONST, const Flat_Map, Flat_Map>;
+
+			Basic_Iterator() = default;
+			Basic_Iterator(Container* container, std::size_t index) : m_container(container), m_index(index) { Skip_Free(); }
+			operator Basic_Iterator<true>() const { return Basic_Iterator<true>(m_container, m_index); }
+
+			reference operator*() const { return m_container->m_slots[m_index]; }
+			pointer operator->() const { return &m_container->m_slots[m_index]; }
+
+			Basic_Iterator& operator++() { ++m_index; Skip_Free(); return *this; }
+			Basic_Iterator operator++(int) { Basic_Iterator old = *this; ++*this; return old; }
+			friend bool operator==(const Basic_Iterator& a, const Basic_Iterator& b) { return a.m_index == b.m_index; }
+
+		private:
+			void Skip_Free() { while (m_index < m_container->m_capacity && m_container->m_control[m_index] < 0) ++m_index; }
+
+			Container* m_container = nullptr;
+			std::size_t m_index = 0;
+		};
+
+	public:
+		using key_type = Key;
+		using mapped_type = Value;
+		using value_type = std::pair<const Key, Value>;
+		using size_type = std::size_t;
+		using hasher = Hash;
+		using iterator = Basic_Iterator<false>;
+		using const_iterator = Basic_Iterator<true>;
+
+		Flat_Map() = default;
+		Flat_Map(const Flat_Map& other) : m_hash(other.m_hash) { reserve(other.m_size); for (const value_type& entry : other) Insert_New(entry.first, Hash_Of(entry.first), entry.second); }
+		Flat_Map(Flat_Map&& other) noexcept { Swap(other); }
+		Flat_Map& operator=(const Flat_Map& other) { if (this != &other) { Flat_Map copy(other); Swap(copy); } return *this; }
+		Flat_Map& operator=(Flat_Map&& other) noexcept { if (this != &other) { Flat_Map moved(std::move(other)); Swap(moved); } return *this; }
+		~Flat_Map() { Release(); }
+
+		/// @name Iterators
+		/// @{
+		iterator begin() { return iterator(this, 0); }
+		iterator end() { return iterator(this, m_capacity); }
+		const_iterator begin() const { return const_iterator(this, 0); }
+		const_iterator end() const { return const_iterator(this, m_capacity); }
+		/// @}
+
+		/// @name Capacity
+		/// @{
+		std::size_t size() const noexcept { return m_size; }
+		bool empty() const noexcept { return m_size == 0; }
+		std::size_t bucket_count() const noexcept { return m_capacity; }
+
+		/// @brief allocate enough slots to hold ``count`` entries without rehashing
+		void reserve(std::size_t count)
+		{
+			const std::size_t capacity = Capacity_For(count);
+			if (capacity > m_capacity)
+				Rehash(capacity);
+		}
+		/// @}
+
+		/// @name Lookup
+		/// @{
+		iterator find(const Key& key) { return iterator(this, Find_Index(key)); }
+		const_iterator find(const Key& key) const { return const_iterator(this, Find_Index(key)); }
+		std::size_t count(const Key& key) const { return Find_Index(key) != m_capacity; }
+		bool contains(const Key& key) const { return Find_Index(key) != m_capacity; }
+		/// @}
+
+		/// @name Modifiers
+		/// @{
+
+		/**
+		 * @brief insert ``key`` mapped to a value built from ``args`` when the key is not in the map
+		 * @return iterator on the entry of ``key`` and whether it was inserted
+		 */
+		template<class... Args>
+		std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+		{
+			const std::size_t hash = Hash_Of(key);
+			if (std::size_t index = Find_Index(key, hash); index != m_capacity)
+				return { iterator(this, index), false };
+			return { iterator(this, Insert_New(key, hash, std::forward<Args>(args)...)), true };
+		}
+
+		template<class K, class... Args>
+		std::pair<iterator, bool> emplace(K&& key, Args&&... args) { return try_emplace(Key(std::forward<K>(key)), std::forward<Args>(args)...); }
+
+		Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+		/// @return number of erased entries (0 or 1)
+		std::size_t erase(const Key& key)
+		{
+			const std::size_t index = Find_Index(key);
+			if (index == m_capacity)
+				return 0;
+			m_slots[index].~value_type();
+			// a group holding an empty slot stops every probe, the slot can become empty again
+			if (Group(m_control.get() + (index & ~(GROUP_SIZE - 1))).Match_Empty())
+			{
+				m_control[index] = EMPTY;
+				++m_growth_left;
+			}
+			else
+				m_control[index] = DELETED;
+			--m_size;
+			return 1;
+		}
+
+		void clear()
+		{
+			Release();
+			m_size = 0;
+			m_capacity = 0;
+			m_growth_left = 0;
+		}
+		/// @}
+
+	private:
+		/// @brief hash of a key, mixed so that its low and high bits both depend on every input bit
+		std::size_t Hash_Of(const Key& key) const
+		{
+			std::uint64_t h = static_cast<std::uint64_t>(m_hash(key)) * 0x9e3779b97f4a7c15ULL;
+			return static_cast<std::size_t>(h ^ (h >> 32));
+		}
+
+		static std::int8_t H2(std::size_t hash) { return static_cast<std::int8_t>(hash & 0x7F); }
+
+		/// @brief smallest power of two number of slots (at least one group) keeping ``count`` entries under a 7/8 load
+		static std::size_t Capacity_For(std::size_t count)
+		{
+			if (count == 0)
+				return 0;
+			return std::max(GROUP_SIZE, std::bit_ceil(count + (count + 6) / 7));
+		}
+
+		static std::size_t Growth_For(std::size_t capacity) { return capacity - capacity / 8; }
+
+		/// @brief slot of ``key`` or ``m_capacity`` when absent
+		std::size_t Find_Index(const Key& key) const { return Find_Index(key, Hash_Of(key)); }
+
+		std::size_t Find_Index(const Key& key, std::size_t hash) const
+		{
+			if (m_capacity == 0)
+				return m_capacity;
+			const std::size_t group_mask = m_capacity / GROUP_SIZE - 1;
+			std::size_t group = (hash >> 7) & group_mask;
+			// triangular steps visit every group once as the group count is a power of two
+			for (std::size_t step = 1;; ++step)
+			{
+				const std::size_t first = group * GROUP_SIZE;
+				Group control(m_control.get() + first);
+				for (Mask match = control.Match(H2(hash)); match; match.Clear_Lowest())
+					if (m_slots[first + match.Lowest()].first == key)
+						return first + match.Lowest();
+				if (control.Match_Empty() || step > group_mask)
+					return m_capacity;
+				group = (group + step) & group_mask;
+			}
+		}
+
+		/// @brief first free slot on the probe sequence of ``hash``
+		std::size_t Find_Free(std::size_t hash) const
+		{
+			const std::size_t group_mask = m_capacity / GROUP_SIZE - 1;
+			std::size_t group = (hash >> 7) & group_mask;
+			for (std::size_t step = 1;; ++step)
+			{
+				if (Mask free = Group(m_control.get() + group * GROUP_SIZE).Match_Free())
+					return group * GROUP_SIZE + free.Lowest();
+				group = (group + step) & group_mask;
+			}
+		}
+
+		template<class... Args>
+		std::size_t Insert_New(const Key& key, std::size_t hash, Args&&... args)
+		{
+			if (m_growth_left == 0)
+				// only tombstones left: clean them in place, otherwise double the table
+				Rehash(m_size + m_size / 8 < Growth_For(m_capacity) / 2 ? m_capacity : std::max(GROUP_SIZE, m_capacity * 2));
+			const std::size_t index = Find_Free(hash);
+			::new (static_cast<void*>(&m_slots[index])) value_type(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+			if (m_control[index] == EMPTY)
+				--m_growth_left;
+			m_control[index] = H2(hash);
+			++m_size;
+			return index;
+		}
+
+		void Rehash(std::size_t capacity)
+		{
+			Flat_Map old;
+			Swap(old);
+			m_hash = old.m_hash;
+			m_capacity = capacity;
+			m_growth_left = Growth_For(capacity);
+			m_control = std::make_unique<std::int8_t[]>(capacity);
+			std::memset(m_control.get(), EMPTY, capacity);
+			m_slots = std::allocator<value_type>().allocate(capacity);
+			for (value_type& entry : old)
+			{
+				const std::size_t hash = Hash_Of(entry.first);
+				const std::size_t index = Find_Free(hash);
+				::new (static_cast<void*>(&m_slots[index])) value_type(entry.first, std::move(entry.second));
+				m_control[index] = H2(hash);
+				--m_growth_left;
+				++m_size;
+			}
+		}
+
+		void Release()
+		{
+			if (!m_slots)
+				return;
+			for (value_type& entry : *this)
+				entry.~value_type();
+			std::allocator<value_type>().deallocate(m_slots, m_capacity);
+			m_slots = nullptr;
+			m_control.reset();
+		}
+
+		void Swap(Flat_Map& other) noexcept
+		{
+			std::swap(m_control, other.m_control);
+			std::swap(m_slots, other.m_slots);
+			std::swap(m_size, other.m_size);
+			std::swap(m_capacity, other.m_capacity);
+			std::swap(m_growth_left, other.m_growth_left);
+			std::swap(m_hash, other.m_hash);
+		}
+
+		std::unique_ptr<std::int8_t[]> m_control; ///< one control byte per slot
+		value_type* m_slots = nullptr;            ///< ``m_capacity`` slots, constructed where the control byte is full
+		std::size_t m_size = 0;                   ///< number of entries
+		std::size_t m_capacity = 0;               ///< number of slots, a power of two multiple of ``GROUP_SIZE``
+		std::size_t m_growth_left = 0;            ///< insertions in empty slots left before a rehash
+		Hash m_hash;
+	};
+} // namespace O::DCEL
+
+#endif // DCEL_FLAT_MAP_H
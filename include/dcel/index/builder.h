@@ -0,0 +1,95 @@
+#ifndef DCEL_INDEX_BUILDER_H
+#define DCEL_INDEX_BUILDER_H
+
+// STL
+#include <optional>
+#include <vector>
+
+// DCEL
+#include "dcel/feature_info.h"
+#include "dcel/index/storage.h"
+
+// GEOJSON
+#include "geojson/root.h"
+#include "geojson/object/feature.h"
+#include "geojson/geometry_type/polygon.h"
+#include "geojson/geometry_type/multi_polygon.h"
+
+namespace O::DCEL::Index
+{
+	/**
+	 * @brief GeoJSON reciever (from ``IO::Full_Parser`` or ``IO::Feature_Parser``) building an ``Index::Storage``.
+	 *        It follows the same steps as ``DCEL::Builder::From_GeoJSON`` and gives the same vertices, half edges and faces in the same order.
+	 */
+	template<class Vertex = Index::Vertex, class Half_Edge = Index::Half_Edge, class Face = Index::Face>
+	class From_GeoJSON
+	{
+	public:
+
+		From_GeoJSON(const O::Configuration::DCEL& config);
+
+		/**
+		 * @brief Create the DCEL structure from a Fully parsed GeoJSON (from IO::Full_Parser for exemple)
+		 * @param geojson the full GeoJSON to parse from
+		 * @return true or false wether parsing is sucessfull
+		 */
+		bool Parse(O::GeoJSON::Root&& geojson);
+
+		/// @name overrides
+		/// @brief implementation of the O::GeoJSON::IO::Feature_Parser functions.
+		/// @{
+		bool On_Full_Feature(O::GeoJSON::Feature&& feature);
+		bool On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id);
+		/// @}
+
+		/**
+		 * @brief retrieve the built ``Index::Storage``
+		 * @return the storage, std::nullopt if already been called.
+		 * @warning this function must only be called once since the storage is moved to the caller
+		 */
+		std::optional<Storage<Vertex, Half_Edge, Face>> Get_Dcel();
+
+		/**
+		 * @brief retrieve the ``DCEL::Feature_Info``, faces are given as handles
+		 * @return the feature info, std::nullopt if already been called.
+		 * @warning this function must only be called once since the ``DCEL::Feature_Info`` is moved to the caller
+		 */
+		std::optional<Feature_Info<Face, Handle>> Get_Feature_Info();
+
+	private:
+		/// @brief Builds the faces of a polygon, the first ring is the outer one
+		std::vector<Handle> Build_Face_From_Rings(const std::vector<std::vector<O::GeoJSON::Position>>& rings);
+
+		/// @name On_Feature
+		/// @brief These function are just a extension of On_Full_Feature to dispatch polygone and multipolygones
+		/// @{
+		bool On_Polygon(const O::GeoJSON::Polygon& poly);
+		bool On_MultiPolygon(const O::GeoJSON::Multi_Polygon& mp);
+		/// @}
+
+		/// @brief Create (or Get) the vertices of a ring, the last position (closing the ring) is skipped
+		std::vector<Handle> Create_Vertex(const std::vector<O::GeoJSON::Position>& ring);
+
+		/// @brief Create (or Get) the half edges of a ring, each one followed by its twin
+		std::vector<Handle> Create_Forward_Half_Edge(const std::vector<Handle>& ring_vertex);
+
+		/// @brief Link the next and prev for each Half Edge of a ring
+		void Link_Next_Prev(const std::vector<Handle>& ring_edges);
+
+		/// @brief create the face of a ring, holes start on the twin of the first half edge
+		Handle Link_Face(const std::vector<Handle>& ring_edge, bool is_hole);
+
+		/// @brief create a face for every half edge cycle left without face
+		void Link_Outer_Bound_Face();
+
+	private:
+		Storage<Vertex, Half_Edge, Face> m_dcel;          ///< Storage for the DCEL
+		bool m_valid_dcel = true;                         ///< runonce for the Get_Dcel() function
+		bool m_valid_feature_info = true;                 ///< runonce for the Get_Feature_Info function
+		Feature_Info<Face, Handle> m_feature_info;        ///< Feature_Info to retain the parsed GeoJSON meta data
+	};
+} // namespace O::DCEL::Index
+
+#include "builder.hpp"
+
+#endif // DCEL_INDEX_BUILDER_H
@@ -0,0 +1,184 @@
+#ifndef DCEL_INDEX_BUILDER_HPP
+#define DCEL_INDEX_BUILDER_HPP
+
+#include "dcel/index/builder.h"
+
+// STL
+#include <algorithm>
+#include <cassert>
+#include <ranges>
+
+// UTILS
+#include <utils/zip.h>
+
+// DCEL
+#include "dcel/ring_orientation.h"
+
+template<class Vertex, class Half_Edge, class Face>
+O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::From_GeoJSON(const O::Configuration::DCEL& config) :
+	m_dcel(config),
+	m_valid_dcel(true),
+	m_valid_feature_info(true),
+	m_feature_info()
+{
+
+}
+
+template<class Vertex, class Half_Edge, class Face>
+bool O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::Parse(GeoJSON::Root&& geojson)
+{
+	if (geojson.Is_Feature_Collection())
+	{
+		for (auto&& feature : geojson.Get_Feature_Collection().features)
+			On_Full_Feature(std::move(feature));
+		return On_Root(std::move(geojson.Get_Feature_Collection().bbox), std::move(geojson.Get_Feature_Collection().id));
+	}
+	if (geojson.Is_Feature())
+		return On_Full_Feature(std::move(geojson.Get_Feature()));
+	return false;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+bool O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::On_Full_Feature(GeoJSON::Feature&& feature)
+{
+	if (!feature.geometry) return true;
+	m_feature_info.feature_properties.emplace_back(std::move(feature.properties));
+	m_feature_info.bboxes.emplace_back(std::move(feature.bbox));
+	m_feature_info.ids.emplace_back(std::move(feature.id));
+
+	auto& geom = *feature.geometry;
+	if (geom.Is_Polygon())
+		On_Polygon(geom.Get_Polygon());
+	else if (geom.Is_Multi_Polygon())
+		On_MultiPolygon(geom.Get_Multi_Polygon());
+	return true;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+bool O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::On_Root(std::optional<GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id)
+{
+	m_feature_info.root_bbox = std::move(bbox);
+	m_feature_info.root_id = std::move(id);
+	m_feature_info.has_root = true;
+	return true;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::Link_Outer_Bound_Face()
+{
+	for (Handle edge = 0; edge < m_dcel.half_edges.size(); ++edge)
+		if (m_dcel.Incident_Face(edge) == INVALID_HANDLE)
+			m_dcel.Create_Face(edge);
+}
+
+template<class Vertex, class Half_Edge, class Face>
+std::optional<O::DCEL::Index::Storage<Vertex, Half_Edge, Face>> O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::Get_Dcel()
+{
+	if (!m_valid_dcel)
+		return std::nullopt;
+	// finish face for outer bound
+	Link_Outer_Bound_Face();
+	m_valid_dcel = false;
+	return std::move(m_dcel);
+}
+
+template<class Vertex, class Half_Edge, class Face>
+std::optional<O::DCEL::Feature_Info<Face, O::DCEL::Index::Handle>> O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::Get_Feature_Info()
+{
+	if (!m_valid_feature_info)
+		return std::nullopt;
+	m_valid_feature_info = false;
+	return std::move(m_feature_info);
+}
+
+template<class Vertex, class Half_Edge, class Face>
+bool O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::On_Polygon(const GeoJSON::Polygon& poly)
+{
+	if (poly.rings.empty()) return true;
+	m_feature_info.faces.push_back({ Build_Face_From_Rings(poly.rings) });
+	return true;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+bool O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::On_MultiPolygon(const GeoJSON::Multi_Polygon& mp)
+{
+	m_feature_info.faces.push_back({});
+	for (auto const& poly : mp.polygons)
+	{
+		if (poly.rings.empty()) return true;
+		m_feature_info.faces.back().emplace_back(Build_Face_From_Rings(poly.rings));
+	}
+	return true;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+std::vector<O::DCEL::Index::Handle> O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::Create_Vertex(const std::vector<GeoJSON::Position>& ring)
+{
+	std::vector<Handle> ring_vertices;
+	ring_vertices.reserve(ring.size());
+
+	for (auto&& [ring_i, ring_i_1] : O::Zip_Adjacent(ring))
+		ring_vertices.emplace_back(m_dcel.Get_Or_Create_Vertex(ring_i.longitude, ring_i.latitude));
+
+	// same orientation test as DCEL::Builder::From_GeoJSON so both storages hold the same half edges
+	if (Double_Signed_Area(ring) < 0) // reverse clockwise rings so ring circle are always counter clock wise
+		std::ranges::reverse(ring_vertices);
+	return ring_vertices;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+std::vector<O::DCEL::Index::Handle> O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::Create_Forward_Half_Edge(const std::vector<Handle>& ring_vertex)
+{
+	std::vector<Handle> ring_edges;
+	ring_edges.reserve(2 * ring_vertex.size());
+	for (auto&& [origin, head] : O::Zip_Adjacent_Circular(ring_vertex))
+	{
+		const Handle half_edge = m_dcel.Get_Or_Create_Half_Edge(origin, head);
+		const Handle half_edge_twin = m_dcel.Twin(half_edge);
+		m_dcel.Insert_Edge_Sorted(origin, half_edge);
+		m_dcel.Insert_Edge_Sorted(head, half_edge_twin);
+		ring_edges.emplace_back(half_edge);
+		ring_edges.emplace_back(half_edge_twin);
+	}
+	return ring_edges;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::Link_Next_Prev(const std::vector<Handle>& ring_edges)
+{
+	for (auto&& [edge, next] : O::Zip_Adjacent_Circular(ring_edges))
+		m_dcel.Link(edge, next);
+}
+
+template<class Vertex, class Half_Edge, class Face>
+O::DCEL::Index::Handle O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::Link_Face(const std::vector<Handle>& ring_edge, bool is_hole)
+{
+	return m_dcel.Create_Face(is_hole ? ring_edge[1] : ring_edge[0]);
+}
+
+template<class Vertex, class Half_Edge, class Face>
+std::vector<O::DCEL::Index::Handle> O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge, Face>::Build_Face_From_Rings(const std::vector<std::vector<GeoJSON::Position>>& rings)
+{
+	assert(!rings.empty());
+
+	std::vector<Handle> created_faces;
+	created_faces.reserve(rings.size());
+	for (auto&& [ring, ring_index] : O::Zip_Index(rings))
+	{
+		assert(ring.size() >= 4);
+
+		std::vector<Handle> ring_vertices = Create_Vertex(ring);
+		std::vector<Handle> ring_edges = Create_Forward_Half_Edge(ring_vertices);
+		// a Starless_Vertex keeps its rotation in the links while edges are inserted, it is already complete
+		if constexpr (Stores_Star<Vertex>)
+		{
+			Link_Next_Prev(ring_edges);
+			for (Handle vertex : ring_vertices)
+				m_dcel.Update_Around_Vertex(vertex);
+		}
+		created_faces.emplace_back(Link_Face(ring_edges, ring_index > 0));
+	}
+	return created_faces;
+}
+
+#endif // DCEL_INDEX_BUILDER_HPP
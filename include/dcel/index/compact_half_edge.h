@@ -0,0 +1,46 @@
+#ifndef DCEL_INDEX_COMPACT_HALF_EDGE_H
+#define DCEL_INDEX_COMPACT_HALF_EDGE_H
+
+// DCEL
+#include "dcel/index/handle.h"
+
+namespace O::DCEL::Index
+{
+	/**
+	 * @brief Compact half edge of an ``Index::Storage``: only the links that can not be recovered are stored.
+	 *        Twins are allocated as adjacent pairs so ``twin = edge ^ 1``, and ``head`` is the tail of the twin.
+	 *        Without ``prev`` the storage finds the previous half edge by walking the outgoing edges of the tail.
+	 * @tparam WITH_PREV store ``prev`` (16 bytes per half edge) or derive it (12 bytes per half edge)
+	 */
+	template<bool WITH_PREV = true>
+	struct Compact_Half_Edge
+	{
+		Handle tail = INVALID_HANDLE; ///< origin vertex
+		Handle next = INVALID_HANDLE; ///< next half edge around the face
+		Handle prev = INVALID_HANDLE; ///< previous half edge around the face
+		Handle face = INVALID_HANDLE; ///< incident face (left side)
+	};
+
+	template<>
+	struct Compact_Half_Edge<false>
+	{
+		Handle tail = INVALID_HANDLE; ///< origin vertex
+		Handle next = INVALID_HANDLE; ///< next half edge around the face
+		Handle face = INVALID_HANDLE; ///< incident face (left side)
+	};
+
+	/// @name Half edge layout
+	/// @brief links a half edge type stores, the ``Index::Storage`` derives the missing ones
+	/// @{
+	template<class Half_Edge>
+	concept Stores_Twin = requires(Half_Edge half_edge) { half_edge.twin; };
+
+	template<class Half_Edge>
+	concept Stores_Head = requires(Half_Edge half_edge) { half_edge.head; };
+
+	template<class Half_Edge>
+	concept Stores_Prev = requires(Half_Edge half_edge) { half_edge.prev; };
+	/// @}
+} // namespace O::DCEL::Index
+
+#endif // DCEL_INDEX_COMPACT_HALF_EDGE_H
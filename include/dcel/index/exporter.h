@@ -0,0 +1,57 @@
+#ifndef DCEL_INDEX_EXPORTER_H
+#define DCEL_INDEX_EXPORTER_H
+
+// STL
+#include <vector>
+
+// DCEL
+#include "dcel/feature_info.h"
+#include "dcel/index/storage.h"
+
+// GEOJSON
+#include "geojson/root.h"
+#include "geojson/geometry_type/polygon.h"
+#include "geojson/geometry_type/multi_polygon.h"
+#include "geojson/object/feature.h"
+#include "geojson/object/feature_collection.h"
+
+namespace O::DCEL::Index
+{
+	/**
+	 * @brief Reconstruct GeoJSON objects from an ``Index::Storage`` and its ``Feature_Info``, the handle counterpart of ``DCEL::Exporter::To_GeoJSON``.
+	 */
+	template<class Vertex = Index::Vertex, class Half_Edge = Index::Half_Edge, class Face = Index::Face>
+	class To_GeoJSON
+	{
+	public:
+		using Storage_Type = Storage<Vertex, Half_Edge, Face>;
+
+		/**
+		 * @brief Convert back the storage and Feature_Info to a GeoJSON Root object
+		 * @param dcel the storage the handles of ``info`` refer to
+		 * @param info the Feature_INFO
+		 * @return O::GeoJSON::Root holding a FeatureCollection
+		 */
+		static O::GeoJSON::Root Convert(const Storage_Type& dcel, const Feature_Info<Face, Handle>& info);
+
+		/**
+		 * @brief Reconstruct a single feature
+		 * @param dcel the storage the handles of ``info`` refer to
+		 * @param info the Feature_INFO
+		 * @param feature_index index of the feature inside the ``Feature_Info``
+		 * @return O::GeoJSON::Feature the reconstructed feature
+		 */
+		static O::GeoJSON::Feature Convert_Feature(const Storage_Type& dcel, const Feature_Info<Face, Handle>& info, std::size_t feature_index);
+
+	private:
+		/// @brief positions of the ``next`` cycle of a face, closed
+		static std::vector<O::GeoJSON::Position> Extract_Ring(const Storage_Type& dcel, Handle face);
+
+		/// @brief polygon made of the rings of the given faces
+		static O::GeoJSON::Polygon Create_Polygones(const Storage_Type& dcel, const std::vector<Handle>& faces);
+	};
+} // namespace O::DCEL::Index
+
+#include "exporter.hpp"
+
+#endif // DCEL_INDEX_EXPORTER_H
@@ -0,0 +1,85 @@
+#ifndef DCEL_INDEX_EXPORTER_HPP
+#define DCEL_INDEX_EXPORTER_HPP
+
+#include "dcel/index/exporter.h"
+
+// STL
+#include <cassert>
+
+template<class Vertex, class Half_Edge, class Face>
+std::vector<O::GeoJSON::Position> O::DCEL::Index::To_GeoJSON<Vertex, Half_Edge, Face>::Extract_Ring(const Storage_Type& dcel, Handle face)
+{
+	std::vector<GeoJSON::Position> coords;
+	const Handle first = dcel.faces[face].edge;
+	Handle e = first;
+	do {
+		coords.emplace_back(dcel.X(dcel.Tail(e)), dcel.Y(dcel.Tail(e)));
+		e = dcel.Next(e);
+	} while (e != first);
+
+	if (!coords.empty() && ((coords.front().latitude != coords.back().latitude) || (coords.front().longitude != coords.back().longitude)))
+		coords.push_back(coords.front());
+
+	return coords;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+O::GeoJSON::Polygon O::DCEL::Index::To_GeoJSON<Vertex, Half_Edge, Face>::Create_Polygones(const Storage_Type& dcel, const std::vector<Handle>& faces)
+{
+	GeoJSON::Polygon polygon;
+	for (Handle face : faces)
+		polygon.rings.emplace_back(Extract_Ring(dcel, face));
+	assert(polygon.rings.size());
+	return polygon;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+O::GeoJSON::Feature O::DCEL::Index::To_GeoJSON<Vertex, Half_Edge, Face>::Convert_Feature(const Storage_Type& dcel, const O::DCEL::Feature_Info<Face, Handle>& info, std::size_t i)
+{
+	const auto& polygons_faces = info.faces[i];
+	GeoJSON::Geometry geometry;
+
+	// Create the Geometry (Polygon or multiPolygon)
+	if (polygons_faces.size() == 1)
+		geometry.value = Create_Polygones(dcel, polygons_faces.front());
+	else
+	{
+		GeoJSON::Multi_Polygon multipolygon;
+		for (auto& polygon_faces : polygons_faces)
+			multipolygon.polygons.emplace_back(Create_Polygones(dcel, polygon_faces));
+		geometry.value = std::move(multipolygon);
+	}
+
+	// Create the feature
+	GeoJSON::Feature feature;
+	feature.geometry = std::move(geometry);
+	feature.properties = info.feature_properties[i];
+
+	if (i < info.ids.size())
+		feature.id = info.ids[i];
+	if (i < info.bboxes.size())
+		feature.bbox = info.bboxes[i];
+	return feature;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+O::GeoJSON::Root O::DCEL::Index::To_GeoJSON<Vertex, Half_Edge, Face>::Convert(const Storage_Type& dcel, const O::DCEL::Feature_Info<Face, Handle>& info)
+{
+	GeoJSON::Feature_Collection feature_collection;
+	feature_collection.features.reserve(info.faces.size());
+
+	for (std::size_t i = 0; i < info.faces.size(); ++i)
+		feature_collection.features.emplace_back(Convert_Feature(dcel, info, i));
+
+	if (info.has_root)
+	{
+		feature_collection.id = info.root_id;
+		feature_collection.bbox = info.root_bbox;
+	}
+
+	GeoJSON::Root result;
+	result.object = std::move(feature_collection);
+	return result;
+}
+
+#endif // DCEL_INDEX_EXPORTER_HPP
@@ -0,0 +1,18 @@
+#ifndef DCEL_INDEX_FACE_H
+#define DCEL_INDEX_FACE_H
+
+// DCEL
+#include "dcel/index/handle.h"
+
+namespace O::DCEL::Index
+{
+	/**
+	 * @brief Face of an ``Index::Storage``
+	 */
+	struct Face
+	{
+		Handle edge = INVALID_HANDLE; ///< a representative half edge belonging to this face
+	};
+} // namespace O::DCEL::Index
+
+#endif // DCEL_INDEX_FACE_H
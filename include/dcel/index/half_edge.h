@@ -0,0 +1,23 @@
+#ifndef DCEL_INDEX_HALF_EDGE_H
+#define DCEL_INDEX_HALF_EDGE_H
+
+// DCEL
+#include "dcel/index/handle.h"
+
+namespace O::DCEL::Index
+{
+	/**
+	 * @brief Half edge of an ``Index::Storage``: the six links of ``DCEL::Half_Edge`` stored as 32 bit handles, 24 bytes instead of 48.
+	 */
+	struct Half_Edge
+	{
+		Handle tail = INVALID_HANDLE; ///< origin vertex
+		Handle head = INVALID_HANDLE; ///< destination vertex
+		Handle twin = INVALID_HANDLE; ///< twin half edge (reverse direction)
+		Handle next = INVALID_HANDLE; ///< next half edge around the face
+		Handle prev = INVALID_HANDLE; ///< previous half edge around the face
+		Handle face = INVALID_HANDLE; ///< incident face (left side)
+	};
+} // namespace O::DCEL::Index
+
+#endif // DCEL_INDEX_HALF_EDGE_H
@@ -0,0 +1,17 @@
+#ifndef DCEL_INDEX_HANDLE_H
+#define DCEL_INDEX_HANDLE_H
+
+// STL
+#include <cstdint>
+#include <limits>
+
+namespace O::DCEL::Index
+{
+	/// @brief position of a vertex, half edge or face inside the vectors of an ``Index::Storage``
+	using Handle = std::uint32_t;
+
+	/// @brief handle value of a missing element (the equivalent of ``nullptr``)
+	constexpr Handle INVALID_HANDLE = std::numeric_limits<Handle>::max();
+} // namespace O::DCEL::Index
+
+#endif // DCEL_INDEX_HANDLE_H
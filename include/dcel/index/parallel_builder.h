@@ -0,0 +1,139 @@
+#ifndef DCEL_INDEX_PARALLEL_BUILDER_H
+#define DCEL_INDEX_PARALLEL_BUILDER_H
+
+// STL
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// DCEL
+#include "dcel/feature_info.h"
+#include "dcel/index/builder.h"
+#include "dcel/index/storage.h"
+
+// GEOJSON
+#include "geojson/root.h"
+#include "geojson/object/feature.h"
+
+namespace O::DCEL::Index
+{
+	/**
+	 * @brief GeoJSON reciever (from ``IO::Full_Parser`` or ``IO::Feature_Parser``) building an ``Index::Storage`` on several threads.
+	 *        The features are kept until the storage is asked for, then they are partitioned in a grid of spatial tiles by the center of their envelope.
+	 *        Every tile is built into its own storage by an ``Index::From_GeoJSON`` on its own thread, the tiles are then stitched into one storage:
+	 *        vertices falling on the same ``Vertex_Key`` are merged, half edges shared by two tiles are kept once, and the stars of the merged (seam) vertices are sorted and relinked.
+	 *        Only the vertices inside the envelope of another tile are looked up, the other elements are copied with their handles mapped, each tile on its own thread.
+	 *        Faces are created last in the reading order of the rings, so ``Feature_Info`` refers to the stitched storage and the export is the one of ``Index::From_GeoJSON``.
+	 * @note the vertex and half edge order follows the tiles, not the input. Handing out the handles, relinking the seam vertices and moving the lookups run on the calling thread.
+	 */
+	template<class Vertex = Index::Vertex, class Half_Edge = Index::Half_Edge, class Face = Index::Face>
+	class Parallel_From_GeoJSON
+	{
+		static_assert(Stores_Star<Vertex>, "seam vertices are relinked from their outgoing edge list");
+
+	public:
+		/**
+		 * @param config configuration of the stitched storage and of the tile storages
+		 * @param thread_count number of tiles built at the same time, 0 for ``std::thread::hardware_concurrency``
+		 */
+		Parallel_From_GeoJSON(const O::Configuration::DCEL& config, std::size_t thread_count = 0);
+
+		/**
+		 * @brief Create the DCEL structure from a Fully parsed GeoJSON (from IO::Full_Parser for exemple)
+		 * @param geojson the full GeoJSON to parse from
+		 * @return true or false wether parsing is sucessfull
+		 */
+		bool Parse(O::GeoJSON::Root&& geojson);
+
+		/// @name overrides
+		/// @brief implementation of the O::GeoJSON::IO::Feature_Parser functions.
+		/// @{
+		bool On_Full_Feature(O::GeoJSON::Feature&& feature);
+		bool On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id);
+		/// @}
+
+		/**
+		 * @brief build the tiles and retrieve the stitched ``Index::Storage``
+		 * @return the storage, std::nullopt if already been called.
+		 * @warning this function must only be called once since the storage is moved to the caller
+		 */
+		std::optional<Storage<Vertex, Half_Edge, Face>> Get_Dcel();
+
+		/**
+		 * @brief build the tiles and retrieve the ``DCEL::Feature_Info``, faces are given as handles of the stitched storage
+		 * @return the feature info, std::nullopt if already been called.
+		 * @warning this function must only be called once since the ``DCEL::Feature_Info`` is moved to the caller
+		 */
+		std::optional<Feature_Info<Face, Handle>> Get_Feature_Info();
+
+	private:
+		/// @brief built tile: its storage, the faces of its features and where its elements land in the stitched storage
+		struct Tile
+		{
+			std::vector<O::GeoJSON::Feature> features;         ///< polygonal features of the tile, geometry only
+			std::optional<Storage<Vertex, Half_Edge, Face>> dcel; ///< storage built from ``features``
+			std::vector<std::vector<std::vector<Handle>>> faces;  ///< faces of ``features`` inside ``dcel``
+			std::array<double, 4> envelope;                       ///< ``[min x, min y, max x, max y]`` of the vertices of ``dcel``
+			std::vector<std::pair<std::size_t, Handle>> owners;   ///< for every vertex, first tile holding its key and its handle in that tile
+			std::vector<bool> shared;                             ///< for every vertex, its key is also in another tile
+			std::vector<Handle> vertex_map;                       ///< handle in ``m_dcel`` of every vertex
+			std::vector<Handle> edge_map;                         ///< handle in ``m_dcel`` of every half edge
+			Handle first_vertex = 0;                              ///< first vertex of ``m_dcel`` created by this tile, smaller handles come from previous tiles
+			Handle first_edge = 0;                                ///< first half edge of ``m_dcel`` created by this tile
+		};
+
+		/// @brief partition, build and stitch the features, done once by the first getter
+		void Build();
+
+		/**
+		 * @brief move every polygonal feature to the tile holding the center of its envelope
+		 * @return for every feature of ``m_features``, its tile and its index inside the tile
+		 */
+		std::vector<std::pair<std::size_t, std::size_t>> Partition(std::vector<Tile>& tiles);
+
+		/// @brief build every tile storage and its envelope, one thread per tile
+		void Build_Tiles(std::vector<Tile>& tiles) const;
+
+		/**
+		 * @brief fill ``owners`` and ``shared`` of every tile, one thread per tile.
+		 *        Only the vertices inside the envelope of another tile are looked up in its ``vertex_lookup``, the lookups are only read.
+		 */
+		void Find_Shared_Vertices(std::vector<Tile>& tiles) const;
+
+		/**
+		 * @brief give every vertex and half edge its handle in ``m_dcel``: the ones created by a tile follow the ones of the previous tiles in their tile order,
+		 *        a vertex owned by a previous tile and a half edge between shared vertices that a previous tile already has take the existing handle.
+		 *        The vertices are created, the half edges are only allocated.
+		 * @param seam_vertices vertices of ``m_dcel`` coming from several tiles, filled
+		 */
+		void Place_Tiles(std::vector<Tile>& tiles, std::vector<Handle>& seam_vertices);
+
+		/// @brief write the half edges and the stars created by a tile into ``m_dcel`` with their handles mapped, one thread per tile
+		void Copy_Tile(Tile& tile);
+
+		/// @brief add the star of the tile to the seam vertices owned by a previous tile and move its lookups into ``m_dcel``, on the calling thread
+		void Merge_Tile(Tile& tile);
+
+		/// @brief run ``function(tile)`` on every non empty tile, one thread per tile
+		template<class Function>
+		static void For_Each_Tile(std::vector<Tile>& tiles, Function&& function);
+
+		/// @brief create the faces of ``m_feature_info`` in reading order, then the outer faces left
+		void Link_Faces(const std::vector<Tile>& tiles, const std::vector<std::pair<std::size_t, std::size_t>>& feature_tiles);
+
+	private:
+		Storage<Vertex, Half_Edge, Face> m_dcel;           ///< stitched storage
+		std::size_t m_thread_count;                        ///< number of tiles
+		bool m_built = false;                              ///< Build() already done
+		bool m_valid_dcel = true;                          ///< runonce for the Get_Dcel() function
+		bool m_valid_feature_info = true;                  ///< runonce for the Get_Feature_Info function
+		Feature_Info<Face, Handle> m_feature_info;         ///< Feature_Info to retain the parsed GeoJSON meta data
+		std::vector<O::GeoJSON::Feature> m_features;       ///< polygonal features waiting for Build(), without their meta data
+	};
+} // namespace O::DCEL::Index
+
+#include "parallel_builder.hpp"
+
+#endif // DCEL_INDEX_PARALLEL_BUILDER_H
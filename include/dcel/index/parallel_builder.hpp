@@ -0,0 +1,421 @@
+#ifndef DCEL_INDEX_PARALLEL_BUILDER_HPP
+#define DCEL_INDEX_PARALLEL_BUILDER_HPP
+
+#include "dcel/index/parallel_builder.h"
+#include "dcel/exception.h"
+
+// STL
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <unordered_map>
+
+// UTILS
+#include <utils/zip.h>
+
+template<class Vertex, class Half_Edge, class Face>
+O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::Parallel_From_GeoJSON(const O::Configuration::DCEL& config, std::size_t thread_count) :
+	m_dcel(config),
+	m_thread_count(thread_count ? thread_count : std::max(1u, std::thread::hardware_concurrency())),
+	m_built(false),
+	m_valid_dcel(true),
+	m_valid_feature_info(true),
+	m_feature_info(),
+	m_features()
+{
+
+}
+
+template<class Vertex, class Half_Edge, class Face>
+bool O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::Parse(GeoJSON::Root&& geojson)
+{
+	if (geojson.Is_Feature_Collection())
+	{
+		for (auto&& feature : geojson.Get_Feature_Collection().features)
+			On_Full_Feature(std::move(feature));
+		return On_Root(std::move(geojson.Get_Feature_Collection().bbox), std::move(geojson.Get_Feature_Collection().id));
+	}
+	if (geojson.Is_Feature())
+		return On_Full_Feature(std::move(geojson.Get_Feature()));
+	return false;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+bool O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::On_Full_Feature(GeoJSON::Feature&& feature)
+{
+	if (!feature.geometry) return true;
+	m_feature_info.feature_properties.emplace_back(std::move(feature.properties));
+	m_feature_info.bboxes.emplace_back(std::move(feature.bbox));
+	m_feature_info.ids.emplace_back(std::move(feature.id));
+
+	// only polygons give faces, the other geometries keep their meta data like in Index::From_GeoJSON
+	if ((feature.geometry->Is_Polygon() && !feature.geometry->Get_Polygon().rings.empty()) || feature.geometry->Is_Multi_Polygon())
+		m_features.emplace_back(std::move(feature));
+	return true;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+bool O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::On_Root(std::optional<GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id)
+{
+	m_feature_info.root_bbox = std::move(bbox);
+	m_feature_info.root_id = std::move(id);
+	m_feature_info.has_root = true;
+	return true;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+std::optional<O::DCEL::Index::Storage<Vertex, Half_Edge, Face>> O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::Get_Dcel()
+{
+	if (!m_valid_dcel)
+		return std::nullopt;
+	Build();
+	m_valid_dcel = false;
+	return std::move(m_dcel);
+}
+
+template<class Vertex, class Half_Edge, class Face>
+std::optional<O::DCEL::Feature_Info<Face, O::DCEL::Index::Handle>> O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::Get_Feature_Info()
+{
+	if (!m_valid_feature_info)
+		return std::nullopt;
+	Build();
+	m_valid_feature_info = false;
+	return std::move(m_feature_info);
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::Build()
+{
+	if (m_built)
+		return;
+	m_built = true;
+
+	std::vector<Tile> tiles(m_thread_count);
+	const std::vector<std::pair<std::size_t, std::size_t>> feature_tiles = Partition(tiles);
+	Build_Tiles(tiles);
+	Find_Shared_Vertices(tiles);
+
+	std::vector<Handle> seam_vertices;
+	Place_Tiles(tiles, seam_vertices);
+	For_Each_Tile(tiles, [this](Tile& tile) { Copy_Tile(tile); });
+	for (Tile& tile : tiles)
+		if (tile.dcel)
+			Merge_Tile(tile);
+
+	// the star of a seam vertex is the union of the stars of its tiles, sort it again and link the half edges around it
+	for (Handle vertex : seam_vertices)
+	{
+		m_dcel.Sort_Around_Vertex(vertex);
+		m_dcel.Update_Around_Vertex(vertex);
+	}
+
+	Link_Faces(tiles, feature_tiles);
+	m_features.clear();
+}
+
+template<class Vertex, class Half_Edge, class Face>
+std::vector<std::pair<std::size_t, std::size_t>> O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::Partition(std::vector<Tile>& tiles)
+{
+	// center of the envelope of the outer rings of every feature
+	std::vector<std::pair<double, double>> centers;
+	centers.reserve(m_features.size());
+	double min_x = std::numeric_limits<double>::infinity();
+	double min_y = std::numeric_limits<double>::infinity();
+	double max_x = -std::numeric_limits<double>::infinity();
+	double max_y = -std::numeric_limits<double>::infinity();
+	for (const GeoJSON::Feature& feature : m_features)
+	{
+		double f_min_x = std::numeric_limits<double>::infinity();
+		double f_min_y = std::numeric_limits<double>::infinity();
+		double f_max_x = -std::numeric_limits<double>::infinity();
+		double f_max_y = -std::numeric_limits<double>::infinity();
+		auto extend = [&](const GeoJSON::Polygon& polygon) {
+			if (polygon.rings.empty()) return;
+			for (const GeoJSON::Position& position : polygon.rings.front())
+			{
+				f_min_x = std::min(f_min_x, position.longitude);
+				f_min_y = std::min(f_min_y, position.latitude);
+				f_max_x = std::max(f_max_x, position.longitude);
+				f_max_y = std::max(f_max_y, position.latitude);
+			}
+		};
+		if (feature.geometry->Is_Polygon())
+			extend(feature.geometry->Get_Polygon());
+		else
+			for (const GeoJSON::Polygon& polygon : feature.geometry->Get_Multi_Polygon().polygons)
+				extend(polygon);
+
+		if (f_min_x > f_max_x) // no ring, any tile will do
+			f_min_x = f_max_x = f_min_y = f_max_y = 0;
+		centers.emplace_back((f_min_x + f_max_x) / 2, (f_min_y + f_max_y) / 2);
+		min_x = std::min(min_x, centers.back().first);
+		min_y = std::min(min_y, centers.back().second);
+		max_x = std::max(max_x, centers.back().first);
+		max_y = std::max(max_y, centers.back().second);
+	}
+
+	// grid of columns x rows tiles over the centers
+	const std::size_t columns = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(tiles.size()))));
+	const std::size_t rows = (tiles.size() + columns - 1) / columns;
+	const double width = max_x - min_x;
+	const double height = max_y - min_y;
+
+	std::vector<std::pair<std::size_t, std::size_t>> feature_tiles;
+	feature_tiles.reserve(m_features.size());
+	for (auto&& [feature, center] : O::Zip(m_features, centers))
+	{
+		std::size_t column = width > 0 ? static_cast<std::size_t>((center.first - min_x) / width * columns) : 0;
+		std::size_t row = height > 0 ? static_cast<std::size_t>((center.second - min_y) / height * rows) : 0;
+		std::size_t tile = std::min(row, rows - 1) * columns + std::min(column, columns - 1);
+		tile = std::min(tile, tiles.size() - 1); // the last row may be incomplete
+		feature_tiles.emplace_back(tile, tiles[tile].features.size());
+		tiles[tile].features.emplace_back(std::move(feature));
+	}
+	return feature_tiles;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+template<class Function>
+void O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::For_Each_Tile(std::vector<Tile>& tiles, Function&& function)
+{
+	std::vector<std::thread> workers;
+	workers.reserve(tiles.size());
+	for (Tile& tile : tiles)
+		if (tile.dcel || !tile.features.empty())
+			workers.emplace_back(function, std::ref(tile));
+	for (std::thread& worker : workers)
+		worker.join();
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::Build_Tiles(std::vector<Tile>& tiles) const
+{
+	For_Each_Tile(tiles, [this](Tile& tile) {
+		From_GeoJSON<Vertex, Half_Edge, Face> builder(m_dcel.config);
+		for (GeoJSON::Feature& feature : tile.features)
+			builder.On_Full_Feature(std::move(feature));
+		tile.dcel = builder.Get_Dcel();
+		tile.faces = std::move(builder.Get_Feature_Info()->faces);
+		tile.features.clear();
+
+		tile.envelope = { std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity() };
+		for (Handle vertex = 0; vertex < tile.dcel->vertices.size(); ++vertex)
+		{
+			tile.envelope[0] = std::min(tile.envelope[0], tile.dcel->X(vertex));
+			tile.envelope[1] = std::min(tile.envelope[1], tile.dcel->Y(vertex));
+			tile.envelope[2] = std::max(tile.envelope[2], tile.dcel->X(vertex));
+			tile.envelope[3] = std::max(tile.envelope[3], tile.dcel->Y(vertex));
+		}
+	});
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::Find_Shared_Vertices(std::vector<Tile>& tiles) const
+{
+	// two positions on the same key are less than one tolerance apart
+	const double margin = m_dcel.config.position_tolerance;
+	For_Each_Tile(tiles, [&tiles, margin](Tile& tile) {
+		const std::size_t tile_index = static_cast<std::size_t>(&tile - tiles.data());
+		const Storage<Vertex, Half_Edge, Face>& dcel = *tile.dcel;
+		tile.owners.resize(dcel.vertices.size());
+		tile.shared.assign(dcel.vertices.size(), false);
+		for (const auto& [key, vertex] : dcel.vertex_lookup)
+		{
+			const double x = dcel.X(vertex);
+			const double y = dcel.Y(vertex);
+			tile.owners[vertex] = { tile_index, vertex };
+			for (std::size_t other = 0; other < tiles.size(); ++other)
+			{
+				const Tile& other_tile = tiles[other];
+				if (other == tile_index || !other_tile.dcel) continue;
+				if (x < other_tile.envelope[0] - margin || x > other_tile.envelope[2] + margin || y < other_tile.envelope[1] - margin || y > other_tile.envelope[3] + margin) continue;
+				auto it = other_tile.dcel->vertex_lookup.find(key);
+				if (it == other_tile.dcel->vertex_lookup.end()) continue;
+				tile.shared[vertex] = true;
+				if (other < tile.owners[vertex].first)
+					tile.owners[vertex] = { other, it->second };
+			}
+		}
+	});
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::Place_Tiles(std::vector<Tile>& tiles, std::vector<Handle>& seam_vertices)
+{
+	std::vector<bool> seam;
+	std::unordered_map<uint64_t, Handle> seam_edges; ///< ``Edge_Key`` -> half edge, for the half edges between shared vertices
+	std::size_t vertex_count = 0;
+	std::size_t edge_count = 0;
+	for (std::size_t tile_index = 0; tile_index < tiles.size(); ++tile_index)
+	{
+		Tile& tile = tiles[tile_index];
+		if (!tile.dcel) continue;
+		const Storage<Vertex, Half_Edge, Face>& dcel = *tile.dcel;
+
+		tile.first_vertex = static_cast<Handle>(vertex_count);
+		tile.vertex_map.resize(dcel.vertices.size());
+		for (Handle vertex = 0; vertex < dcel.vertices.size(); ++vertex)
+		{
+			auto [owner, owner_vertex] = tile.owners[vertex];
+			if (owner == tile_index)
+			{
+				if (vertex_count >= INVALID_HANDLE) [[unlikely]] throw Exception{Exception::VERTICES_OVERFLOW};
+				tile.vertex_map[vertex] = static_cast<Handle>(vertex_count++);
+				seam.emplace_back(false);
+				continue;
+			}
+			const Handle stitched = tiles[owner].vertex_map[owner_vertex];
+			tile.vertex_map[vertex] = stitched;
+			if (!seam[stitched])
+			{
+				seam[stitched] = true;
+				seam_vertices.emplace_back(stitched);
+			}
+		}
+
+		// twin pairs are adjacent in both storages, a pair already created by a previous tile keeps its handles (in either direction)
+		tile.first_edge = static_cast<Handle>(edge_count);
+		tile.edge_map.resize(dcel.half_edges.size());
+		for (Handle edge = 0; edge < dcel.half_edges.size(); edge += 2)
+		{
+			const Handle tail = dcel.Tail(edge);
+			const Handle head = dcel.Head(edge);
+			const bool between_shared = tile.shared[tail] && tile.shared[head];
+			if (between_shared)
+			{
+				auto it = seam_edges.find(Storage<Vertex, Half_Edge, Face>::Edge_Key(tile.vertex_map[tail], tile.vertex_map[head]));
+				if (it != seam_edges.end())
+				{
+					tile.edge_map[edge] = it->second;
+					tile.edge_map[edge + 1] = it->second ^ 1;
+					continue;
+				}
+			}
+			if (edge_count + 2 > INVALID_HANDLE) [[unlikely]] throw Exception{Exception::HALF_EDGES_OVERFLOW};
+			tile.edge_map[edge] = static_cast<Handle>(edge_count);
+			tile.edge_map[edge + 1] = static_cast<Handle>(edge_count + 1);
+			edge_count += 2;
+			if (between_shared)
+			{
+				seam_edges.emplace(Storage<Vertex, Half_Edge, Face>::Edge_Key(tile.vertex_map[tail], tile.vertex_map[head]), tile.edge_map[edge]);
+				seam_edges.emplace(Storage<Vertex, Half_Edge, Face>::Edge_Key(tile.vertex_map[head], tile.vertex_map[tail]), tile.edge_map[edge + 1]);
+			}
+		}
+	}
+
+	// the vertices are appended in handle order, the half edges are written by Copy_Tile
+	m_dcel.vertices.reserve(vertex_count);
+	if constexpr (!Stores_Position<Vertex>)
+	{
+		m_dcel.coordinates.x.reserve(vertex_count);
+		m_dcel.coordinates.y.reserve(vertex_count);
+	}
+	for (const Tile& tile : tiles)
+	{
+		if (!tile.dcel) continue;
+		for (Handle vertex = 0; vertex < tile.dcel->vertices.size(); ++vertex)
+		{
+			if (tile.vertex_map[vertex] < tile.first_vertex) continue;
+			if constexpr (Stores_Position<Vertex>)
+				m_dcel.vertices.emplace_back(tile.dcel->X(vertex), tile.dcel->Y(vertex));
+			else
+			{
+				m_dcel.vertices.emplace_back();
+				m_dcel.coordinates.x.push_back(tile.dcel->X(vertex));
+				m_dcel.coordinates.y.push_back(tile.dcel->Y(vertex));
+			}
+		}
+	}
+	m_dcel.half_edges.resize(edge_count);
+	m_dcel.vertex_lookup.reserve(vertex_count);
+	m_dcel.edge_lookup.reserve(edge_count);
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::Copy_Tile(Tile& tile)
+{
+	Storage<Vertex, Half_Edge, Face>& dcel = *tile.dcel;
+	auto map_edge = [&tile](Handle edge) { return edge == INVALID_HANDLE ? INVALID_HANDLE : tile.edge_map[edge]; };
+
+	// only the half edges created by this tile are written, the links reaching a seam vertex are redone from its merged star
+	for (Handle edge = 0; edge < dcel.half_edges.size(); ++edge)
+	{
+		const Handle stitched = tile.edge_map[edge];
+		if (stitched < tile.first_edge) continue;
+		Half_Edge& half_edge = m_dcel.half_edges[stitched];
+		half_edge.tail = tile.vertex_map[dcel.Tail(edge)];
+		if constexpr (Stores_Head<Half_Edge>)
+			half_edge.head = tile.vertex_map[dcel.Head(edge)];
+		if constexpr (Stores_Twin<Half_Edge>)
+			half_edge.twin = tile.edge_map[dcel.Twin(edge)];
+		half_edge.next = map_edge(dcel.Next(edge));
+		if constexpr (Stores_Prev<Half_Edge>)
+			half_edge.prev = map_edge(dcel.Prev(edge));
+	}
+
+	for (Handle vertex = 0; vertex < dcel.vertices.size(); ++vertex)
+	{
+		if (tile.vertex_map[vertex] < tile.first_vertex) continue;
+		auto& outgoing_edges = m_dcel.vertices[tile.vertex_map[vertex]].outgoing_edges;
+		for (Handle edge : dcel.vertices[vertex].outgoing_edges)
+			outgoing_edges.push_back(tile.edge_map[edge]);
+	}
+
+	for (auto& [key, vertex] : dcel.vertex_lookup)
+		vertex = tile.vertex_map[vertex];
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::Merge_Tile(Tile& tile)
+{
+	Storage<Vertex, Half_Edge, Face>& dcel = *tile.dcel;
+	for (Handle vertex = 0; vertex < dcel.vertices.size(); ++vertex)
+	{
+		if (tile.vertex_map[vertex] >= tile.first_vertex) continue;
+		auto& outgoing_edges = m_dcel.vertices[tile.vertex_map[vertex]].outgoing_edges;
+		for (Handle edge : dcel.vertices[vertex].outgoing_edges)
+			if (std::ranges::find(outgoing_edges, tile.edge_map[edge]) == outgoing_edges.end())
+				outgoing_edges.push_back(tile.edge_map[edge]);
+	}
+
+	// the lookup nodes are moved, keys already in m_dcel (merged vertices and half edges) stay behind
+	m_dcel.vertex_lookup.merge(dcel.vertex_lookup);
+	while (!dcel.edge_lookup.empty())
+	{
+		auto node = dcel.edge_lookup.extract(dcel.edge_lookup.begin());
+		const Handle tail = static_cast<Handle>(node.key() >> 32);
+		const Handle head = static_cast<Handle>(node.key() & 0xFFFFFFFFu);
+		node.key() = Storage<Vertex, Half_Edge, Face>::Edge_Key(tile.vertex_map[tail], tile.vertex_map[head]);
+		node.mapped() = tile.edge_map[node.mapped()];
+		m_dcel.edge_lookup.insert(std::move(node));
+	}
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::Parallel_From_GeoJSON<Vertex, Half_Edge, Face>::Link_Faces(const std::vector<Tile>& tiles, const std::vector<std::pair<std::size_t, std::size_t>>& feature_tiles)
+{
+	// ring faces in reading order start on the same half edge as in their tile
+	for (auto&& [tile_index, feature_index] : feature_tiles)
+	{
+		const Tile& tile = tiles[tile_index];
+		std::vector<std::vector<Handle>> polygons;
+		polygons.reserve(tile.faces[feature_index].size());
+		for (const std::vector<Handle>& tile_faces : tile.faces[feature_index])
+		{
+			std::vector<Handle>& faces = polygons.emplace_back();
+			faces.reserve(tile_faces.size());
+			for (Handle face : tile_faces)
+				faces.emplace_back(m_dcel.Create_Face(tile.edge_map[tile.dcel->faces[face].edge]));
+		}
+		m_feature_info.faces.emplace_back(std::move(polygons));
+	}
+
+	// finish face for outer bound
+	for (Handle edge = 0; edge < m_dcel.half_edges.size(); ++edge)
+		if (m_dcel.Incident_Face(edge) == INVALID_HANDLE)
+			m_dcel.Create_Face(edge);
+}
+
+#endif // DCEL_INDEX_PARALLEL_BUILDER_HPP
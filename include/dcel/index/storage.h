@@ -0,0 +1,140 @@
+#ifndef DCEL_INDEX_STORAGE_H
+#define DCEL_INDEX_STORAGE_H
+
+// STL
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// CONFIGURATION
+#include "configuration/dcel.h"
+
+// DCEL
+#include "dcel/vertex_key.h"
+#include "dcel/coordinate_kernels.h"
+#include "dcel/index/handle.h"
+#include "dcel/index/vertex.h"
+#include "dcel/index/half_edge.h"
+#include "dcel/index/compact_half_edge.h"
+#include "dcel/index/face.h"
+
+namespace O::DCEL::Index
+{
+	/**
+	 * @brief Index handle variant of ``DCEL::Storage``: vertices, half edges and faces refer to each other with 32 bit handles into the vectors.
+	 *        Handles stay valid when the vectors grow, so nothing is reserved up front (``max_*`` of the configuration are ignored, call ``reserve`` on the members for a known size) and a storage can be copied or written as plain memory.
+	 *        The two half edges of an edge are created together: ``Get_Or_Create_Half_Edge(a, b)`` stores ``a -> b`` at an even handle and its twin right after it.
+	 * @note the links are read and written through the navigation functions (``Tail``, ``Next``, ``Link``...) so algorithms do not depend on the half edge layout.
+	 *       ``Half_Edge`` may leave out ``twin``, ``head`` and ``prev`` (see ``Compact_Half_Edge``), they are then derived from the adjacent twin pairs and the outgoing edges of the vertices.
+	 *       ``Vertex`` may leave out its outgoing edge list (see ``Starless_Vertex``), the rotation around it is then kept in the ``next`` and ``prev`` links as soon as an edge is inserted.
+	 *       ``Vertex`` may also leave out its coordinates (see ``Topology_Vertex``), they are then stored in the ``coordinates`` arrays and read with ``X`` and ``Y``.
+	 * @throw Exception ``VERTICES_OVERFLOW``, ``HALF_EDGES_OVERFLOW`` or ``FACES_OVERFLOW`` when a vector would need more than ``INVALID_HANDLE`` elements.
+	 */
+	template<class Vertex = Index::Vertex, class Half_Edge = Index::Half_Edge, class Face = Index::Face>
+	struct Storage
+	{
+		static_assert(Stores_Star<Vertex> || Stores_Prev<Half_Edge>, "a Starless_Vertex walks its rotation through prev, the half edge has to store it");
+
+		O::Configuration::DCEL config;
+		std::vector<Vertex> vertices;      ///< List of Vertex in the DCEL
+		std::vector<Half_Edge> half_edges; ///< List of Half_Edges in the DCEL, twins are adjacent
+		std::vector<Face> faces;           ///< List of Faces in the DCEL
+
+		/// @brief stands for ``coordinates`` when the vertices store their position
+		struct No_Coordinates {};
+		[[no_unique_address]] std::conditional_t<Stores_Position<Vertex>, No_Coordinates, Coordinates> coordinates; ///< ``x[]``/``y[]`` of the vertices when ``Vertex`` has no coordinates
+
+		std::unordered_map<Vertex_Key, Handle, Vertex_Hash> vertex_lookup; ///< rounded position -> vertex
+		std::unordered_map<uint64_t, Handle> edge_lookup;                  ///< ``Edge_Key(tail, head)`` -> half edge
+
+		Storage() = delete;
+		Storage(const O::Configuration::DCEL& config);
+
+		/// @name Building
+		/// @{
+
+		/**
+		 * @brief Create or Get the vertex at a position
+		 * @return handle of the vertex
+		 */
+		Handle Get_Or_Create_Vertex(double x, double y);
+
+		/// @brief tell if a vertex already exist at coordinate
+		bool Does_Vertex_Exist(double x, double y) const;
+
+		/**
+		 * @brief Create or Get the half edge ``origin -> head``, its twin is created and linked at the same time
+		 * @return handle of the half edge
+		 */
+		Handle Get_Or_Create_Half_Edge(Handle origin, Handle head);
+
+		/// @brief tell if an half edge linking the two vertex exist
+		bool Does_Half_Edge_Exist(Handle origin, Handle head) const;
+
+		/**
+		 * @brief insert half_edge inside the vertex outgoing edge list, keeping it sorted clockwise
+		 * @note with a ``Starless_Vertex`` the edge is spliced in the rotation right away: ``twin(edge).next`` and the ``next`` of the twin of the following edge are updated
+		 * @param vertex the vertex where to add the outgoing edge
+		 * @param edge half edge starting at ``vertex``
+		 */
+		void Insert_Edge_Sorted(Handle vertex, Handle edge);
+
+		/**
+		 * @brief ensure the "around-vertex linking" invariants: for each outgoing edge e in clockwise order, ``twin(next outgoing).next = e``
+		 * @note nothing to do with a ``Starless_Vertex``, ``Insert_Edge_Sorted`` already keeps them
+		 * @param vertex the vertex where to update all outgoing edge
+		 */
+		void Update_Around_Vertex(Handle vertex);
+
+		/**
+		 * @brief sort the outgoing edges of a vertex in one pass by the pseudo-angle of their direction, giving the order ``Insert_Edge_Sorted`` builds edge by edge
+		 * @note only for vertices storing their outgoing edge list
+		 */
+		void Sort_Around_Vertex(Handle vertex) requires Stores_Star<Vertex>;
+
+		/**
+		 * @brief create a face and assign it to every half edge of the ``next`` cycle of ``edge``
+		 * @return handle of the face
+		 */
+		Handle Create_Face(Handle edge);
+
+		/**
+		 * @brief recompute ``vertex_lookup`` after the coordinates were changed in bulk (for instance with the ``Kernel`` functions)
+		 * @note vertices are not merged: when two of them end up on the same key, the lookup keeps the first one
+		 */
+		void Rebuild_Vertex_Lookup();
+		/// @}
+
+		/// @name Coordinates
+		/// @{
+		double X(Handle vertex) const;
+		double Y(Handle vertex) const;
+		/// @}
+
+		/// @name Navigation
+		/// @{
+		Handle Tail(Handle edge) const { return half_edges[edge].tail; }
+		Handle Head(Handle edge) const;
+		Handle Twin(Handle edge) const;
+		Handle Next(Handle edge) const { return half_edges[edge].next; }
+		Handle Prev(Handle edge) const;
+		Handle Incident_Face(Handle edge) const { return half_edges[edge].face; }
+
+		/// @brief make ``next`` follow ``edge`` around their face
+		void Link(Handle edge, Handle next);
+		void Set_Face(Handle edge, Handle face) { half_edges[edge].face = face; }
+
+		/// @brief call ``function(edge)`` on the outgoing edges of ``vertex`` in clockwise order, whatever the vertex layout
+		template<class Function>
+		void For_Each_Outgoing_Edge(Handle vertex, Function&& function) const;
+		/// @}
+
+		/// @brief key of the half edge ``tail -> head`` inside ``edge_lookup``
+		static uint64_t Edge_Key(Handle tail, Handle head) noexcept { return (static_cast<uint64_t>(tail) << 32) | head; }
+	};
+} // namespace O::DCEL::Index
+
+#include "storage.hpp"
+
+#endif // DCEL_INDEX_STORAGE_H
@@ -0,0 +1,286 @@
+#ifndef DCEL_INDEX_STORAGE_HPP
+#define DCEL_INDEX_STORAGE_HPP
+
+// DCEL
+#include "dcel/index/storage.h"
+#include "dcel/exception.h"
+
+// STL
+#include <algorithm>
+#include <cmath>
+
+// UTILS
+#include <utils/zip.h>
+
+template<class Vertex, class Half_Edge, class Face>
+O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Storage(const O::Configuration::DCEL& config) :
+	config(config),
+	vertices(),
+	half_edges(),
+	faces(),
+	coordinates(),
+	vertex_lookup(),
+	edge_lookup()
+{
+
+}
+
+template<class Vertex, class Half_Edge, class Face>
+O::DCEL::Index::Handle O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Get_Or_Create_Vertex(double x, double y)
+{
+	auto key = Vertex_Key(x, y, config);
+	auto it = vertex_lookup.find(key);
+	if (it != vertex_lookup.end()) return it->second;
+	if (vertices.size() >= INVALID_HANDLE) [[unlikely]] throw Exception{Exception::VERTICES_OVERFLOW};
+	const Handle vertex = static_cast<Handle>(vertices.size());
+	if constexpr (Stores_Position<Vertex>)
+		vertices.emplace_back(x, y);
+	else
+	{
+		vertices.emplace_back();
+		coordinates.x.push_back(x);
+		coordinates.y.push_back(y);
+	}
+	vertex_lookup.emplace(key, vertex);
+	return vertex;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+bool O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Does_Vertex_Exist(double x, double y) const
+{
+	return vertex_lookup.find(Vertex_Key(x, y, config)) != vertex_lookup.end();
+}
+
+template<class Vertex, class Half_Edge, class Face>
+O::DCEL::Index::Handle O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Get_Or_Create_Half_Edge(Handle origin, Handle head)
+{
+	auto it = edge_lookup.find(Edge_Key(origin, head));
+	if (it != edge_lookup.end()) return it->second;
+	if (half_edges.size() + 2 > INVALID_HANDLE) [[unlikely]] throw Exception{Exception::HALF_EDGES_OVERFLOW};
+	const Handle edge = static_cast<Handle>(half_edges.size());
+	half_edges.emplace_back();
+	half_edges.emplace_back();
+	half_edges[edge].tail = origin;
+	half_edges[edge + 1].tail = head;
+	if constexpr (Stores_Head<Half_Edge>)
+	{
+		half_edges[edge].head = head;
+		half_edges[edge + 1].head = origin;
+	}
+	if constexpr (Stores_Twin<Half_Edge>)
+	{
+		half_edges[edge].twin = edge + 1;
+		half_edges[edge + 1].twin = edge;
+	}
+	edge_lookup.emplace(Edge_Key(origin, head), edge);
+	edge_lookup.emplace(Edge_Key(head, origin), edge + 1);
+	return edge;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+bool O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Does_Half_Edge_Exist(Handle origin, Handle head) const
+{
+	return edge_lookup.find(Edge_Key(origin, head)) != edge_lookup.end();
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Insert_Edge_Sorted(Handle vertex, Handle edge)
+{
+	Vertex& v = vertices[vertex];
+	const double x = X(vertex);
+	const double y = Y(vertex);
+	double vx = X(Head(edge)) - x;
+	double vy = Y(Head(edge)) - y;
+
+	if constexpr (Stores_Star<Vertex>)
+	{
+		if (std::ranges::find(v.outgoing_edges, edge) != v.outgoing_edges.end())
+			return; // we already inserted this half edge in vertex
+
+		auto pos = v.outgoing_edges.begin();
+		for (; pos != v.outgoing_edges.end(); ++pos)
+		{
+			double ox = X(Head(*pos)) - x;
+			double oy = Y(Head(*pos)) - y;
+
+			double cross = ox * vy - oy * vx;
+			if (cross < 0) break; // new edge is clockwise after old edge
+		}
+
+		v.outgoing_edges.insert(pos, edge);
+	}
+	else
+	{
+		if (Next(Twin(edge)) != INVALID_HANDLE)
+			return; // the rotation already goes through this half edge
+		if (v.edge == INVALID_HANDLE)
+		{
+			v.edge = edge;
+			Link(Twin(edge), edge);
+			return;
+		}
+
+		// same scan as the outgoing edge list, walking the rotation clockwise from the first edge
+		Handle pos = v.edge;
+		bool first = true;
+		do {
+			double ox = X(Head(pos)) - x;
+			double oy = Y(Head(pos)) - y;
+
+			double cross = ox * vy - oy * vx;
+			if (cross < 0) break; // new edge is clockwise after old edge
+			pos = Twin(Prev(pos));
+			first = false;
+		} while (pos != v.edge);
+
+		// splice edge before pos, inserting before the first edge or after the last one is the same place in the rotation
+		Link(Twin(edge), Next(Twin(pos)));
+		Link(Twin(pos), edge);
+		if (first)
+			v.edge = edge;
+	}
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Update_Around_Vertex(Handle vertex)
+{
+	if constexpr (Stores_Star<Vertex>)
+	{
+		const auto& outgoing_edges = vertices[vertex].outgoing_edges;
+		if (outgoing_edges.size() < 2) return;
+
+		for (auto&& [half_edge_curr, half_edge_next] : O::Zip_Adjacent_Circular(outgoing_edges))
+			Link(Twin(half_edge_next), half_edge_curr);
+	}
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Sort_Around_Vertex(Handle vertex) requires Stores_Star<Vertex>
+{
+	const double x = X(vertex);
+	const double y = Y(vertex);
+	// monotonic in the angle from the +x axis counter clockwise, in [0, 4)
+	auto pseudo_angle = [this, x, y](Handle edge) {
+		double dx = X(Head(edge)) - x;
+		double dy = Y(Head(edge)) - y;
+		double p = dy / (std::abs(dx) + std::abs(dy));
+		return dx < 0 ? 2 - p : (dy < 0 ? 4 + p : p);
+	};
+	std::ranges::stable_sort(vertices[vertex].outgoing_edges, {}, pseudo_angle);
+}
+
+template<class Vertex, class Half_Edge, class Face>
+template<class Function>
+void O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::For_Each_Outgoing_Edge(Handle vertex, Function&& function) const
+{
+	if constexpr (Stores_Star<Vertex>)
+	{
+		for (Handle edge : vertices[vertex].outgoing_edges)
+			function(edge);
+	}
+	else
+	{
+		const Handle first = vertices[vertex].edge;
+		if (first == INVALID_HANDLE) return;
+		Handle edge = first;
+		do {
+			function(edge);
+			edge = Twin(Prev(edge));
+		} while (edge != first);
+	}
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Rebuild_Vertex_Lookup()
+{
+	vertex_lookup.clear();
+	vertex_lookup.reserve(vertices.size());
+	if constexpr (Stores_Position<Vertex>)
+	{
+		for (Handle vertex = 0; vertex < vertices.size(); ++vertex)
+			vertex_lookup.emplace(Vertex_Key(vertices[vertex].x, vertices[vertex].y, config), vertex);
+	}
+	else
+	{
+		std::vector<Vertex_Key> keys;
+		Kernel::Compute_Vertex_Keys(coordinates.x, coordinates.y, config, keys);
+		for (Handle vertex = 0; vertex < keys.size(); ++vertex)
+			vertex_lookup.emplace(keys[vertex], vertex);
+	}
+}
+
+template<class Vertex, class Half_Edge, class Face>
+double O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::X(Handle vertex) const
+{
+	if constexpr (Stores_Position<Vertex>)
+		return vertices[vertex].x;
+	else
+		return coordinates.x[vertex];
+}
+
+template<class Vertex, class Half_Edge, class Face>
+double O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Y(Handle vertex) const
+{
+	if constexpr (Stores_Position<Vertex>)
+		return vertices[vertex].y;
+	else
+		return coordinates.y[vertex];
+}
+
+template<class Vertex, class Half_Edge, class Face>
+O::DCEL::Index::Handle O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Head(Handle edge) const
+{
+	if constexpr (Stores_Head<Half_Edge>)
+		return half_edges[edge].head;
+	else
+		return Tail(Twin(edge));
+}
+
+template<class Vertex, class Half_Edge, class Face>
+O::DCEL::Index::Handle O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Twin(Handle edge) const
+{
+	if constexpr (Stores_Twin<Half_Edge>)
+		return half_edges[edge].twin;
+	else
+		return edge ^ 1;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+O::DCEL::Index::Handle O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Prev(Handle edge) const
+{
+	if constexpr (Stores_Prev<Half_Edge>)
+		return half_edges[edge].prev;
+	else
+	{
+		// the previous half edge ends at the tail of edge: it is the twin of one of its outgoing edges (the vertex stores them, see the static_assert)
+		for (Handle out_edge : vertices[Tail(edge)].outgoing_edges)
+			if (Next(Twin(out_edge)) == edge)
+				return Twin(out_edge);
+		return INVALID_HANDLE;
+	}
+}
+
+template<class Vertex, class Half_Edge, class Face>
+void O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Link(Handle edge, Handle next)
+{
+	half_edges[edge].next = next;
+	if constexpr (Stores_Prev<Half_Edge>)
+		half_edges[next].prev = edge;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+O::DCEL::Index::Handle O::DCEL::Index::Storage<Vertex, Half_Edge, Face>::Create_Face(Handle edge)
+{
+	if (faces.size() >= INVALID_HANDLE) [[unlikely]] throw Exception{Exception::FACES_OVERFLOW};
+	const Handle face = static_cast<Handle>(faces.size());
+	faces.emplace_back();
+	faces.back().edge = edge;
+	Handle current = edge;
+	do {
+		Set_Face(current, face);
+		current = Next(current);
+	} while (current != edge);
+	return face;
+}
+
+#endif // DCEL_INDEX_STORAGE_HPP
@@ -0,0 +1,86 @@
+#ifndef DCEL_INDEX_VERTEX_H
+#define DCEL_INDEX_VERTEX_H
+
+// STL
+#include <vector>
+
+// DCEL
+#include "dcel/small_vector.h"
+#include "dcel/index/handle.h"
+
+namespace O::DCEL::Index
+{
+	/**
+	 * @brief Vertex of an ``Index::Storage``, the outgoing half edges are handles instead of pointers.
+	 * @tparam Edge_List container of the outgoing edges
+	 */
+	template<class Edge_List>
+	struct Basic_Vertex
+	{
+		double x = 0.0;           ///< x coordinate of the vertex (same coordinate system as the GeoJSON).
+		double y = 0.0;           ///< y coordinate of the vertex (same coordinate system as the GeoJSON).
+		Edge_List outgoing_edges; ///< ordered outgoing half edges of the vertex (hedges are ordered clockwise).
+
+		Basic_Vertex(double x, double y) :
+			x(x),
+			y(y),
+			outgoing_edges()
+		{
+
+		}
+	};
+
+	/// @brief vertex with its outgoing edges in a ``std::vector``
+	using Vertex = Basic_Vertex<std::vector<Handle>>;
+
+	/// @brief vertex keeping up to 4 outgoing edges inline
+	using Small_Vertex = Basic_Vertex<Small_Vector<Handle, 4>>;
+
+	/**
+	 * @brief Vertex without outgoing edge list: it only holds the first of its outgoing edges.
+	 *        The others are recovered from the rotation around the vertex: the edge following ``e`` clockwise is ``Twin(Prev(e))``, the one before is ``Next(Twin(e))``.
+	 *        ``Index::Storage`` keeps these links up to date while inserting edges, so the half edge type has to store ``prev``.
+	 */
+	struct Starless_Vertex
+	{
+		double x = 0.0;               ///< x coordinate of the vertex (same coordinate system as the GeoJSON).
+		double y = 0.0;               ///< y coordinate of the vertex (same coordinate system as the GeoJSON).
+		Handle edge = INVALID_HANDLE; ///< first outgoing half edge, ``INVALID_HANDLE`` for an isolated vertex
+
+		Starless_Vertex(double x, double y) :
+			x(x),
+			y(y)
+		{
+
+		}
+	};
+
+	/**
+	 * @brief Vertex holding only its outgoing edges: the ``Index::Storage`` keeps the coordinates of such vertices in its ``coordinates`` arrays (structure of arrays).
+	 * @tparam Edge_List container of the outgoing edges
+	 */
+	template<class Edge_List>
+	struct Basic_Topology_Vertex
+	{
+		Edge_List outgoing_edges; ///< ordered outgoing half edges of the vertex (hedges are ordered clockwise).
+	};
+
+	/// @brief topology only vertex with its outgoing edges in a ``std::vector``
+	using Topology_Vertex = Basic_Topology_Vertex<std::vector<Handle>>;
+
+	/// @brief topology only ``Starless_Vertex``, 4 bytes per vertex next to the coordinate arrays
+	struct Starless_Topology_Vertex
+	{
+		Handle edge = INVALID_HANDLE; ///< first outgoing half edge, ``INVALID_HANDLE`` for an isolated vertex
+	};
+
+	/// @brief vertex types storing their outgoing edge list
+	template<class Vertex>
+	concept Stores_Star = requires(Vertex vertex) { vertex.outgoing_edges; };
+
+	/// @brief vertex types storing their coordinates
+	template<class Vertex>
+	concept Stores_Position = requires(Vertex vertex) { vertex.x; vertex.y; };
+} // namespace O::DCEL::Index
+
+#endif // DCEL_INDEX_VERTEX_H
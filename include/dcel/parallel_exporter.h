@@ -0,0 +1,37 @@
+#ifndef DCEL_TO_GEOJSON_PARALLEL_H
+#define DCEL_TO_GEOJSON_PARALLEL_H
+
+// STL
+#include <cstddef>
+
+// DCEL
+#include "exporter.h"
+#include "feature_info.h"
+
+// IO
+#include "io/parallel_writer.h"
+
+namespace O::DCEL::Exporter
+{
+	/**
+	 * @brief To_GeoJSON_Parallel serializes a DCEL as a GeoJSON FeatureCollection without building the ``O::GeoJSON::Root``.
+	 *        Features are reconstructed with ``To_GeoJSON::Convert_Feature`` and formatted on several threads (see ``O::GeoJSON::IO::Write_Features_Parallel``).
+	 */
+	template<class Vertex, class Half_Edge, class Face>
+	class To_GeoJSON_Parallel
+	{
+	public:
+		/**
+		 * @brief Serialize the DCEL Storage and Feature_Info, the output is the same as writing the result of ``To_GeoJSON::Convert``
+		 * @param info the Feature_INFO
+		 * @param writer writer sink
+		 * @param thread_count number of workers, 0 for ``std::thread::hardware_concurrency``
+		 */
+		template<class Out_Stream>
+		static void Write(const Feature_Info<Face>& info, O::GeoJSON::IO::Writer<Out_Stream>& writer, std::size_t thread_count = 0);
+	};
+}
+
+#include "parallel_exporter.hpp"
+
+#endif // DCEL_TO_GEOJSON_PARALLEL_H
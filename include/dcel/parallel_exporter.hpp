@@ -0,0 +1,18 @@
+#ifndef DCEL_PARALLEL_EXPORTER_HPP
+#define DCEL_PARALLEL_EXPORTER_HPP
+
+#include "dcel/parallel_exporter.h"
+
+template<class Vertex, class Half_Edge, class Face>
+template<class Out_Stream>
+void O::DCEL::Exporter::To_GeoJSON_Parallel<Vertex, Half_Edge, Face>::Write(const O::DCEL::Feature_Info<Face>& info, O::GeoJSON::IO::Writer<Out_Stream>& writer, std::size_t thread_count)
+{
+	if (info.has_root)
+		writer.Begin_Feature_Collection(info.root_bbox, info.root_id);
+	else
+		writer.Begin_Feature_Collection();
+	O::GeoJSON::IO::Write_Features_Parallel(writer, info.faces.size(), [&info](std::size_t i) { return To_GeoJSON<Vertex, Half_Edge, Face>::Convert_Feature(info, i); }, thread_count);
+	writer.End_Feature_Collection();
+}
+
+#endif //DCEL_PARALLEL_EXPORTER_HPP
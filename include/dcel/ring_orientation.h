@@ -0,0 +1,29 @@
+#ifndef DCEL_RING_ORIENTATION_H
+#define DCEL_RING_ORIENTATION_H
+
+// STL
+#include <vector>
+
+// GEOJSON
+#include "geojson/position.h"
+
+// UTILS
+#include <utils/zip.h>
+
+namespace O::DCEL
+{
+	/**
+	 * @brief twice the signed area of a ring (shoelace formula), shared by the builders so that every storage orients its rings the same way
+	 * @param ring closed GeoJSON ring, the last position repeats the first one
+	 * @return positive for a counter clockwise ring (longitude east, latitude north), negative for a clockwise one
+	 */
+	inline double Double_Signed_Area(const std::vector<O::GeoJSON::Position>& ring)
+	{
+		double area = 0;
+		for (auto&& [ring_i, ring_i_1] : O::Zip_Adjacent(ring))
+			area += ring_i.longitude * ring_i_1.latitude - ring_i.latitude * ring_i_1.longitude;
+		return area;
+	}
+}
+
+#endif // DCEL_RING_ORIENTATION_H
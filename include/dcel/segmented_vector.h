@@ -0,0 +1,151 @@
+#ifndef DCEL_SEGMENTED_VECTOR_H
+#define DCEL_SEGMENTED_VECTOR_H
+
+// STL
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace O::DCEL
+{
+	/**
+	 * @brief Sequence container allocating its elements in fixed-size blocks. Growing never moves an element, so pointers and references stay valid until the element is removed.
+	 *        It offers the part of the ``std::vector`` interface used by ``DCEL::Storage`` (indexing, ``back``, ``emplace_back``, ``pop_back``, random access iterators).
+	 * @tparam T element type
+	 * @tparam BLOCK_SIZE number of elements per block
+	 */
+	template<class T, std::size_t BLOCK_SIZE = 4096>
+	class Segmented_Vector
+	{
+		static_assert(BLOCK_SIZE > 0);
+
+		template<bool CONST>
+		class Basic_Iterator
+		{
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<CONST, const T*, T*>;
+			using reference = std::conditional_t<CONST, const T&, T&>;
+			using Container = std::conditional_t<CONST, const Segmented_Vector, Segmented_Vector>;
+
+			Basic_Iterator() = default;
+			Basic_Iterator(Container* container, std::size_t index) : m_container(container), m_index(index) {}
+			operator Basic_Iterator<true>() const { return Basic_Iterator<true>(m_container, m_index); }
+
+			reference operator*() const { return (*m_container)[m_index]; }
+			pointer operator->() const { return &(*m_container)[m_index]; }
+			reference operator[](difference_type n) const { return (*m_container)[m_index + n]; }
+
+			Basic_Iterator& operator++() { ++m_index; return *this; }
+			Basic_Iterator operator++(int) { Basic_Iterator old = *this; ++m_index; return old; }
+			Basic_Iterator& operator--() { --m_index; return *this; }
+			Basic_Iterator operator--(int) { Basic_Iterator old = *this; --m_index; return old; }
+			Basic_Iterator& operator+=(difference_type n) { m_index += n; return *this; }
+			Basic_Iterator& operator-=(difference_type n) { m_index -= n; return *this; }
+			friend Basic_Iterator operator+(Basic_Iterator it, difference_type n) { return it += n; }
+			friend Basic_Iterator operator+(difference_type n, Basic_Iterator it) { return it += n; }
+			friend Basic_Iterator operator-(Basic_Iterator it, difference_type n) { return it -= n; }
+			friend difference_type operator-(const Basic_Iterator& a, const Basic_Iterator& b) { return static_cast<difference_type>(a.m_index) - static_cast<difference_type>(b.m_index); }
+			friend bool operator==(const Basic_Iterator& a, const Basic_Iterator& b) { return a.m_index == b.m_index; }
+			friend auto operator<=>(const Basic_Iterator& a, const Basic_Iterator& b) { return a.m_index <=> b.m_index; }
+
+		private:
+			Container* m_container = nullptr;
+			std::size_t m_index = 0;
+		};
+
+		/// @brief uninitialized memory of one block
+		struct Block
+		{
+			alignas(T) std::byte bytes[sizeof(T) * BLOCK_SIZE];
+		};
+
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using iterator = Basic_Iterator<false>;
+		using const_iterator = Basic_Iterator<true>;
+
+		Segmented_Vector() = default;
+		Segmented_Vector(const Segmented_Vector& other) { for (const T& element : other) emplace_back(element); }
+		Segmented_Vector(Segmented_Vector&& other) noexcept : m_blocks(std::move(other.m_blocks)), m_size(std::exchange(other.m_size, 0)) {}
+		Segmented_Vector& operator=(const Segmented_Vector& other) { if (this != &other) { clear(); for (const T& element : other) emplace_back(element); } return *this; }
+		Segmented_Vector& operator=(Segmented_Vector&& other) noexcept { if (this != &other) { clear(); m_blocks = std::move(other.m_blocks); m_size = std::exchange(other.m_size, 0); } return *this; }
+		~Segmented_Vector() { clear(); }
+
+		/// @name Element access
+		/// @{
+		T& operator[](std::size_t i) { return *std::launder(reinterpret_cast<T*>(m_blocks[i / BLOCK_SIZE]->bytes) + i % BLOCK_SIZE); }
+		const T& operator[](std::size_t i) const { return *std::launder(reinterpret_cast<const T*>(m_blocks[i / BLOCK_SIZE]->bytes) + i % BLOCK_SIZE); }
+		T& front() { return (*this)[0]; }
+		const T& front() const { return (*this)[0]; }
+		T& back() { return (*this)[m_size - 1]; }
+		const T& back() const { return (*this)[m_size - 1]; }
+		/// @}
+
+		/// @name Iterators
+		/// @{
+		iterator begin() { return iterator(this, 0); }
+		iterator end() { return iterator(this, m_size); }
+		const_iterator begin() const { return const_iterator(this, 0); }
+		const_iterator end() const { return const_iterator(this, m_size); }
+		/// @}
+
+		/// @name Capacity
+		/// @{
+		std::size_t size() const noexcept { return m_size; }
+		bool empty() const noexcept { return m_size == 0; }
+		std::size_t capacity() const noexcept { return m_blocks.size() * BLOCK_SIZE; }
+
+		/// @brief allocate the blocks holding ``count`` elements
+		void reserve(std::size_t count)
+		{
+			m_blocks.reserve((count + BLOCK_SIZE - 1) / BLOCK_SIZE);
+			while (capacity() < count)
+				m_blocks.emplace_back(new Block);
+		}
+		/// @}
+
+		/// @name Modifiers
+		/// @{
+		template<class... Args>
+		T& emplace_back(Args&&... args)
+		{
+			if (m_size == capacity())
+				m_blocks.emplace_back(new Block);
+			T* element = ::new (static_cast<void*>(reinterpret_cast<T*>(m_blocks[m_size / BLOCK_SIZE]->bytes) + m_size % BLOCK_SIZE)) T(std::forward<Args>(args)...);
+			++m_size;
+			return *element;
+		}
+
+		void push_back(const T& value) { emplace_back(value); }
+		void push_back(T&& value) { emplace_back(std::move(value)); }
+
+		/// @brief destroy the last element, its block is kept for the next insertions
+		void pop_back()
+		{
+			back().~T();
+			--m_size;
+		}
+
+		/// @brief destroy every element and release the blocks
+		void clear()
+		{
+			while (m_size)
+				pop_back();
+			m_blocks.clear();
+		}
+		/// @}
+
+	private:
+		std::vector<std::unique_ptr<Block>> m_blocks; ///< blocks of ``BLOCK_SIZE`` elements, never reallocated
+		std::size_t m_size = 0;                       ///< number of constructed elements
+	};
+} // namespace O::DCEL
+
+#endif // DCEL_SEGMENTED_VECTOR_H
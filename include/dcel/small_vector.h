@@ -0,0 +1,166 @@
+#ifndef DCEL_SMALL_VECTOR_H
+#define DCEL_SMALL_VECTOR_H
+
+// STL
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace O::DCEL
+{
+	/**
+	 * @brief Sequence container holding up to ``N`` elements inline and moving to the heap beyond, used for the outgoing edges of vertices which rarely go past 4.
+	 *        It offers the part of the ``std::vector`` interface used by the DCEL (indexing, ``insert``, ``erase``, ``push_back``, contiguous iterators).
+	 * @tparam T element type
+	 * @tparam N number of elements stored inline
+	 */
+	template<class T, std::size_t N = 4>
+	class Small_Vector
+	{
+		static_assert(N > 0);
+
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using iterator = T*;
+		using const_iterator = const T*;
+
+		Small_Vector() = default;
+		Small_Vector(std::initializer_list<T> values) { reserve(values.size()); for (const T& value : values) emplace_back(value); }
+		Small_Vector(const Small_Vector& other) { reserve(other.m_size); for (const T& value : other) emplace_back(value); }
+		Small_Vector(Small_Vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) { Steal(other); }
+		Small_Vector& operator=(const Small_Vector& other) { if (this != &other) { clear(); reserve(other.m_size); for (const T& value : other) emplace_back(value); } return *this; }
+		Small_Vector& operator=(Small_Vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) { if (this != &other) { Release(); Steal(other); } return *this; }
+		~Small_Vector() { Release(); }
+
+		/// @name Element access
+		/// @{
+		T* data() noexcept { return m_data; }
+		const T* data() const noexcept { return m_data; }
+		T& operator[](std::size_t i) { return m_data[i]; }
+		const T& operator[](std::size_t i) const { return m_data[i]; }
+		T& front() { return m_data[0]; }
+		const T& front() const { return m_data[0]; }
+		T& back() { return m_data[m_size - 1]; }
+		const T& back() const { return m_data[m_size - 1]; }
+		/// @}
+
+		/// @name Iterators
+		/// @{
+		iterator begin() noexcept { return m_data; }
+		iterator end() noexcept { return m_data + m_size; }
+		const_iterator begin() const noexcept { return m_data; }
+		const_iterator end() const noexcept { return m_data + m_size; }
+		/// @}
+
+		/// @name Capacity
+		/// @{
+		std::size_t size() const noexcept { return m_size; }
+		bool empty() const noexcept { return m_size == 0; }
+		std::size_t capacity() const noexcept { return m_capacity; }
+		bool is_inline() const noexcept { return m_data == Inline(); } ///< true while the elements fit in the inline buffer
+
+		void reserve(std::size_t count)
+		{
+			if (count <= m_capacity)
+				return;
+			T* data = std::allocator<T>().allocate(count);
+			std::uninitialized_move(begin(), end(), data);
+			std::destroy(begin(), end());
+			if (!is_inline())
+				std::allocator<T>().deallocate(m_data, m_capacity);
+			m_data = data;
+			m_capacity = count;
+		}
+		/// @}
+
+		/// @name Modifiers
+		/// @{
+		template<class... Args>
+		T& emplace_back(Args&&... args)
+		{
+			if (m_size == m_capacity)
+			{
+				// the value may live in this vector, build it before growing
+				T value(std::forward<Args>(args)...);
+				reserve(2 * m_capacity);
+				return *::new (static_cast<void*>(m_data + m_size++)) T(std::move(value));
+			}
+			return *::new (static_cast<void*>(m_data + m_size++)) T(std::forward<Args>(args)...);
+		}
+
+		void push_back(const T& value) { emplace_back(value); }
+		void push_back(T&& value) { emplace_back(std::move(value)); }
+		void pop_back() { std::destroy_at(m_data + --m_size); }
+
+		iterator insert(const_iterator pos, T value)
+		{
+			const std::size_t index = static_cast<std::size_t>(pos - begin());
+			emplace_back(std::move(value));
+			std::rotate(begin() + index, end() - 1, end());
+			return begin() + index;
+		}
+
+		iterator erase(const_iterator pos)
+		{
+			const std::size_t index = static_cast<std::size_t>(pos - begin());
+			std::move(begin() + index + 1, end(), begin() + index);
+			pop_back();
+			return begin() + index;
+		}
+
+		/// @brief destroy every element, the heap buffer is released and the inline one used again
+		void clear()
+		{
+			Release();
+			m_data = Inline();
+			m_size = 0;
+			m_capacity = N;
+		}
+		/// @}
+
+		friend bool operator==(const Small_Vector& a, const Small_Vector& b) { return std::equal(a.begin(), a.end(), b.begin(), b.end()); }
+
+	private:
+		T* Inline() noexcept { return std::launder(reinterpret_cast<T*>(m_inline)); }
+		const T* Inline() const noexcept { return std::launder(reinterpret_cast<const T*>(m_inline)); }
+
+		void Release()
+		{
+			std::destroy(begin(), end());
+			if (!is_inline())
+				std::allocator<T>().deallocate(m_data, m_capacity);
+		}
+
+		/// @brief take the elements of ``other`` (its heap buffer or a move of its inline elements), ``other`` is left empty
+		void Steal(Small_Vector& other)
+		{
+			if (other.is_inline())
+			{
+				m_data = Inline();
+				m_capacity = N;
+				std::uninitialized_move(other.begin(), other.end(), m_data);
+				std::destroy(other.begin(), other.end());
+			}
+			else
+			{
+				m_data = other.m_data;
+				m_capacity = other.m_capacity;
+			}
+			m_size = other.m_size;
+			other.m_data = other.Inline();
+			other.m_size = 0;
+			other.m_capacity = N;
+		}
+
+		alignas(T) std::byte m_inline[sizeof(T) * N]; ///< inline buffer of ``N`` elements
+		T* m_data = Inline();                          ///< inline buffer or heap buffer
+		std::size_t m_size = 0;                        ///< number of constructed elements
+		std::size_t m_capacity = N;                    ///< number of elements ``m_data`` can hold
+	};
+} // namespace O::DCEL
+
+#endif // DCEL_SMALL_VECTOR_H
@@ -3,10 +3,10 @@
 
 // STL
 #include <vector>
-#include <unordered_map>
 #include <cstdint>
 #include <cmath>
 #include <limits>
+#include <type_traits>
 
 // CONFIGURATION
 #include "configuration/dcel.h"
@@ -14,61 +14,35 @@
 // UTILS
 #include <utils/unowned_ptr.h>
 
+// DCEL
+#include "vertex_key.h"
+#include "storage_policy.h"
+#include "feature_info.h"
+
 namespace O::DCEL
 {
 	/**
 	 * @brief Storage is structure that hold all the DCEL Information (``Vertex``, ``Half_Edge``, ``Face``).
 	 *        The class also contain look up map for fast acess to linked feature.
 	 *        We also embed a look up table that link face to their feature inside the GeoJSON it can be linked to the ``Feature_Info`` class
+	 * @tparam Policy how the elements are kept, ``Vector_Policy`` (reserved ``std::vector``, bounded by the ``max_*`` values) or ``Arena_Policy`` (chunked arena growing on demand).
+	 *                The lookups use the map of its ``Lookup`` parameter, ``Flat_Lookup`` (open addressing ``Flat_Map``, the default), ``Node_Lookup`` (``std::unordered_map``)
+	 *                or ``Star_Lookup`` (no ``edge_lookup``, half edges are searched in the outgoing edges of their origin)
 	 */
-	template<class Vertex, class Half_Edge, class Face>
+	template<class Vertex, class Half_Edge, class Face, class Policy = Vector_Policy<>>
 	struct Storage
 	{
-		private:
-
-			struct Vertex_Key {
-				int64_t qx;
-				int64_t qy;
-
-				Vertex_Key(const Vertex& vertex, const O::Configuration::DCEL& config) :
-					qx(std::llround(vertex.x / config.position_tolerance)),
-					qy(std::llround(vertex.y / config.position_tolerance))
-				{
-
-				}
-
-				Vertex_Key(double x, double y, const O::Configuration::DCEL& config) :
-					qx(std::llround(x / config.position_tolerance)),
-					qy(std::llround(y / config.position_tolerance))
-				{
-
-				}
-
-				bool operator==(Vertex_Key const& o) const noexcept
-				{
-					return qx == o.qx && qy == o.qy;
-				}
-			};
-
-			struct Vertex_Hash
-			{
-				size_t operator()(Vertex_Key const& k) const noexcept
-				{
-					uint64_t a = static_cast<uint64_t>(k.qx) * 0xbf58476d1ce4e5b9ULL;
-					uint64_t b = static_cast<uint64_t>(k.qy) * 0x94d049bb133111ebULL;
-					uint64_t h = a ^ (b + 0x9e3779b97f4a7c15ULL + (a << 6) + (a >> 2));
-					return static_cast<size_t>(h);
-				}
-			};
 		public:
 		O::Configuration::DCEL config;
-		std::vector<Vertex> vertices;      ///< List of Vertex in the DCEL
-		std::vector<Half_Edge> half_edges; ///< List of Half_Edges in the DCEL
-		std::vector<Face> faces;           ///< List of Faces in the DCEL
+		typename Policy::template Container<Vertex> vertices;      ///< List of Vertex in the DCEL
+		typename Policy::template Container<Half_Edge> half_edges; ///< List of Half_Edges in the DCEL
+		typename Policy::template Container<Face> faces;           ///< List of Faces in the DCEL
 
-		std::unordered_map<Vertex_Key, O::Unowned_Ptr<Vertex>, Vertex_Hash> vertex_lookup;               ///< Vertex::Hash -> vertex index in the Storage::vertices
-		std::unordered_map<uint64_t, O::Unowned_Ptr<Half_Edge>> edge_lookup;                 ///< half_edges::Hash -> halfedge index in the Storage::half_edges
-		std::unordered_map<size_t, std::vector<O::Unowned_Ptr<Face>>> feature_to_faces; ///< feature_Idx -> list of face indices
+		typename Policy::template Map<Vertex_Key, O::Unowned_Ptr<Vertex>, Vertex_Hash> vertex_lookup;   ///< Vertex::Hash -> vertex index in the Storage::vertices
+		[[no_unique_address]] std::conditional_t<Policy::EDGE_LOOKUP,
+			typename Policy::template Map<uint64_t, O::Unowned_Ptr<Half_Edge>>,
+			No_Edge_Lookup> edge_lookup;                                                                ///< half_edges::Hash -> halfedge index in the Storage::half_edges, empty with ``Star_Lookup``
+		typename Policy::template Map<size_t, std::vector<O::Unowned_Ptr<Face>>> feature_to_faces;      ///< feature_Idx -> list of face indices
 
 
 		/**
@@ -128,6 +102,12 @@ namespace O::DCEL
 		 */
 		void Update_Around_Vertex(const Vertex& vertex);
 
+		/**
+		 * @brief sort the outgoing edges of a vertex in one pass by the pseudo-angle of their direction, giving the order ``Insert_Edge_Sorted`` builds edge by edge
+		 * @param vertex the vertex whose outgoing edges are sorted
+		 */
+		void Sort_Around_Vertex(Vertex& vertex);
+
 		Storage() = delete;
 		Storage(const O::Configuration::DCEL& config);
 
@@ -135,6 +115,15 @@ namespace O::DCEL
 
 		Vertex_Key Key_From_Vertex(Vertex& vertex);
 
+		/**
+		 * @brief renumber the storage for traversal locality: vertices follow the Hilbert curve of their position, faces follow the reading order of ``info``
+		 *        (the outer bounds last) and the half edges are laid out cycle by cycle in the order of the faces.
+		 *        Every link, the lookups, ``feature_to_faces`` and the faces of ``info`` are updated.
+		 * @param info the ``Feature_Info`` built with this storage
+		 * @warning every pointer to an element of the storage taken before the call is invalidated
+		 */
+		void Compact_And_Reorder(Feature_Info<Face>& info);
+
 		private:
 
 			/**
@@ -156,6 +145,12 @@ namespace O::DCEL
 
 			bool Merge(Vertex& v_keep, Vertex& v_discard, Half_Edge& e_discard);
 
+			/**
+			 * @brief search the half edge ``origin_vertex -> head_vertex`` in the outgoing edges of ``origin_vertex``
+			 * @return the half edge or nullptr
+			 */
+			Half_Edge* Find_In_Star(const Vertex& origin_vertex, const Vertex& head_vertex) const;
+
 	};
 } // namespace O::DCEL
 
@@ -6,13 +6,21 @@
 #include "dcel/exception.h"
 
 //STD
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <ranges>
+#include <utility>
+#include <vector>
+
+//GEOJSON
+#include "geojson/hilbert.h"
 
 //Utils
 #include <utils/zip.h>
 
-template<class Vertex, class Half_Edge, class Face>
-O::DCEL::Storage<Vertex, Half_Edge, Face>::Storage(const O::Configuration::DCEL& config) :
+template<class Vertex, class Half_Edge, class Face, class Policy>
+O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Storage(const O::Configuration::DCEL& config) :
 	config(config),
 	vertices(),
 	half_edges(),
@@ -21,28 +29,32 @@ O::DCEL::Storage<Vertex, Half_Edge, Face>::Storage(const O::Configuration::DCEL&
 	edge_lookup(),
 	feature_to_faces()
 {
-	vertices.reserve(config.max_vertices);
-	half_edges.reserve(config.max_half_edges);
-	faces.reserve(config.max_faces);
-	vertex_lookup.reserve(config.max_vertices);
-	edge_lookup.reserve(config.max_half_edges);
-	feature_to_faces.reserve(config.max_faces);
+	if constexpr (Policy::RESERVED)
+	{
+		vertices.reserve(config.max_vertices);
+		half_edges.reserve(config.max_half_edges);
+		faces.reserve(config.max_faces);
+		vertex_lookup.reserve(config.max_vertices);
+		if constexpr (Policy::EDGE_LOOKUP)
+			edge_lookup.reserve(config.max_half_edges);
+		feature_to_faces.reserve(config.max_faces);
+	}
 }
 
-template<class Vertex, class Half_Edge, class Face>
-Vertex& O::DCEL::Storage<Vertex, Half_Edge, Face>::Get_Or_Create_Vertex(double x, double y)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+Vertex& O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Get_Or_Create_Vertex(double x, double y)
 {
 	auto key = Vertex_Key(x, y, config);
 	auto it = vertex_lookup.find(key);
 	if (it != vertex_lookup.end()) return *it->second;
-	if(vertices.size() + 1 > config.max_vertices) [[unlikely]] throw Exception{Exception::VERTICES_OVERFLOW};
+	if(Policy::RESERVED && vertices.size() + 1 > config.max_vertices) [[unlikely]] throw Exception{Exception::VERTICES_OVERFLOW};
 	vertices.emplace_back(x, y);
 	vertex_lookup.emplace(key, &vertices.back());
 	return vertices.back();
 }
 
-template<class Vertex, class Half_Edge, class Face>
-bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Does_Vertex_Exist(double x, double y)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+bool O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Does_Vertex_Exist(double x, double y)
 {
 	auto key = Vertex_Key(x, y, config);
 	auto it = vertex_lookup.find(key);
@@ -50,47 +62,72 @@ bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Does_Vertex_Exist(double x, doub
 }
 
 
-template<class Vertex, class Half_Edge, class Face>
-Half_Edge& O::DCEL::Storage<Vertex, Half_Edge, Face>::Get_Or_Create_Half_Edge(Vertex& origin,Vertex& head)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+Half_Edge& O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Get_Or_Create_Half_Edge(Vertex& origin,Vertex& head)
 {
-	uint64_t key = Half_Edge::Hash(origin, head);
-	auto it = edge_lookup.find(key);
-	if (it != edge_lookup.end()) return *it->second;
-	if(vertices.size() + 1 > config.max_half_edges) [[unlikely]] throw Exception{Exception::HALF_EDGES_OVERFLOW};
-	// create new halfedge for origin->head
-	half_edges.emplace_back(origin, head);
-	edge_lookup.emplace(key, &half_edges.back());
-
+	if constexpr (Policy::EDGE_LOOKUP)
+	{
+		uint64_t key = Half_Edge::Hash(origin, head);
+		auto it = edge_lookup.find(key);
+		if (it != edge_lookup.end()) return *it->second;
+		if(Policy::RESERVED && half_edges.size() + 1 > config.max_half_edges) [[unlikely]] throw Exception{Exception::HALF_EDGES_OVERFLOW};
+		// create new halfedge for origin->head
+		half_edges.emplace_back(origin, head);
+		edge_lookup.emplace(key, &half_edges.back());
+	}
+	else
+	{
+		if (Half_Edge* existing = Find_In_Star(origin, head)) return *existing;
+		if(Policy::RESERVED && half_edges.size() + 1 > config.max_half_edges) [[unlikely]] throw Exception{Exception::HALF_EDGES_OVERFLOW};
+		// create new halfedge for origin->head, the star of origin is its lookup
+		half_edges.emplace_back(origin, head);
+		Insert_Edge_Sorted(origin, half_edges.back());
+	}
 	return half_edges.back();
 }
 
-template<class Vertex, class Half_Edge, class Face>
-bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Does_Half_Edge_Exist(Vertex& origin_vertex, Vertex& head_vertex)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+bool O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Does_Half_Edge_Exist(Vertex& origin_vertex, Vertex& head_vertex)
 {
-	uint64_t key = Half_Edge::Hash(origin_vertex, head_vertex);
-	auto it = edge_lookup.find(key);
-	return it != edge_lookup.end();
+	if constexpr (Policy::EDGE_LOOKUP)
+	{
+		uint64_t key = Half_Edge::Hash(origin_vertex, head_vertex);
+		auto it = edge_lookup.find(key);
+		return it != edge_lookup.end();
+	}
+	else
+		return Find_In_Star(origin_vertex, head_vertex) != nullptr;
 }
 
-template<class Vertex, class Half_Edge, class Face>
-void O::DCEL::Storage<Vertex, Half_Edge, Face>::Links_twins( Half_Edge& edge, Half_Edge& twin)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+Half_Edge* O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Find_In_Star(const Vertex& origin_vertex, const Vertex& head_vertex) const
+{
+	for (auto edge : origin_vertex.outgoing_edges)
+		if (edge->head == &head_vertex)
+			return edge;
+	return nullptr;
+}
+
+template<class Vertex, class Half_Edge, class Face, class Policy>
+void O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Links_twins( Half_Edge& edge, Half_Edge& twin)
 {
 	edge.twin = &twin;
 	twin.twin = &edge;
 }
 
-template<class Vertex, class Half_Edge, class Face>
-void O::DCEL::Storage<Vertex, Half_Edge, Face>::Insert_Edge_Sorted(Vertex& vertex,Half_Edge& edge)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+void O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Insert_Edge_Sorted(Vertex& vertex,Half_Edge& edge)
 {
 	double vx = edge.head->x - vertex.x;
 	double vy = edge.head->y - vertex.y;
 
+	if (std::ranges::find(vertex.outgoing_edges, O::Unowned_Ptr<Half_Edge>(&edge)) != vertex.outgoing_edges.end())
+		return; // we already inserted this half edge in vertex
+
 	auto pos = vertex.outgoing_edges.begin();
 	for (; pos != vertex.outgoing_edges.end(); ++pos)
 	{
 		const Half_Edge& old_edge = **pos;
-		if (edge == old_edge)
-			return; // we already inserted this half edge in vertex
 		const Vertex& old_head = *old_edge.head;
 		double ox = old_head.x - vertex.x;
 		double oy = old_head.y - vertex.y;
@@ -102,8 +139,8 @@ void O::DCEL::Storage<Vertex, Half_Edge, Face>::Insert_Edge_Sorted(Vertex& verte
 	vertex.outgoing_edges.insert(pos, &edge);
 }
 
-template<class Vertex, class Half_Edge, class Face>
-void O::DCEL::Storage<Vertex, Half_Edge, Face>::Update_Around_Vertex(const Vertex& vertex)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+void O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Update_Around_Vertex(const Vertex& vertex)
 {
 	if (vertex.outgoing_edges.size() < 2) return;
 
@@ -114,12 +151,25 @@ void O::DCEL::Storage<Vertex, Half_Edge, Face>::Update_Around_Vertex(const Verte
 	}
 }
 
-template<class Vertex, class Half_Edge, class Face>
-bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Move(Vertex& vertex, double new_x, double new_y)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+void O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Sort_Around_Vertex(Vertex& vertex)
+{
+	// monotonic in the angle from the +x axis counter clockwise, in [0, 4)
+	auto pseudo_angle = [&vertex](const O::Unowned_Ptr<Half_Edge>& edge) {
+		double dx = edge->head->x - vertex.x;
+		double dy = edge->head->y - vertex.y;
+		double p = dy / (std::abs(dx) + std::abs(dy));
+		return dx < 0 ? 2 - p : (dy < 0 ? 4 + p : p);
+	};
+	std::ranges::stable_sort(vertex.outgoing_edges, {}, pseudo_angle);
+}
+
+template<class Vertex, class Half_Edge, class Face, class Policy>
+bool O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Move(Vertex& vertex, double new_x, double new_y)
 {
 	if (!Does_Vertex_Exist(new_x, new_y))
 	{
-		vertex_lookup.erase(Vertex_Key(vertex, config));
+		vertex_lookup.erase(Vertex_Key(vertex.x, vertex.y, config));
 		vertex_lookup.emplace(Vertex_Key(new_x, new_y, config),&vertex);
 		return vertex.Move(new_x, new_y);
 	}
@@ -133,7 +183,7 @@ bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Move(Vertex& vertex, double new_
 		if (&linking_half_edge < linking_half_edge.twin)
 		{
 			// tricks so we always move from the orginial edge and dcel keep its order
-			auto old_hash = Vertex_Key(vertex, config);
+			auto old_hash = Vertex_Key(vertex.x, vertex.y, config);
 			vertex.Move(new_x, new_y);
 			if (!Merge(vertex, other_vertex, *linking_half_edge.twin)) [[unlikely]] return false;
 			// check edge order with twin to always remove in the right order
@@ -155,8 +205,8 @@ bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Move(Vertex& vertex, double new_
 	}
 }
 
-template<class Vertex, class Half_Edge, class Face>
-bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Remove(Half_Edge& half_edge)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+bool O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Remove(Half_Edge& half_edge)
 {
 	if (half_edge.twin == &half_edges.back())
 	{
@@ -174,7 +224,8 @@ bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Remove(Half_Edge& half_edge)
 	auto it = std::ranges::find(half_edges.back().tail->outgoing_edges, O::Unowned_Ptr<Half_Edge>(&half_edges.back()));
 	if (it == half_edges.back().tail->outgoing_edges.end()) [[unlikely]] return false;
 	*it = half_edge.twin;
-	edge_lookup[Half_Edge::Hash(*half_edges.back().tail, *half_edges.back().head)] = half_edge.twin;
+	if constexpr (Policy::EDGE_LOOKUP)
+		edge_lookup[Half_Edge::Hash(*half_edges.back().tail, *half_edges.back().head)] = half_edge.twin;
 	std::swap(half_edges.back(), *half_edge.twin);
 	half_edges.pop_back();
 
@@ -186,7 +237,8 @@ bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Remove(Half_Edge& half_edge)
 	it = std::ranges::find(half_edges.back().tail->outgoing_edges, O::Unowned_Ptr<Half_Edge>(&half_edges.back()));
 	if (it == half_edges.back().tail->outgoing_edges.end()) [[unlikely]] return false;
 	*it = &half_edge;
-	edge_lookup[Half_Edge::Hash(*half_edges.back().tail, *half_edges.back().head)] = &half_edge;
+	if constexpr (Policy::EDGE_LOOKUP)
+		edge_lookup[Half_Edge::Hash(*half_edges.back().tail, *half_edges.back().head)] = &half_edge;
 	std::swap(half_edges.back(), half_edge);
 	half_edges.pop_back();
 
@@ -194,8 +246,8 @@ bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Remove(Half_Edge& half_edge)
 	return true;
 }
 
-template<class Vertex, class Half_Edge, class Face>
-bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Remove(Vertex& vertex)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+bool O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Remove(Vertex& vertex)
 {
 	if (&vertex == &vertices.back())
 	{
@@ -207,28 +259,34 @@ bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Remove(Vertex& vertex)
 	{
 		if(!edge || !edge->twin) [[unlikely]] return false;
 
-		edge_lookup.erase(Half_Edge::Hash(*edge->tail, *edge->head));
-		edge_lookup.emplace(Half_Edge::Hash(vertex, *edge->head), edge);
-		edge_lookup.erase(Half_Edge::Hash(*edge->head, *edge->tail));
-		edge_lookup.emplace(Half_Edge::Hash(*edge->head, vertex), edge->twin);
+		if constexpr (Policy::EDGE_LOOKUP)
+		{
+			edge_lookup.erase(Half_Edge::Hash(*edge->tail, *edge->head));
+			edge_lookup.emplace(Half_Edge::Hash(vertex, *edge->head), edge);
+			edge_lookup.erase(Half_Edge::Hash(*edge->head, *edge->tail));
+			edge_lookup.emplace(Half_Edge::Hash(*edge->head, vertex), edge->twin);
+		}
 		edge->tail = &vertex;
 		edge->twin->head = &vertex;
 	}
-	vertex_lookup[Vertex_Key(vertices.back(), config)] = &vertex;
+	vertex_lookup[Vertex_Key(vertices.back().x, vertices.back().y, config)] = &vertex;
 	std::swap(vertex, vertices.back());
 	vertices.pop_back();
 	return true;
 }
 
-template<class Vertex, class Half_Edge, class Face>
-bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Merge(Vertex& v_keep, Vertex& v_discard, Half_Edge& e_discard)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+bool O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Merge(Vertex& v_keep, Vertex& v_discard, Half_Edge& e_discard)
 {
 	if(!e_discard.prev || !e_discard.next || !e_discard.twin) [[unlikely]] return false;
 
 	//remove inside the lookup the vertex and edge
-	vertex_lookup.erase(Vertex_Key(v_discard, config));
-	edge_lookup.erase(Half_Edge::Hash(*e_discard.tail, *e_discard.head));
-	edge_lookup.erase(Half_Edge::Hash(*e_discard.head, *e_discard.tail));
+	vertex_lookup.erase(Vertex_Key(v_discard.x, v_discard.y, config));
+	if constexpr (Policy::EDGE_LOOKUP)
+	{
+		edge_lookup.erase(Half_Edge::Hash(*e_discard.tail, *e_discard.head));
+		edge_lookup.erase(Half_Edge::Hash(*e_discard.head, *e_discard.tail));
+	}
 
 	// Relink outgoing edge of v_discard to v_keep
 	auto it = std::ranges::find(v_keep.outgoing_edges, O::Unowned_Ptr<Half_Edge>(e_discard.twin));
@@ -245,15 +303,20 @@ bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Merge(Vertex& v_keep, Vertex& v_
 		if(!remaining_edge || !remaining_edge->twin) [[unlikely]] return false;
 		Insert_Edge_Sorted(v_keep, *remaining_edge);
 		// While we are here change head tail of kept edge to v_keep
-
-		edge_lookup.erase(Half_Edge::Hash(*remaining_edge->tail, *remaining_edge->head));
-		edge_lookup.erase(Half_Edge::Hash(*remaining_edge->head, *remaining_edge->tail));
+		if constexpr (Policy::EDGE_LOOKUP)
+		{
+			edge_lookup.erase(Half_Edge::Hash(*remaining_edge->tail, *remaining_edge->head));
+			edge_lookup.erase(Half_Edge::Hash(*remaining_edge->head, *remaining_edge->tail));
+		}
 
 		remaining_edge->tail = &v_keep;
 		remaining_edge->twin->head = &v_keep;
 
-		edge_lookup.emplace(Half_Edge::Hash(*remaining_edge->tail, *remaining_edge->head), remaining_edge);
-		edge_lookup.emplace(Half_Edge::Hash(*remaining_edge->head, *remaining_edge->tail), remaining_edge->twin);
+		if constexpr (Policy::EDGE_LOOKUP)
+		{
+			edge_lookup.emplace(Half_Edge::Hash(*remaining_edge->tail, *remaining_edge->head), remaining_edge);
+			edge_lookup.emplace(Half_Edge::Hash(*remaining_edge->head, *remaining_edge->tail), remaining_edge->twin);
+		}
 	}
 
 	// Relink next and prev of all edge connected to 
@@ -264,10 +327,131 @@ bool O::DCEL::Storage<Vertex, Half_Edge, Face>::Merge(Vertex& v_keep, Vertex& v_
 	return true;
 }
 
-template<class Vertex, class Half_Edge, class Face>
-O::DCEL::Storage<Vertex, Half_Edge, Face>::Vertex_Key O::DCEL::Storage<Vertex, Half_Edge, Face>::Key_From_Vertex(Vertex& vertex)
+template<class Vertex, class Half_Edge, class Face, class Policy>
+O::DCEL::Vertex_Key O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Key_From_Vertex(Vertex& vertex)
 {
-	return Vertex_Key(vertex, config);
+	return Vertex_Key(vertex.x, vertex.y, config);
+}
+
+template<class Vertex, class Half_Edge, class Face, class Policy>
+void O::DCEL::Storage<Vertex, Half_Edge, Face, Policy>::Compact_And_Reorder(Feature_Info<Face>& info)
+{
+	// vertices along the Hilbert curve of the 2^16 x 2^16 grid over their envelope
+	double min_x = std::numeric_limits<double>::infinity();
+	double min_y = std::numeric_limits<double>::infinity();
+	double max_x = -std::numeric_limits<double>::infinity();
+	double max_y = -std::numeric_limits<double>::infinity();
+	for (const Vertex& vertex : vertices)
+	{
+		min_x = std::min(min_x, vertex.x);
+		min_y = std::min(min_y, vertex.y);
+		max_x = std::max(max_x, vertex.x);
+		max_y = std::max(max_y, vertex.y);
+	}
+	const double width = max_x - min_x;
+	const double height = max_y - min_y;
+	std::vector<std::pair<std::uint32_t, Vertex*>> vertex_order;
+	vertex_order.reserve(vertices.size());
+	for (Vertex& vertex : vertices)
+	{
+		std::uint32_t x = width > 0 ? static_cast<std::uint32_t>(std::floor(O::GeoJSON::HILBERT_MAX * (vertex.x - min_x) / width)) : 0;
+		std::uint32_t y = height > 0 ? static_cast<std::uint32_t>(std::floor(O::GeoJSON::HILBERT_MAX * (vertex.y - min_y) / height)) : 0;
+		vertex_order.emplace_back(O::GeoJSON::Hilbert(x, y), &vertex);
+	}
+	std::ranges::stable_sort(vertex_order, {}, &std::pair<std::uint32_t, Vertex*>::first);
+
+	// faces of the features in reading order, then the others (outer bounds)
+	typename Policy::template Map<const Face*, std::size_t> face_index;
+	std::vector<Face*> face_order;
+	face_index.reserve(faces.size());
+	face_order.reserve(faces.size());
+	auto place_face = [&](Face& face) {
+		if (face_index.emplace(&face, face_order.size()).second)
+			face_order.emplace_back(&face);
+	};
+	for (auto& polygons : info.faces)
+		for (auto& rings : polygons)
+			for (auto& face : rings)
+				place_face(*face);
+	for (Face& face : faces)
+		place_face(face);
+
+	// half edges cycle by cycle in the face order, then the ones no face reaches
+	typename Policy::template Map<const Half_Edge*, std::size_t> edge_index;
+	std::vector<Half_Edge*> edge_order;
+	edge_index.reserve(half_edges.size());
+	edge_order.reserve(half_edges.size());
+	auto place_edge = [&](Half_Edge& half_edge) {
+		if (!edge_index.emplace(&half_edge, edge_order.size()).second)
+			return false;
+		edge_order.emplace_back(&half_edge);
+		return true;
+	};
+	for (Face* face : face_order)
+	{
+		O::Unowned_Ptr<Half_Edge> current = face->edge;
+		while (current && place_edge(*current))
+			current = current->next;
+	}
+	for (Half_Edge& half_edge : half_edges)
+		place_edge(half_edge);
+
+	// move the elements to their new place
+	typename Policy::template Container<Vertex> new_vertices;
+	typename Policy::template Container<Half_Edge> new_half_edges;
+	typename Policy::template Container<Face> new_faces;
+	new_vertices.reserve(Policy::RESERVED ? config.max_vertices : vertices.size());
+	new_half_edges.reserve(Policy::RESERVED ? config.max_half_edges : half_edges.size());
+	new_faces.reserve(Policy::RESERVED ? config.max_faces : faces.size());
+	typename Policy::template Map<const Vertex*, Vertex*> vertex_map;
+	vertex_map.reserve(vertices.size());
+	for (auto&& [key, vertex] : vertex_order)
+		vertex_map.emplace(vertex, &new_vertices.emplace_back(std::move(*vertex)));
+	for (Half_Edge* half_edge : edge_order)
+		new_half_edges.emplace_back(std::move(*half_edge));
+	for (Face* face : face_order)
+		new_faces.emplace_back(std::move(*face));
+
+	// point every link to the new places
+	auto new_vertex = [&](O::Unowned_Ptr<Vertex> vertex) -> Vertex* { return vertex ? vertex_map.find(&*vertex)->second : nullptr; };
+	auto new_edge = [&](O::Unowned_Ptr<Half_Edge> half_edge) -> Half_Edge* { return half_edge ? &new_half_edges[edge_index.find(&*half_edge)->second] : nullptr; };
+	auto new_face = [&](O::Unowned_Ptr<Face> face) -> Face* { return face ? &new_faces[face_index.find(&*face)->second] : nullptr; };
+	for (Vertex& vertex : new_vertices)
+		for (auto& half_edge : vertex.outgoing_edges)
+			half_edge = new_edge(half_edge);
+	for (Half_Edge& half_edge : new_half_edges)
+	{
+		half_edge.tail = new_vertex(half_edge.tail);
+		half_edge.head = new_vertex(half_edge.head);
+		half_edge.twin = new_edge(half_edge.twin);
+		half_edge.next = new_edge(half_edge.next);
+		half_edge.prev = new_edge(half_edge.prev);
+		half_edge.face = new_face(half_edge.face);
+	}
+	for (Face& face : new_faces)
+		face.edge = new_edge(face.edge);
+
+	for (auto& [key, vertex] : vertex_lookup)
+		vertex = new_vertex(vertex);
+	for (auto& [feature, feature_faces] : feature_to_faces)
+		for (auto& face : feature_faces)
+			face = new_face(face);
+	for (auto& polygons : info.faces)
+		for (auto& rings : polygons)
+			for (auto& face : rings)
+				face = new_face(face);
+
+	vertices = std::move(new_vertices);
+	half_edges = std::move(new_half_edges);
+	faces = std::move(new_faces);
+
+	// the half edge keys hash the vertex addresses
+	if constexpr (Policy::EDGE_LOOKUP)
+	{
+		edge_lookup.clear();
+		for (Half_Edge& half_edge : half_edges)
+			edge_lookup.emplace(Half_Edge::Hash(*half_edge.tail, *half_edge.head), &half_edge);
+	}
 }
 
 #endif //DCEL_STORAGE_HPP
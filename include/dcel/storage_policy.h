@@ -0,0 +1,83 @@
+#ifndef DCEL_STORAGE_POLICY_H
+#define DCEL_STORAGE_POLICY_H
+
+// STL
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+// DCEL
+#include "flat_map.h"
+#include "segmented_vector.h"
+
+namespace O::DCEL
+{
+	/**
+	 * @brief Lookup policy keeping the ``Storage`` lookups in ``Flat_Map``s (open addressing, entries stored inline).
+	 */
+	struct Flat_Lookup
+	{
+		template<class Key, class Value, class Hash = std::hash<Key>>
+		using Map = Flat_Map<Key, Value, Hash>;
+
+		static constexpr bool EDGE_LOOKUP = true; ///< half edges are found through ``Storage::edge_lookup``
+	};
+
+	/**
+	 * @brief Lookup policy keeping the ``Storage`` lookups in ``std::unordered_map``s (one node per entry), kept to compare with ``Flat_Lookup``.
+	 */
+	struct Node_Lookup
+	{
+		template<class Key, class Value, class Hash = std::hash<Key>>
+		using Map = std::unordered_map<Key, Value, Hash>;
+
+		static constexpr bool EDGE_LOOKUP = true; ///< half edges are found through ``Storage::edge_lookup``
+	};
+
+	/**
+	 * @brief Lookup policy without ``Storage::edge_lookup``: the half edge ``origin -> head`` is found by scanning the outgoing edges of ``origin``.
+	 *        Vertices rarely have more than a few outgoing edges so the scan is cheaper than a hash probe, and moving or merging vertices no longer rehashes their edges.
+	 *        ``Get_Or_Create_Half_Edge`` inserts the new half edge in the outgoing edges of its origin so it can be found right away.
+	 * @tparam Lookup policy of the remaining lookups (vertices and features)
+	 */
+	template<class Lookup = Flat_Lookup>
+	struct Star_Lookup : Lookup
+	{
+		static constexpr bool EDGE_LOOKUP = false; ///< half edges are found in the outgoing edges of their origin
+	};
+
+	/// @brief stands for ``Storage::edge_lookup`` when the policy has none
+	struct No_Edge_Lookup {};
+
+	/**
+	 * @brief Default ``Storage`` policy: elements live in ``std::vector``s reserved once with the ``max_*`` values of the configuration.
+	 *        Pointers stay valid because the vectors never reallocate, going over a ``max_*`` value throws the matching ``Exception``.
+	 * @tparam Lookup map used by the lookups, ``Flat_Lookup``, ``Node_Lookup`` or ``Star_Lookup``
+	 */
+	template<class Lookup = Flat_Lookup>
+	struct Vector_Policy : Lookup
+	{
+		template<class T>
+		using Container = std::vector<T>;
+
+		static constexpr bool RESERVED = true; ///< containers are reserved up front and bounded by the ``max_*`` values
+	};
+
+	/**
+	 * @brief ``Storage`` policy keeping the elements in a chunked arena (``Segmented_Vector``): the storage grows one block at a time without moving anything,
+	 *        so nothing is sized in advance, the ``max_*`` values are ignored and no overflow exception is thrown.
+	 * @tparam BLOCK_SIZE number of elements allocated at once
+	 * @tparam Lookup map used by the lookups, ``Flat_Lookup``, ``Node_Lookup`` or ``Star_Lookup``
+	 */
+	template<std::size_t BLOCK_SIZE = 4096, class Lookup = Flat_Lookup>
+	struct Arena_Policy : Lookup
+	{
+		template<class T>
+		using Container = Segmented_Vector<T, BLOCK_SIZE>;
+
+		static constexpr bool RESERVED = false; ///< containers grow on demand
+	};
+} // namespace O::DCEL
+
+#endif // DCEL_STORAGE_POLICY_H
@@ -0,0 +1,76 @@
+#ifndef DCEL_TO_TOPOJSON_H
+#define DCEL_TO_TOPOJSON_H
+
+// STL
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// DCEL
+#include "feature_info.h"
+
+// IO
+#include "io/writer.h"
+
+namespace O::DCEL::Exporter
+{
+	/**
+	 * @brief To_TopoJSON writes the features of a DCEL as a TopoJSON Topology (https://github.com/topojson/topojson-specification).
+	 *        Borders shared by adjacent features are twin half-edges, so every border is stored once as an arc and rings reference arcs by index (``~i`` when walked backward).
+	 *        Arcs are the maximal chains of half-edges between nodes, a node being a vertex whose degree is not 2. A ring touching no node is a single closed arc.
+	 */
+	template<class Vertex, class Half_Edge, class Face>
+	class To_TopoJSON
+	{
+	public:
+		static constexpr std::uint32_t DEFAULT_QUANTIZATION = 100000;
+
+		/**
+		 * @brief Arcs and arc references of the features, before quantization
+		 */
+		struct Topology
+		{
+			std::vector<std::vector<std::array<double, 2>>> arcs;                 ///< arc coordinates, every shared border once
+			std::vector<std::vector<std::vector<std::vector<std::int64_t>>>> features; ///< feature -> polygon -> ring -> arc indices (``~i`` for a reversed arc), same layout as ``Feature_Info::faces``
+			std::array<double, 4> bbox = { 0, 0, 0, 0 };                          ///< ``[minX, minY, maxX, maxY]`` of every arc
+		};
+
+		/**
+		 * @brief extract the arcs of every ring referenced by the Feature_Info
+		 * @param info the Feature_INFO
+		 * @return the topology
+		 */
+		static Topology Extract(const Feature_Info<Face>& info);
+
+		/**
+		 * @brief write the Feature_Info as a TopoJSON Topology holding one GeometryCollection
+		 *        Quantized arcs are delta encoded and a ``transform`` is written, ``quantization`` 0 writes the raw coordinates.
+		 * @param info the Feature_INFO
+		 * @param writer writer sink
+		 * @param quantization number of distinct values per axis (at least 2), 0 to disable
+		 * @param object_name name of the GeometryCollection inside ``objects``
+		 * @note feature bboxes have no TopoJSON counterpart and are dropped, the topology bbox is written instead
+		 */
+		template<class Out_Stream>
+		static void Write(const Feature_Info<Face>& info, O::GeoJSON::IO::Writer<Out_Stream>& writer, std::uint32_t quantization = DEFAULT_QUANTIZATION, std::string_view object_name = "features");
+
+	private:
+		/**
+		 * @brief split the half-edge cycle of a face in arcs, creating the arcs not seen yet
+		 * @param face the ring to split
+		 * @param arc_of first half-edge of every known arc traversal to its arc reference
+		 * @param topology receives the new arcs
+		 * @return arc references of the ring
+		 */
+		static std::vector<std::int64_t> Ring_Arcs(const Face& face, std::unordered_map<const Half_Edge*, std::int64_t>& arc_of, Topology& topology);
+
+		/// @brief tells if arcs must be split at the vertex
+		static bool Is_Node(const Vertex& vertex) { return vertex.outgoing_edges.size() != 2; }
+	};
+}
+
+#include "topojson_exporter.hpp"
+
+#endif //DCEL_TO_TOPOJSON_H
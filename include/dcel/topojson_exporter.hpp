@@ -0,0 +1,229 @@
+#ifndef DCEL_TOPOJSON_EXPORTER_HPP
+#define DCEL_TOPOJSON_EXPORTER_HPP
+
+#include "dcel/topojson_exporter.h"
+
+// STL
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+
+template<class Vertex, class Half_Edge, class Face>
+std::vector<std::int64_t> O::DCEL::Exporter::To_TopoJSON<Vertex, Half_Edge, Face>::Ring_Arcs(const Face& face, std::unordered_map<const Half_Edge*, std::int64_t>& arc_of, Topology& topology)
+{
+	std::vector<const Half_Edge*> cycle;
+	const Half_Edge* e = face.edge;
+	do {
+		cycle.push_back(e);
+		e = e->next;
+	} while (e != face.edge);
+	const std::size_t n = cycle.size();
+
+	// start on a node, a ring without node starts on its lowest vertex so that both of its sides agree on the arc start
+	std::size_t start = n;
+	for (std::size_t i = 0; i < n && start == n; ++i)
+		if (Is_Node(*cycle[i]->tail))
+			start = i;
+	const bool closed = start == n;
+	if (closed)
+	{
+		start = 0;
+		for (std::size_t i = 1; i < n; ++i)
+			if (std::tie(cycle[i]->tail->x, cycle[i]->tail->y) < std::tie(cycle[start]->tail->x, cycle[start]->tail->y))
+				start = i;
+	}
+
+	std::vector<std::int64_t> arcs;
+	for (std::size_t i = 0; i < n;)
+	{
+		std::size_t j = i;
+		while (j + 1 < n && (closed || !Is_Node(*cycle[(start + j) % n]->head)))
+			++j;
+		const Half_Edge* first = cycle[(start + i) % n];
+		const Half_Edge* last = cycle[(start + j) % n];
+
+		if (auto it = arc_of.find(first); it != arc_of.end())
+			arcs.push_back(it->second);
+		else
+		{
+			const std::int64_t arc = static_cast<std::int64_t>(topology.arcs.size());
+			auto& coordinates = topology.arcs.emplace_back();
+			coordinates.reserve(j - i + 2);
+			coordinates.push_back({ first->tail->x, first->tail->y });
+			for (std::size_t k = i; k <= j; ++k)
+			{
+				const Vertex& head = *cycle[(start + k) % n]->head;
+				coordinates.push_back({ head.x, head.y });
+			}
+			for (const auto& [x, y] : coordinates)
+			{
+				topology.bbox[0] = std::min(topology.bbox[0], x);
+				topology.bbox[1] = std::min(topology.bbox[1], y);
+				topology.bbox[2] = std::max(topology.bbox[2], x);
+				topology.bbox[3] = std::max(topology.bbox[3], y);
+			}
+			// the other side walks the same chain backward, starting with the twin of the last half-edge
+			arc_of.emplace(first, arc);
+			arc_of.emplace(static_cast<const Half_Edge*>(last->twin), ~arc);
+			arcs.push_back(arc);
+		}
+		i = j + 1;
+	}
+	return arcs;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+typename O::DCEL::Exporter::To_TopoJSON<Vertex, Half_Edge, Face>::Topology O::DCEL::Exporter::To_TopoJSON<Vertex, Half_Edge, Face>::Extract(const O::DCEL::Feature_Info<Face>& info)
+{
+	Topology topology;
+	constexpr double inf = std::numeric_limits<double>::infinity();
+	topology.bbox = { inf, inf, -inf, -inf };
+	std::unordered_map<const Half_Edge*, std::int64_t> arc_of;
+
+	topology.features.reserve(info.faces.size());
+	for (const auto& polygons_faces : info.faces)
+	{
+		auto& polygons = topology.features.emplace_back();
+		for (const auto& polygon_faces : polygons_faces)
+		{
+			auto& rings = polygons.emplace_back();
+			for (const auto& face : polygon_faces)
+				rings.push_back(Ring_Arcs(*face, arc_of, topology));
+		}
+	}
+	if (topology.arcs.empty())
+		topology.bbox = { 0, 0, 0, 0 };
+	return topology;
+}
+
+template<class Vertex, class Half_Edge, class Face>
+template<class Out_Stream>
+void O::DCEL::Exporter::To_TopoJSON<Vertex, Half_Edge, Face>::Write(const O::DCEL::Feature_Info<Face>& info, O::GeoJSON::IO::Writer<Out_Stream>& writer, std::uint32_t quantization, std::string_view object_name)
+{
+	const Topology topology = Extract(info);
+	const bool quantized = quantization != 0 && !topology.arcs.empty();
+	const auto& bbox = topology.bbox;
+	const double q = std::max<double>(quantization, 2) - 1;
+	const double kx = bbox[2] > bbox[0] ? (bbox[2] - bbox[0]) / q : 1;
+	const double ky = bbox[3] > bbox[1] ? (bbox[3] - bbox[1]) / q : 1;
+
+	writer.StartObject();
+	writer.Key("type");
+	writer.String("Topology");
+	if (!topology.arcs.empty())
+	{
+		writer.Key("bbox");
+		writer.StartArray();
+		for (double value : bbox)
+			writer.Double(value);
+		writer.EndArray();
+	}
+	if (quantized)
+	{
+		writer.Key("transform");
+		writer.StartObject();
+		writer.Key("scale");
+		writer.StartArray();
+		writer.Double(kx);
+		writer.Double(ky);
+		writer.EndArray();
+		writer.Key("translate");
+		writer.StartArray();
+		writer.Double(bbox[0]);
+		writer.Double(bbox[1]);
+		writer.EndArray();
+		writer.EndObject();
+	}
+
+	writer.Key("objects");
+	writer.StartObject();
+	writer.Key(object_name.data(), static_cast<rapidjson::SizeType>(object_name.size()));
+	writer.StartObject();
+	writer.Key("type");
+	writer.String("GeometryCollection");
+	if (info.has_root && info.root_id)
+	{
+		writer.Key("id");
+		writer.Write_Id(info.root_id);
+	}
+	writer.Key("geometries");
+	writer.StartArray();
+	for (std::size_t i = 0; i < topology.features.size(); ++i)
+	{
+		const auto& polygons = topology.features[i];
+		writer.StartObject();
+		writer.Key("type");
+		if (polygons.empty())
+			writer.Null();
+		else
+		{
+			writer.String(polygons.size() == 1 ? "Polygon" : "MultiPolygon");
+			writer.Key("arcs");
+			if (polygons.size() > 1)
+				writer.StartArray();
+			for (const auto& rings : polygons)
+			{
+				writer.StartArray();
+				for (const auto& ring : rings)
+				{
+					writer.StartArray();
+					for (std::int64_t arc : ring)
+						writer.Int64(arc);
+					writer.EndArray();
+				}
+				writer.EndArray();
+			}
+			if (polygons.size() > 1)
+				writer.EndArray();
+		}
+		if (i < info.ids.size() && info.ids[i])
+		{
+			writer.Key("id");
+			writer.Write_Id(info.ids[i]);
+		}
+		if (i < info.feature_properties.size())
+			writer.Write_Properties(info.feature_properties[i]);
+		writer.EndObject();
+	}
+	writer.EndArray();
+	writer.EndObject();
+	writer.EndObject();
+
+	writer.Key("arcs");
+	writer.StartArray();
+	for (const auto& arc : topology.arcs)
+	{
+		writer.StartArray();
+		if (quantized)
+		{
+			// quantize then delta encode, dropping the points merged by the quantization (an arc keeps at least two points)
+			std::int64_t previous_x = 0;
+			std::int64_t previous_y = 0;
+			std::size_t written = 0;
+			for (std::size_t k = 0; k < arc.size(); ++k)
+			{
+				const std::int64_t x = std::llround((arc[k][0] - bbox[0]) / kx);
+				const std::int64_t y = std::llround((arc[k][1] - bbox[1]) / ky);
+				const bool keep_last = k + 1 == arc.size() && written < 2;
+				if (written != 0 && x == previous_x && y == previous_y && !keep_last)
+					continue;
+				writer.StartArray();
+				writer.Int64(x - previous_x);
+				writer.Int64(y - previous_y);
+				writer.EndArray();
+				previous_x = x;
+				previous_y = y;
+				++written;
+			}
+		}
+		else
+			for (const auto& [x, y] : arc)
+				writer.Write_Position(O::GeoJSON::Position{ x, y });
+		writer.EndArray();
+	}
+	writer.EndArray();
+	writer.EndObject();
+}
+
+#endif //DCEL_TOPOJSON_EXPORTER_HPP
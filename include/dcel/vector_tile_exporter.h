@@ -0,0 +1,34 @@
+#ifndef DCEL_TO_VECTOR_TILER_H
+#define DCEL_TO_VECTOR_TILER_H
+
+// DCEL
+#include "exporter.h"
+#include "feature_info.h"
+
+// IO
+#include "io/vector_tile.h"
+
+namespace O::DCEL::Exporter
+{
+	/**
+	 * @brief To_Vector_Tiler feeds the features of a DCEL to a vector tiler (see ``O::GeoJSON::IO::Vector_Tiler``).
+	 *        Features are reconstructed with ``To_GeoJSON::Convert_Feature``, only their projected form is kept by the tiler.
+	 */
+	template<class Vertex, class Half_Edge, class Face>
+	class To_Vector_Tiler
+	{
+	public:
+		/**
+		 * @brief Build a vector tiler holding every feature of the DCEL Storage and Feature_Info
+		 *        The tiles are then written with ``Write_Directory``, ``Write_Archive`` or ``Generate``.
+		 * @param info the Feature_INFO
+		 * @param options tiling settings, set ``bounds`` when the DCEL is not in longitude/latitude
+		 * @return the filled tiler
+		 */
+		static O::GeoJSON::IO::Vector_Tiler Convert(const Feature_Info<Face>& info, O::GeoJSON::IO::Tiler_Options options = {});
+	};
+}
+
+#include "vector_tile_exporter.hpp"
+
+#endif // DCEL_TO_VECTOR_TILER_H
@@ -0,0 +1,18 @@
+#ifndef DCEL_VECTOR_TILE_EXPORTER_HPP
+#define DCEL_VECTOR_TILE_EXPORTER_HPP
+
+#include "dcel/vector_tile_exporter.h"
+
+// STL
+#include <utility>
+
+template<class Vertex, class Half_Edge, class Face>
+O::GeoJSON::IO::Vector_Tiler O::DCEL::Exporter::To_Vector_Tiler<Vertex, Half_Edge, Face>::Convert(const O::DCEL::Feature_Info<Face>& info, O::GeoJSON::IO::Tiler_Options options)
+{
+	O::GeoJSON::IO::Vector_Tiler tiler(std::move(options));
+	for (std::size_t i = 0; i < info.faces.size(); ++i)
+		tiler.Add_Feature(To_GeoJSON<Vertex, Half_Edge, Face>::Convert_Feature(info, i));
+	return tiler;
+}
+
+#endif //DCEL_VECTOR_TILE_EXPORTER_HPP
@@ -4,6 +4,7 @@
 // STL
 #include <vector>
 #include <cstdint>
+#include <type_traits>
 
 // UTILS
 #include <utils/unowned_ptr.h>
@@ -11,25 +12,30 @@
 // CONFIGURATION
 #include "configuration/dcel.h"
 
+// DCEL
+#include "small_vector.h"
+
 namespace O::DCEL
 {
 
 	/**
 	 * @brief Vertex represent a Point in space linked to some outgoing and ingoing half_edges.
+	 * @tparam Edge_List container of the outgoing edges, ``std::vector`` or ``Small_Vector`` to keep the first ones inline (see ``Small_Vertex``)
 	 */
-	template< class Half_Edge>
+	template<class Half_Edge, class Edge_List = std::vector<O::Unowned_Ptr<Half_Edge>>>
 	struct Vertex
 	{
 		double x = 0.0;  ///< x coordinate of the vertex (it is assumed that this value is in the same Coordinate system as the GeoJSON).
 		double y = 0.0;  ///< y coordinate of the vertex (it is assumed that this value is in the same Coordinate system as the GeoJSON).
-		std::vector<O::Unowned_Ptr<Half_Edge>> outgoing_edges; ///< ordered outgoing half edges of the vertex (hedges are ordered clockwise).
+		Edge_List outgoing_edges; ///< ordered outgoing half edges of the vertex (hedges are ordered clockwise).
 
 		Vertex(double x, double y) :
 			x(x),
 			y(y),
 			outgoing_edges()
 		{
-			outgoing_edges.reserve(2);
+			if constexpr (std::is_same_v<Edge_List, std::vector<O::Unowned_Ptr<Half_Edge>>>)
+				outgoing_edges.reserve(2);
 		}
 
 		/**
@@ -47,6 +53,10 @@ namespace O::DCEL
 		}
 	};
 
+	/// @brief ``Vertex`` keeping up to 4 outgoing edges inline, most vertices then need no heap allocation
+	template<class Half_Edge>
+	using Small_Vertex = Vertex<Half_Edge, Small_Vector<O::Unowned_Ptr<Half_Edge>, 4>>;
+
 } // namespace O::DCEL
 
 #endif // DCEL_VERTEX_H
@@ -0,0 +1,50 @@
+#ifndef DCEL_VERTEX_KEY_H
+#define DCEL_VERTEX_KEY_H
+
+// STL
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// CONFIGURATION
+#include "configuration/dcel.h"
+
+namespace O::DCEL
+{
+	/**
+	 * @brief Position of a vertex rounded on the ``position_tolerance`` grid. Two positions with the same key are the same vertex of the DCEL.
+	 */
+	struct Vertex_Key
+	{
+		int64_t qx;
+		int64_t qy;
+
+		Vertex_Key(double x, double y, const O::Configuration::DCEL& config) :
+			qx(std::llround(x / config.position_tolerance)),
+			qy(std::llround(y / config.position_tolerance))
+		{
+
+		}
+
+		bool operator==(Vertex_Key const& o) const noexcept
+		{
+			return qx == o.qx && qy == o.qy;
+		}
+	};
+
+	/**
+	 * @brief hash function of ``Vertex_Key``
+	 */
+	struct Vertex_Hash
+	{
+		size_t operator()(Vertex_Key const& k) const noexcept
+		{
+			uint64_t a = static_cast<uint64_t>(k.qx) * 0xbf58476d1ce4e5b9ULL;
+			uint64_t b = static_cast<uint64_t>(k.qy) * 0x94d049bb133111ebULL;
+			uint64_t h = a ^ (b + 0x9e3779b97f4a7c15ULL + (a << 6) + (a >> 2));
+			return static_cast<size_t>(h);
+		}
+	};
+} // namespace O::DCEL
+
+#endif // DCEL_VERTEX_KEY_H
@@ -0,0 +1,84 @@
+#ifndef FILTER_DEFERRED_FEATURE_H
+#define FILTER_DEFERRED_FEATURE_H
+
+#include <concepts>
+#include <optional>
+#include <string_view>
+
+#include "geojson/object/feature.h"
+#include "io/feature_parser.h"
+#include "io/deferred_stream.h"
+#include "filter/feature.h"
+
+namespace O::GeoJSON::Filter
+{
+	/**
+	 * @brief Feature filter that decodes geometries only for the features accepted by the predicate.
+	 *
+	 * Behavior:
+	 *  - When the ``"geometry"`` key of a feature is read, the geometry text is skipped by the ``O::GeoJSON::IO::Deferred_Stream`` and its span is kept aside. No coordinate is tokenized.
+	 *  - When parser invokes On_Full_Feature(feature), the predicate is evaluated on a feature whose geometry is not decoded yet (``feature.geometry`` is empty). Properties, id and bbox are available.
+	 *  - If predicate returns true, the kept span is decoded and the complete feature is forwarded (moved) to the Next_Handler. If false, the span is dropped without ever being decoded.
+	 *  - The geometry may appear before or after ``"properties"`` inside the feature, the decision is always taken once the whole feature has been read.
+	 *  - A geometry that fails to decode records its error (see ``Get_Error``) and aborts the parsing.
+	 *
+	 * @tparam Next_Handler: type of the next handler/sink. Must expose:
+	 *        bool On_Full_Feature(::GeoJSON::Feature&& f);
+	 *        bool On_Root(std::optional<::GeoJSON::Bbox>&& bbox, ::GeoJSON::Id&& id);
+	 *
+	 * @tparam Predicate: callable with signature bool(const ::GeoJSON::Feature&) the predicate can be default or non default constructible
+	 *
+	 * @note The filter only works with the ``O::GeoJSON::IO::Deferred_Stream`` it has been built with, and that stream must be the one given to ``rapidjson::Reader::Parse``.
+	 */
+	template <class Next_Handler, class Predicate = Default_Predicate>
+	requires std::invocable<Predicate, O::GeoJSON::Feature&>
+	class Deferred_Feature : public O::GeoJSON::IO::Feature_Parser<Deferred_Feature<Next_Handler, Predicate>>
+	{
+		using Base = O::GeoJSON::IO::Feature_Parser<Deferred_Feature<Next_Handler, Predicate>>;
+	public:
+
+		/**
+		 * @brief constructor with a default predicate
+		 * @param stream stream that will be parsed
+		 * @note only available when m_pred is default constructible
+		 */
+		Deferred_Feature(O::GeoJSON::IO::Deferred_Stream& stream) requires std::default_initializable<Predicate>;
+
+		/**
+		 * @brief Constructor with a predicate
+		 * @param stream stream that will be parsed
+		 * @param pred the predicate to use when evaluating
+		 */
+		Deferred_Feature(O::GeoJSON::IO::Deferred_Stream& stream, Predicate pred);
+
+		/// @name RapidJSON Event Overrides
+		/// @brief intercept the ``"geometry"`` key of features and stop the parsing on deferred decoding errors
+		/// @{
+		bool Key(const char* str, rapidjson::SizeType length, bool copy);
+		bool EndObject(rapidjson::SizeType element_count);
+		/// @}
+
+		/// @name overrides
+		/// @brief implementation of the ``O::GeoJSON::IO::Feature_Parser`` functions
+		/// @{
+		bool On_Full_Feature(O::GeoJSON::Feature&& feature);
+		bool On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id);
+		/// @}
+
+		/**
+		 * @brief give the filter predicator
+		 * @return the instance predicator
+		 */
+		const Predicate& Get_Predicator();
+
+	private:
+		O::GeoJSON::IO::Deferred_Stream& m_stream;           ///< stream being parsed, used to skip geometries
+		std::optional<std::string_view> m_geometry_span;    ///< raw geometry text of the feature being parsed
+		Predicate m_pred;
+	};
+
+}
+
+#include "deferred_feature.hpp"
+
+#endif // FILTER_DEFERRED_FEATURE_H
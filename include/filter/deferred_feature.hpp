@@ -0,0 +1,75 @@
+#ifndef FILTER_DEFERRED_FEATURE_HPP
+#define FILTER_DEFERRED_FEATURE_HPP
+
+#include "deferred_feature.h"
+
+#include <utility>
+
+#include "io/parser.h"
+
+template <class Next_Handler, class Predicate>
+requires std::invocable<Predicate, O::GeoJSON::Feature&>
+O::GeoJSON::Filter::Deferred_Feature<Next_Handler, Predicate>::Deferred_Feature(O::GeoJSON::IO::Deferred_Stream& stream) requires std::default_initializable<Predicate> :
+	m_stream(stream),
+	m_pred()
+{
+
+}
+
+template <class Next_Handler, class Predicate>
+requires std::invocable<Predicate, O::GeoJSON::Feature&>
+O::GeoJSON::Filter::Deferred_Feature<Next_Handler, Predicate>::Deferred_Feature(O::GeoJSON::IO::Deferred_Stream& stream, Predicate pred) :
+	m_stream(stream),
+	m_pred(std::move(pred))
+{
+
+}
+
+template <class Next_Handler, class Predicate>
+requires std::invocable<Predicate, O::GeoJSON::Feature&>
+bool O::GeoJSON::Filter::Deferred_Feature<Next_Handler, Predicate>::Key(const char* str, rapidjson::SizeType length, bool copy)
+{
+	auto state = this->Current_State();
+	if ((state == Base::Parse_State::FEATURE || state == Base::Parse_State::ROOT) && std::string_view(str, length) == "geometry")
+		m_geometry_span = m_stream.Skip_Value();
+	return Base::Key(str, length, copy);
+}
+
+template <class Next_Handler, class Predicate>
+requires std::invocable<Predicate, O::GeoJSON::Feature&>
+bool O::GeoJSON::Filter::Deferred_Feature<Next_Handler, Predicate>::EndObject(rapidjson::SizeType element_count)
+{
+	return Base::EndObject(element_count) && this->Get_Error() == O::GeoJSON::IO::Error::NO_ERROR;
+}
+
+template <class Next_Handler, class Predicate>
+requires std::invocable<Predicate, O::GeoJSON::Feature&>
+bool O::GeoJSON::Filter::Deferred_Feature<Next_Handler, Predicate>::On_Full_Feature(O::GeoJSON::Feature&& feature)
+{
+	auto span = std::exchange(m_geometry_span, std::nullopt);
+	if (!m_pred(feature)) return true;
+	if (span)
+	{
+		auto geometry = O::GeoJSON::IO::Parse_Geometry_Span(*span);
+		if (!geometry.Has_Value())
+			return this->Push_Error(geometry.Error());
+		feature.geometry = std::move(geometry.Value());
+	}
+	return static_cast<Next_Handler&>(*this).On_Full_Feature(std::move(feature));
+}
+
+template <class Next_Handler, class Predicate>
+requires std::invocable<Predicate, O::GeoJSON::Feature&>
+bool O::GeoJSON::Filter::Deferred_Feature<Next_Handler, Predicate>::On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id)
+{
+	return static_cast<Next_Handler&>(*this).On_Root(std::move(bbox), std::move(id));
+}
+
+template <class Next_Handler, class Predicate>
+requires std::invocable<Predicate, O::GeoJSON::Feature&>
+const Predicate& O::GeoJSON::Filter::Deferred_Feature<Next_Handler, Predicate>::Get_Predicator()
+{
+	return m_pred;
+}
+
+#endif // FILTER_DEFERRED_FEATURE_HPP
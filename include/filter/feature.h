@@ -23,7 +23,7 @@ namespace O::GeoJSON::Filter
 	 *
 	 * @tparam Next_Handler: type of the next handler/sink. Must expose:
 	 *        bool On_Full_Feature(::GeoJSON::Feature&& f);
-	 *        bool On_Root(std::optional<::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id);
+	 *        bool On_Root(std::optional<::GeoJSON::Bbox>&& bbox, ::GeoJSON::Id&& id);
 	 * 
 	 * @tparam Predicate: callable with signature bool(const ::GeoJSON::Feature&) the predicate can be default or non default constructible
 	 *
@@ -55,7 +55,7 @@ namespace O::GeoJSON::Filter
 		/// @brief implementation of the ``O::GeoJSON::IO::Feature_Parser`` functions
 		/// @{
 		bool On_Full_Feature(O::GeoJSON::Feature&& feature);
-		bool On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id);
+		bool On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id);
 		/// @}
 
 		/**
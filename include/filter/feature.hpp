@@ -21,7 +21,7 @@ bool O::GeoJSON::Filter::Feature<Next_Handler, Predicate>::On_Full_Feature(O::Ge
 
 template <class Next_Handler, class Predicate>
 requires std::invocable<Predicate, O::GeoJSON::Feature&>
-bool O::GeoJSON::Filter::Feature<Next_Handler, Predicate>::On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id)
+bool O::GeoJSON::Filter::Feature<Next_Handler, Predicate>::On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id)
 {
 	return static_cast<Next_Handler&>(*this).On_Root(std::move(bbox), std::move(id));
 }
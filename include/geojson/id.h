@@ -0,0 +1,142 @@
+#ifndef GEOJSON_ID_H
+#define GEOJSON_ID_H
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+namespace O::GeoJSON
+{
+	/**
+	 * @brief Owned string of an ``Id``.
+	 *        Strings up to ``INLINE_SIZE`` bytes are stored inline, longer ones in an immutable heap copy shared by the copies of the id and released with the last of them.
+	 *        Nothing is shared between unrelated ids, so no global table grows with the input and no lock is taken.
+	 */
+	class Id_String
+	{
+	public:
+		static constexpr std::size_t INLINE_SIZE = 15;
+
+		Id_String(std::string_view str)
+		{
+			if (str.size() <= INLINE_SIZE)
+			{
+				std::array<char, INLINE_SIZE + 1> buffer{};
+				std::copy(str.begin(), str.end(), buffer.begin());
+				buffer[INLINE_SIZE] = static_cast<char>(str.size());
+				m_value = buffer;
+			}
+			else
+				m_value = std::make_shared<const std::string>(str);
+		}
+
+		/// @brief true when the string is stored inline
+		bool Is_Inline() const noexcept { return std::holds_alternative<std::array<char, INLINE_SIZE + 1>>(m_value); }
+
+		std::string_view View() const noexcept
+		{
+			if (const auto* buffer = std::get_if<std::array<char, INLINE_SIZE + 1>>(&m_value))
+				return std::string_view(buffer->data(), static_cast<std::size_t>((*buffer)[INLINE_SIZE]));
+			return *std::get<std::shared_ptr<const std::string>>(m_value);
+		}
+
+		friend bool operator==(const Id_String& lhs, const Id_String& rhs) noexcept { return lhs.View() == rhs.View(); }
+
+	private:
+		std::variant<std::array<char, INLINE_SIZE + 1>, std::shared_ptr<const std::string>> m_value;
+	};
+
+	/**
+	 * @brief Compact identifier of a GeoJSON Feature or FeatureCollection.
+	 *        An id is either absent, an integer, a non integral number or a string (see ``Id_String``), strings longer than ``Id_String::INLINE_SIZE`` are the only ids allocating.
+	 *        Integral numbers are always stored as integers, so ``12`` and ``12.0`` are the same id.
+	 *
+	 * @see RFC 7946 §3.2 — "id" is either a JSON string or number
+	 */
+	class Id
+	{
+	public:
+		/// @brief build an absent id
+		Id() = default;
+		Id(std::int64_t value) : m_value(value) {}
+		Id(int value) : m_value(static_cast<std::int64_t>(value)) {}
+		Id(double value)
+		{
+			if (std::trunc(value) == value && value >= -9223372036854775808.0 && value < 9223372036854775808.0)
+				m_value = static_cast<std::int64_t>(value);
+			else
+				m_value = value;
+		}
+		Id(std::string_view value) : m_value(Id_String(value)) {}
+		Id(const std::string& value) : Id(std::string_view(value)) {}
+		Id(const char* value) : Id(std::string_view(value)) {}
+
+		/** @name Type Queries
+		 *  @{
+		 */
+		bool Has_Value()  const noexcept { return !std::holds_alternative<std::monostate>(m_value); }
+		bool Is_Integer() const noexcept { return std::holds_alternative<std::int64_t>(m_value); }
+		bool Is_Double()  const noexcept { return std::holds_alternative<double>(m_value); }
+		bool Is_String()  const noexcept { return std::holds_alternative<Id_String>(m_value); }
+		explicit operator bool() const noexcept { return Has_Value(); }
+		/** @} */
+
+		/** @name Accessors
+		 *  @{
+		 */
+		std::int64_t Get_Integer()    const noexcept { return std::get<std::int64_t>(m_value); }
+		double Get_Double()           const noexcept { return std::get<double>(m_value); }
+		std::string_view Get_String() const noexcept { return std::get<Id_String>(m_value).View(); }
+		/** @} */
+
+		/**
+		 * @brief textual form of the id
+		 * @return the string itself, the decimal form of a number, or an empty string when absent
+		 */
+		std::string To_String() const
+		{
+			if (Is_Integer()) return std::to_string(Get_Integer());
+			if (Is_String())  return std::string(Get_String());
+			if (Is_Double())
+			{
+				char buffer[32];
+				auto result = std::to_chars(buffer, buffer + sizeof(buffer), Get_Double());
+				return std::string(buffer, result.ptr);
+			}
+			return std::string();
+		}
+
+		/// @brief hash of the id (strings hash by content)
+		std::size_t Hash() const noexcept
+		{
+			return std::visit([](const auto& value) -> std::size_t
+			{
+				using T = std::decay_t<decltype(value)>;
+				if constexpr (std::is_same_v<T, std::monostate>) return 0;
+				else if constexpr (std::is_same_v<T, Id_String>) return std::hash<std::string_view>{}(value.View());
+				else return std::hash<T>{}(value);
+			}, m_value);
+		}
+
+		friend bool operator==(const Id& lhs, const Id& rhs) noexcept { return lhs.m_value == rhs.m_value; }
+
+	private:
+		std::variant<std::monostate, std::int64_t, double, Id_String> m_value;
+	};
+}
+
+template<>
+struct std::hash<O::GeoJSON::Id>
+{
+	std::size_t operator()(const O::GeoJSON::Id& id) const noexcept { return id.Hash(); }
+};
+
+#endif // GEOJSON_ID_H
@@ -7,6 +7,7 @@
 #include "geometry.h"
 #include "geojson/properties.h"
 #include "geojson/bbox.h"
+#include "geojson/id.h"
 
 namespace O::GeoJSON
 {
@@ -44,7 +45,7 @@ namespace O::GeoJSON
 		Property properties;
 
 		/// Optional unique identifier of the feature.
-		std::optional<std::string> id;
+		Id id;
 
 		/// Optional bounding box for this feature.
 		std::optional<Bbox> bbox;
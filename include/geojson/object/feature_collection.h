@@ -2,10 +2,12 @@
 #define GEOJSON_FEATURE_COLLECTION_H
 
 #include <vector>
+#include <unordered_map>
 #include <optional>
 #include <string>
 #include "feature.h"
 #include "geojson/bbox.h"
+#include "geojson/id.h"
 
 namespace O::GeoJSON
 {
@@ -45,7 +47,22 @@ namespace O::GeoJSON
 		std::optional<Bbox> bbox;
 
 		/// Optional unique identifier for the collection.
-		std::optional<std::string> id;
+		Id id;
+
+		/**
+		 * @brief build a hash index from feature id to feature position inside ``features``
+		 * @return map from id to index, features without id are skipped and the first feature wins on duplicated ids
+		 * @note the index is a snapshot, rebuild it after modifying ``features``
+		 */
+		std::unordered_map<Id, std::size_t> Create_Id_Index() const
+		{
+			std::unordered_map<Id, std::size_t> index;
+			index.reserve(features.size());
+			for (std::size_t i = 0; i < features.size(); ++i)
+				if (features[i].id)
+					index.emplace(features[i].id, i);
+			return index;
+		}
 	};
 }
 
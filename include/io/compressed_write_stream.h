@@ -0,0 +1,103 @@
+#ifndef IO_COMPRESSED_WRITE_STREAM_H
+#define IO_COMPRESSED_WRITE_STREAM_H
+
+// STL
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+// UTILS
+#include <utils/expected.h>
+
+// IO
+#include "io/error.h"
+
+namespace O::GeoJSON::IO
+{
+	/**
+	 * @brief compression formats of ``Compressed_Write_Stream``
+	 */
+	enum class Compression
+	{
+		GZIP, ///< single gzip member, available when built with zlib (``OGEOFLOW_HAS_ZLIB``)
+		ZSTD  ///< sequence of zstd frames, available when built with zstd (``OGEOFLOW_HAS_ZSTD``)
+	};
+
+	/**
+	 * @brief ``rapidjson`` output stream compressing on background threads.
+	 *        The serializer fills fixed size blocks taken from a ring of ``2 * thread_count + 1`` buffers, full blocks are compressed independently by ``thread_count`` workers (pigz style),
+	 *        and the compressed blocks are written in order to an ``O::GeoJSON::IO::Fd_Write_Stream`` by the serializing thread when it recycles their buffer.
+	 *        - gzip: every block is a raw deflate segment ended by a sync flush, the last one by the final block, so the file is one standard gzip member. CRCs are combined in order.
+	 *        - zstd: every block is an independent frame, concatenated frames are a valid zstd stream.
+	 *        The stream is move-only and closes the file when destroyed.
+	 * @note Flush does nothing: a block is only compressed once full, or by Close.
+	 */
+	class Compressed_Write_Stream
+	{
+	public:
+		typedef char Ch;
+
+		static constexpr std::size_t DEFAULT_BLOCK_SIZE = std::size_t(1) << 20; ///< uncompressed bytes per block (1 MiB)
+
+		/**
+		 * @brief create (or truncate) the given compressed file
+		 * @param path file to write
+		 * @param compression output format
+		 * @param level compression level, negative for the codec default
+		 * @param thread_count number of compression threads, 0 for ``std::thread::hardware_concurrency``
+		 * @param block_size uncompressed bytes per block
+		 * @return the stream, ``COMPRESSION_UNAVAILABLE`` if the format was not built in, ``FILE_OPENNING_FAILED`` or ``COMPRESSION_FAILED``
+		 */
+		static O::Expected<Compressed_Write_Stream, Error> Open(const std::filesystem::path& path, Compression compression, int level = -1, std::size_t thread_count = 1, std::size_t block_size = DEFAULT_BLOCK_SIZE);
+
+		/// @brief tells if the given format has been built in
+		static bool Is_Available(Compression compression) noexcept;
+
+		/// @brief build a closed stream
+		Compressed_Write_Stream();
+		Compressed_Write_Stream(Compressed_Write_Stream&& other) noexcept;
+		Compressed_Write_Stream& operator=(Compressed_Write_Stream&& other) noexcept;
+		Compressed_Write_Stream(const Compressed_Write_Stream&) = delete;
+		Compressed_Write_Stream& operator=(const Compressed_Write_Stream&) = delete;
+		~Compressed_Write_Stream();
+
+		/// @name RapidJSON output stream concept
+		/// @{
+		void Put(Ch c)
+		{
+			if (m_cursor == m_end)
+				Submit_Block(false);
+			*m_cursor++ = c;
+		}
+		void Flush() {}
+		/// @}
+
+		/**
+		 * @brief compress the pending bytes, write the format trailer and close the file
+		 * @return ``NO_ERROR`` or the first compression or write error
+		 */
+		Error Close();
+
+		/// @brief first compression or write error, ``NO_ERROR`` if none
+		Error Get_Error() const noexcept;
+
+		/// @brief number of uncompressed bytes given to the stream so far
+		std::uint64_t Tell() const noexcept;
+
+	private:
+		struct Pipeline;
+
+		/**
+		 * @brief hand the current block to the workers and take the next free buffer
+		 * @param last the block is the final one of the stream
+		 */
+		void Submit_Block(bool last);
+
+		std::unique_ptr<Pipeline> m_pipeline; ///< workers, block ring and output file
+		char* m_cursor = nullptr;             ///< next byte to fill in the current block
+		char* m_end = nullptr;                ///< end of the current block
+	};
+}
+
+#endif //IO_COMPRESSED_WRITE_STREAM_H
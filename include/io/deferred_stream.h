@@ -0,0 +1,66 @@
+#ifndef IO_DEFERRED_STREAM_H
+#define IO_DEFERRED_STREAM_H
+
+// STL
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace O::GeoJSON::IO
+{
+	/**
+	 * @brief In-memory ``rapidjson`` input stream able to jump over a JSON value without tokenizing it.
+	 *        When ``Skip_Value`` is called right after a key has been read, the stream scans the raw bytes of the upcoming object or array (only braces and strings are tracked, numbers are never converted),
+	 *        records their span and hands ``:null`` to the reader instead. The SAX handler therefore sees a ``null`` value while the skipped text stays available for a later decoding.
+	 * @note The buffer is not copied. It must outlive the stream and every span given back by ``Skip_Value``.
+	 * @warning The stream must be passed by reference to ``rapidjson::Reader::Parse`` (no ``StreamTraits`` copy optimization) so that the handler can drive it while parsing.
+	 */
+	class Deferred_Stream
+	{
+	public:
+		typedef char Ch;
+
+		/**
+		 * @param buffer whole JSON text to read
+		 */
+		Deferred_Stream(std::string_view buffer);
+
+		/// @name RapidJSON input stream concept
+		/// @{
+		Ch Peek() const
+		{
+			if (m_injected) [[unlikely]]
+				return *m_injected;
+			return m_current == m_end ? '\0' : *m_current;
+		}
+
+		Ch Take()
+		{
+			if (m_injected) [[unlikely]]
+			{
+				Ch c = *m_injected++;
+				if (*m_injected == '\0')
+					m_injected = nullptr;
+				return c;
+			}
+			return m_current == m_end ? '\0' : *m_current++;
+		}
+
+		std::size_t Tell() const { return static_cast<std::size_t>(m_current - m_begin); }
+		/// @}
+
+		/**
+		 * @brief Skip the value following the key that was just read.
+		 * @return the raw text of the skipped object or array, std::nullopt if nothing was skipped (scalar value or malformed input, the reader will then process it normally)
+		 */
+		std::optional<std::string_view> Skip_Value();
+
+	private:
+		const Ch* m_begin;              ///< start of the buffer
+		const Ch* m_current;            ///< reading position inside the buffer
+		const Ch* m_end;                ///< end of the buffer
+		const Ch* m_injected = nullptr; ///< replacement text handed to the reader before resuming at ``m_current``
+	};
+}
+
+#endif //IO_DEFERRED_STREAM_H
@@ -32,6 +32,18 @@ namespace O::GeoJSON::IO
 		RECURSIVE_GEMETRY_COLLECTION_UNSUPPORTED,
 		UNKNOWN_ROOT_OBJECT,
 		GEOMETRY_COLLECTION_ELLEMENT_COUNT_MISMATCH,
+		GEOMETRY_TYPE_DISABLED_BY_POLICY,
+		INVALID_INDEX_FILE,
+		FEATURE_INDEX_OUT_OF_RANGE,
+		FILE_WRITE_FAILED,
+		COMPRESSION_UNAVAILABLE,
+		COMPRESSION_FAILED,
+		INVALID_FLAT_GEOBUF,
+		INVALID_WKB,
+		INVALID_TILE_ARCHIVE,
+		INVALID_SNAPSHOT,
+		HANDLER_ABORTED,
+		TOO_MANY_PROPERTY_COLUMNS,
 	};
 }
 
@@ -0,0 +1,108 @@
+#ifndef IO_FD_WRITE_STREAM_H
+#define IO_FD_WRITE_STREAM_H
+
+// STL
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+// UTILS
+#include <utils/expected.h>
+
+// IO
+#include "io/error.h"
+
+namespace O::GeoJSON::IO
+{
+	/**
+	 * @brief ``rapidjson`` output stream writing straight to a file descriptor in large blocks.
+	 *        Bytes are gathered in one aligned buffer (8 MiB by default) and handed to ``write`` a whole block at a time, no ``FILE``, ``std::ostream``, locale or virtual call is involved.
+	 *        With ``direct_io`` the file is opened with ``O_DIRECT`` (``F_NOCACHE`` on macOS) so the output bypasses the page cache, the unaligned tail is written once direct I/O is turned off by ``Close``.
+	 *        The stream is move-only and closes the file when destroyed.
+	 * @note a failed write is kept in ``Get_Error`` and every following byte is dropped, bytes given to a closed or moved-from stream are dropped with ``FILE_WRITE_FAILED``.
+	 */
+	class Fd_Write_Stream
+	{
+	public:
+		typedef char Ch;
+
+		static constexpr std::size_t DEFAULT_BUFFER_SIZE = std::size_t(8) << 20; ///< default block size (8 MiB)
+		static constexpr std::size_t ALIGNMENT = 4096;                           ///< buffer and block alignment required by direct I/O
+
+		/**
+		 * @brief create (or truncate) the given file
+		 * @param path file to write
+		 * @param direct_io bypass the page cache, silently ignored when the file system or platform does not support it
+		 * @param buffer_size block size, rounded up to a multiple of ALIGNMENT
+		 * @return the stream or ``FILE_OPENNING_FAILED``
+		 */
+		static O::Expected<Fd_Write_Stream, Error> Open(const std::filesystem::path& path, bool direct_io = false, std::size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+		/// @brief build a closed stream
+		Fd_Write_Stream() = default;
+		Fd_Write_Stream(Fd_Write_Stream&& other) noexcept;
+		Fd_Write_Stream& operator=(Fd_Write_Stream&& other) noexcept;
+		Fd_Write_Stream(const Fd_Write_Stream&) = delete;
+		Fd_Write_Stream& operator=(const Fd_Write_Stream&) = delete;
+		~Fd_Write_Stream();
+
+		/// @name RapidJSON output stream concept
+		/// @{
+		void Put(Ch c)
+		{
+			if (m_cursor == m_end && !Make_Room())
+				return;
+			*m_cursor++ = c;
+		}
+		void Flush();
+		/// @}
+
+		/**
+		 * @brief append a whole range of bytes
+		 * @param data first byte
+		 * @param size number of bytes
+		 */
+		void Write(const Ch* data, std::size_t size);
+
+		/**
+		 * @brief write every buffered byte and close the file
+		 * @return ``NO_ERROR`` or ``FILE_WRITE_FAILED`` if any write failed
+		 */
+		Error Close();
+
+		/// @brief first write error, ``NO_ERROR`` if none
+		Error Get_Error() const noexcept { return m_error; }
+
+		/// @brief number of bytes given to the stream so far
+		std::uint64_t Tell() const noexcept { return m_written + static_cast<std::uint64_t>(m_cursor - m_buffer); }
+
+		/// @brief tells if the file really is written with direct I/O
+		bool Is_Direct() const noexcept { return m_direct; }
+
+	private:
+		/**
+		 * @brief empty the full buffer
+		 * @return false when the stream has no buffer (closed or moved-from), ``FILE_WRITE_FAILED`` is then recorded
+		 */
+		bool Make_Room();
+
+		/**
+		 * @brief write the first bytes of the buffer and move the remaining ones to its front
+		 * @param size number of bytes to write, a multiple of ALIGNMENT in direct mode (except on close)
+		 */
+		void Write_Block(std::size_t size);
+
+		/// @brief free the buffer and close the file without flushing
+		void Release() noexcept;
+
+		int m_fd = -1;                     ///< file descriptor, -1 when closed
+		bool m_direct = false;             ///< direct I/O is active on m_fd
+		char* m_buffer = nullptr;          ///< aligned block buffer
+		char* m_cursor = nullptr;          ///< next byte to fill
+		char* m_end = nullptr;             ///< end of the buffer
+		std::uint64_t m_written = 0;       ///< bytes already written to the file
+		Error m_error = Error::NO_ERROR;   ///< first write error
+	};
+}
+
+#endif //IO_FD_WRITE_STREAM_H
@@ -0,0 +1,144 @@
+#ifndef IO_FEATURE_INDEX_H
+#define IO_FEATURE_INDEX_H
+
+// STL
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// UTILS
+#include <utils/expected.h>
+
+// IO
+#include "io/error.h"
+#include "io/mapped_file.h"
+
+namespace O::GeoJSON::IO
+{
+	/**
+	 * @brief Location and envelope of one feature inside a GeoJSON FeatureCollection file.
+	 */
+	struct Feature_Index_Entry
+	{
+		std::uint64_t offset;           ///< byte offset of the feature object (its opening brace) inside the file
+		std::uint64_t length;           ///< byte length of the feature object
+		std::array<double, 4> envelope; ///< ``[minX, minY, maxX, maxY]`` of the geometry, inverted (min > max) when the feature has no geometry
+		std::uint64_t id_hash;          ///< ``Feature_Index::Hash_Id`` of the feature id, 0 when the feature has none
+	};
+
+	/**
+	 * @brief Sidecar index of a GeoJSON FeatureCollection file.
+	 *        The index is built with a single scan of the file and can be saved next to it, so that later extractions only read the selected features (see ``Indexed_Reader``).
+	 *
+	 * Sidecar binary layout (native endianness):
+	 *   - ``"OGFI"`` magic, ``uint32`` version, ``uint64`` size of the indexed file, ``uint64`` feature count
+	 *   - one ``Feature_Index_Entry`` per feature, in document order
+	 */
+	class Feature_Index
+	{
+	public:
+		/**
+		 * @brief scan a GeoJSON FeatureCollection file and index every feature
+		 * @param geojson_file file to index
+		 * @return the index or the error encountered while parsing (``UNKNOWN_ROOT_OBJECT`` if the root is not a FeatureCollection)
+		 */
+		static O::Expected<Feature_Index, Error> Build(const std::filesystem::path& geojson_file);
+
+		/**
+		 * @brief read a sidecar index written by ``Save``
+		 * @param index_file sidecar file
+		 * @return the index, ``FILE_OPENNING_FAILED`` or ``INVALID_INDEX_FILE`` (also when the feature count does not fit in the file)
+		 */
+		static O::Expected<Feature_Index, Error> Load(const std::filesystem::path& index_file);
+
+		/**
+		 * @brief write the index as a sidecar file
+		 * @param index_file destination
+		 * @return ``NO_ERROR`` or ``FILE_OPENNING_FAILED``
+		 */
+		Error Save(const std::filesystem::path& index_file) const;
+
+		/// @brief FNV-1a hash used for ``Feature_Index_Entry::id_hash`` (never 0)
+		static std::uint64_t Hash_Id(std::string_view id);
+
+		/// @name Accessors
+		/// @{
+		std::size_t Size() const { return m_entries.size(); }
+		std::uint64_t Get_Source_Size() const { return m_source_size; }
+		const Feature_Index_Entry& operator[](std::size_t i) const { return m_entries[i]; }
+		const std::vector<Feature_Index_Entry>& Get_Entries() const { return m_entries; }
+		/// @}
+
+		/**
+		 * @brief find the features whose envelope intersects the given box
+		 * @param bbox ``[minX, minY, maxX, maxY]``
+		 * @return feature indices in document order
+		 */
+		std::vector<std::size_t> Query(const std::array<double, 4>& bbox) const;
+
+		/**
+		 * @brief find the features whose id hash matches the given id
+		 * @param id feature id
+		 * @return candidate feature indices in document order (hash collisions are possible, check the parsed id)
+		 */
+		std::vector<std::size_t> Find(std::string_view id) const;
+
+	private:
+		std::vector<Feature_Index_Entry> m_entries; ///< one entry per feature
+		std::uint64_t m_source_size = 0;            ///< size of the indexed file, used to detect stale sidecars
+	};
+
+	/**
+	 * @brief Random access to the features of a memory-mapped GeoJSON file through its ``Feature_Index``.
+	 *        The selected features are handed to a ``SAX_Parser`` based handler as a ``FeatureCollection`` holding only them, so a ``Feature_Parser`` receives ``On_Full_Feature`` for each selected feature then ``On_Root``.
+	 */
+	class Indexed_Reader
+	{
+	public:
+		/**
+		 * @brief map a GeoJSON file and attach its index
+		 * @param geojson_file indexed file
+		 * @param index index of the file
+		 * @return the reader, ``FILE_OPENNING_FAILED`` or ``INVALID_INDEX_FILE`` when the index does not match the file
+		 */
+		static O::Expected<Indexed_Reader, Error> Open(const std::filesystem::path& geojson_file, Feature_Index index);
+
+		/// @brief give back the index of the reader
+		const Feature_Index& Get_Index() const { return m_index; }
+
+		/// @brief raw text of the i-th feature
+		std::string_view Feature_Text(std::size_t i) const;
+
+		/// @name Parse functions
+		/// @brief parse a selection of features with the given handler
+		/// @return ``NO_ERROR``, ``FEATURE_INDEX_OUT_OF_RANGE``, the handler error or ``PARSING_ERROR``
+		/// @{
+		template<class Handler>
+		Error Parse_Feature(std::size_t i, Handler& handler) const;
+
+		template<class Handler>
+		Error Parse_Range(std::size_t first, std::size_t last, Handler& handler) const;
+
+		template<class Handler>
+		Error Parse_Features(std::span<const std::size_t> indices, Handler& handler) const;
+
+		template<class Handler>
+		Error Parse_Bbox(const std::array<double, 4>& bbox, Handler& handler) const;
+		/// @}
+
+	private:
+		/// @brief run the handler over the pieces wrapped inside a FeatureCollection
+		template<class Handler>
+		Error Parse_Pieces(std::vector<std::string_view>& pieces, Handler& handler) const;
+
+		Mapped_File m_file;    ///< mapped GeoJSON file
+		Feature_Index m_index; ///< index of the mapped file
+	};
+}
+
+#include "feature_index.hpp"
+
+#endif //IO_FEATURE_INDEX_H
@@ -0,0 +1,72 @@
+#ifndef IO_FEATURE_INDEX_HPP
+#define IO_FEATURE_INDEX_HPP
+
+#include "io/feature_index.h"
+#include "io/piece_stream.h"
+
+#include <rapidjson/reader.h>
+
+template<class Handler>
+O::GeoJSON::IO::Error O::GeoJSON::IO::Indexed_Reader::Parse_Feature(std::size_t i, Handler& handler) const
+{
+	return Parse_Range(i, i + 1, handler);
+}
+
+template<class Handler>
+O::GeoJSON::IO::Error O::GeoJSON::IO::Indexed_Reader::Parse_Range(std::size_t first, std::size_t last, Handler& handler) const
+{
+	if (first > last || last > m_index.Size())
+		return Error::FEATURE_INDEX_OUT_OF_RANGE;
+	std::vector<std::string_view> pieces;
+	if (first != last)
+	{
+		// consecutive features are contiguous in the file, only separated by commas and whitespaces
+		const auto& front = m_index[first];
+		const auto& back = m_index[last - 1];
+		pieces.emplace_back(m_file.View().substr(front.offset, back.offset + back.length - front.offset));
+	}
+	return Parse_Pieces(pieces, handler);
+}
+
+template<class Handler>
+O::GeoJSON::IO::Error O::GeoJSON::IO::Indexed_Reader::Parse_Features(std::span<const std::size_t> indices, Handler& handler) const
+{
+	std::vector<std::string_view> pieces;
+	pieces.reserve(indices.size() * 2);
+	for (std::size_t i : indices)
+	{
+		if (i >= m_index.Size())
+			return Error::FEATURE_INDEX_OUT_OF_RANGE;
+		if (!pieces.empty())
+			pieces.emplace_back(",");
+		pieces.emplace_back(Feature_Text(i));
+	}
+	return Parse_Pieces(pieces, handler);
+}
+
+template<class Handler>
+O::GeoJSON::IO::Error O::GeoJSON::IO::Indexed_Reader::Parse_Bbox(const std::array<double, 4>& bbox, Handler& handler) const
+{
+	auto indices = m_index.Query(bbox);
+	return Parse_Features(indices, handler);
+}
+
+template<class Handler>
+O::GeoJSON::IO::Error O::GeoJSON::IO::Indexed_Reader::Parse_Pieces(std::vector<std::string_view>& pieces, Handler& handler) const
+{
+	pieces.insert(pieces.begin(), R"({"type":"FeatureCollection","features":[)");
+	pieces.emplace_back("]}");
+	Piece_Stream stream(std::move(pieces));
+	rapidjson::Reader reader;
+
+	if (!reader.Parse(stream, handler))
+	{
+		if (handler.Get_Error() != Error::NO_ERROR)
+			return handler.Get_Error();
+		else
+			return Error::PARSING_ERROR;
+	}
+	return Error::NO_ERROR;
+}
+
+#endif //IO_FEATURE_INDEX_HPP
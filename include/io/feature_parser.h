@@ -14,9 +14,10 @@ namespace O::GeoJSON::IO
 	 *          - Root entry point with optional bbox/id
 	 * Derived classes can override these methods to implement custom business logic (indexing, validation, transformation, storage, etc).
 	 * @tparam Derived The CRTP derived class that implements the handlers.
+	 * @tparam Policy Compile-time capabilities forwarded to the underlying ``SAX_Parser``.
 	 */
-	template <class Derived>
-	class Feature_Parser : public SAX_Parser<Feature_Parser<Derived>>
+	template <class Derived, Parser_Policy Policy = Default_Policy>
+	class Feature_Parser : public SAX_Parser<Feature_Parser<Derived, Policy>, Policy>
 	{
 	public:
 
@@ -35,14 +36,14 @@ namespace O::GeoJSON::IO
 		 * @param id Optional identifier string.
 		 * @return true if parsing should continue, false to abort.
 		 */
-		bool On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id);
+		bool On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id);
 		
 		/// @name CRTP implementation
 		/// @brief Implementation of the Base SAX parser
 		/// @{
 		bool On_Geometry(O::GeoJSON::Geometry&& geometry, std::size_t element_number);
 		bool On_Feature(O::GeoJSON::Feature&& feature);
-		bool On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id);
+		bool On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id);
 		/// @}
 
 	private:
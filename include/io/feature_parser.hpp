@@ -7,25 +7,25 @@
 #include <memory>
 #include <cassert>
 
-template <class Derived>
-bool O::GeoJSON::IO::Feature_Parser<Derived>::On_Full_Feature(O::GeoJSON::Feature&& feature) 
+template <class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::Feature_Parser<Derived, Policy>::On_Full_Feature(O::GeoJSON::Feature&& feature) 
 {
 	return static_cast<Derived&>(*this).On_Full_Feature(std::move(feature));
 }
 
-template <class Derived>
-bool O::GeoJSON::IO::Feature_Parser<Derived>::On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id) 
+template <class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::Feature_Parser<Derived, Policy>::On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id) 
 {
 	return static_cast<Derived&>(*this).On_Root(std::move(bbox), std::move(id));
 }
 
-template <class Derived>
-bool O::GeoJSON::IO::Feature_Parser<Derived>::On_Geometry(O::GeoJSON::Geometry&& geometry, std::size_t element_number)
+template <class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::Feature_Parser<Derived, Policy>::On_Geometry(O::GeoJSON::Geometry&& geometry, std::size_t element_number)
 {
 	if(geometry.Is_Geometry_Collection() && element_number > 0)
 	{
 		O::GeoJSON::Geometry_Collection collection;
-		if(m_geometries.size() < element_number) return  O::GeoJSON::IO::SAX_Parser<O::GeoJSON::IO::Feature_Parser<Derived>>::Push_Error(O::GeoJSON::IO::Error::GEOMETRY_COLLECTION_ELLEMENT_COUNT_MISMATCH);
+		if(m_geometries.size() < element_number) return  O::GeoJSON::IO::SAX_Parser<O::GeoJSON::IO::Feature_Parser<Derived, Policy>, Policy>::Push_Error(O::GeoJSON::IO::Error::GEOMETRY_COLLECTION_ELLEMENT_COUNT_MISMATCH);
 		for (auto& temp_geometry : std::span<O::GeoJSON::Geometry>(m_geometries.data() + (m_geometries.size() - element_number),element_number))
 			collection.geometries.emplace_back(std::make_shared<O::GeoJSON::Geometry>(std::move(temp_geometry)));
 		geometry.value = std::move(collection);
@@ -35,17 +35,18 @@ bool O::GeoJSON::IO::Feature_Parser<Derived>::On_Geometry(O::GeoJSON::Geometry&&
 	return true;
 }
 
-template <class Derived>
-bool O::GeoJSON::IO::Feature_Parser<Derived>::On_Feature(O::GeoJSON::Feature&& feature)
+template <class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::Feature_Parser<Derived, Policy>::On_Feature(O::GeoJSON::Feature&& feature)
 {
 	if(!m_geometries.empty())
 		feature.geometry = std::move(m_geometries.back());
+	m_geometries.clear();
 	On_Full_Feature(std::move(feature));
 	return true;
 }
 
-template <class Derived>
-bool O::GeoJSON::IO::Feature_Parser<Derived>::On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id)
+template <class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::Feature_Parser<Derived, Policy>::On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id)
 { 
 	return On_Root(std::move(bbox), std::move(id));
 };
@@ -0,0 +1,195 @@
+#ifndef IO_FLAT_GEOBUF_H
+#define IO_FLAT_GEOBUF_H
+
+// STL
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// UTILS
+#include <utils/expected.h>
+
+// GEOJSON
+#include "geojson/root.h"
+
+// IO
+#include "io/error.h"
+#include "io/mapped_file.h"
+#include "io/packed_rtree.h"
+
+namespace O::GeoJSON::IO
+{
+	/// @brief FlatGeobuf geometry types (subset of the specification used by GeoJSON)
+	enum class Flat_Geobuf_Geometry_Type : std::uint8_t
+	{
+		UNKNOWN = 0,
+		POINT = 1,
+		LINE_STRING = 2,
+		POLYGON = 3,
+		MULTI_POINT = 4,
+		MULTI_LINE_STRING = 5,
+		MULTI_POLYGON = 6,
+		GEOMETRY_COLLECTION = 7,
+	};
+
+	/// @brief FlatGeobuf column types
+	enum class Flat_Geobuf_Column_Type : std::uint8_t
+	{
+		BYTE = 0,
+		UBYTE,
+		BOOL,
+		SHORT,
+		USHORT,
+		INT,
+		UINT,
+		LONG,
+		ULONG,
+		FLOAT,
+		DOUBLE,
+		STRING,
+		JSON,
+		DATE_TIME,
+		BINARY,
+	};
+
+	/// @brief one property column of a FlatGeobuf file
+	struct Flat_Geobuf_Column
+	{
+		std::string name;             ///< property key
+		Flat_Geobuf_Column_Type type; ///< storage type of the values
+	};
+
+	/// @brief decoded FlatGeobuf header
+	struct Flat_Geobuf_Header
+	{
+		std::string name;                                           ///< dataset name
+		std::optional<std::array<double, 4>> envelope;              ///< ``[minX, minY, maxX, maxY]`` of every feature
+		Flat_Geobuf_Geometry_Type geometry_type = Flat_Geobuf_Geometry_Type::UNKNOWN; ///< common geometry type, ``UNKNOWN`` when mixed
+		bool has_z = false;                                         ///< coordinates carry an altitude
+		std::vector<Flat_Geobuf_Column> columns;                    ///< property columns
+		std::uint64_t features_count = 0;                           ///< number of features
+		std::uint16_t index_node_size = Packed_RTree::DEFAULT_NODE_SIZE; ///< R-tree node size, 0 when the file has no index
+	};
+
+	/**
+	 * @brief Writer of FlatGeobuf files (https://flatgeobuf.org).
+	 *        Features are accumulated then ``Save`` sorts them along a Hilbert curve, writes them after the header and seeks back to fill the packed R-tree placed between both.
+	 *        The writer is also a ``Feature_Parser`` sink (``On_Full_Feature``/``On_Root``) so a GeoJSON file can be converted while it is parsed.
+	 *
+	 * Property columns are inferred from the values: booleans only give ``BOOL``, integers only ``LONG``, numbers ``DOUBLE``, strings ``STRING``, any other mix or nested value ``JSON``.
+	 * ``null`` values are not stored.
+	 * @note GeoJSON ids and foreign members have no FlatGeobuf counterpart and are dropped.
+	 */
+	class Flat_Geobuf_Writer
+	{
+	public:
+		/**
+		 * @brief write features to a FlatGeobuf file
+		 * @param features features to write
+		 * @param path destination
+		 * @param name dataset name stored in the header
+		 * @param node_size R-tree node size, 0 to write no index
+		 * @return ``NO_ERROR``, ``FILE_OPENNING_FAILED``, ``FILE_WRITE_FAILED`` or ``TOO_MANY_PROPERTY_COLUMNS`` when the features hold more than 65535 distinct property keys (columns are indexed on 16 bits), nothing is written then
+		 */
+		static Error Save(std::span<const O::GeoJSON::Feature> features, const std::filesystem::path& path, std::string_view name = {}, std::uint16_t node_size = Packed_RTree::DEFAULT_NODE_SIZE);
+
+		/**
+		 * @brief write a GeoJSON root, a lone feature or geometry becomes a single feature file
+		 * @see Save
+		 */
+		static Error Save(const O::GeoJSON::Root& root, const std::filesystem::path& path, std::string_view name = {}, std::uint16_t node_size = Packed_RTree::DEFAULT_NODE_SIZE);
+
+		/// @name Feature accumulation
+		/// @{
+		void Add_Feature(const O::GeoJSON::Feature& feature) { m_features.push_back(feature); }
+		void Add_Feature(O::GeoJSON::Feature&& feature) { m_features.push_back(std::move(feature)); }
+		std::size_t Size() const { return m_features.size(); }
+		/// @}
+
+		/// @name Feature_Parser sink callbacks
+		/// @{
+		bool On_Full_Feature(O::GeoJSON::Feature&& feature) { Add_Feature(std::move(feature)); return true; }
+		bool On_Root(std::optional<O::GeoJSON::Bbox>&&, O::GeoJSON::Id&&) { return true; }
+		/// @}
+
+		/**
+		 * @brief write the accumulated features
+		 * @see Save
+		 */
+		Error Save(const std::filesystem::path& path, std::string_view name = {}, std::uint16_t node_size = Packed_RTree::DEFAULT_NODE_SIZE) const { return Save(std::span<const O::GeoJSON::Feature>(m_features), path, name, node_size); }
+
+	private:
+		std::vector<O::GeoJSON::Feature> m_features; ///< features waiting for ``Save``
+	};
+
+	/**
+	 * @brief Reader of FlatGeobuf files backed by a memory mapping.
+	 *        Features are decoded on demand. When the file has a spatial index a bbox query only reads the R-tree nodes on the matching paths and the matching features.
+	 *        The ``Parse`` functions feed any ``Feature_Parser`` sink (``IO::Writer``, ``Builder::From_GeoJSON``...): ``On_Full_Feature`` for every selected feature then ``On_Root`` with the header envelope.
+	 *        A sink returning false stops the parse with ``HANDLER_ABORTED``.
+	 */
+	class Flat_Geobuf_Reader
+	{
+	public:
+		/**
+		 * @brief map a FlatGeobuf file and decode its header
+		 * @param path file to read
+		 * @return the reader, ``FILE_OPENNING_FAILED`` or ``INVALID_FLAT_GEOBUF``
+		 */
+		static O::Expected<Flat_Geobuf_Reader, Error> Open(const std::filesystem::path& path);
+
+		/// @brief give back the decoded header
+		const Flat_Geobuf_Header& Get_Header() const { return m_header; }
+
+		/// @brief tells if the file carries a packed R-tree
+		bool Has_Index() const { return m_header.index_node_size != 0 && m_header.features_count != 0; }
+
+		/**
+		 * @brief find the features whose envelope intersects a box
+		 * @param bbox ``[minX, minY, maxX, maxY]``
+		 * @return feature offsets in file order (see ``Read_Feature``)
+		 */
+		std::vector<std::uint64_t> Query(const std::array<double, 4>& bbox) const;
+
+		/**
+		 * @brief decode the feature stored at the given offset of the feature section
+		 * @param offset offset returned by ``Query`` (0 is the first feature)
+		 * @param next if not null, receives the offset of the following feature
+		 * @return the feature or ``INVALID_FLAT_GEOBUF``
+		 */
+		O::Expected<O::GeoJSON::Feature, Error> Read_Feature(std::uint64_t offset, std::uint64_t* next = nullptr) const;
+
+		/// @name Parse functions
+		/// @brief decode a selection of features into the given handler
+		/// @return ``NO_ERROR``, ``INVALID_FLAT_GEOBUF`` or ``HANDLER_ABORTED`` when a callback returned false
+		/// @{
+		template<class Handler>
+		Error Parse(Handler& handler) const;
+
+		template<class Handler>
+		Error Parse_Bbox(const std::array<double, 4>& bbox, Handler& handler) const;
+		/// @}
+
+	private:
+		/// @brief hand the features at the given offsets then the root to the handler
+		template<class Handler>
+		Error Parse_Offsets(std::span<const std::uint64_t> offsets, Handler& handler) const;
+
+		/// @brief envelope of the header as a GeoJSON bbox
+		std::optional<O::GeoJSON::Bbox> Root_Bbox() const;
+
+		Mapped_File m_file;                 ///< mapped FlatGeobuf file
+		Flat_Geobuf_Header m_header;        ///< decoded header
+		std::uint64_t m_index_offset = 0;   ///< file offset of the R-tree
+		std::uint64_t m_feature_offset = 0; ///< file offset of the first feature
+	};
+}
+
+#include "flat_geobuf.hpp"
+
+#endif //IO_FLAT_GEOBUF_H
@@ -0,0 +1,42 @@
+#ifndef IO_FLAT_GEOBUF_HPP
+#define IO_FLAT_GEOBUF_HPP
+
+#include "io/flat_geobuf.h"
+
+template<class Handler>
+O::GeoJSON::IO::Error O::GeoJSON::IO::Flat_Geobuf_Reader::Parse(Handler& handler) const
+{
+	std::uint64_t offset = 0;
+	for (std::uint64_t i = 0; i < m_header.features_count; ++i)
+	{
+		auto feature = Read_Feature(offset, &offset);
+		if (!feature.Has_Value())
+			return feature.Error();
+		if (!handler.On_Full_Feature(std::move(feature.Value())))
+			return Error::HANDLER_ABORTED;
+	}
+	return handler.On_Root(Root_Bbox(), O::GeoJSON::Id()) ? Error::NO_ERROR : Error::HANDLER_ABORTED;
+}
+
+template<class Handler>
+O::GeoJSON::IO::Error O::GeoJSON::IO::Flat_Geobuf_Reader::Parse_Bbox(const std::array<double, 4>& bbox, Handler& handler) const
+{
+	auto offsets = Query(bbox);
+	return Parse_Offsets(offsets, handler);
+}
+
+template<class Handler>
+O::GeoJSON::IO::Error O::GeoJSON::IO::Flat_Geobuf_Reader::Parse_Offsets(std::span<const std::uint64_t> offsets, Handler& handler) const
+{
+	for (std::uint64_t offset : offsets)
+	{
+		auto feature = Read_Feature(offset);
+		if (!feature.Has_Value())
+			return feature.Error();
+		if (!handler.On_Full_Feature(std::move(feature.Value())))
+			return Error::HANDLER_ABORTED;
+	}
+	return handler.On_Root(Root_Bbox(), O::GeoJSON::Id()) ? Error::NO_ERROR : Error::HANDLER_ABORTED;
+}
+
+#endif //IO_FLAT_GEOBUF_HPP
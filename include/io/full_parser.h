@@ -28,7 +28,7 @@ namespace O::GeoJSON::IO
 		/// @{
 		bool On_Geometry(O::GeoJSON::Geometry&& geometry, std::size_t element_number);
 		bool On_Feature(O::GeoJSON::Feature&& feature);
-		bool On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id);
+		bool On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id);
 		/// @}
 	private:
 
@@ -36,7 +36,7 @@ namespace O::GeoJSON::IO
 		std::vector<O::GeoJSON::Geometry> m_geometries; ///< Temporary geometry accumulator used while parsing.
 		std::vector<O::GeoJSON::Feature> m_features;    ///< Temporary feature accumulator used while parsing.
 		std::optional<O::GeoJSON::Bbox> m_bbox;         ///< Temporary bbox accumulator used while parsing.
-		std::optional<std::string> m_id;                ///< Temporary bbox accumulator used while parsing.
+		O::GeoJSON::Id m_id;                            ///< Temporary id accumulator used while parsing.
 		bool m_is_feature_collection = false;           ///< boolean telling if we were parsing a feature collection. help distinguish one feature inside a feature collection. from just a feature at root
 		bool m_valid = true;                            ///< boolean ensuring that the Get_Geojson is called only once
 	};
@@ -0,0 +1,44 @@
+#ifndef IO_HYPER_LOG_LOG_H
+#define IO_HYPER_LOG_LOG_H
+
+// STL
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace O::GeoJSON::IO
+{
+	/**
+	 * @brief HyperLogLog distinct count estimator.
+	 *        Uses 2^PRECISION one byte registers (4 KiB), the standard error of the estimate is about 1.6%.
+	 */
+	class Hyper_Log_Log
+	{
+	public:
+		static constexpr unsigned PRECISION = 12;
+		static constexpr std::size_t REGISTER_COUNT = std::size_t(1) << PRECISION;
+
+		/// @name Insertion
+		/// @brief add a value to the estimated set. Numbers are hashed on their double value so ``1`` and ``1.0`` count once.
+		/// @{
+		void Add(std::string_view value);
+		void Add(double value);
+		void Add(bool value);
+		/// @}
+
+		/// @brief merge another estimator inside this one (union of both sets)
+		void Merge(const Hyper_Log_Log& other);
+
+		/// @brief give back the estimated number of distinct values
+		double Estimate() const;
+
+	private:
+		/// @brief add an already hashed value
+		void Add_Hash(std::uint64_t hash);
+
+		std::array<std::uint8_t, REGISTER_COUNT> m_registers = {}; ///< max leading zero rank per bucket
+	};
+}
+
+#endif //IO_HYPER_LOG_LOG_H
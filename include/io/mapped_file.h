@@ -0,0 +1,51 @@
+#ifndef IO_MAPPED_FILE_H
+#define IO_MAPPED_FILE_H
+
+// STL
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+// UTILS
+#include <utils/expected.h>
+
+// IO
+#include "io/error.h"
+
+namespace O::GeoJSON::IO
+{
+	/**
+	 * @brief Read-only memory mapping of a whole file.
+	 *        The mapping is released when the object is destroyed. The object is move-only.
+	 */
+	class Mapped_File
+	{
+	public:
+		/**
+		 * @brief map the given file in memory
+		 * @param path file to map
+		 * @return the mapping or ``FILE_OPENNING_FAILED``
+		 */
+		static O::Expected<Mapped_File, Error> Open(const std::filesystem::path& path);
+
+		/// @brief build an empty mapping
+		Mapped_File() = default;
+		Mapped_File(Mapped_File&& other) noexcept;
+		Mapped_File& operator=(Mapped_File&& other) noexcept;
+		Mapped_File(const Mapped_File&) = delete;
+		Mapped_File& operator=(const Mapped_File&) = delete;
+		~Mapped_File();
+
+		/// @brief give back the mapped bytes
+		std::string_view View() const { return std::string_view(m_data, m_size); }
+
+	private:
+		/// @brief unmap the file if it is mapped
+		void Release();
+
+		const char* m_data = nullptr; ///< first mapped byte
+		std::size_t m_size = 0;       ///< number of mapped bytes
+	};
+}
+
+#endif //IO_MAPPED_FILE_H
@@ -0,0 +1,29 @@
+#ifndef IO_NUMBER_FORMAT_H
+#define IO_NUMBER_FORMAT_H
+
+// STL
+#include <cstddef>
+
+namespace O::GeoJSON::IO
+{
+	/// @brief biggest number of decimals accepted by ``Format_Fixed``
+	constexpr int MAX_FIXED_DECIMALS = 17;
+
+	/// @brief buffer size always large enough for ``Format_Fixed``
+	constexpr std::size_t FIXED_BUFFER_SIZE = 40;
+
+	/**
+	 * @brief write a double as a fixed-decimal JSON number, rounded half away from zero.
+	 *        The value is scaled to an integer once and digits are produced two at a time, no locale nor ``printf`` machinery is involved.
+	 *        Values whose scaled form is above 2^53 (no longer exact in a double) fall back to the shortest round-trip representation.
+	 *        Non finite values have no JSON form: nothing is written, as ``rapidjson::Writer::Double`` does.
+	 * @param value number to write
+	 * @param decimals number of decimals, clamped to [0, MAX_FIXED_DECIMALS]
+	 * @param trim_trailing_zeros drop the trailing zeros of the decimal part (one is kept so the number stays a JSON double, ``1.50`` -> ``1.5``, ``2.00`` -> ``2.0``)
+	 * @param buffer output buffer of at least FIXED_BUFFER_SIZE chars, not null terminated
+	 * @return number of chars written, 0 for a non finite value
+	 */
+	std::size_t Format_Fixed(double value, int decimals, bool trim_trailing_zeros, char* buffer);
+}
+
+#endif //IO_NUMBER_FORMAT_H
@@ -0,0 +1,93 @@
+#ifndef IO_PACKED_RTREE_H
+#define IO_PACKED_RTREE_H
+
+// STL
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// GEOJSON
+#include "geojson/hilbert.h"
+
+namespace O::GeoJSON::IO
+{
+	/**
+	 * @brief Node of a ``Packed_RTree``, stored as 40 little-endian bytes.
+	 *        For a leaf ``offset`` is the byte offset of the feature inside the feature section, for an inner node it is the position of its first child node.
+	 */
+	struct Node_Item
+	{
+		double min_x = std::numeric_limits<double>::infinity();
+		double min_y = std::numeric_limits<double>::infinity();
+		double max_x = -std::numeric_limits<double>::infinity();
+		double max_y = -std::numeric_limits<double>::infinity();
+		std::uint64_t offset = 0;
+
+		/// @brief grow the node to contain the other one
+		void Expand(const Node_Item& other) noexcept;
+
+		/// @brief tells if both nodes overlap (borders included)
+		bool Intersects(const Node_Item& other) const noexcept { return min_x <= other.max_x && min_y <= other.max_y && max_x >= other.min_x && max_y >= other.min_y; }
+
+		/// @brief tells if the node contains nothing
+		bool Is_Empty() const noexcept { return min_x > max_x; }
+	};
+	static_assert(sizeof(Node_Item) == 40, "Node_Item must match the FlatGeobuf node layout");
+
+	/**
+	 * @brief Static packed Hilbert R-tree as used by FlatGeobuf.
+	 *        Leaves are sorted on the Hilbert value of their center, then every level groups ``node_size`` consecutive nodes of the level below.
+	 *        Nodes are stored top-down: root first, leaves last. The tree is never modified, a bbox query only touches the nodes on the matching paths.
+	 * @note the byte layout is little-endian, the tree is read and written as-is on little-endian hosts.
+	 */
+	class Packed_RTree
+	{
+	public:
+		static constexpr std::uint16_t DEFAULT_NODE_SIZE = 16;
+
+		/// @brief result of a ``Search``
+		struct Search_Result
+		{
+			std::uint64_t offset; ///< leaf offset (feature byte offset)
+			std::uint64_t index;  ///< position of the leaf in the sorted leaves
+		};
+
+		/**
+		 * @brief sort leaves on the Hilbert value (``GeoJSON::Hilbert``) of their center, in the FlatGeobuf order (descending)
+		 * @param items leaves to sort
+		 * @param extent envelope of every leaf
+		 */
+		static void Hilbert_Sort(std::vector<Node_Item>& items, const Node_Item& extent);
+
+		/**
+		 * @brief [first, last) node positions of every level, leaves first
+		 * @param item_count number of leaves (> 0)
+		 * @param node_size max children per node (>= 2)
+		 */
+		static std::vector<std::pair<std::uint64_t, std::uint64_t>> Level_Bounds(std::uint64_t item_count, std::uint16_t node_size);
+
+		/// @brief number of bytes of a tree with the given number of leaves
+		static std::uint64_t Size(std::uint64_t item_count, std::uint16_t node_size);
+
+		/**
+		 * @brief build every node of the tree above the given (already sorted) leaves
+		 * @return nodes in storage order, root first
+		 */
+		static std::vector<Node_Item> Build(const std::vector<Node_Item>& leaves, std::uint16_t node_size);
+
+		/**
+		 * @brief find the leaves intersecting a box
+		 * @param index raw tree bytes
+		 * @param item_count number of leaves
+		 * @param node_size max children per node
+		 * @param box query box
+		 * @return matching leaves sorted by offset, empty if the index is too small for the given sizes
+		 */
+		static std::vector<Search_Result> Search(std::string_view index, std::uint64_t item_count, std::uint16_t node_size, const Node_Item& box);
+	};
+}
+
+#endif //IO_PACKED_RTREE_H
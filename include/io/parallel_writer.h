@@ -0,0 +1,43 @@
+#ifndef IO_PARALLEL_WRITER_H
+#define IO_PARALLEL_WRITER_H
+
+// STL
+#include <cstddef>
+
+// IO
+#include "io/writer.h"
+
+namespace O::GeoJSON::IO
+{
+	/// @brief number of features formatted by one task of ``Write_Features_Parallel``
+	constexpr std::size_t PARALLEL_TASK_SIZE = 256;
+
+	/**
+	 * @brief Serialize features on several threads into the array opened by ``Writer::Begin_Feature_Collection``.
+	 *        Features are split into tasks of PARALLEL_TASK_SIZE contiguous features. Each worker formats its task into a ``rapidjson::StringBuffer`` with the writer coordinate precision,
+	 *        and the calling thread copies the buffers to the writer stream in task order, so the output is byte identical to a serial ``Append_Feature`` loop.
+	 *        At most ``4 * thread_count`` formatted tasks are held at once, buffers are reused between tasks.
+	 * @tparam Out_Stream output stream of the writer
+	 * @tparam Feature_Source callable ``source(std::size_t i)`` giving back the i-th feature (by value or const reference), it is called concurrently from the workers
+	 * @param writer writer inside a streamed collection (see ``Writer::Begin_Feature_Collection``)
+	 * @param feature_count number of features to write
+	 * @param source feature provider
+	 * @param thread_count number of workers, 0 for ``std::thread::hardware_concurrency``. With 1 worker or a single task the features are written serially
+	 * @note an exception thrown by source stops the workers and is rethrown by this function
+	 */
+	template <class Out_Stream, class Feature_Source>
+	void Write_Features_Parallel(Writer<Out_Stream>& writer, std::size_t feature_count, Feature_Source&& source, std::size_t thread_count = 0);
+
+	/**
+	 * @brief Serialize a whole FeatureCollection with ``Write_Features_Parallel``
+	 * @param writer writer sink
+	 * @param fc collection to write
+	 * @param thread_count number of workers, 0 for ``std::thread::hardware_concurrency``
+	 */
+	template <class Out_Stream>
+	void Write_Feature_Collection_Parallel(Writer<Out_Stream>& writer, const O::GeoJSON::Feature_Collection& fc, std::size_t thread_count = 0);
+}
+
+#include "io/parallel_writer.hpp"
+
+#endif //IO_PARALLEL_WRITER_H
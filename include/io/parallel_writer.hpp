@@ -0,0 +1,132 @@
+#ifndef IO_PARALLEL_WRITER_HPP
+#define IO_PARALLEL_WRITER_HPP
+
+#include "io/parallel_writer.h"
+
+// STL
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <rapidjson/stringbuffer.h>
+
+template <class Out_Stream, class Feature_Source>
+void O::GeoJSON::IO::Write_Features_Parallel(Writer<Out_Stream>& writer, std::size_t feature_count, Feature_Source&& source, std::size_t thread_count)
+{
+	if (thread_count == 0)
+		thread_count = std::max(1u, std::thread::hardware_concurrency());
+	const std::size_t task_count = (feature_count + PARALLEL_TASK_SIZE - 1) / PARALLEL_TASK_SIZE;
+	thread_count = std::min(thread_count, task_count);
+
+	if (thread_count <= 1 || task_count <= 1)
+	{
+		for (std::size_t i = 0; i < feature_count; ++i)
+			writer.Append_Feature(source(i));
+		return;
+	}
+
+	struct Slot
+	{
+		rapidjson::StringBuffer buffer;
+		std::size_t task = 0;       ///< task formatted in the buffer
+		bool ready = false;         ///< buffer holds a formatted task not written yet
+	};
+
+	const std::size_t window = 4 * thread_count;
+	std::vector<Slot> slots(window);
+	std::mutex mutex;
+	std::condition_variable slot_freed;
+	std::condition_variable slot_ready;
+	std::size_t next_task = 0;
+	std::size_t written_tasks = 0;
+	std::exception_ptr error;
+
+	auto worker = [&]()
+	{
+		Writer<rapidjson::StringBuffer> task_writer(slots.front().buffer);
+		task_writer.Set_Coordinate_Precision(writer.Get_Coordinate_Precision(), writer.Get_Trim_Trailing_Zeros());
+		for (;;)
+		{
+			std::size_t task;
+			{
+				std::unique_lock lock(mutex);
+				if (error || next_task == task_count)
+					return;
+				task = next_task++;
+				// the slot of this task is free once the task using it one window earlier has been written
+				slot_freed.wait(lock, [&] { return error || task < written_tasks + window; });
+				if (error)
+					return;
+			}
+
+			Slot& slot = slots[task % window];
+			try
+			{
+				const std::size_t first = task * PARALLEL_TASK_SIZE;
+				const std::size_t last = std::min(first + PARALLEL_TASK_SIZE, feature_count);
+				for (std::size_t i = first; i < last; ++i)
+				{
+					if (i != first)
+						slot.buffer.Put(',');
+					task_writer.Reset(slot.buffer);
+					task_writer.Append_Feature(source(i));
+				}
+			}
+			catch (...)
+			{
+				std::lock_guard lock(mutex);
+				if (!error)
+					error = std::current_exception();
+				slot_freed.notify_all();
+				slot_ready.notify_all();
+				return;
+			}
+
+			std::lock_guard lock(mutex);
+			slot.task = task;
+			slot.ready = true;
+			slot_ready.notify_all();
+		}
+	};
+
+	std::vector<std::thread> workers;
+	workers.reserve(thread_count);
+	for (std::size_t i = 0; i < thread_count; ++i)
+		workers.emplace_back(worker);
+
+	for (std::size_t task = 0; task < task_count; ++task)
+	{
+		Slot& slot = slots[task % window];
+		{
+			std::unique_lock lock(mutex);
+			slot_ready.wait(lock, [&] { return error || (slot.ready && slot.task == task); });
+			if (error)
+				break;
+		}
+		writer.RawValue(slot.buffer.GetString(), slot.buffer.GetSize(), rapidjson::kObjectType);
+		slot.buffer.Clear();
+
+		std::lock_guard lock(mutex);
+		slot.ready = false;
+		++written_tasks;
+		slot_freed.notify_all();
+	}
+
+	for (std::thread& thread : workers)
+		thread.join();
+	if (error)
+		std::rethrow_exception(error);
+}
+
+template <class Out_Stream>
+void O::GeoJSON::IO::Write_Feature_Collection_Parallel(Writer<Out_Stream>& writer, const O::GeoJSON::Feature_Collection& fc, std::size_t thread_count)
+{
+	writer.Begin_Feature_Collection(fc.bbox, fc.id);
+	Write_Features_Parallel(writer, fc.features.size(), [&fc](std::size_t i) -> const O::GeoJSON::Feature& { return fc.features[i]; }, thread_count);
+	writer.End_Feature_Collection();
+}
+
+#endif //IO_PARALLEL_WRITER_HPP
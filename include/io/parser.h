@@ -3,6 +3,7 @@
 #define IO_PARSER_H
 
 #include <filesystem>
+#include <string_view>
 
 #include "geojson/root.h"
 #include <utils/expected.h>
@@ -24,6 +25,13 @@ namespace O::GeoJSON::IO
 	 */
 	O::Expected<O::GeoJSON::Root, Error> Parse_Geojson_File(const std::filesystem::path& filename);
 
+	/**
+	 * @brief Parse a single GeoJSON geometry object from a non null-terminated text span
+	 * @param json_span text of the geometry object (ex: a span given back by ``Deferred_Stream::Skip_Value``)
+	 * @return Parsed Geometry
+	 */
+	O::Expected<O::GeoJSON::Geometry, Error> Parse_Geometry_Span(std::string_view json_span);
+
 } // namespace GeoJSON
 
 #endif //IO_PARSER_H
\ No newline at end of file
@@ -0,0 +1,73 @@
+#ifndef IO_PIECE_STREAM_H
+#define IO_PIECE_STREAM_H
+
+// STL
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace O::GeoJSON::IO
+{
+	/**
+	 * @brief ``rapidjson`` input stream reading several non contiguous text pieces as one document.
+	 *        It is used to present a selection of features taken from a memory-mapped file as a single ``FeatureCollection`` without copying them.
+	 * @note pieces are not copied, the viewed memory must outlive the stream.
+	 */
+	class Piece_Stream
+	{
+	public:
+		typedef char Ch;
+
+		/**
+		 * @param pieces text pieces read one after the other
+		 */
+		Piece_Stream(std::vector<std::string_view> pieces) :
+			m_pieces(std::move(pieces))
+		{
+			Next_Piece();
+		}
+
+		/// @name RapidJSON input stream concept
+		/// @{
+		Ch Peek() const { return m_current == m_end ? '\0' : *m_current; }
+
+		Ch Take()
+		{
+			if (m_current == m_end)
+				return '\0';
+			Ch c = *m_current++;
+			if (m_current == m_end)
+				Next_Piece();
+			return c;
+		}
+
+		std::size_t Tell() const { return m_count + static_cast<std::size_t>(m_current - m_piece_begin); }
+		/// @}
+
+	private:
+		/// @brief move to the next non empty piece
+		void Next_Piece()
+		{
+			m_count += static_cast<std::size_t>(m_current - m_piece_begin);
+			while (m_next < m_pieces.size() && m_pieces[m_next].empty()) ++m_next;
+			if (m_next == m_pieces.size())
+			{
+				m_piece_begin = m_current = m_end = nullptr;
+				return;
+			}
+			m_piece_begin = m_current = m_pieces[m_next].data();
+			m_end = m_current + m_pieces[m_next].size();
+			++m_next;
+		}
+
+		std::vector<std::string_view> m_pieces; ///< pieces to read
+		std::size_t m_next = 0;                 ///< index of the next piece to read
+		std::size_t m_count = 0;                ///< number of bytes read in the previous pieces
+		const Ch* m_piece_begin = nullptr;      ///< start of the current piece
+		const Ch* m_current = nullptr;          ///< reading position inside the current piece
+		const Ch* m_end = nullptr;              ///< end of the current piece
+	};
+}
+
+#endif //IO_PIECE_STREAM_H
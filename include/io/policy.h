@@ -0,0 +1,50 @@
+#ifndef IO_POLICY_H
+#define IO_POLICY_H
+
+// STL
+#include <concepts>
+
+namespace O::GeoJSON::IO
+{
+	/**
+	 * @brief Compile-time capabilities of the ``SAX_Parser``.
+	 *        A policy is a plain structure exposing ``static constexpr bool`` flags. The parser reads them through ``if constexpr`` so disabled capabilities are pruned from the generated code.
+	 *          - **ALTITUDE**                Accept a third coordinate inside positions. When disabled, 3D positions are rejected with ``COORDINATE_OVERSIZED``.
+	 *          - **NON_POLYGONAL_GEOMETRY**  Accept ``Point``, ``MultiPoint``, ``LineString`` and ``MultiLineString``.
+	 *          - **GEOMETRY_COLLECTION**     Accept ``GeometryCollection``.
+	 *          - **INPUT_VALIDATION**        Run the defensive checks (duplicated property keys, ring size and closure, line string size). Disable it only for trusted upstream data.
+	 */
+	struct Default_Policy
+	{
+		static constexpr bool ALTITUDE = true;
+		static constexpr bool NON_POLYGONAL_GEOMETRY = true;
+		static constexpr bool GEOMETRY_COLLECTION = true;
+		static constexpr bool INPUT_VALIDATION = true;
+	};
+
+	/**
+	 * @brief Policy for DCEL ingest of validated 2D polygonal data.
+	 *        Only ``Polygon`` and ``MultiPolygon`` are accepted, altitudes are rejected and defensive checks are skipped.
+	 */
+	struct Trusted_Polygon_2D_Policy
+	{
+		static constexpr bool ALTITUDE = false;
+		static constexpr bool NON_POLYGONAL_GEOMETRY = false;
+		static constexpr bool GEOMETRY_COLLECTION = false;
+		static constexpr bool INPUT_VALIDATION = false;
+	};
+
+	/**
+	 * @brief Concept that every parser policy must satisfy.
+	 */
+	template<class Policy>
+	concept Parser_Policy = requires
+	{
+		{ Policy::ALTITUDE } -> std::convertible_to<bool>;
+		{ Policy::NON_POLYGONAL_GEOMETRY } -> std::convertible_to<bool>;
+		{ Policy::GEOMETRY_COLLECTION } -> std::convertible_to<bool>;
+		{ Policy::INPUT_VALIDATION } -> std::convertible_to<bool>;
+	};
+}
+
+#endif //IO_POLICY_H
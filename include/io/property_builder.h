@@ -0,0 +1,91 @@
+#ifndef IO_PROPERTY_BUILDER_H
+#define IO_PROPERTY_BUILDER_H
+
+// STL
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// RAPIDJSON
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
+
+// GEOJSON
+#include "geojson/properties.h"
+
+namespace O::GeoJSON::IO
+{
+	/**
+	 * @brief SAX handler building a ``Property`` from a JSON text, used by the binary formats storing nested values as JSON
+	 */
+	class Property_Builder : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, Property_Builder>
+	{
+	public:
+		/**
+		 * @brief parse a whole JSON text
+		 * @param text JSON value
+		 * @return the value, nothing when the text is not valid JSON
+		 */
+		static std::optional<O::GeoJSON::Property> Parse(std::string_view text)
+		{
+			rapidjson::MemoryStream stream(text.data(), text.size());
+			rapidjson::Reader reader;
+			Property_Builder builder;
+			if (!reader.Parse(stream, builder))
+				return std::nullopt;
+			return std::move(builder.Get_Value());
+		}
+
+		bool Null()                 { return Add(O::GeoJSON::Property(nullptr)); }
+		bool Bool(bool b)           { return Add(O::GeoJSON::Property(b)); }
+		bool Int(int i)             { return Add(O::GeoJSON::Property(static_cast<std::int64_t>(i))); }
+		bool Uint(unsigned u)       { return Add(O::GeoJSON::Property(static_cast<std::int64_t>(u))); }
+		bool Int64(std::int64_t i)  { return Add(O::GeoJSON::Property(i)); }
+		bool Uint64(std::uint64_t u)
+		{
+			if (u <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+				return Add(O::GeoJSON::Property(static_cast<std::int64_t>(u)));
+			return Add(O::GeoJSON::Property(static_cast<double>(u)));
+		}
+		bool Double(double d)       { return Add(O::GeoJSON::Property(d)); }
+		bool String(const char* str, rapidjson::SizeType length, bool) { return Add(O::GeoJSON::Property(std::string(str, length))); }
+		bool Key(const char* str, rapidjson::SizeType length, bool)    { m_keys.emplace_back(str, length); return true; }
+		bool StartObject()                   { m_stack.emplace_back(O::GeoJSON::Property::Object()); return true; }
+		bool EndObject(rapidjson::SizeType)  { return Close(); }
+		bool StartArray()                    { m_stack.emplace_back(O::GeoJSON::Property::Array()); return true; }
+		bool EndArray(rapidjson::SizeType)   { return Close(); }
+
+		O::GeoJSON::Property& Get_Value() { return m_root; }
+
+	private:
+		bool Close()
+		{
+			O::GeoJSON::Property value = std::move(m_stack.back());
+			m_stack.pop_back();
+			return Add(std::move(value));
+		}
+
+		bool Add(O::GeoJSON::Property&& value)
+		{
+			if (m_stack.empty())
+				m_root = std::move(value);
+			else if (m_stack.back().Is_Array())
+				m_stack.back().Get_Array().push_back(std::move(value));
+			else
+			{
+				m_stack.back().Get_Object().insert_or_assign(std::move(m_keys.back()), std::move(value));
+				m_keys.pop_back();
+			}
+			return true;
+		}
+
+		std::vector<O::GeoJSON::Property> m_stack; ///< arrays and objects being filled
+		std::vector<std::string> m_keys;           ///< pending object keys
+		O::GeoJSON::Property m_root;               ///< parsed value
+	};
+}
+
+#endif //IO_PROPERTY_BUILDER_H
@@ -14,6 +14,7 @@
 
 // IO
 #include "io/error.h"
+#include "io/policy.h"
 
 // UTILS
 #include <utils/bounded_array.h>
@@ -28,6 +29,7 @@ namespace O::GeoJSON::IO
 	/**
 	 * @class SAX_Parser
 	 * @tparam Derived Optional CRTP parameter used when extending parser behavior.
+	 * @tparam Policy Compile-time capabilities of the parser (see ``Default_Policy``). Disabled capabilities are pruned with ``if constexpr``.
 	 * @brief Streaming SAX parser for GeoJSON documents.
 	 *        This class consumes JSON through RapidJSON's SAX interface and reconstructs GeoJSON objects incrementally. 
 	 *        It maintains an internal parsing stack representing the current context within the GeoJSON structure (feature, geometry, coordinates, properties, etc.).
@@ -37,8 +39,8 @@ namespace O::GeoJSON::IO
 	 *          - **On_Feature_Collection()**   Invoked at the end of a `FeatureCollection`, after all contained features have been streamed through `On_Feature()`.
 	 * These callbacks allow the user to handle GeoJSON elements as they stream in, without requiring the entire document to be stored in memory.
 	 */
-	template<class Derived = void>
-	class SAX_Parser : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, SAX_Parser<Derived>>
+	template<class Derived = void, Parser_Policy Policy = Default_Policy>
+	class SAX_Parser : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, SAX_Parser<Derived, Policy>>
 	{
 	public:
 		/**
@@ -63,7 +65,7 @@ namespace O::GeoJSON::IO
 		 * @return `true` to continue parsing, `false` to abort.
 		 * @note Features in the collection are streamed individually through `On_Feature()` before this function is called.
 		 */
-		bool On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id);
+		bool On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id);
 
 		/**
 		 * @brief Parsing state machine used to interpret JSON tokens.
@@ -148,6 +150,9 @@ namespace O::GeoJSON::IO
 		 */
 		bool Push_Error(Error error);
 
+		/// @brief give back the current context state
+		Parse_State Current_State() const;
+
 	private:
 
 		/** 
@@ -165,9 +170,6 @@ namespace O::GeoJSON::IO
 		/// @brief Pop the current context and give it back
 		Parse_Context Pop_Context();
 
-		/// @brief give back the current context state
-		Parse_State Current_State() const;
-
 		/// @brief Set the current key inside the context
 		O::GeoJSON::Key Set_Current_Key(std::string_view key);
 
@@ -177,6 +179,15 @@ namespace O::GeoJSON::IO
 		/// @brief tells if we are parsing an array or not
 		bool In_Array();
 
+		/// @brief tells if the current sub key already exist inside the current property object (always false when ``Policy::INPUT_VALIDATION`` is disabled)
+		bool Property_Key_Exist();
+
+		/// @brief tells if the given type can be parsed with the current ``Policy``
+		static constexpr bool Is_Type_Enabled(O::GeoJSON::Type type);
+
+		/// @brief check the size and closure of a polygon ring (always valid when ``Policy::INPUT_VALIDATION`` is disabled)
+		Error Check_Ring(const std::vector<O::GeoJSON::Position>& ring);
+
 		/// @brief Factory function that create a Feature from the current state
 		std::optional<O::GeoJSON::Feature> Create_Feature();
 
@@ -189,7 +200,8 @@ namespace O::GeoJSON::IO
 		std::vector<Parse_Context> m_context_stack; ///< Context Stack
 		O::GeoJSON::Property m_property;            ///< current property inside the current feature
 		O::Bounded_Vector<double,6> m_positions;    ///< Temporary position buffer used to accumulate coordinate tuples.
-		std::optional<std::string> m_id;            ///< Current id inside the Feature
+		O::GeoJSON::Id m_id;                        ///< Current id inside the Feature
+		O::GeoJSON::Id m_root_id;                   ///< id of the FeatureCollection when it is read before its features
 		char m_level;                               ///< current level of coordinate
 		char m_max_level;                           ///< max reach level of coordinate
 		char m_add_level = 0;                       ///< difference of level between max and level at the previous step
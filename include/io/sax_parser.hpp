@@ -5,6 +5,8 @@
 #include <algorithm>
 #include <format>
 #include <ranges>
+#include <limits>
+#include <utility>
 
 #include "io/sax_parser.h"
 #include "io/error.h"
@@ -19,27 +21,27 @@ using Level2 = std::vector<O::GeoJSON::Position>;
 using Level3 = std::vector<std::vector<O::GeoJSON::Position>>;
 using Level4 = std::vector<O::GeoJSON::Polygon>;
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::On_Geometry(O::GeoJSON::Geometry&& geometry, std::size_t element_number) 
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::On_Geometry(O::GeoJSON::Geometry&& geometry, std::size_t element_number) 
 {
 	return static_cast<Derived&>(*this).On_Geometry(std::move(geometry), element_number);
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::On_Feature(O::GeoJSON::Feature&& feature) 
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::On_Feature(O::GeoJSON::Feature&& feature) 
 {
 	return static_cast<Derived&>(*this).On_Feature(std::move(feature));
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id)
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id)
 {
 	return static_cast<Derived&>(*this).On_Feature_Collection(std::move(bbox), std::move(id));
 }
 
 
-template<class Derived>
-O::GeoJSON::IO::SAX_Parser<Derived>::SAX_Parser() :
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+O::GeoJSON::IO::SAX_Parser<Derived, Policy>::SAX_Parser() :
 	m_current_error(O::GeoJSON::IO::Error::NO_ERROR),
 	m_level(0),
 	m_max_level(0),
@@ -48,13 +50,14 @@ O::GeoJSON::IO::SAX_Parser<Derived>::SAX_Parser() :
 	Push_Context(Parse_State::ROOT);
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::Push_Context(Parse_State state,O::GeoJSON::Property& ref_property, std::string_view key)
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Push_Context(Parse_State state,O::GeoJSON::Property& ref_property, std::string_view key)
 {
 	switch (state)
 	{
 		case Parse_State::FEATURE:
-			m_id = std::nullopt;
+			if (m_id)
+				m_root_id = std::exchange(m_id, O::GeoJSON::Id());
 			break;
 		case Parse_State::COORDINATES:
 			m_coordinate = O::GeoJSON::Position();
@@ -63,44 +66,50 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Push_Context(Parse_State state,O::GeoJ
 			m_level = 0;
 			m_add_level = 0;
 			break;
+		case Parse_State::BBOX:
+			// a bbox may follow coordinates (or a whole "features" array), forget their level
+			m_positions.Clear();
+			m_max_level = 0;
+			m_level = 0;
+			break;
 	}
 	m_context_stack.emplace_back( ref_property, state, std::string(key), O::GeoJSON::Key::FOREIGN);
 	return true;
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::Reset_State(Parse_State state)
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Reset_State(Parse_State state)
 {
 	Current_Context().state = state;
 	return true;
 }
 
 
-template<class Derived>
-typename O::GeoJSON::IO::SAX_Parser<Derived>::Parse_Context O::GeoJSON::IO::SAX_Parser<Derived>::Pop_Context()
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+typename O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Parse_Context O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Pop_Context()
 {
 	assert(!m_context_stack.empty());
-	typename SAX_Parser<Derived>::Parse_Context context = std::move(m_context_stack.back());
+	typename SAX_Parser<Derived, Policy>::Parse_Context context = std::move(m_context_stack.back());
 	m_context_stack.pop_back();
 	return context;
 }
 
-template<class Derived>
-typename O::GeoJSON::IO::SAX_Parser<Derived>::Parse_State O::GeoJSON::IO::SAX_Parser<Derived>::Current_State() const
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+typename O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Parse_State O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Current_State() const
 {
 	assert(!m_context_stack.empty());
 	return m_context_stack.back().state;
 }
 
-template<class Derived>
-typename O::GeoJSON::IO::SAX_Parser<Derived>::Parse_Context& O::GeoJSON::IO::SAX_Parser<Derived>::Current_Context()
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+typename O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Parse_Context& O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Current_Context()
 {
 	assert(!m_context_stack.empty());
 	return m_context_stack.back();
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::In_Array()
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::In_Array()
 {
 	switch (Current_State())
 	{
@@ -116,8 +125,8 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::In_Array()
 	}
 }
 
-template<class Derived>
-O::GeoJSON::Key O::GeoJSON::IO::SAX_Parser<Derived>::Set_Current_Key(std::string_view key)
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+O::GeoJSON::Key O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Set_Current_Key(std::string_view key)
 {
 	if (!m_context_stack.empty())
 	{
@@ -127,8 +136,8 @@ O::GeoJSON::Key O::GeoJSON::IO::SAX_Parser<Derived>::Set_Current_Key(std::string
 	return O::GeoJSON::Key::FOREIGN;
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::StartObject()
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::StartObject()
 {
 	switch (Current_State())
 	{
@@ -147,7 +156,7 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::StartObject()
 		{
 			if (Current_Context().property.get().Is_Object())
 			{
-				if (Current_Context().property.get().Get_Object().contains(Current_Context().key_str))
+				if (Property_Key_Exist())
 					return Push_Error(O::GeoJSON::IO::Error::PROPERTY_KEY_ALREADY_EXIST);
 				Current_Context().property.get().Get_Object()[Current_Context().key_str] = O::GeoJSON::Property::Object();
 				Reset_State(Parse_State::PROPERTIES_OBJECT);
@@ -166,8 +175,8 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::StartObject()
 	return Push_Error(O::GeoJSON::IO::Error::UNEXPECTED_STATE_OBJECT);
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::EndObject(rapidjson::SizeType /*elementCount*/)
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::EndObject(rapidjson::SizeType /*elementCount*/)
 {
 	switch (Current_State())
 	{
@@ -190,7 +199,7 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::EndObject(rapidjson::SizeType /*elemen
 		switch (Current_Context().type)
 		{
 		case O::GeoJSON::Type::FEATURE_COLLECTION:
-			return On_Feature_Collection(std::move(Current_Context().bbox), std::move(m_id));
+			return On_Feature_Collection(std::move(Current_Context().bbox), m_id ? std::exchange(m_id, O::GeoJSON::Id()) : std::move(m_root_id));
 		case O::GeoJSON::Type::FEATURE:
 			if (auto feature = Create_Feature())
 				return On_Feature(std::move(*feature));
@@ -211,8 +220,8 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::EndObject(rapidjson::SizeType /*elemen
 	return Push_Error(O::GeoJSON::IO::Error::UNEXPECTED_STATE_OBJECT);
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::StartArray() {
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::StartArray() {
 	switch (Current_State())
 	{
 	case Parse_State::PROPERTIES_SUB_ARRAY:
@@ -228,7 +237,7 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::StartArray() {
 	{
 		if (Current_Context().property.get().Is_Object())
 		{
-			if (Current_Context().property.get().Get_Object().contains(Current_Context().key_str))
+			if (Property_Key_Exist())
 				return Push_Error(O::GeoJSON::IO::Error::PROPERTY_KEY_ALREADY_EXIST);
 			Current_Context().property.get().Get_Object()[Current_Context().key_str] = O::GeoJSON::Property::Array();
 			Reset_State(Parse_State::PROPERTIES_SUB_ARRAY);
@@ -253,8 +262,8 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::StartArray() {
 	}
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::EndArray(rapidjson::SizeType element_count)
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::EndArray(rapidjson::SizeType element_count)
 {
 	switch (Current_State())
 	{
@@ -300,8 +309,8 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::EndArray(rapidjson::SizeType element_c
 	}
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::Key(const char* str, rapidjson::SizeType length, bool /*copy*/)
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Key(const char* str, rapidjson::SizeType length, bool /*copy*/)
 {
 	std::string_view key_str(str, length);
 	O::GeoJSON::Key key = Set_Current_Key(key_str);
@@ -319,7 +328,9 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Key(const char* str, rapidjson::SizeTy
 				case O::GeoJSON::Key::COORDINATES:         return Push_Context(Parse_State::COORDINATES);
 				case O::GeoJSON::Key::BBOX:                return Push_Context(Parse_State::BBOX);
 				case O::GeoJSON::Key::FOREIGN:             return Push_Context(Parse_State::FOREIGN_KEY);
-				case O::GeoJSON::Key::GEOMETRY_COLLECTION: return Push_Context(Parse_State::GEOMETRY_COLLECTION);
+				case O::GeoJSON::Key::GEOMETRY_COLLECTION:
+					if constexpr (!Policy::GEOMETRY_COLLECTION) return Push_Error(O::GeoJSON::IO::Error::GEOMETRY_TYPE_DISABLED_BY_POLICY);
+					return Push_Context(Parse_State::GEOMETRY_COLLECTION);
 			}
 			break;
 		case Parse_State::FEATURE:
@@ -348,14 +359,16 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Key(const char* str, rapidjson::SizeTy
 				case O::GeoJSON::Key::FOREIGN:             return Push_Context(Parse_State::FOREIGN_KEY);
 				case O::GeoJSON::Key::GEOMETRY:            return Push_Context(Parse_State::GEOMETRY);
 				case O::GeoJSON::Key::ID:                  return Push_Context(Parse_State::ID);
-				case O::GeoJSON::Key::GEOMETRY_COLLECTION: return Push_Context(Parse_State::GEOMETRY_COLLECTION);
+				case O::GeoJSON::Key::GEOMETRY_COLLECTION:
+					if constexpr (!Policy::GEOMETRY_COLLECTION) return Push_Error(O::GeoJSON::IO::Error::GEOMETRY_TYPE_DISABLED_BY_POLICY);
+					return Push_Context(Parse_State::GEOMETRY_COLLECTION);
 			}
 	}
 	return Push_Error(O::GeoJSON::IO::Error::UNEXPECTED_STATE_KEY);
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::String(const char* str, rapidjson::SizeType length, bool /*copy*/)
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::String(const char* str, rapidjson::SizeType length, bool /*copy*/)
 {
 	switch (Current_State())
 	{		
@@ -367,14 +380,16 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::String(const char* str, rapidjson::Siz
 				Push_Error(O::GeoJSON::IO::Error::UNKNOWN_TYPE);
 				return false;
 			}
+			if (!Is_Type_Enabled(Current_Context().type))
+				return Push_Error(O::GeoJSON::IO::Error::GEOMETRY_TYPE_DISABLED_BY_POLICY);
 			return true;
 		case Parse_State::ID:
-			m_id = std::string(str, length);
+			m_id = O::GeoJSON::Id(std::string_view(str, length));
 			break;
 		case Parse_State::PROPERTIES_SUB_KEY:
 			if (Current_Context().property.get().Is_Object())
 			{
-				if (Current_Context().property.get().Get_Object().contains(Current_Context().key_str))
+				if (Property_Key_Exist())
 					return Push_Error(O::GeoJSON::IO::Error::PROPERTY_KEY_ALREADY_EXIST);
 				Current_Context().property.get().Get_Object()[Current_Context().key_str] = std::string(str, length);
 				break;
@@ -397,15 +412,15 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::String(const char* str, rapidjson::Siz
 	return true;
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::Bool(bool value)
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Bool(bool value)
 {
 	switch (Current_State())
 	{
 	case Parse_State::PROPERTIES_SUB_KEY:
 		if (Current_Context().property.get().Is_Object())
 		{
-			if (Current_Context().property.get().Get_Object().contains(Current_Context().key_str))
+			if (Property_Key_Exist())
 				return Push_Error(O::GeoJSON::IO::Error::PROPERTY_KEY_ALREADY_EXIST);
 			Current_Context().property.get().Get_Object()[Current_Context().key_str] = value;
 			break;
@@ -428,15 +443,15 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Bool(bool value)
 	return true;
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::Double(double value)
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Double(double value)
 {
 	switch (Current_State())
 	{
 	case Parse_State::PROPERTIES_SUB_KEY:
 		if (Current_Context().property.get().Is_Object())
 		{
-			if (Current_Context().property.get().Get_Object().contains(Current_Context().key_str))
+			if (Property_Key_Exist())
 				return Push_Error(O::GeoJSON::IO::Error::PROPERTY_KEY_ALREADY_EXIST);
 			Current_Context().property.get().Get_Object()[Current_Context().key_str] = value;
 			break;
@@ -450,7 +465,7 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Double(double value)
 		}
 		return Push_Error(O::GeoJSON::IO::Error::UNEXPECTED_PROPERTY_STATE);
 	case Parse_State::ID:
-		m_id = std::to_string(value);
+		m_id = O::GeoJSON::Id(value);
 		break;
 	case Parse_State::COORDINATES:
 	case Parse_State::BBOX:
@@ -469,15 +484,15 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Double(double value)
 }
 
 // Implement other numeric types to handle coordinates
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::Int(int value) 
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Int(int value) 
 { 
 	switch (Current_State())
 	{
 	case Parse_State::PROPERTIES_SUB_KEY:
 		if (Current_Context().property.get().Is_Object())
 		{
-			if (Current_Context().property.get().Get_Object().contains(Current_Context().key_str))
+			if (Property_Key_Exist())
 				return Push_Error(O::GeoJSON::IO::Error::PROPERTY_KEY_ALREADY_EXIST);
 			Current_Context().property.get().Get_Object()[Current_Context().key_str] = value;
 			break;
@@ -491,7 +506,7 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Int(int value)
 		}
 		return Push_Error(O::GeoJSON::IO::Error::UNEXPECTED_PROPERTY_STATE);
 	case Parse_State::ID:
-		m_id = std::to_string(value);
+		m_id = O::GeoJSON::Id(value);
 		break;
 	default:
 		return Double(static_cast<double>(value));
@@ -501,15 +516,15 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Int(int value)
 	return true;
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::Uint(unsigned value) 
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Uint(unsigned value) 
 { 
 	switch (Current_State())
 	{
 	case Parse_State::PROPERTIES_SUB_KEY:
 		if (Current_Context().property.get().Is_Object())
 		{
-			if (Current_Context().property.get().Get_Object().contains(Current_Context().key_str))
+			if (Property_Key_Exist())
 				return Push_Error(O::GeoJSON::IO::Error::PROPERTY_KEY_ALREADY_EXIST);
 			Current_Context().property.get().Get_Object()[Current_Context().key_str] = static_cast<int>(value);
 			break;
@@ -523,7 +538,7 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Uint(unsigned value)
 		}
 		return Push_Error(O::GeoJSON::IO::Error::UNEXPECTED_PROPERTY_STATE);
 	case Parse_State::ID:
-		m_id = std::to_string(value);
+		m_id = O::GeoJSON::Id(static_cast<std::int64_t>(value));
 		break;
 	default:
 		return Double(static_cast<double>(value));
@@ -533,15 +548,15 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Uint(unsigned value)
 	return true;
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::Int64(int64_t value) 
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Int64(int64_t value) 
 { 
 	switch (Current_State())
 	{
 	case Parse_State::PROPERTIES_SUB_KEY:
 		if (Current_Context().property.get().Is_Object())
 		{
-			if (Current_Context().property.get().Get_Object().contains(Current_Context().key_str))
+			if (Property_Key_Exist())
 				return Push_Error(O::GeoJSON::IO::Error::PROPERTY_KEY_ALREADY_EXIST);
 			Current_Context().property.get().Get_Object()[Current_Context().key_str] = static_cast<int>(value);
 			break;
@@ -555,7 +570,7 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Int64(int64_t value)
 		}
 		return Push_Error(O::GeoJSON::IO::Error::UNEXPECTED_PROPERTY_STATE);
 	case Parse_State::ID:
-		m_id = std::to_string(value);
+		m_id = O::GeoJSON::Id(static_cast<std::int64_t>(value));
 		break;
 	default:
 		return Double(static_cast<double>(value));
@@ -565,15 +580,15 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Int64(int64_t value)
 	return true;
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::Uint64(uint64_t value) 
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Uint64(uint64_t value) 
 {
 	switch (Current_State())
 	{
 	case Parse_State::PROPERTIES_SUB_KEY:
 		if (Current_Context().property.get().Is_Object())
 		{
-			if (Current_Context().property.get().Get_Object().contains(Current_Context().key_str))
+			if (Property_Key_Exist())
 				return Push_Error(O::GeoJSON::IO::Error::PROPERTY_KEY_ALREADY_EXIST);
 			Current_Context().property.get().Get_Object()[Current_Context().key_str] = static_cast<int>(value);
 			break;
@@ -587,7 +602,7 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Uint64(uint64_t value)
 		}
 		return Push_Error(O::GeoJSON::IO::Error::UNEXPECTED_PROPERTY_STATE);
 	case Parse_State::ID:
-		m_id = std::to_string(value);
+		m_id = value <= static_cast<uint64_t>(std::numeric_limits<std::int64_t>::max()) ? O::GeoJSON::Id(static_cast<std::int64_t>(value)) : O::GeoJSON::Id(std::to_string(value));
 		break;
 	default:
 		return Double(static_cast<double>(value));
@@ -597,8 +612,8 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Uint64(uint64_t value)
 	return true;
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::RawNumber(const char* str, rapidjson::SizeType length, bool /*copy*/) {
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::RawNumber(const char* str, rapidjson::SizeType length, bool /*copy*/) {
 	// Convert string to double
 	try
 	{
@@ -611,15 +626,15 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::RawNumber(const char* str, rapidjson::
 	}
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::Null()
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Null()
 {
 	switch (Current_State())
 	{
 	case Parse_State::PROPERTIES_SUB_KEY:
 		if (Current_Context().property.get().Is_Object())
 		{
-			if (Current_Context().property.get().Get_Object().contains(Current_Context().key_str))
+			if (Property_Key_Exist())
 				return Push_Error(O::GeoJSON::IO::Error::PROPERTY_KEY_ALREADY_EXIST);
 			Current_Context().property.get().Get_Object()[Current_Context().key_str] = O::GeoJSON::Property();
 			break;
@@ -644,8 +659,8 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Null()
 	return true;
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::Finalize_Coordinates()
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Finalize_Coordinates()
 {
 	// verify current pushed positions
 	if (m_level != m_max_level)
@@ -655,9 +670,13 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Finalize_Coordinates()
 		return true;
 	}
 	else if (m_positions.Size() < 2) return Push_Error(O::GeoJSON::IO::Error::COORDINATE_UNDERSIZED);
-	else if (m_positions.Size() > 3) return Push_Error(O::GeoJSON::IO::Error::COORDINATE_OVERSIZED);
-	
-	auto position = Level1{ m_positions[0], m_positions[1], (m_positions.Size() == 3) ? std::optional<double>(m_positions[2]) : std::nullopt };
+	else if (m_positions.Size() > (Policy::ALTITUDE ? 3 : 2)) return Push_Error(O::GeoJSON::IO::Error::COORDINATE_OVERSIZED);
+
+	Level1 position;
+	if constexpr (Policy::ALTITUDE)
+		position = Level1{ m_positions[0], m_positions[1], (m_positions.Size() == 3) ? std::optional<double>(m_positions[2]) : std::nullopt };
+	else
+		position = Level1{ m_positions[0], m_positions[1], std::nullopt };
 	m_positions.Clear();
 	switch(m_max_level)
 	{
@@ -710,29 +729,56 @@ bool O::GeoJSON::IO::SAX_Parser<Derived>::Finalize_Coordinates()
 	}
 }
 
-template<class Derived>
-std::optional<O::GeoJSON::Feature> O::GeoJSON::IO::SAX_Parser<Derived>::Create_Feature()
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Property_Key_Exist()
 {
-	if(!Current_Context().geometry.has_value())
+	if constexpr (Policy::INPUT_VALIDATION)
+		return Current_Context().property.get().Get_Object().contains(Current_Context().key_str);
+	else
+		return false;
+}
+
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+constexpr bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Is_Type_Enabled(O::GeoJSON::Type type)
+{
+	switch (type)
 	{
-		if(auto bbox = Current_Context().bbox)
-		{
-			if(auto& id = m_id)
-				return O::GeoJSON::Feature{std::move(m_context_stack.back().geometry),std::move(m_property), std::move(*id), std::move(*bbox)};
-			else
-				return O::GeoJSON::Feature{std::move(m_context_stack.back().geometry),std::move(m_property), std::nullopt, std::move(*bbox)};
-		}
-		else if(auto& id = m_id)
-			return O::GeoJSON::Feature{std::move(m_context_stack.back().geometry),std::move(m_property), std::move(*id), std::nullopt};
-		else
-			return O::GeoJSON::Feature{std::move(m_context_stack.back().geometry), std::move(m_property), std::nullopt, std::nullopt};
+		case O::GeoJSON::Type::POINT:
+		case O::GeoJSON::Type::MULTI_POINT:
+		case O::GeoJSON::Type::LINE_STRING:
+		case O::GeoJSON::Type::MULTI_LINE_STRING:
+			return Policy::NON_POLYGONAL_GEOMETRY;
+		case O::GeoJSON::Type::GEOMETRY_COLLECTION:
+			return Policy::GEOMETRY_COLLECTION;
+		default:
+			return true;
+	}
+}
+
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+O::GeoJSON::IO::Error O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Check_Ring(const std::vector<O::GeoJSON::Position>& ring)
+{
+	if constexpr (Policy::INPUT_VALIDATION)
+	{
+		if (ring.size() < 4)
+			return O::GeoJSON::IO::Error::NEED_AT_LEAST_FOUR_POSITION_FOR_POLYGON;
+		if (ring.front().altitude != ring.back().altitude || ring.front().latitude != ring.back().latitude || ring.front().longitude != ring.back().longitude)
+			return O::GeoJSON::IO::Error::POLYGON_NEED_TO_BE_CLOSED;
 	}
+	return O::GeoJSON::IO::Error::NO_ERROR;
+}
+
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+std::optional<O::GeoJSON::Feature> O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Create_Feature()
+{
+	if(!Current_Context().geometry.has_value())
+		return O::GeoJSON::Feature{std::move(m_context_stack.back().geometry), std::move(m_property), std::exchange(m_id, O::GeoJSON::Id()), std::move(Current_Context().bbox)};
 	Push_Error(O::GeoJSON::IO::Error::FEATURE_NEED_INITIALIZED_GEOMETRY);
 	return std::nullopt;
 }
 
-template<class Derived>
-std::optional<O::GeoJSON::Geometry> O::GeoJSON::IO::SAX_Parser<Derived>::Create_Geometry()
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+std::optional<O::GeoJSON::Geometry> O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Create_Geometry()
 {
 	auto Fail = [&](Error e) -> std::optional<O::GeoJSON::Geometry>
 	{
@@ -772,16 +818,17 @@ std::optional<O::GeoJSON::Geometry> O::GeoJSON::IO::SAX_Parser<Derived>::Create_
 		case O::GeoJSON::Type::LINE_STRING:
 			if (!std::holds_alternative<Level2>(m_coordinate))
 				return Fail(O::GeoJSON::IO::Error::BAD_COORDINATE_FOR_GEMETRY);
-			if (std::get<Level2>(m_coordinate).size() < 2)
+			if (Policy::INPUT_VALIDATION && std::get<Level2>(m_coordinate).size() < 2)
 				return Fail(O::GeoJSON::IO::Error::NEED_AT_LEAST_TWO_POSITION_FOR_LINESTRING);
 			return O::GeoJSON::Geometry{ O::GeoJSON::Line_String{std::move(std::get<Level2>(m_coordinate))}, std::move(Current_Context().bbox) };
 
 		case O::GeoJSON::Type::MULTI_LINE_STRING:
 			if (!std::holds_alternative<Level3>(m_coordinate))
 				return Fail(O::GeoJSON::IO::Error::BAD_COORDINATE_FOR_GEMETRY);
-			for(auto& line_string : std::get<Level3>(m_coordinate))
-				if(line_string.size() < 2)
-					return Fail(O::GeoJSON::IO::Error::NEED_AT_LEAST_TWO_POSITION_FOR_LINESTRING);
+			if constexpr (Policy::INPUT_VALIDATION)
+				for(auto& line_string : std::get<Level3>(m_coordinate))
+					if(line_string.size() < 2)
+						return Fail(O::GeoJSON::IO::Error::NEED_AT_LEAST_TWO_POSITION_FOR_LINESTRING);
 			return O::GeoJSON::Geometry{ Make_Multi_Line_String(std::get<Level3>(m_coordinate)), std::move(Current_Context().bbox) };
 
 		case O::GeoJSON::Type::POLYGON:
@@ -790,12 +837,8 @@ std::optional<O::GeoJSON::Geometry> O::GeoJSON::IO::SAX_Parser<Derived>::Create_
 			if (std::get<Level3>(m_coordinate).empty())
 				return Fail(O::GeoJSON::IO::Error::POLYGON_NEED_AT_LEAST_ONE_RING);
 			for (auto& ring : std::get<Level3>(m_coordinate))
-			{
-				if (ring.size() < 4)
-					return Fail(O::GeoJSON::IO::Error::NEED_AT_LEAST_FOUR_POSITION_FOR_POLYGON);
-				if (ring.front().altitude != ring.back().altitude || ring.front().latitude != ring.back().latitude || ring.front().longitude != ring.back().longitude)
-					return Fail(O::GeoJSON::IO::Error::POLYGON_NEED_TO_BE_CLOSED);
-			}
+				if (auto error = Check_Ring(ring); error != O::GeoJSON::IO::Error::NO_ERROR)
+					return Fail(error);
 			return O::GeoJSON::Geometry{ O::GeoJSON::Polygon(std::get<Level3>(m_coordinate)), std::move(Current_Context().bbox) };
 
 		case O::GeoJSON::Type::MULTI_POLYGON:
@@ -806,12 +849,8 @@ std::optional<O::GeoJSON::Geometry> O::GeoJSON::IO::SAX_Parser<Derived>::Create_
 				if(polygone.rings.empty())
 					return Fail(O::GeoJSON::IO::Error::POLYGON_NEED_AT_LEAST_ONE_RING);
 				for (auto& ring : polygone.rings)
-				{
-					if (ring.size() < 4)
-						return Fail(O::GeoJSON::IO::Error::NEED_AT_LEAST_FOUR_POSITION_FOR_POLYGON);
-					if (ring.front().altitude != ring.back().altitude || ring.front().latitude != ring.back().latitude || ring.front().longitude != ring.back().longitude)
-						return Fail(O::GeoJSON::IO::Error::POLYGON_NEED_TO_BE_CLOSED);
-				}
+					if (auto error = Check_Ring(ring); error != O::GeoJSON::IO::Error::NO_ERROR)
+						return Fail(error);
 			}
 			return O::GeoJSON::Geometry{ Make_Multi_Polygon(std::get<Level4>(m_coordinate)) , std::move(Current_Context().bbox) };
 
@@ -823,8 +862,8 @@ std::optional<O::GeoJSON::Geometry> O::GeoJSON::IO::SAX_Parser<Derived>::Create_
 	}
 }
 
-template<class Derived>
-bool O::GeoJSON::IO::SAX_Parser<Derived>::Push_Error(Error error)
+template<class Derived, O::GeoJSON::IO::Parser_Policy Policy>
+bool O::GeoJSON::IO::SAX_Parser<Derived, Policy>::Push_Error(Error error)
 {
 	 m_current_error = error; return false; 
 }
\ No newline at end of file
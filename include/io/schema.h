@@ -0,0 +1,140 @@
+#ifndef IO_SCHEMA_H
+#define IO_SCHEMA_H
+
+// STL
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+
+// UTILS
+#include <utils/expected.h>
+
+// IO
+#include "io/sax_parser.h"
+#include "io/hyper_log_log.h"
+
+namespace O::GeoJSON::IO
+{
+	/**
+	 * @brief JSON types a property value can take, usable as bit flags inside ``Property_Schema::types``.
+	 */
+	enum class Property_Type : std::uint8_t
+	{
+		NULL_VALUE = 1 << 0,
+		BOOL       = 1 << 1,
+		INTEGER    = 1 << 2,
+		DOUBLE     = 1 << 3,
+		STRING     = 1 << 4,
+		ARRAY      = 1 << 5,
+		OBJECT     = 1 << 6
+	};
+
+	/**
+	 * @brief Statistics inferred for one top-level property key.
+	 */
+	struct Property_Schema
+	{
+		std::uint8_t types = 0;              ///< union of the observed ``Property_Type``
+		std::size_t present_count = 0;       ///< number of features holding the key (null included)
+		std::size_t null_count = 0;          ///< number of features holding the key with a null value
+		double min_number = std::numeric_limits<double>::infinity();   ///< smallest number observed
+		double max_number = -std::numeric_limits<double>::infinity();  ///< biggest number observed
+		std::optional<std::string> min_string; ///< lexicographically smallest string observed
+		std::optional<std::string> max_string; ///< lexicographically biggest string observed
+		std::size_t max_string_length = 0;   ///< longest string observed (bytes)
+		Hyper_Log_Log cardinality;           ///< distinct scalar values (null excluded)
+
+		/// @brief tells if the given type has been observed
+		bool Has_Type(Property_Type type) const noexcept { return types & static_cast<std::uint8_t>(type); }
+
+		/// @brief tells if only the given type (and possibly null) has been observed
+		bool Is_Only(Property_Type type) const noexcept { return (types & ~static_cast<std::uint8_t>(Property_Type::NULL_VALUE)) == static_cast<std::uint8_t>(type); }
+
+		/**
+		 * @brief ratio of features where the key is null or missing
+		 * @param feature_count number of scanned features
+		 */
+		double Null_Ratio(std::size_t feature_count) const noexcept { return feature_count ? double(feature_count - present_count + null_count) / double(feature_count) : 0.0; }
+	};
+
+	/**
+	 * @brief Inferred schema of the properties of a FeatureCollection.
+	 */
+	struct Schema
+	{
+		std::size_t feature_count = 0;                                 ///< number of scanned features
+		std::map<std::string, Property_Schema, std::less<>> properties; ///< statistics per top-level property key
+	};
+
+	/**
+	 * @brief SAX handler inferring a ``Schema`` in one streaming pass.
+	 *        Geometries and features go through the usual ``SAX_Parser`` state machine but the content of ``properties`` is intercepted once the parser enters the ``PROPERTIES_OBJECT`` state:
+	 *        values are folded into the statistics directly and no ``Property`` tree is ever built. Nested objects and arrays only contribute their type to the top-level key holding them.
+	 *        The nesting is tracked by ``m_depth`` rather than by the ``PROPERTIES_SUB_KEY``/``PROPERTIES_SUB_ARRAY`` states: each of those contexts holds a reference to the ``Property`` node it fills,
+	 *        so following them would build the very tree the scanner avoids.
+	 */
+	class Schema_Scanner : public SAX_Parser<Schema_Scanner>
+	{
+		using Base = SAX_Parser<Schema_Scanner>;
+	public:
+		/**
+		 * @brief retrieve the inferred schema
+		 * @warning the schema is moved to the caller, call it once after parsing
+		 */
+		Schema Get_Schema() { return std::move(m_schema); }
+
+		/// @name RapidJSON Event Overrides
+		/// @brief events inside ``properties`` are consumed here, every other event is forwarded to ``SAX_Parser``
+		/// @{
+		bool StartObject();
+		bool EndObject(rapidjson::SizeType element_count);
+		bool StartArray();
+		bool EndArray(rapidjson::SizeType element_count);
+		bool Key(const char* str, rapidjson::SizeType length, bool copy);
+		bool String(const char* str, rapidjson::SizeType length, bool copy);
+		bool Bool(bool value);
+		bool Int(int value);
+		bool Uint(unsigned value);
+		bool Int64(int64_t value);
+		bool Uint64(uint64_t value);
+		bool Double(double value);
+		bool Null();
+		/// @}
+
+		/// @name CRTP implementation
+		/// @brief Implementation of the Base SAX parser
+		/// @{
+		bool On_Geometry(O::GeoJSON::Geometry&& geometry, std::size_t element_number);
+		bool On_Feature(O::GeoJSON::Feature&& feature);
+		bool On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id);
+		/// @}
+
+	private:
+		/// @brief fold a number into the current key statistics
+		void Record_Number(double value, Property_Type type);
+
+		Schema m_schema;                             ///< schema being inferred
+		Property_Schema* m_current = nullptr;        ///< statistics of the key being read
+		std::size_t m_depth = 0;                     ///< nesting depth inside ``properties`` (0 when outside, 1 for the values of the top-level keys), stands in for the parser property states
+	};
+
+	/**
+	 * @brief Infer the properties schema of a GeoJSON string
+	 * @param json_string Input JSON string
+	 * @return the schema or the parsing error
+	 */
+	O::Expected<Schema, Error> Infer_Schema_String(const std::string& json_string);
+
+	/**
+	 * @brief Infer the properties schema of a GeoJSON file
+	 * @param filename Path to GeoJSON file
+	 * @return the schema or the parsing error
+	 */
+	O::Expected<Schema, Error> Infer_Schema_File(const std::filesystem::path& filename);
+}
+
+#endif //IO_SCHEMA_H
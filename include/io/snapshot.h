@@ -0,0 +1,216 @@
+#ifndef IO_SNAPSHOT_H
+#define IO_SNAPSHOT_H
+
+// STL
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// UTILS
+#include <utils/expected.h>
+
+// GEOJSON
+#include "geojson/root.h"
+
+// IO
+#include "io/error.h"
+#include "io/mapped_file.h"
+
+namespace O::GeoJSON::IO
+{
+	/// @brief index value standing for "no record" in the snapshot tables
+	constexpr std::uint64_t SNAPSHOT_NONE = ~std::uint64_t(0);
+
+	/// @brief GeoJSON object held at the root of a snapshot
+	enum class Snapshot_Root : std::uint8_t
+	{
+		FEATURE_COLLECTION,
+		FEATURE,
+		GEOMETRY,
+	};
+
+	/// @brief type of a property value inside a column
+	enum class Snapshot_Value : std::uint8_t
+	{
+		ABSENT,     ///< the feature has no such key
+		NULL_VALUE,
+		BOOL,
+		INTEGER,
+		DOUBLE,
+		STRING,
+		JSON,       ///< array or object, stored as its JSON text
+		MIXED,      ///< column summary only: the column holds several types
+	};
+
+	/// @brief type of a feature id
+	enum class Snapshot_Id : std::uint8_t
+	{
+		NONE,
+		INTEGER,
+		DOUBLE,
+		STRING,
+	};
+
+	/**
+	 * @brief geometry record. ``begin``/``end`` is a range of positions (Point, MultiPoint, LineString), of rings (Polygon, MultiLineString),
+	 *        of polygons (MultiPolygon) or of geometry records (GeometryCollection, the members are stored after the collection)
+	 */
+	struct Snapshot_Geometry
+	{
+		std::uint8_t type;          ///< ``O::GeoJSON::Type`` of the geometry
+		std::uint8_t padding[7];
+		std::uint64_t bbox;         ///< index in the bbox table or ``SNAPSHOT_NONE``
+		std::uint64_t begin;        ///< first element of the range
+		std::uint64_t end;          ///< one past the last element of the range
+	};
+
+	/// @brief feature record
+	struct Snapshot_Feature
+	{
+		std::uint64_t geometry;     ///< index in the geometry table or ``SNAPSHOT_NONE``
+		std::uint64_t bbox;         ///< index in the bbox table or ``SNAPSHOT_NONE``
+		std::uint64_t properties;   ///< ``SNAPSHOT_NONE`` when the properties are an object stored in the columns, otherwise the string holding their JSON text
+		Snapshot_Id id_type;        ///< type of the id
+		std::uint8_t padding[7];
+		std::uint64_t id;           ///< integer, bits of the double, or string index
+	};
+
+	/// @brief bbox record
+	struct Snapshot_Bbox
+	{
+		std::uint64_t dimensions;   ///< 4 or 6 coordinates
+		double coordinates[6];      ///< GeoJSON bbox order
+	};
+
+	/**
+	 * @brief property column record. The entries of a column (a type tag and an 8 byte value each) are either dense, entry ``i`` being feature ``i``,
+	 *        or sparse, only the features holding the key having an entry and the row table giving their feature index
+	 */
+	struct Snapshot_Column
+	{
+		std::uint64_t name;         ///< string index of the key
+		Snapshot_Value type;        ///< common type of the values, ``MIXED`` when they differ
+		std::uint8_t padding[7];
+		std::uint64_t begin;        ///< first entry of the column in the tag and value tables
+		std::uint64_t count;        ///< number of entries, the feature count for a dense column
+		std::uint64_t rows;         ///< first entry of the column in the row table (increasing feature indices), ``SNAPSHOT_NONE`` for a dense column
+	};
+
+	/**
+	 * @brief Writer of the OGeoFlow snapshot format, a binary image of a ``O::GeoJSON::Root`` meant to be memory-mapped (see ``Snapshot_Reader``).
+	 *        The file is a fixed header followed by 8 byte aligned sections: interleaved ``x, y`` coordinates, altitudes, ring and polygon offsets, geometry, feature and bbox records,
+	 *        property columns and an interned string pool. Every property key becomes a column of type tags and 8 byte values.
+	 *        A column is stored dense (one entry per feature) when the key is frequent enough for it to be smaller than the sparse form (one entry and one row index per feature holding the key),
+	 *        so a collection whose features all have different keys costs its entries and not keys times features.
+	 * @note the sections are written in the native byte order and the reader only accepts little-endian files. Foreign members are dropped.
+	 */
+	class Snapshot_Writer
+	{
+	public:
+		/**
+		 * @brief write a GeoJSON root
+		 * @param root object to write
+		 * @param path destination
+		 * @return ``NO_ERROR``, ``FILE_OPENNING_FAILED`` or ``FILE_WRITE_FAILED``
+		 */
+		static Error Save(const O::GeoJSON::Root& root, const std::filesystem::path& path);
+	};
+
+	/**
+	 * @brief Zero-copy reader of snapshot files.
+	 *        ``Open`` maps the file and checks every table once, the accessors then give views into the mapping: coordinates and records are read in place, nothing is deserialized.
+	 *        ``Read_Feature``, ``To_Root`` and ``Parse`` rebuild GeoJSON objects when they are needed.
+	 */
+	class Snapshot_Reader
+	{
+	public:
+		/**
+		 * @brief map a snapshot and validate its tables
+		 * @return the reader, ``FILE_OPENNING_FAILED`` or ``INVALID_SNAPSHOT``
+		 */
+		static O::Expected<Snapshot_Reader, Error> Open(const std::filesystem::path& path);
+
+		/// @name Tables
+		/// @brief views on the mapped file, valid as long as the reader
+		/// @{
+		Snapshot_Root Get_Root_Kind() const { return m_root_kind; }
+		std::span<const Snapshot_Feature> Features() const { return m_features; }
+		std::span<const Snapshot_Geometry> Geometries() const { return m_geometries; }
+		std::span<const Snapshot_Bbox> Bboxes() const { return m_bboxes; }
+		std::span<const Snapshot_Column> Columns() const { return m_columns; }
+		std::span<const double> XY() const { return m_xy; }                         ///< interleaved ``x, y`` of every position
+		std::span<const double> Altitudes() const { return m_altitudes; }           ///< one altitude per position (NaN when missing), empty when no position has one
+		std::span<const std::uint64_t> Ring_Offsets() const { return m_rings; }     ///< ring ``i`` is positions ``[offsets[i], offsets[i + 1])``, some rings only cover the points and lines stored between two polygons
+		std::span<const std::uint64_t> Polygon_Offsets() const { return m_polygons; } ///< polygon ``i`` is rings ``[offsets[i], offsets[i + 1])``
+		std::string_view String(std::uint64_t index) const;
+		/// @}
+
+		/// @brief geometry held by the root of a ``GEOMETRY`` snapshot, ``SNAPSHOT_NONE`` otherwise
+		std::uint64_t Root_Geometry() const { return m_root_geometry; }
+
+		/// @name Columnar property access
+		/// @{
+		std::optional<std::size_t> Find_Column(std::string_view key) const;
+		Snapshot_Value Value_Type(std::size_t column, std::size_t feature) const { const std::uint64_t entry = Entry(column, feature); return entry == SNAPSHOT_NONE ? Snapshot_Value::ABSENT : static_cast<Snapshot_Value>(m_tags[entry]); } ///< constant time on a dense column, a binary search on a sparse one
+		bool Get_Bool(std::size_t column, std::size_t feature) const { return Raw(column, feature) != 0; }
+		std::int64_t Get_Integer(std::size_t column, std::size_t feature) const { return static_cast<std::int64_t>(Raw(column, feature)); }
+		double Get_Double(std::size_t column, std::size_t feature) const;
+		std::string_view Get_String(std::size_t column, std::size_t feature) const { return String(Raw(column, feature)); } ///< value of ``STRING`` and ``JSON`` entries
+		/// @}
+
+		/// @name GeoJSON reconstruction
+		/// @{
+		O::GeoJSON::Geometry Read_Geometry(std::uint64_t index) const;
+		O::GeoJSON::Feature Read_Feature(std::size_t index) const;
+		O::GeoJSON::Root To_Root() const;
+
+		/**
+		 * @brief hand every feature to a ``Feature_Parser`` sink (``On_Full_Feature`` then ``On_Root``), like ``IO::Writer`` or ``Builder::From_GeoJSON``
+		 * @return ``NO_ERROR`` or ``HANDLER_ABORTED`` when a callback returned false
+		 */
+		template<class Handler>
+		Error Parse(Handler& handler) const
+		{
+			for (std::size_t i = 0; i < m_features.size(); ++i)
+				if (!handler.On_Full_Feature(Read_Feature(i)))
+					return Error::HANDLER_ABORTED;
+			return handler.On_Root(Read_Bbox(m_root_bbox), Read_Id(m_root_id_type, m_root_id)) ? Error::NO_ERROR : Error::HANDLER_ABORTED;
+		}
+		/// @}
+
+	private:
+		std::uint64_t Raw(std::size_t column, std::size_t feature) const { const std::uint64_t entry = Entry(column, feature); return entry == SNAPSHOT_NONE ? 0 : m_values[entry]; }
+		std::uint64_t Entry(std::size_t column, std::size_t feature) const; ///< entry of a feature inside a column or ``SNAPSHOT_NONE``
+		std::optional<O::GeoJSON::Bbox> Read_Bbox(std::uint64_t index) const;
+		O::GeoJSON::Id Read_Id(Snapshot_Id type, std::uint64_t value) const;
+		std::vector<O::GeoJSON::Position> Read_Positions(std::uint64_t begin, std::uint64_t end) const;
+		std::vector<std::vector<O::GeoJSON::Position>> Read_Rings(std::uint64_t begin, std::uint64_t end) const;
+		O::GeoJSON::Property Read_Value(std::size_t column, std::size_t feature) const;
+
+		Mapped_File m_file;                          ///< mapped snapshot
+		Snapshot_Root m_root_kind = Snapshot_Root::FEATURE_COLLECTION;
+		std::uint64_t m_root_geometry = SNAPSHOT_NONE;
+		std::uint64_t m_root_bbox = SNAPSHOT_NONE;
+		Snapshot_Id m_root_id_type = Snapshot_Id::NONE;
+		std::uint64_t m_root_id = 0;
+		std::span<const Snapshot_Feature> m_features;
+		std::span<const Snapshot_Geometry> m_geometries;
+		std::span<const Snapshot_Bbox> m_bboxes;
+		std::span<const Snapshot_Column> m_columns;
+		std::span<const double> m_xy;
+		std::span<const double> m_altitudes;
+		std::span<const std::uint64_t> m_rings;
+		std::span<const std::uint64_t> m_polygons;
+		std::span<const std::uint8_t> m_tags;        ///< column major value types
+		std::span<const std::uint64_t> m_values;     ///< column major values
+		std::span<const std::uint64_t> m_rows;       ///< feature index of each entry of the sparse columns
+		std::span<const std::uint64_t> m_string_offsets;
+		std::string_view m_string_bytes;
+	};
+}
+
+#endif //IO_SNAPSHOT_H
@@ -0,0 +1,210 @@
+#ifndef IO_VECTOR_TILE_H
+#define IO_VECTOR_TILE_H
+
+// STL
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+// UTILS
+#include <utils/expected.h>
+
+// GEOJSON
+#include "geojson/object/feature.h"
+
+// IO
+#include "io/error.h"
+#include "io/mapped_file.h"
+
+namespace O::GeoJSON::IO
+{
+	/// @brief deepest zoom level a ``Vector_Tiler`` generates (the archive keys hold 29 bit columns and rows)
+	constexpr std::uint8_t MAX_TILE_ZOOM = 28;
+
+	/// @brief tile coordinates in the XYZ scheme, ``y`` grows southward
+	struct Tile_Id
+	{
+		std::uint8_t z = 0;  ///< zoom level
+		std::uint32_t x = 0; ///< column, west to east
+		std::uint32_t y = 0; ///< row, north to south
+
+		/// @brief tiles are ordered by zoom, then column, then row
+		auto operator<=>(const Tile_Id&) const = default;
+	};
+
+	/// @brief settings of a ``Vector_Tiler``
+	struct Tiler_Options
+	{
+		std::uint8_t min_zoom = 0;                   ///< first generated zoom level
+		std::uint8_t max_zoom = 14;                  ///< last generated zoom level, at most ``MAX_TILE_ZOOM``
+		std::uint32_t extent = 4096;                 ///< tile size in integer tile units
+		std::uint32_t buffer = 64;                   ///< margin kept around the tile when clipping, in tile units
+		double tolerance = 1.0;                      ///< Douglas-Peucker tolerance in tile units, applied at every zoom, 0 keeps every vertex
+		std::string layer_name = "features";         ///< name of the single layer of the tiles
+		std::optional<std::array<double, 4>> bounds; ///< ``[minX, minY, maxX, maxY]`` of planar coordinates stretched over the whole tile pyramid (north up), longitude/latitude in Web Mercator when empty
+		std::size_t thread_count = 0;                ///< number of workers, 0 for ``std::thread::hardware_concurrency``
+	};
+
+	/**
+	 * @brief Mapbox Vector Tile (https://github.com/mapbox/vector-tile-spec, version 2.1) generator.
+	 *        Features are projected when they are added, the original features are not kept, so a GeoJSON file can be tiled while it is parsed (``On_Full_Feature``/``On_Root``).
+	 *        For each zoom level the features are simplified once, then every tile reached by a feature is clipped, quantized to the tile extent and encoded on its own worker.
+	 *        The tiles reached by a feature are found geojson-vt style: its geometry is clipped to the children of the tiles it reached at the previous zoom, so a long diagonal line only visits the tiles it crosses and not every tile of its bbox.
+	 *
+	 * Multi geometries become one MVT feature, a GeometryCollection one MVT feature per member.
+	 * Integer ids are kept as MVT ids, properties become layer tags: strings, booleans, integers and doubles keep their type, arrays and objects are stored as their JSON text, ``null`` values are dropped.
+	 * @note the protobuf encoding is written by hand, no protobuf library is needed.
+	 */
+	class Vector_Tiler
+	{
+	public:
+		/// @brief function receiving the encoded tiles in (z, x, y) order, any error stops the generation
+		using Tile_Sink = std::function<Error(const Tile_Id& tile, std::string_view bytes)>;
+
+		explicit Vector_Tiler(Tiler_Options options = {});
+
+		/// @name Feature accumulation
+		/// @{
+		void Add_Feature(const O::GeoJSON::Feature& feature);
+		std::size_t Size() const { return m_features.size(); }
+		const Tiler_Options& Get_Options() const { return m_options; }
+		/// @}
+
+		/// @name Feature_Parser sink callbacks
+		/// @{
+		bool On_Full_Feature(O::GeoJSON::Feature&& feature) { Add_Feature(feature); return true; }
+		bool On_Root(std::optional<O::GeoJSON::Bbox>&&, O::GeoJSON::Id&&) { return true; }
+		/// @}
+
+		/**
+		 * @brief encode a single tile
+		 * @param tile tile to encode
+		 * @return the MVT bytes, empty when no feature reaches the tile
+		 */
+		std::string Encode_Tile(const Tile_Id& tile) const;
+
+		/**
+		 * @brief encode every non empty tile of the zoom range
+		 * @param sink receiver of the tiles, called from the calling thread
+		 * @return ``NO_ERROR`` or the first sink error
+		 */
+		Error Generate(const Tile_Sink& sink) const;
+
+		/**
+		 * @brief write every tile as ``directory/z/x/y.mvt``
+		 * @return ``NO_ERROR``, ``FILE_OPENNING_FAILED`` or ``FILE_WRITE_FAILED``
+		 */
+		Error Write_Directory(const std::filesystem::path& directory) const;
+
+		/**
+		 * @brief write every tile to a single tile archive (see ``Tile_Archive_Reader``)
+		 * @return ``NO_ERROR``, ``FILE_OPENNING_FAILED`` or ``FILE_WRITE_FAILED``
+		 */
+		Error Write_Archive(const std::filesystem::path& path) const;
+
+	private:
+		/// @brief MVT geometry types
+		enum class Kind : std::uint8_t
+		{
+			POINT = 1,
+			LINE_STRING = 2,
+			POLYGON = 3,
+		};
+
+		/// @brief property value stored in the layer ``values``
+		using Value = std::variant<std::string, double, std::int64_t, bool>;
+
+		/// @brief point of the unit square covering the tile pyramid
+		using World_Point = std::array<double, 2>;
+
+		/// @brief a projected feature of a single MVT geometry type
+		struct Tile_Feature
+		{
+			Kind kind = Kind::POINT;                       ///< MVT geometry type
+			std::vector<std::vector<World_Point>> parts;   ///< the points, the lines or the polygon rings (outer ring first, rings closed)
+			std::vector<bool> outer;                       ///< for polygons, true on the first ring of each polygon
+			std::array<double, 4> bbox;                    ///< ``[minX, minY, maxX, maxY]`` of the parts
+			std::optional<std::uint64_t> id;               ///< MVT id
+			std::vector<std::uint32_t> tags;               ///< (key, value) indices in ``m_keys``/``m_values``
+		};
+
+		/// @brief project a position on the unit square
+		World_Point Project(const O::GeoJSON::Position& position) const;
+
+		/// @brief project a geometry into ``m_features``, collections are flattened
+		void Add_Geometry(const O::GeoJSON::Geometry& geometry, const std::optional<std::uint64_t>& id, const std::vector<std::uint32_t>& tags);
+
+		/// @brief intern a property key or value
+		/// @{
+		std::uint32_t Key_Index(const std::string& key);
+		std::uint32_t Value_Index(Value&& value);
+		/// @}
+
+		/// @brief features reaching a tile, clipped to it so that the tiles of the next zoom are found from this geometry only
+		struct Tile_Cell
+		{
+			Tile_Id tile;                                                 ///< the tile
+			std::vector<std::uint32_t> features;                          ///< indices in ``m_features``, increasing
+			std::vector<std::vector<std::vector<World_Point>>> parts;     ///< parts of each feature clipped to the tile, buffer and tolerance included, in tile coordinates (the tile is the unit square)
+		};
+
+		/// @brief clip the cells of a zoom level to their four children, children reached by no feature are dropped and the result is in (z, x, y) order
+		std::vector<Tile_Cell> Split(const std::vector<Tile_Cell>& cells) const;
+
+		/// @brief features of a zoom level simplified with ``m_options.tolerance``
+		std::vector<Tile_Feature> Simplify(std::uint8_t z, const std::vector<std::uint32_t>& selection) const;
+
+		/// @brief clip, quantize and encode the given features of a tile
+		std::string Encode(const Tile_Id& tile, const std::vector<Tile_Feature>& features, const std::vector<std::uint32_t>& selection) const;
+
+		Tiler_Options m_options;                                  ///< tiling settings
+		std::vector<Tile_Feature> m_features;                     ///< projected features
+		std::vector<std::string> m_keys;                          ///< layer keys
+		std::unordered_map<std::string, std::uint32_t> m_key_ids; ///< index of each key in ``m_keys``
+		std::vector<Value> m_values;                              ///< layer values
+		std::map<Value, std::uint32_t> m_value_ids;               ///< index of each value in ``m_values``
+	};
+
+	/**
+	 * @brief Reader of the single file tile archives written by ``Vector_Tiler::Write_Archive``, a stand-in for MBTiles without SQLite.
+	 *        An archive is the ``OGFTILES`` magic, the tiles one after the other, then an index of ``(key, offset, size)`` little-endian ``uint64`` triplets sorted by tile,
+	 *        and a footer holding the index offset, the tile count and the magic again. The key of a tile is ``z << 58 | x << 29 | y``.
+	 */
+	class Tile_Archive_Reader
+	{
+	public:
+		/**
+		 * @brief map an archive and check its footer
+		 * @return the reader, ``FILE_OPENNING_FAILED`` or ``INVALID_TILE_ARCHIVE``
+		 */
+		static O::Expected<Tile_Archive_Reader, Error> Open(const std::filesystem::path& path);
+
+		/// @brief number of tiles in the archive
+		std::size_t Size() const { return m_count; }
+
+		/// @brief i-th tile of the archive, in (z, x, y) order
+		Tile_Id Get_Tile_Id(std::size_t i) const;
+
+		/// @brief bytes of a tile, empty when the archive does not hold it
+		std::string_view Get_Tile(const Tile_Id& tile) const;
+
+	private:
+		/// @brief i-th index entry
+		std::array<std::uint64_t, 3> Entry(std::size_t i) const;
+
+		Mapped_File m_file;          ///< mapped archive
+		std::size_t m_index = 0;     ///< file offset of the index
+		std::size_t m_count = 0;     ///< number of tiles
+	};
+}
+
+#endif //IO_VECTOR_TILE_H
@@ -0,0 +1,92 @@
+#ifndef IO_WKB_H
+#define IO_WKB_H
+
+// STL
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// UTILS
+#include <utils/expected.h>
+
+// GEOJSON
+#include "geojson/object/feature_collection.h"
+#include "geojson/object/geometry.h"
+
+// IO
+#include "io/error.h"
+
+namespace O::GeoJSON::IO
+{
+	/**
+	 * @name WKB
+	 * @brief ISO Well-Known Binary encoding of geometries.
+	 *        Geometries are written little-endian, with the ISO ``Z`` type codes (``1001`` ...) when one of their positions has an altitude, a missing altitude is then written as NaN.
+	 *        The decoder reads both byte orders, the ISO and EWKB ``Z``/``M`` flags (``M`` values are dropped) and skips EWKB SRIDs.
+	 * @{
+	 */
+
+	/// @brief append the WKB of a geometry to ``out``
+	void Write_WKB(const O::GeoJSON::Geometry& geometry, std::string& out);
+
+	/// @brief WKB of a geometry
+	std::string To_WKB(const O::GeoJSON::Geometry& geometry);
+
+	/**
+	 * @brief decode one WKB geometry
+	 * @param bytes buffer starting with the geometry
+	 * @param consumed if not null, receives the number of bytes read
+	 * @return the geometry or ``INVALID_WKB``
+	 */
+	O::Expected<O::GeoJSON::Geometry, Error> From_WKB(std::string_view bytes, std::size_t* consumed = nullptr);
+	/** @} */
+
+	/**
+	 * @name TWKB
+	 * @brief Tiny Well-Known Binary (https://github.com/TWKB/Specification): coordinates are scaled by ``10^precision``, rounded and written as zigzag varint deltas.
+	 *        ``precision`` is the number of decimals kept, in ``[-7, 7]``, altitudes keep ``clamp(precision, 0, 7)`` decimals.
+	 * @{
+	 */
+	constexpr int DEFAULT_TWKB_PRECISION = 6;
+
+	/// @brief append the TWKB of a geometry to ``out``
+	void Write_TWKB(const O::GeoJSON::Geometry& geometry, std::string& out, int precision = DEFAULT_TWKB_PRECISION);
+
+	/// @brief TWKB of a geometry
+	std::string To_TWKB(const O::GeoJSON::Geometry& geometry, int precision = DEFAULT_TWKB_PRECISION);
+
+	/**
+	 * @brief decode one TWKB geometry
+	 * @param bytes buffer starting with the geometry
+	 * @param consumed if not null, receives the number of bytes read
+	 * @return the geometry or ``INVALID_WKB``
+	 */
+	O::Expected<O::GeoJSON::Geometry, Error> From_TWKB(std::string_view bytes, std::size_t* consumed = nullptr);
+	/** @} */
+
+	/**
+	 * @brief Binary geometries of a whole FeatureCollection in one contiguous buffer.
+	 *        The geometry of feature ``i`` is ``data[offsets[i], offsets[i + 1])``, empty when the feature has no geometry.
+	 */
+	struct Geometry_Buffer
+	{
+		std::string data;                   ///< concatenated encoded geometries
+		std::vector<std::uint64_t> offsets; ///< ``features.size() + 1`` offsets inside ``data``
+
+		/// @brief number of encoded features
+		std::size_t Size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+		/// @brief encoded geometry of the i-th feature
+		std::string_view operator[](std::size_t i) const { return std::string_view(data).substr(offsets[i], offsets[i + 1] - offsets[i]); }
+	};
+
+	/// @name Bulk encoding
+	/// @{
+	Geometry_Buffer Encode_WKB(const O::GeoJSON::Feature_Collection& collection);
+	Geometry_Buffer Encode_TWKB(const O::GeoJSON::Feature_Collection& collection, int precision = DEFAULT_TWKB_PRECISION);
+	/// @}
+}
+
+#endif //IO_WKB_H
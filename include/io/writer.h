@@ -1,6 +1,9 @@
 #ifndef IO_WRITER_H
 #define IO_WRITER_H
 
+// STL
+#include <optional>
+
 #include "geojson/root.h"
 #include "geojson/properties.h"
 #include "geojson/position.h"
@@ -16,7 +19,7 @@ namespace O::GeoJSON::IO
 {
 	/**
 	 * @brief this class can be used to write down ``O::GeoJSON`` object to an outstream.
-	 * @tparam Out_Stream outputing stream type from ``rapidjson`` (ex: rapidjson::OStreamWrapper, rapidjson::FileWriteStream).
+	 * @tparam Out_Stream outputing stream type. Explicitly instantiated for ``rapidjson::OStreamWrapper``, ``rapidjson::FileWriteStream``, ``rapidjson::StringBuffer``, ``O::GeoJSON::IO::Fd_Write_Stream`` and ``O::GeoJSON::IO::Compressed_Write_Stream``.
 	 */
 	template <class Out_Stream>
 	class Writer : public rapidjson::Writer<Out_Stream>
@@ -27,11 +30,22 @@ namespace O::GeoJSON::IO
 		 */
 		Writer(Out_Stream& out);
 
+		/// @name Coordinate precision
+		/// @brief number of decimals used for coordinates (positions and bboxes), property doubles are not affected.
+		///        The default (negative) precision writes coordinates through ``rapidjson::Writer::Double`` at full precision.
+		///        Six decimals is about 11 cm at the equator, seven about 1 cm.
+		/// @{
+		void Set_Coordinate_Precision(int decimals, bool trim_trailing_zeros = true) noexcept { m_coordinate_precision = decimals; m_trim_trailing_zeros = trim_trailing_zeros; }
+		int Get_Coordinate_Precision() const noexcept { return m_coordinate_precision; }
+		bool Get_Trim_Trailing_Zeros() const noexcept { return m_trim_trailing_zeros; }
+		/// @}
+
 		/// @name Write functions
 		/// @brief Implementation for every type to sink a GeoJSON object to the Out_Stream. in practice only Write_GeoJSON_Object should be used.
 		/// @{
 		void Write_Position          (const O::GeoJSON::Position& p);
 		void Write_Bbox              (const O::GeoJSON::Bbox& bbox);
+		void Write_Id                (const O::GeoJSON::Id& id);
 		void Write_Property_Value    (const O::GeoJSON::Property& prop);
 		void Write_Properties        (const O::GeoJSON::Property& props);
 		void Write_Feature           (const O::GeoJSON::Feature& f);
@@ -39,6 +53,42 @@ namespace O::GeoJSON::IO
 		void Write_Feature_Collection(const O::GeoJSON::Feature_Collection& f);
 		void Write_GeoJSON_Object    (const O::GeoJSON::Root& f);
 		/// @}
+
+		/// @name Streaming functions
+		/// @brief write a FeatureCollection one feature at a time, the collection is never held in memory.
+		///        Members given to End_Feature_Collection are written after ``"features"``, which is valid GeoJSON since member order is free.
+		/// @{
+		void Begin_Feature_Collection(const std::optional<O::GeoJSON::Bbox>& bbox = std::nullopt, const O::GeoJSON::Id& id = O::GeoJSON::Id());
+		void Append_Feature          (const O::GeoJSON::Feature& f);
+		void End_Feature_Collection  (const std::optional<O::GeoJSON::Bbox>& bbox = std::nullopt, const O::GeoJSON::Id& id = O::GeoJSON::Id());
+		bool Is_Streaming() const noexcept { return m_streaming; }
+		/// @}
+
+		/// @name Feature sink
+		/// @brief same signatures as the ``O::GeoJSON::IO::Feature_Parser`` callbacks so a parser or filter can forward its features straight to the writer.
+		///        The collection is opened by the first feature and closed by On_Root with the bbox and id of the parsed collection.
+		///        A parser never calls On_Root when the input root is a single Feature, the collection is then closed by Finish.
+		/// @{
+		bool On_Full_Feature(O::GeoJSON::Feature&& feature);
+		bool On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id);
+
+		/**
+		 * @brief close the collection opened by On_Full_Feature if On_Root did not, nothing is written otherwise
+		 * @note must be called before reading the output of a sink whose input may be a single Feature, the destructor leaves an open collection as is
+		 */
+		void Finish();
+		/// @}
+
+	private:
+		/**
+		 * @brief write one coordinate value with the coordinate precision
+		 * @return false and nothing written for a non finite value, like ``rapidjson::Writer::Double``
+		 */
+		bool Write_Coordinate(double value);
+
+		bool m_streaming = false;           ///< true between Begin_Feature_Collection and End_Feature_Collection
+		int m_coordinate_precision = -1;    ///< decimals of coordinates, negative for full precision
+		bool m_trim_trailing_zeros = true;  ///< drop trailing zeros of fixed-decimal coordinates
 	};
 }
 	
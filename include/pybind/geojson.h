@@ -23,6 +23,8 @@
 
 pybind11::object Property_To_PyBind(const O::GeoJSON::Property& p);
 O::GeoJSON::Property PyBind_To_Property(pybind11::handle obj);
+pybind11::object Id_To_PyBind(const O::GeoJSON::Id& id);
+O::GeoJSON::Id PyBind_To_Id(pybind11::handle obj);
 
 void Init_Geojson_Bindings(pybind11::module_& m);
 
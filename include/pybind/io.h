@@ -9,6 +9,8 @@
 #include "io/full_parser.h"
 #include "io/feature_parser.h"
 #include "io/sax_parser.h"
+#include "io/feature_index.h"
+#include "io/wkb.h"
 
 
 void Init_Io_Bindings(pybind11::module_ &m);
@@ -28,7 +30,7 @@ public:
 		PYBIND11_OVERRIDE(bool, Base, On_Full_Feature, std::move(feature));
 	}
 
-	bool On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id)
+	bool On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id)
 	{
 		PYBIND11_OVERRIDE(bool, Base, On_Root, std::move(bbox), std::move(id) );
 	}
@@ -52,7 +54,7 @@ public:
 		PYBIND11_OVERRIDE(bool, Base, On_Feature, std::move(f));
 	}
 
-	bool On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id)
+	bool On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id)
 	{
 		PYBIND11_OVERRIDE(bool, Base, On_Feature_Collection, std::move(bbox), std::move(id));
 	}
@@ -68,4 +70,29 @@ private:
 	O::GeoJSON::Root m_geojson;
 };
 
+class Py_Feature_Index
+{
+public:
+	O::GeoJSON::IO::Error Build(const std::filesystem::path& path);
+	O::GeoJSON::IO::Error Load(const std::filesystem::path& path);
+	O::GeoJSON::IO::Error Save(const std::filesystem::path& path) const;
+	std::size_t Size() const { return m_index.Size(); }
+	std::vector<std::size_t> Query(const std::array<double, 4>& bbox) const { return m_index.Query(bbox); }
+	std::vector<std::size_t> Find(const std::string& id) const { return m_index.Find(id); }
+	const O::GeoJSON::IO::Feature_Index& Get_Index() const { return m_index; }
+private:
+	O::GeoJSON::IO::Feature_Index m_index;
+};
+
+class Py_Indexed_Reader
+{
+public:
+	O::GeoJSON::IO::Error Open(const std::filesystem::path& path, const Py_Feature_Index& index);
+	std::string Feature_Text(std::size_t i) const;
+	O::GeoJSON::IO::Error Parse_Features(Py_Feature_Parser& handler, const std::vector<std::size_t>& indices) const;
+	O::GeoJSON::IO::Error Parse_Bbox(Py_Feature_Parser& handler, const std::array<double, 4>& bbox) const;
+private:
+	std::optional<O::GeoJSON::IO::Indexed_Reader> m_reader;
+};
+
 #endif //PYBIND_IO_H
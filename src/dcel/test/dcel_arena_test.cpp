@@ -0,0 +1,108 @@
+#include "dcel_arena_test.h"
+
+// STL
+#include <sstream>
+
+// DCEL
+#include "dcel/segmented_vector.h"
+
+// EXEMPLE
+#include "dcel_exemple/hole_exemple.h"
+#include "dcel_exemple/multi_polygon_exemple.h"
+#include "dcel_exemple/reverse_exemple.h"
+#include "dcel_exemple/simple_exemple.h"
+
+// UTILS
+#include <utils/zip.h>
+
+// TEST UTILS
+#include "dcel_test_utils.h"
+
+namespace
+{
+	// build the exemple and check it against the links expected from the default storage
+	template<class Exemple, class Policy>
+	void Check_Same_DCEL()
+	{
+		Test_Utils::Auto_Builder<Test_Utils::Test_Builder<Policy>> auto_builder(Test_Utils::g_config);
+		ASSERT_TRUE(Test_Utils::Parse(Exemple::json, auto_builder));
+		auto opt_dcel = auto_builder.Get_Dcel();
+		ASSERT_TRUE(opt_dcel.has_value());
+		auto& dcel = opt_dcel.value();
+
+		ASSERT_EQ(dcel.vertices.size(), Exemple::expected_coords.size());
+		for (auto&& [vertex, expected_out_edge] : O::Zip(dcel.vertices, Exemple::expected_out_edges))
+		{
+			ASSERT_EQ(vertex.outgoing_edges.size(), expected_out_edge.size());
+			for (auto&& [out_edge, expected_out_edge_index] : O::Zip(vertex.outgoing_edges, expected_out_edge))
+				EXPECT_EQ(out_edge, &dcel.half_edges[expected_out_edge_index]);
+		}
+
+		ASSERT_EQ(dcel.half_edges.size(), Exemple::expected_tails.size());
+		for (std::size_t i = 0; i < dcel.half_edges.size(); ++i)
+		{
+			const Test_Utils::Test_Half_Edge<>& half_edge = dcel.half_edges[i];
+			EXPECT_EQ(half_edge.tail, &dcel.vertices[Exemple::expected_tails[i]]);
+			EXPECT_EQ(half_edge.twin, &dcel.half_edges[Exemple::expected_twins[i]]);
+			EXPECT_EQ(half_edge.prev, &dcel.half_edges[Exemple::expected_prevs[i]]);
+			EXPECT_EQ(half_edge.next, &dcel.half_edges[Exemple::expected_nexts[i]]);
+			EXPECT_EQ(half_edge.face, &dcel.faces[Exemple::expected_faces[i]]);
+		}
+
+		auto info = auto_builder.Get_Feature_Info();
+		ASSERT_TRUE(info.has_value());
+		EXPECT_EQ(Test_Utils::Serialize(Test_Utils::Test_Exporter<>::Convert(info.value())), Exemple::expected_write);
+	}
+}
+
+TEST(DCEL_Arena, Stable_Addresses)
+{
+	O::DCEL::Segmented_Vector<std::vector<int>, 3> values;
+	values.emplace_back(std::vector<int>{ 1, 2 });
+	const std::vector<int>* first = &values.front();
+	for (int i = 0; i < 100; ++i)
+		values.emplace_back(std::vector<int>{ i });
+
+	EXPECT_EQ(&values.front(), first);
+	EXPECT_EQ(values.front(), (std::vector<int>{ 1, 2 }));
+	EXPECT_EQ(values.size(), 101u);
+	EXPECT_GE(values.capacity(), 101u);
+	EXPECT_EQ(values.end() - values.begin(), 101);
+	EXPECT_EQ(values[57].front(), 56);
+
+	values.pop_back();
+	EXPECT_EQ(values.back().front(), 98);
+
+	// moving the container keeps the elements in place
+	O::DCEL::Segmented_Vector<std::vector<int>, 3> moved = std::move(values);
+	EXPECT_EQ(&moved.front(), first);
+	EXPECT_TRUE(values.empty());
+}
+
+TYPED_TEST_SUITE_P(DCEL_Arena_Test);
+
+TYPED_TEST_P(DCEL_Arena_Test, Same_DCEL_As_Vector_Storage)
+{
+	// tiny blocks so that every exemple spans several of them
+	Check_Same_DCEL<TypeParam, O::DCEL::Arena_Policy<4>>();
+}
+
+TYPED_TEST_P(DCEL_Arena_Test, Star_Lookup)
+{
+	Check_Same_DCEL<TypeParam, O::DCEL::Arena_Policy<4, O::DCEL::Star_Lookup<>>>();
+}
+
+REGISTER_TYPED_TEST_SUITE_P(
+	DCEL_Arena_Test,
+	Same_DCEL_As_Vector_Storage,
+	Star_Lookup
+);
+
+using All_Arena_Test_Sets = ::testing::Types<
+	Simple_Exemple,
+	Reverse_Exemple,
+	Hole_Exemple,
+	Multi_Polygon_Exemple
+>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(DCEL, DCEL_Arena_Test, All_Arena_Test_Sets);
@@ -0,0 +1,96 @@
+#include "dcel_bulk_build_test.h"
+
+// STL
+#include <algorithm>
+
+// EXEMPLE
+#include "dcel_exemple/hole_exemple.h"
+#include "dcel_exemple/multi_polygon_exemple.h"
+#include "dcel_exemple/reverse_exemple.h"
+#include "dcel_exemple/simple_exemple.h"
+
+// UTILS
+#include <utils/zip.h>
+
+// TEST UTILS
+#include "dcel_test_utils.h"
+
+namespace
+{
+	using Bulk_Half_Edge = Test_Utils::Test_Half_Edge<>;
+
+	// build the exemple in bulk mode and check it against the links expected from the incremental build
+	template<class Exemple, class Policy>
+	void Check_Bulk_DCEL(std::size_t thread_count)
+	{
+		Test_Utils::Auto_Builder<Test_Utils::Test_Builder<Policy>> auto_builder(Test_Utils::g_config, O::DCEL::Builder::Build_Mode::BULK, thread_count);
+		ASSERT_TRUE(Test_Utils::Parse(Exemple::json, auto_builder));
+		auto opt_dcel = auto_builder.Get_Dcel();
+		ASSERT_TRUE(opt_dcel.has_value());
+		auto& dcel = opt_dcel.value();
+
+		// the stars hold the same cyclic order, the sort may start it on another edge
+		ASSERT_EQ(dcel.vertices.size(), Exemple::expected_coords.size());
+		for (auto&& [vertex, expected_out_edge] : O::Zip(dcel.vertices, Exemple::expected_out_edges))
+		{
+			ASSERT_EQ(vertex.outgoing_edges.size(), expected_out_edge.size());
+			std::vector<const Bulk_Half_Edge*> expected;
+			for (int index : expected_out_edge)
+				expected.push_back(&dcel.half_edges[index]);
+			auto first = std::ranges::find(expected, &*vertex.outgoing_edges.front());
+			ASSERT_NE(first, expected.end());
+			std::ranges::rotate(expected, first);
+			for (auto&& [out_edge, expected_edge] : O::Zip(vertex.outgoing_edges, expected))
+				EXPECT_EQ(&*out_edge, expected_edge);
+		}
+
+		ASSERT_EQ(dcel.half_edges.size(), Exemple::expected_tails.size());
+		ASSERT_EQ(dcel.faces.size(), *std::ranges::max_element(Exemple::expected_faces) + 1u);
+		for (std::size_t i = 0; i < dcel.half_edges.size(); ++i)
+		{
+			const Bulk_Half_Edge& half_edge = dcel.half_edges[i];
+			EXPECT_EQ(half_edge.tail, &dcel.vertices[Exemple::expected_tails[i]]);
+			EXPECT_EQ(half_edge.twin, &dcel.half_edges[Exemple::expected_twins[i]]);
+			EXPECT_EQ(half_edge.prev, &dcel.half_edges[Exemple::expected_prevs[i]]);
+			EXPECT_EQ(half_edge.next, &dcel.half_edges[Exemple::expected_nexts[i]]);
+			EXPECT_EQ(half_edge.face, &dcel.faces[Exemple::expected_faces[i]]);
+		}
+
+		auto info = auto_builder.Get_Feature_Info();
+		ASSERT_TRUE(info.has_value());
+		EXPECT_EQ(Test_Utils::Serialize(Test_Utils::Test_Exporter<>::Convert(info.value())), Exemple::expected_write);
+	}
+}
+
+TYPED_TEST_SUITE_P(DCEL_Bulk_Build_Test);
+
+TYPED_TEST_P(DCEL_Bulk_Build_Test, Single_Thread)
+{
+	Check_Bulk_DCEL<TypeParam, O::DCEL::Vector_Policy<>>(1);
+}
+
+TYPED_TEST_P(DCEL_Bulk_Build_Test, Several_Threads)
+{
+	Check_Bulk_DCEL<TypeParam, O::DCEL::Vector_Policy<>>(3);
+}
+
+TYPED_TEST_P(DCEL_Bulk_Build_Test, Star_Lookup)
+{
+	Check_Bulk_DCEL<TypeParam, O::DCEL::Arena_Policy<4, O::DCEL::Star_Lookup<>>>(0);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(
+	DCEL_Bulk_Build_Test,
+	Single_Thread,
+	Several_Threads,
+	Star_Lookup
+);
+
+using All_Bulk_Build_Test_Sets = ::testing::Types<
+	Simple_Exemple,
+	Reverse_Exemple,
+	Hole_Exemple,
+	Multi_Polygon_Exemple
+>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(DCEL, DCEL_Bulk_Build_Test, All_Bulk_Build_Test_Sets);
@@ -0,0 +1,9 @@
+#ifndef SRC_DCEL_TEST_DCEL_BULK_BUILD_TEST_H
+#define SRC_DCEL_TEST_DCEL_BULK_BUILD_TEST_H
+
+#include <gtest/gtest.h>
+
+template<typename T>
+class DCEL_Bulk_Build_Test : public ::testing::Test {};
+
+#endif //SRC_DCEL_TEST_DCEL_BULK_BUILD_TEST_H
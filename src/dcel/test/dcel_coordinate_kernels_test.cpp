@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+// STL
+#include <cmath>
+#include <limits>
+#include <vector>
+
+// DCEL
+#include "dcel/coordinate_kernels.h"
+#include "dcel/index/storage.h"
+
+// CONFIGURATION
+#include "configuration/dcel.h"
+
+static O::Configuration::DCEL g_kernel_config{
+	0,
+	0,
+	0,
+	1e-9,
+	O::Configuration::DCEL::Merge_Strategy::AT_FIRST
+};
+
+TEST(DCEL_Kernel, Transforms)
+{
+	std::vector<double> x = { 0.0, 1.0, 2.0, -3.5, 4.0 };
+	std::vector<double> y = { 1.0, -1.0, 0.5, 2.0, 0.0 };
+
+	O::DCEL::Kernel::Translate(x, y, 1.0, -2.0);
+	EXPECT_EQ(x, (std::vector<double>{ 1.0, 2.0, 3.0, -2.5, 5.0 }));
+	EXPECT_EQ(y, (std::vector<double>{ -1.0, -3.0, -1.5, 0.0, -2.0 }));
+
+	O::DCEL::Kernel::Scale(x, y, 2.0, -1.0);
+	EXPECT_EQ(x, (std::vector<double>{ 2.0, 4.0, 6.0, -5.0, 10.0 }));
+	EXPECT_EQ(y, (std::vector<double>{ 1.0, 3.0, 1.5, -0.0, 2.0 }));
+
+	// quarter turn then shift: (x, y) -> (-y + 1, x)
+	O::DCEL::Kernel::Affine(x, y, 0.0, -1.0, 1.0, 1.0, 0.0, 0.0);
+	EXPECT_EQ(x, (std::vector<double>{ 0.0, -2.0, -0.5, 1.0, -1.0 }));
+	EXPECT_EQ(y, (std::vector<double>{ 2.0, 4.0, 6.0, -5.0, 10.0 }));
+}
+
+TEST(DCEL_Kernel, Envelope)
+{
+	std::vector<double> x = { 3.0, -1.0, std::numeric_limits<double>::quiet_NaN(), 7.0, 2.0 };
+	std::vector<double> y = { 0.0, 5.0, 1.0, -2.0, std::numeric_limits<double>::quiet_NaN() };
+
+	O::DCEL::Envelope envelope = O::DCEL::Kernel::Compute_Envelope(x, y);
+	EXPECT_EQ(envelope.min_x, -1.0);
+	EXPECT_EQ(envelope.max_x, 7.0);
+	EXPECT_EQ(envelope.min_y, -2.0);
+	EXPECT_EQ(envelope.max_y, 5.0);
+
+	O::DCEL::Envelope empty = O::DCEL::Kernel::Compute_Envelope({}, {});
+	EXPECT_GT(empty.min_x, empty.max_x);
+}
+
+TEST(DCEL_Kernel, Snap_And_Keys)
+{
+	std::vector<double> x = { 0.24, 0.26, -0.25, 1.0 };
+	std::vector<double> y = { 0.74, -0.74, 0.0, 0.49 };
+
+	O::DCEL::Kernel::Snap_To_Grid(x, y, 0.5);
+	EXPECT_EQ(x, (std::vector<double>{ 0.0, 0.5, -0.5, 1.0 }));
+	EXPECT_EQ(y, (std::vector<double>{ 0.5, -0.5, 0.0, 0.5 }));
+
+	std::vector<O::DCEL::Vertex_Key> keys;
+	O::DCEL::Kernel::Compute_Vertex_Keys(x, y, g_kernel_config, keys);
+	ASSERT_EQ(keys.size(), x.size());
+	for (std::size_t i = 0; i < x.size(); ++i)
+		EXPECT_TRUE(keys[i] == O::DCEL::Vertex_Key(x[i], y[i], g_kernel_config));
+}
+
+TEST(DCEL_Kernel, Storage_Coordinates)
+{
+	O::DCEL::Index::Storage<O::DCEL::Index::Topology_Vertex> dcel(g_kernel_config);
+	dcel.Get_Or_Create_Vertex(0.0, 0.0);
+	dcel.Get_Or_Create_Vertex(1.0, 0.0);
+	dcel.Get_Or_Create_Vertex(1.0, 1.0);
+
+	O::DCEL::Kernel::Translate(dcel.coordinates.x, dcel.coordinates.y, 10.0, 20.0);
+	dcel.Rebuild_Vertex_Lookup();
+
+	EXPECT_FALSE(dcel.Does_Vertex_Exist(0.0, 0.0));
+	EXPECT_TRUE(dcel.Does_Vertex_Exist(11.0, 21.0));
+	EXPECT_EQ(dcel.Get_Or_Create_Vertex(11.0, 20.0), 1u);
+	EXPECT_EQ(dcel.X(2), 11.0);
+	EXPECT_EQ(dcel.Y(2), 21.0);
+}
@@ -2,13 +2,24 @@
 
 // DCEL
 #include "dcel/exporter.h"
+#include "dcel/flat_geobuf_exporter.h"
+#include "dcel/parallel_exporter.h"
+#include "dcel/topojson_exporter.h"
+#include "dcel/vector_tile_exporter.h"
 #include "dcel/builder.h"
 #include "dcel/face.h"
 #include "dcel/vertex.h"
 #include "dcel/half_edge.h"
 
+// STL
+#include <filesystem>
+#include <map>
+#include <set>
+
 // IO
 #include "io/feature_parser.h"
+#include "io/flat_geobuf.h"
+#include "io/vector_tile.h"
 #include "io/writer.h"
 
 // EXEMPLE
@@ -19,6 +30,7 @@
 
 // RAPIDJSON
 #include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/stringbuffer.h>
 
 // CONFIGURATION
 #include "configuration/dcel.h"
@@ -78,9 +90,168 @@ TYPED_TEST_P(DCEL_Builder_Exporter, Exporter)
 	EXPECT_EQ(str, TypeParam::expected_write);
 }
 
+TYPED_TEST_P(DCEL_Builder_Exporter, Parallel_Write)
+{
+	Auto_Builder auto_builder(g_config);
+	rapidjson::StringStream ss(TypeParam::json.c_str());
+	rapidjson::Reader reader;
+	ASSERT_TRUE(reader.Parse(ss, auto_builder));
+
+	auto opt_feature = auto_builder.Get_Feature_Info();
+	ASSERT_TRUE(opt_feature.has_value());
+
+	std::stringstream out;
+	rapidjson::OStreamWrapper osw(out);
+	O::GeoJSON::IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+	O::DCEL::Exporter::To_GeoJSON_Parallel<O::DCEL::Vertex<Half_Edge_Impl>, Half_Edge_Impl, O::DCEL::Face<Half_Edge_Impl>>::Write(opt_feature.value(), writer, 4);
+	EXPECT_EQ(out.str(), TypeParam::expected_write);
+}
+
+TYPED_TEST_P(DCEL_Builder_Exporter, Flat_Geobuf)
+{
+	using Exporter = O::DCEL::Exporter::To_GeoJSON<O::DCEL::Vertex<Half_Edge_Impl>, Half_Edge_Impl, O::DCEL::Face<Half_Edge_Impl>>;
+	using Fgb_Exporter = O::DCEL::Exporter::To_Flat_Geobuf<O::DCEL::Vertex<Half_Edge_Impl>, Half_Edge_Impl, O::DCEL::Face<Half_Edge_Impl>>;
+	Auto_Builder auto_builder(g_config);
+	rapidjson::StringStream ss(TypeParam::json.c_str());
+	rapidjson::Reader reader;
+	ASSERT_TRUE(reader.Parse(ss, auto_builder));
+
+	auto opt_feature = auto_builder.Get_Feature_Info();
+	ASSERT_TRUE(opt_feature.has_value());
+
+	// without index the features keep their order, ids are not part of FlatGeobuf
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_dcel.fgb";
+	ASSERT_EQ(Fgb_Exporter::Save(opt_feature.value(), path, 0), O::GeoJSON::IO::Error::NO_ERROR);
+	auto fgb = O::GeoJSON::IO::Flat_Geobuf_Reader::Open(path);
+	ASSERT_TRUE(fgb.Has_Value());
+	ASSERT_EQ(fgb.Value().Get_Header().features_count, opt_feature.value().faces.size());
+
+	std::uint64_t offset = 0;
+	for (std::size_t i = 0; i < opt_feature.value().faces.size(); ++i)
+	{
+		auto read = fgb.Value().Read_Feature(offset, &offset);
+		ASSERT_TRUE(read.Has_Value());
+		O::GeoJSON::Feature expected = Exporter::Convert_Feature(opt_feature.value(), i);
+		expected.id = O::GeoJSON::Id();
+
+		rapidjson::StringBuffer expected_buffer;
+		O::GeoJSON::IO::Writer<rapidjson::StringBuffer> expected_writer(expected_buffer);
+		expected_writer.Write_Feature(expected);
+		rapidjson::StringBuffer read_buffer;
+		O::GeoJSON::IO::Writer<rapidjson::StringBuffer> read_writer(read_buffer);
+		read_writer.Write_Feature(read.Value());
+		EXPECT_STREQ(read_buffer.GetString(), expected_buffer.GetString());
+	}
+	std::filesystem::remove(path);
+}
+
+TYPED_TEST_P(DCEL_Builder_Exporter, Vector_Tiles)
+{
+	using Exporter = O::DCEL::Exporter::To_GeoJSON<O::DCEL::Vertex<Half_Edge_Impl>, Half_Edge_Impl, O::DCEL::Face<Half_Edge_Impl>>;
+	Auto_Builder auto_builder(g_config);
+	rapidjson::StringStream ss(TypeParam::json.c_str());
+	rapidjson::Reader reader;
+	ASSERT_TRUE(reader.Parse(ss, auto_builder));
+
+	auto opt_feature = auto_builder.Get_Feature_Info();
+	ASSERT_TRUE(opt_feature.has_value());
+
+	O::GeoJSON::IO::Tiler_Options options;
+	options.max_zoom = 6;
+	O::GeoJSON::IO::Vector_Tiler tiler = O::DCEL::Exporter::To_Vector_Tiler<O::DCEL::Vertex<Half_Edge_Impl>, Half_Edge_Impl, O::DCEL::Face<Half_Edge_Impl>>::Convert(opt_feature.value(), options);
+	ASSERT_EQ(tiler.Size(), opt_feature.value().faces.size());
+
+	// same tiles as the reconstructed GeoJSON
+	O::GeoJSON::IO::Vector_Tiler expected(options);
+	O::GeoJSON::Root root = Exporter::Convert(opt_feature.value());
+	for (const O::GeoJSON::Feature& feature : std::get<O::GeoJSON::Feature_Collection>(root.object).features)
+		expected.Add_Feature(feature);
+
+	std::size_t tile_count = 0;
+	ASSERT_EQ(tiler.Generate([&](const O::GeoJSON::IO::Tile_Id& tile, std::string_view bytes)
+	{
+		EXPECT_EQ(bytes, expected.Encode_Tile(tile));
+		++tile_count;
+		return O::GeoJSON::IO::Error::NO_ERROR;
+	}), O::GeoJSON::IO::Error::NO_ERROR);
+	EXPECT_GE(tile_count, 7u);
+}
+
+TYPED_TEST_P(DCEL_Builder_Exporter, TopoJSON_Rings_Match_GeoJSON)
+{
+	using Exporter = O::DCEL::Exporter::To_GeoJSON<O::DCEL::Vertex<Half_Edge_Impl>, Half_Edge_Impl, O::DCEL::Face<Half_Edge_Impl>>;
+	using Topo_Exporter = O::DCEL::Exporter::To_TopoJSON<O::DCEL::Vertex<Half_Edge_Impl>, Half_Edge_Impl, O::DCEL::Face<Half_Edge_Impl>>;
+	Auto_Builder auto_builder(g_config);
+	rapidjson::StringStream ss(TypeParam::json.c_str());
+	rapidjson::Reader reader;
+	ASSERT_TRUE(reader.Parse(ss, auto_builder));
+	auto opt_feature = auto_builder.Get_Feature_Info();
+	ASSERT_TRUE(opt_feature.has_value());
+
+	const auto topology = Topo_Exporter::Extract(opt_feature.value());
+	ASSERT_EQ(topology.features.size(), opt_feature.value().faces.size());
+
+	// every arc is used at most once per direction
+	std::map<std::int64_t, int> uses;
+	for (std::size_t i = 0; i < topology.features.size(); ++i)
+	{
+		O::GeoJSON::Feature feature = Exporter::Convert_Feature(opt_feature.value(), i);
+		std::vector<std::vector<O::GeoJSON::Position>> expected_rings;
+		if (feature.geometry->Is_Polygon())
+			expected_rings = feature.geometry->Get_Polygon().rings;
+		else
+			for (const auto& polygon : feature.geometry->Get_Multi_Polygon().polygons)
+				expected_rings.insert(expected_rings.end(), polygon.rings.begin(), polygon.rings.end());
+
+		std::size_t ring_index = 0;
+		for (const auto& polygon : topology.features[i])
+			for (const auto& ring : polygon)
+			{
+				// stitch the arcs, dropping the first point of every arc but the first one
+				std::vector<std::array<double, 2>> points;
+				for (std::int64_t arc : ring)
+				{
+					++uses[arc];
+					auto coordinates = topology.arcs[arc >= 0 ? arc : ~arc];
+					if (arc < 0)
+						std::reverse(coordinates.begin(), coordinates.end());
+					if (!points.empty())
+					{
+						EXPECT_EQ(points.back(), coordinates.front());
+						points.pop_back();
+					}
+					points.insert(points.end(), coordinates.begin(), coordinates.end());
+				}
+				ASSERT_LT(ring_index, expected_rings.size());
+				const auto& expected = expected_rings[ring_index++];
+				ASSERT_EQ(points.size(), expected.size());
+				EXPECT_EQ(points.front(), points.back());
+
+				// same closed ring up to its starting point
+				const std::size_t n = points.size() - 1;
+				std::size_t shift = 0;
+				while (shift < n && (points[shift][0] != expected[0].longitude || points[shift][1] != expected[0].latitude))
+					++shift;
+				ASSERT_LT(shift, n);
+				for (std::size_t k = 0; k < n; ++k)
+				{
+					EXPECT_EQ(points[(shift + k) % n][0], expected[k].longitude);
+					EXPECT_EQ(points[(shift + k) % n][1], expected[k].latitude);
+				}
+			}
+		EXPECT_EQ(ring_index, expected_rings.size());
+	}
+	for (const auto& [arc, count] : uses)
+		EXPECT_EQ(count, 1) << "arc " << arc;
+}
+
 REGISTER_TYPED_TEST_SUITE_P(
     DCEL_Builder_Exporter,
-	Exporter
+	Exporter,
+	Parallel_Write,
+	Flat_Geobuf,
+	Vector_Tiles,
+	TopoJSON_Rings_Match_GeoJSON
 );
 
 // Instantiate for all ts
@@ -91,4 +262,65 @@ using All_Test_Sets = ::testing::Types<
 	Multi_Polygon_Exemple
 >;
 
-INSTANTIATE_TYPED_TEST_SUITE_P(DCEL, DCEL_Builder_Exporter, All_Test_Sets);
\ No newline at end of file
+INSTANTIATE_TYPED_TEST_SUITE_P(DCEL, DCEL_Builder_Exporter, All_Test_Sets);
+TEST(DCEL_TopoJSON_Exporter, Shared_Borders_Are_Stored_Once)
+{
+	using Topo_Exporter = O::DCEL::Exporter::To_TopoJSON<O::DCEL::Vertex<Half_Edge_Impl>, Half_Edge_Impl, O::DCEL::Face<Half_Edge_Impl>>;
+	Auto_Builder auto_builder(g_config);
+	rapidjson::StringStream ss(Multi_Polygon_Exemple::json.c_str());
+	rapidjson::Reader reader;
+	ASSERT_TRUE(reader.Parse(ss, auto_builder));
+	auto info = auto_builder.Get_Feature_Info();
+	ASSERT_TRUE(info.has_value());
+
+	// the border x = 5 between both polygons, the two other chains of the outer rings and the two holes
+	const auto topology = Topo_Exporter::Extract(info.value());
+	EXPECT_EQ(topology.arcs.size(), 5u);
+	EXPECT_EQ(topology.bbox, (std::array<double, 4>{ 0, 0, 6, 5 }));
+	const auto& polygons = topology.features.front();
+	ASSERT_EQ(polygons.size(), 2u);
+	ASSERT_EQ(polygons[0][0].size(), 2u);
+	ASSERT_EQ(polygons[1][0].size(), 2u);
+	std::set<std::int64_t> first(polygons[0][0].begin(), polygons[0][0].end());
+	std::int64_t shared = 0;
+	for (std::int64_t arc : polygons[1][0])
+		if (first.count(~arc))
+			++shared;
+	EXPECT_EQ(shared, 1);
+}
+
+TEST(DCEL_TopoJSON_Exporter, Write_Quantized)
+{
+	using Topo_Exporter = O::DCEL::Exporter::To_TopoJSON<O::DCEL::Vertex<Half_Edge_Impl>, Half_Edge_Impl, O::DCEL::Face<Half_Edge_Impl>>;
+	Auto_Builder auto_builder(g_config);
+	rapidjson::StringStream ss(Hole_Exemple::json.c_str());
+	rapidjson::Reader reader;
+	ASSERT_TRUE(reader.Parse(ss, auto_builder));
+	auto info = auto_builder.Get_Feature_Info();
+	ASSERT_TRUE(info.has_value());
+
+	// 6 values on [0, 5]: one unit per step, quantized coordinates are the input ones
+	std::stringstream out;
+	rapidjson::OStreamWrapper osw(out);
+	O::GeoJSON::IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+	Topo_Exporter::Write(info.value(), writer, 6);
+
+	std::string expected_arcs = R"("arcs":[)";
+	for (const auto& arc : Topo_Exporter::Extract(info.value()).arcs)
+	{
+		expected_arcs += expected_arcs.back() == '[' ? "[" : ",[";
+		double x = 0, y = 0;
+		for (std::size_t k = 0; k < arc.size(); ++k)
+		{
+			expected_arcs += (k ? ",[" : "[") + std::to_string(static_cast<int>(arc[k][0] - x)) + "," + std::to_string(static_cast<int>(arc[k][1] - y)) + "]";
+			x = arc[k][0];
+			y = arc[k][1];
+		}
+		expected_arcs += "]";
+	}
+	expected_arcs += "]}";
+
+	// the hole of the first feature is the ring of the second one, walked backward
+	const std::string expected_head = R"({"type":"Topology","bbox":[0.0,0.0,5.0,5.0],"transform":{"scale":[1.0,1.0],"translate":[0.0,0.0]},"objects":{"features":{"type":"GeometryCollection","geometries":[{"type":"Polygon","arcs":[[0],[1],[2]],"properties":{}},{"type":"Polygon","arcs":[[-2]],"properties":{}}]}},)";
+	EXPECT_EQ(out.str(), expected_head + expected_arcs);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+// STL
+#include <random>
+#include <string>
+#include <unordered_map>
+
+// DCEL
+#include "dcel/flat_map.h"
+#include "dcel/vertex_key.h"
+
+// CONFIGURATION
+#include "configuration/dcel.h"
+
+namespace
+{
+	// every key lands in the same group, the probes have to go through the control bytes and the next groups
+	struct Collide_Hash
+	{
+		size_t operator()(uint64_t) const noexcept { return 0; }
+	};
+}
+
+TEST(DCEL_Flat_Map, Same_As_Unordered_Map)
+{
+	O::DCEL::Flat_Map<uint64_t, std::string> map;
+	std::unordered_map<uint64_t, std::string> reference;
+	std::mt19937_64 random(42);
+
+	for (int i = 0; i < 20000; ++i)
+	{
+		const uint64_t key = random() % 2048;
+		switch (random() % 3)
+		{
+		case 0:
+			EXPECT_EQ(map.emplace(key, std::to_string(i)).second, reference.emplace(key, std::to_string(i)).second);
+			break;
+		case 1:
+			EXPECT_EQ(map.erase(key), reference.erase(key));
+			break;
+		default:
+			map[key] += "x";
+			reference[key] += "x";
+			break;
+		}
+	}
+
+	ASSERT_EQ(map.size(), reference.size());
+	for (const auto& [key, value] : reference)
+	{
+		auto it = map.find(key);
+		ASSERT_NE(it, map.end());
+		EXPECT_EQ(it->second, value);
+	}
+	std::size_t visited = 0;
+	for (const auto& [key, value] : map)
+	{
+		EXPECT_EQ(reference.at(key), value);
+		++visited;
+	}
+	EXPECT_EQ(visited, reference.size());
+}
+
+TEST(DCEL_Flat_Map, Colliding_Hash)
+{
+	O::DCEL::Flat_Map<uint64_t, uint64_t, Collide_Hash> map;
+	for (uint64_t key = 0; key < 100; ++key)
+		EXPECT_TRUE(map.emplace(key, key * 2).second);
+	for (uint64_t key = 0; key < 100; key += 2)
+		EXPECT_EQ(map.erase(key), 1u);
+
+	EXPECT_EQ(map.size(), 50u);
+	for (uint64_t key = 0; key < 100; ++key)
+	{
+		auto it = map.find(key);
+		if (key % 2)
+		{
+			ASSERT_NE(it, map.end());
+			EXPECT_EQ(it->second, key * 2);
+		}
+		else
+			EXPECT_EQ(it, map.end());
+	}
+}
+
+TEST(DCEL_Flat_Map, Reserve_Copy_Move)
+{
+	O::DCEL::Flat_Map<O::DCEL::Vertex_Key, int, O::DCEL::Vertex_Hash> map;
+	O::Configuration::DCEL config{ 0, 0, 0, 1e-9, O::Configuration::DCEL::Merge_Strategy::AT_FIRST };
+	map.reserve(1000);
+	const std::size_t capacity = map.bucket_count();
+	EXPECT_GE(capacity, 1000u);
+	for (int i = 0; i < 1000; ++i)
+		map.emplace(O::DCEL::Vertex_Key(i * 0.5, -i * 0.25, config), i);
+	EXPECT_EQ(map.bucket_count(), capacity);
+
+	O::DCEL::Flat_Map<O::DCEL::Vertex_Key, int, O::DCEL::Vertex_Hash> copy = map;
+	O::DCEL::Flat_Map<O::DCEL::Vertex_Key, int, O::DCEL::Vertex_Hash> moved = std::move(map);
+	EXPECT_TRUE(map.empty());
+	ASSERT_EQ(copy.size(), 1000u);
+	ASSERT_EQ(moved.size(), 1000u);
+	for (int i = 0; i < 1000; ++i)
+	{
+		const O::DCEL::Vertex_Key key(i * 0.5, -i * 0.25, config);
+		EXPECT_EQ(copy.find(key)->second, i);
+		EXPECT_EQ(moved.find(key)->second, i);
+	}
+	EXPECT_FALSE(copy.contains(O::DCEL::Vertex_Key(0.1, 0.1, config)));
+}
@@ -0,0 +1,267 @@
+#include "dcel_index_test.h"
+
+// STL
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// DCEL
+#include "dcel/index/builder.h"
+#include "dcel/index/exporter.h"
+#include "dcel/ring_orientation.h"
+
+// EXEMPLE
+#include "dcel_exemple/hole_exemple.h"
+#include "dcel_exemple/multi_polygon_exemple.h"
+#include "dcel_exemple/reverse_exemple.h"
+#include "dcel_exemple/simple_exemple.h"
+
+// UTILS
+#include <utils/zip.h>
+
+// TEST UTILS
+#include "dcel_test_utils.h"
+
+namespace
+{
+	using Test_Utils::Auto_Builder;
+	using Test_Utils::Serialize;
+	using Test_Utils::g_config;
+
+	using Index_Exporter = O::DCEL::Index::To_GeoJSON<>;
+
+	// a counter clockwise square whose closing edge alone looks clockwise, and the same square clockwise
+	struct Counter_Clockwise_Square
+	{
+		static inline const std::string json = R"({"type":"Feature","geometry":{"type":"Polygon","coordinates":[[[2,0],[2,2],[0,2],[0,0],[2,0]]]},"properties":{}})";
+	};
+	struct Clockwise_Square
+	{
+		static inline const std::string json = R"({"type":"Feature","geometry":{"type":"Polygon","coordinates":[[[2,0],[0,0],[0,2],[2,2],[2,0]]]},"properties":{}})";
+	};
+
+	template<class Exemple, class Vertex = O::DCEL::Index::Vertex, class Half_Edge = O::DCEL::Index::Half_Edge>
+	std::pair<O::DCEL::Index::Storage<Vertex, Half_Edge>, O::DCEL::Feature_Info<O::DCEL::Index::Face, O::DCEL::Index::Handle>> Build()
+	{
+		Auto_Builder<O::DCEL::Index::From_GeoJSON<Vertex, Half_Edge>> auto_builder(g_config);
+		EXPECT_TRUE(Test_Utils::Parse(Exemple::json, auto_builder));
+		return { std::move(auto_builder.Get_Dcel().value()), std::move(auto_builder.Get_Feature_Info().value()) };
+	}
+}
+
+TYPED_TEST_SUITE_P(DCEL_Index_Test);
+
+TYPED_TEST_P(DCEL_Index_Test, Vertex)
+{
+	auto [dcel, info] = Build<TypeParam>();
+	ASSERT_EQ(dcel.vertices.size(), TypeParam::expected_coords.size());
+	for (auto&& [vertex, expected_coord] : O::Zip(dcel.vertices, TypeParam::expected_coords))
+	{
+		EXPECT_EQ(vertex.x, expected_coord.first);
+		EXPECT_EQ(vertex.y, expected_coord.second);
+	}
+
+	for (auto&& [vertex, expected_out_edge] : O::Zip(dcel.vertices, TypeParam::expected_out_edges))
+	{
+		ASSERT_EQ(vertex.outgoing_edges.size(), expected_out_edge.size());
+		for (auto&& [out_edge, expected_out_edge_index] : O::Zip(vertex.outgoing_edges, expected_out_edge))
+			EXPECT_EQ(out_edge, static_cast<O::DCEL::Index::Handle>(expected_out_edge_index));
+	}
+}
+
+TYPED_TEST_P(DCEL_Index_Test, Half_Edge)
+{
+	auto [dcel, info] = Build<TypeParam>();
+	ASSERT_EQ(dcel.half_edges.size(), TypeParam::expected_tails.size());
+	for (O::DCEL::Index::Handle edge = 0; edge < dcel.half_edges.size(); ++edge)
+	{
+		SCOPED_TRACE(edge);
+		EXPECT_EQ(dcel.Tail(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_tails[edge]));
+		EXPECT_EQ(dcel.Head(edge), dcel.Tail(dcel.Twin(edge)));
+		EXPECT_EQ(dcel.Twin(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_twins[edge]));
+		EXPECT_EQ(dcel.Prev(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_prevs[edge]));
+		EXPECT_EQ(dcel.Next(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_nexts[edge]));
+		EXPECT_EQ(dcel.Incident_Face(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_faces[edge]));
+	}
+}
+
+TYPED_TEST_P(DCEL_Index_Test, Compact_Half_Edge)
+{
+	// the compact layouts derive twin, head and prev but must give the same links
+	auto check = [](const auto& dcel)
+	{
+		ASSERT_EQ(dcel.half_edges.size(), TypeParam::expected_tails.size());
+		for (O::DCEL::Index::Handle edge = 0; edge < dcel.half_edges.size(); ++edge)
+		{
+			SCOPED_TRACE(edge);
+			EXPECT_EQ(dcel.Tail(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_tails[edge]));
+			EXPECT_EQ(dcel.Head(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_tails[TypeParam::expected_twins[edge]]));
+			EXPECT_EQ(dcel.Twin(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_twins[edge]));
+			EXPECT_EQ(dcel.Prev(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_prevs[edge]));
+			EXPECT_EQ(dcel.Next(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_nexts[edge]));
+			EXPECT_EQ(dcel.Incident_Face(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_faces[edge]));
+		}
+	};
+
+	auto [dcel_with_prev, info_with_prev] = Build<TypeParam, O::DCEL::Index::Vertex, O::DCEL::Index::Compact_Half_Edge<true>>();
+	check(dcel_with_prev);
+	auto [dcel_without_prev, info_without_prev] = Build<TypeParam, O::DCEL::Index::Vertex, O::DCEL::Index::Compact_Half_Edge<false>>();
+	check(dcel_without_prev);
+	EXPECT_EQ(Serialize(O::DCEL::Index::To_GeoJSON<O::DCEL::Index::Vertex, O::DCEL::Index::Compact_Half_Edge<false>>::Convert(dcel_without_prev, info_without_prev)), TypeParam::expected_write);
+}
+
+TYPED_TEST_P(DCEL_Index_Test, Vertex_Layout)
+{
+	// the outgoing edges are kept inline or recovered from the rotation but the DCEL is the same
+	auto check = [](const auto& dcel, const auto& info)
+	{
+		ASSERT_EQ(dcel.vertices.size(), TypeParam::expected_out_edges.size());
+		for (O::DCEL::Index::Handle vertex = 0; vertex < dcel.vertices.size(); ++vertex)
+		{
+			SCOPED_TRACE(vertex);
+			std::vector<int> out_edges;
+			dcel.For_Each_Outgoing_Edge(vertex, [&](O::DCEL::Index::Handle edge) { out_edges.push_back(static_cast<int>(edge)); });
+			EXPECT_EQ(out_edges, TypeParam::expected_out_edges[vertex]);
+		}
+		ASSERT_EQ(dcel.half_edges.size(), TypeParam::expected_tails.size());
+		for (O::DCEL::Index::Handle edge = 0; edge < dcel.half_edges.size(); ++edge)
+		{
+			SCOPED_TRACE(edge);
+			EXPECT_EQ(dcel.Prev(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_prevs[edge]));
+			EXPECT_EQ(dcel.Next(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_nexts[edge]));
+			EXPECT_EQ(dcel.Incident_Face(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_faces[edge]));
+		}
+		EXPECT_EQ(Serialize(O::DCEL::Index::To_GeoJSON<std::decay_t<decltype(dcel.vertices.front())>>::Convert(dcel, info)), TypeParam::expected_write);
+	};
+
+	auto [small_dcel, small_info] = Build<TypeParam, O::DCEL::Index::Small_Vertex>();
+	check(small_dcel, small_info);
+	auto [starless_dcel, starless_info] = Build<TypeParam, O::DCEL::Index::Starless_Vertex>();
+	check(starless_dcel, starless_info);
+}
+
+TYPED_TEST_P(DCEL_Index_Test, Coordinate_Arrays)
+{
+	// the vertices only hold topology, the storage keeps x[] and y[]
+	auto check = [](const auto& dcel, const auto& info)
+	{
+		ASSERT_EQ(dcel.vertices.size(), TypeParam::expected_coords.size());
+		ASSERT_EQ(dcel.coordinates.x.size(), TypeParam::expected_coords.size());
+		for (O::DCEL::Index::Handle vertex = 0; vertex < dcel.vertices.size(); ++vertex)
+		{
+			EXPECT_EQ(dcel.X(vertex), TypeParam::expected_coords[vertex].first);
+			EXPECT_EQ(dcel.Y(vertex), TypeParam::expected_coords[vertex].second);
+		}
+		ASSERT_EQ(dcel.half_edges.size(), TypeParam::expected_nexts.size());
+		for (O::DCEL::Index::Handle edge = 0; edge < dcel.half_edges.size(); ++edge)
+			EXPECT_EQ(dcel.Next(edge), static_cast<O::DCEL::Index::Handle>(TypeParam::expected_nexts[edge]));
+		EXPECT_EQ(Serialize(O::DCEL::Index::To_GeoJSON<std::decay_t<decltype(dcel.vertices.front())>>::Convert(dcel, info)), TypeParam::expected_write);
+	};
+
+	auto [topology_dcel, topology_info] = Build<TypeParam, O::DCEL::Index::Topology_Vertex>();
+	check(topology_dcel, topology_info);
+	auto [starless_dcel, starless_info] = Build<TypeParam, O::DCEL::Index::Starless_Topology_Vertex>();
+	check(starless_dcel, starless_info);
+}
+
+TYPED_TEST_P(DCEL_Index_Test, Face)
+{
+	auto [dcel, info] = Build<TypeParam>();
+	ASSERT_EQ(dcel.faces.size(), TypeParam::expected_edges.size());
+	for (auto&& [face, edge_index] : O::Zip(dcel.faces, TypeParam::expected_edges))
+		EXPECT_EQ(face.edge, static_cast<O::DCEL::Index::Handle>(edge_index));
+}
+
+TYPED_TEST_P(DCEL_Index_Test, Exporter)
+{
+	auto [dcel, info] = Build<TypeParam>();
+	EXPECT_EQ(Serialize(Index_Exporter::Convert(dcel, info)), TypeParam::expected_write);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(
+	DCEL_Index_Test,
+	Vertex,
+	Half_Edge,
+	Compact_Half_Edge,
+	Vertex_Layout,
+	Coordinate_Arrays,
+	Face,
+	Exporter
+);
+
+using All_Index_Test_Sets = ::testing::Types<
+	Simple_Exemple,
+	Reverse_Exemple,
+	Hole_Exemple,
+	Multi_Polygon_Exemple
+>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(DCEL, DCEL_Index_Test, All_Index_Test_Sets);
+
+TEST(DCEL_Index, Relocatable_Copy)
+{
+	static_assert(sizeof(O::DCEL::Index::Half_Edge) == 6 * sizeof(O::DCEL::Index::Handle));
+	static_assert(std::is_trivially_copyable_v<O::DCEL::Index::Half_Edge>);
+	static_assert(sizeof(O::DCEL::Index::Compact_Half_Edge<true>) == 4 * sizeof(O::DCEL::Index::Handle));
+	static_assert(sizeof(O::DCEL::Index::Compact_Half_Edge<false>) == 3 * sizeof(O::DCEL::Index::Handle));
+
+	auto [dcel, info] = Build<Multi_Polygon_Exemple>();
+
+	// a byte copy of the half edges is a valid storage, whatever address it lands at
+	O::DCEL::Index::Storage<> copy(g_config);
+	copy.vertices = dcel.vertices;
+	copy.faces = dcel.faces;
+	copy.half_edges.resize(dcel.half_edges.size());
+	std::memcpy(copy.half_edges.data(), dcel.half_edges.data(), dcel.half_edges.size() * sizeof(O::DCEL::Index::Half_Edge));
+	dcel.half_edges.clear();
+	dcel.half_edges.shrink_to_fit();
+
+	EXPECT_EQ(Serialize(Index_Exporter::Convert(copy, info)), Multi_Polygon_Exemple::expected_write);
+}
+
+TEST(DCEL_Index, Nothing_Reserved)
+{
+	// bounds sized for the pointer storage do not commit memory here
+	O::Configuration::DCEL config = g_config;
+	config.max_vertices = 1'000'000;
+	config.max_half_edges = 4'000'000;
+	config.max_faces = 1'000'000;
+	O::DCEL::Index::Storage<> dcel(config);
+	EXPECT_EQ(dcel.vertices.capacity(), 0u);
+	EXPECT_EQ(dcel.half_edges.capacity(), 0u);
+	EXPECT_EQ(dcel.faces.capacity(), 0u);
+	EXPECT_LT(dcel.vertex_lookup.bucket_count(), 1000u);
+	EXPECT_LT(dcel.edge_lookup.bucket_count(), 1000u);
+
+	const auto a = dcel.Get_Or_Create_Vertex(0, 0);
+	const auto b = dcel.Get_Or_Create_Vertex(1, 0);
+	dcel.Get_Or_Create_Half_Edge(a, b);
+	EXPECT_EQ(dcel.vertices.size(), 2u);
+	EXPECT_EQ(dcel.half_edges.size(), 2u);
+}
+
+TEST(DCEL_Index, Ring_Orientation)
+{
+	const std::vector<O::GeoJSON::Position> square = { {2, 0}, {2, 2}, {0, 2}, {0, 0}, {2, 0} };
+	EXPECT_EQ(O::DCEL::Double_Signed_Area(square), 8.0);
+	EXPECT_EQ(O::DCEL::Double_Signed_Area({ square.rbegin(), square.rend() }), -8.0);
+
+	// both rings are stored counter clockwise: walking the face of the feature goes around the square the positive way
+	auto check = [](const auto& dcel, const auto& info)
+	{
+		const O::DCEL::Index::Handle face = info.faces[0][0][0];
+		std::vector<O::GeoJSON::Position> boundary;
+		O::DCEL::Index::Handle edge = dcel.faces[face].edge;
+		do
+		{
+			boundary.push_back({ dcel.X(dcel.Tail(edge)), dcel.Y(dcel.Tail(edge)) });
+			edge = dcel.Next(edge);
+		} while (edge != dcel.faces[face].edge);
+		boundary.push_back(boundary.front());
+		EXPECT_EQ(O::DCEL::Double_Signed_Area(boundary), 8.0);
+	};
+	auto [counter_clockwise_dcel, counter_clockwise_info] = Build<Counter_Clockwise_Square>();
+	check(counter_clockwise_dcel, counter_clockwise_info);
+	auto [clockwise_dcel, clockwise_info] = Build<Clockwise_Square>();
+	check(clockwise_dcel, clockwise_info);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <type_traits>
 
 // DCEL
 #include "dcel/storage.h"
@@ -16,23 +17,26 @@ class Merge_Test : public ::testing::Test {};
 TYPED_TEST_SUITE_P(Merge_Test);
 
 
-TYPED_TEST_P(Merge_Test, Nominal)
+template<class Exemple, class Storage>
+void Check_Merge()
 {
+	constexpr bool HAS_EDGE_LOOKUP = !std::is_same_v<decltype(Storage::edge_lookup), O::DCEL::No_Edge_Lookup>;
 
-	Merge_Exemple::Classifier_Storage dcel = Merge_Exemple::From_Vertex(TypeParam::vertices, TypeParam::edges);
+	Storage dcel = Merge_Exemple::From_Vertex<Storage>(Exemple::vertices, Exemple::edges);
 
-	for (auto& half_edge :dcel.half_edges)
-	{
-		EXPECT_EQ(dcel.edge_lookup[Merge_Exemple::Half_Edge_Impl::Hash(*half_edge.tail, *half_edge.head)], &half_edge);
-	}
+	if constexpr (HAS_EDGE_LOOKUP)
+		for (auto& half_edge :dcel.half_edges)
+		{
+			EXPECT_EQ(dcel.edge_lookup[Merge_Exemple::Half_Edge_Impl::Hash(*half_edge.tail, *half_edge.head)], &half_edge);
+		}
 
-	for (auto& object : TypeParam::moves)
+	for (auto& object : Exemple::moves)
 	{
 		auto& vertex_to_move = dcel.vertices[object.vertex_id];
 		ASSERT_TRUE(dcel.Move(vertex_to_move, object.new_x, object.new_y));
 	}
 
-	for (auto&& [vertex, expected_vertex] : O::Zip(dcel.vertices, TypeParam::expected_vertices))
+	for (auto&& [vertex, expected_vertex] : O::Zip(dcel.vertices, Exemple::expected_vertices))
 	{
 		//auto d_v = std::distance(dcel.vertices.begin(), std::ranges::find_if(dcel.vertices, [&](O::DCEL::Shemapify::Vertex& a) {return &a == &vertex; }));
 
@@ -50,7 +54,7 @@ TYPED_TEST_P(Merge_Test, Nominal)
 		EXPECT_EQ(dcel.vertex_lookup[dcel.Key_From_Vertex(vertex)], &vertex);
 	}
 
-	for (auto&& [half_edge, expected_half_edge] : O::Zip(dcel.half_edges, TypeParam::expected_edges))
+	for (auto&& [half_edge, expected_half_edge] : O::Zip(dcel.half_edges, Exemple::expected_edges))
 	{
 		//auto d_h = std::distance(dcel.half_edges.begin(), std::ranges::find_if(dcel.half_edges, [&](O::DCEL::Shemapify::Half_Edge& a) {return &a == &half_edge; }));
 
@@ -68,13 +72,27 @@ TYPED_TEST_P(Merge_Test, Nominal)
 		EXPECT_EQ(d_next, expected_half_edge.prev);
 		EXPECT_EQ(d_prev, expected_half_edge.next);
 		EXPECT_EQ(d_face, expected_half_edge.face);
-		EXPECT_EQ(dcel.edge_lookup[Merge_Exemple::Half_Edge_Impl::Hash(*half_edge.tail, *half_edge.head)], &half_edge);
+		if constexpr (HAS_EDGE_LOOKUP)
+			EXPECT_EQ(dcel.edge_lookup[Merge_Exemple::Half_Edge_Impl::Hash(*half_edge.tail, *half_edge.head)], &half_edge);
+		else
+			EXPECT_TRUE(dcel.Does_Half_Edge_Exist(*half_edge.tail, *half_edge.head));
 	}
 }
 
+TYPED_TEST_P(Merge_Test, Nominal)
+{
+	Check_Merge<TypeParam, Merge_Exemple::Classifier_Storage>();
+}
+
+TYPED_TEST_P(Merge_Test, Star_Lookup)
+{
+	Check_Merge<TypeParam, Merge_Exemple::Star_Storage>();
+}
+
 REGISTER_TYPED_TEST_SUITE_P(
 	Merge_Test,
-	Nominal
+	Nominal,
+	Star_Lookup
 );
 
 // Instantiate for all ts
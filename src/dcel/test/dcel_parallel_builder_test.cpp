@@ -0,0 +1,144 @@
+#include "dcel_parallel_builder_test.h"
+
+// STL
+#include <map>
+#include <string>
+#include <utility>
+
+// DCEL
+#include "dcel/index/builder.h"
+#include "dcel/index/parallel_builder.h"
+#include "dcel/index/exporter.h"
+
+// EXEMPLE
+#include "dcel_exemple/hole_exemple.h"
+#include "dcel_exemple/multi_polygon_exemple.h"
+#include "dcel_exemple/reverse_exemple.h"
+#include "dcel_exemple/simple_exemple.h"
+
+// TEST UTILS
+#include "dcel_test_utils.h"
+
+namespace
+{
+	using Test_Utils::Auto_Builder;
+	using Test_Utils::Serialize;
+
+	using Index_Storage = O::DCEL::Index::Storage<>;
+	using Index_Info = O::DCEL::Feature_Info<O::DCEL::Index::Face, O::DCEL::Index::Handle>;
+	using Index_Exporter = O::DCEL::Index::To_GeoJSON<>;
+
+	template<class Builder, class... Args>
+	std::pair<Index_Storage, Index_Info> Build(const std::string& json, Args&&... args)
+	{
+		Auto_Builder<Builder> auto_builder(Test_Utils::g_config, std::forward<Args>(args)...);
+		EXPECT_TRUE(Test_Utils::Parse(json, auto_builder));
+		return { std::move(auto_builder.Get_Dcel().value()), std::move(auto_builder.Get_Feature_Info().value()) };
+	}
+
+	// every half edge of the sequential build has a counterpart with the same end points, followed by the same half edge
+	// the faces are not compared one by one: the sequential build names the cycles of rings that are not counter clockwise while they are still open
+	void Check_Same_Topology(const Index_Storage& expected, const Index_Info& expected_info, const Index_Storage& stitched, const Index_Info& stitched_info)
+	{
+		using Segment = std::pair<std::pair<double, double>, std::pair<double, double>>;
+		auto segment = [](const Index_Storage& dcel, O::DCEL::Index::Handle edge) {
+			return Segment{ { dcel.X(dcel.Tail(edge)), dcel.Y(dcel.Tail(edge)) }, { dcel.X(dcel.Head(edge)), dcel.Y(dcel.Head(edge)) } };
+		};
+
+		ASSERT_EQ(stitched.vertices.size(), expected.vertices.size());
+		ASSERT_EQ(stitched.half_edges.size(), expected.half_edges.size());
+		ASSERT_EQ(stitched_info.faces.size(), expected_info.faces.size());
+
+		std::map<Segment, O::DCEL::Index::Handle> stitched_edges;
+		for (O::DCEL::Index::Handle edge = 0; edge < stitched.half_edges.size(); ++edge)
+		{
+			EXPECT_EQ(stitched.Twin(stitched.Twin(edge)), edge);
+			EXPECT_EQ(stitched.Prev(stitched.Next(edge)), edge);
+			EXPECT_EQ(stitched.Incident_Face(stitched.Next(edge)), stitched.Incident_Face(edge));
+			stitched_edges.emplace(segment(stitched, edge), edge);
+		}
+		ASSERT_EQ(stitched_edges.size(), stitched.half_edges.size());
+
+		for (O::DCEL::Index::Handle edge = 0; edge < expected.half_edges.size(); ++edge)
+		{
+			auto it = stitched_edges.find(segment(expected, edge));
+			ASSERT_NE(it, stitched_edges.end());
+			EXPECT_EQ(segment(stitched, stitched.Next(it->second)), segment(expected, expected.Next(edge)));
+		}
+	}
+
+	// size x size grid of unit squares, one feature per square
+	std::string Grid_JSON(int size)
+	{
+		std::string json = R"({"type":"FeatureCollection","features":[)";
+		for (int i = 0; i < size; ++i)
+			for (int j = 0; j < size; ++j)
+			{
+				if (i || j)
+					json += ",";
+				const std::string x0 = std::to_string(i), x1 = std::to_string(i + 1), y0 = std::to_string(j), y1 = std::to_string(j + 1);
+				json += R"({"type":"Feature","geometry":{"type":"Polygon","coordinates":[[[)" + x0 + "," + y0 + "],[" + x1 + "," + y0 + "],[" + x1 + "," + y1 + "],[" + x0 + "," + y1 + "],[" + x0 + "," + y0 + R"(]]]},"properties":{}})";
+			}
+		return json + "]}";
+	}
+}
+
+TYPED_TEST_SUITE_P(DCEL_Parallel_Builder_Test);
+
+TYPED_TEST_P(DCEL_Parallel_Builder_Test, Same_Export)
+{
+	for (std::size_t thread_count : { 1u, 2u, 4u })
+	{
+		SCOPED_TRACE(thread_count);
+		auto [dcel, info] = Build<O::DCEL::Index::Parallel_From_GeoJSON<>>(TypeParam::json, thread_count);
+		EXPECT_EQ(Serialize(Index_Exporter::Convert(dcel, info)), TypeParam::expected_write);
+	}
+}
+
+TYPED_TEST_P(DCEL_Parallel_Builder_Test, Same_Topology)
+{
+	auto [expected, expected_info] = Build<O::DCEL::Index::From_GeoJSON<>>(TypeParam::json);
+	auto [stitched, stitched_info] = Build<O::DCEL::Index::Parallel_From_GeoJSON<>>(TypeParam::json, 4u);
+	Check_Same_Topology(expected, expected_info, stitched, stitched_info);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(
+	DCEL_Parallel_Builder_Test,
+	Same_Export,
+	Same_Topology
+);
+
+using All_Parallel_Builder_Test_Sets = ::testing::Types<
+	Simple_Exemple,
+	Reverse_Exemple,
+	Hole_Exemple,
+	Multi_Polygon_Exemple
+>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(DCEL, DCEL_Parallel_Builder_Test, All_Parallel_Builder_Test_Sets);
+
+TEST(DCEL_Parallel_Builder, Grid_Seams)
+{
+	// 9 tiles cut the grid, most vertices and edges of the middle lie on a seam
+	const std::string json = Grid_JSON(12);
+	auto [expected, expected_info] = Build<O::DCEL::Index::From_GeoJSON<>>(json);
+	auto [stitched, stitched_info] = Build<O::DCEL::Index::Parallel_From_GeoJSON<>>(json, 9u);
+	Check_Same_Topology(expected, expected_info, stitched, stitched_info);
+	EXPECT_EQ(Serialize(Index_Exporter::Convert(stitched, stitched_info)), Serialize(Index_Exporter::Convert(expected, expected_info)));
+}
+
+TEST(DCEL_Parallel_Builder, Compact_Grid_Seams)
+{
+	// the half edges and the stars are copied field by field, the layouts deriving the head, twin and prev must stitch the same
+	using Compact_Builder = O::DCEL::Index::Parallel_From_GeoJSON<O::DCEL::Index::Topology_Vertex, O::DCEL::Index::Compact_Half_Edge<false>>;
+	const std::string json = Grid_JSON(12);
+	auto [expected, expected_info] = Build<O::DCEL::Index::From_GeoJSON<>>(json);
+
+	Auto_Builder<Compact_Builder> auto_builder(Test_Utils::g_config, 9u);
+	ASSERT_TRUE(Test_Utils::Parse(json, auto_builder));
+	auto stitched = auto_builder.Get_Dcel().value();
+	auto stitched_info = auto_builder.Get_Feature_Info().value();
+	EXPECT_EQ(stitched.vertices.size(), expected.vertices.size());
+	EXPECT_EQ(stitched.half_edges.size(), expected.half_edges.size());
+	EXPECT_EQ(Serialize(O::DCEL::Index::To_GeoJSON<O::DCEL::Index::Topology_Vertex, O::DCEL::Index::Compact_Half_Edge<false>>::Convert(stitched, stitched_info)), Serialize(Index_Exporter::Convert(expected, expected_info)));
+}
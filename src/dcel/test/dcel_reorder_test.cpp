@@ -0,0 +1,127 @@
+#include "dcel_reorder_test.h"
+
+// STL
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+// GEOJSON
+#include "geojson/hilbert.h"
+
+// EXEMPLE
+#include "dcel_exemple/hole_exemple.h"
+#include "dcel_exemple/multi_polygon_exemple.h"
+#include "dcel_exemple/reverse_exemple.h"
+#include "dcel_exemple/simple_exemple.h"
+
+// TEST UTILS
+#include "dcel_test_utils.h"
+
+namespace
+{
+	using Reorder_Half_Edge = Test_Utils::Test_Half_Edge<>;
+	using Reorder_Vertex = Test_Utils::Test_Vertex<>;
+
+	// build the exemple, reorder it and check the new layout, the links and the lookups
+	template<class Exemple, class Policy>
+	void Check_Reorder()
+	{
+		Test_Utils::Auto_Builder<Test_Utils::Test_Builder<Policy>> auto_builder(Test_Utils::g_config);
+		ASSERT_TRUE(Test_Utils::Parse(Exemple::json, auto_builder));
+		auto opt_dcel = auto_builder.Get_Dcel();
+		auto opt_info = auto_builder.Get_Feature_Info();
+		ASSERT_TRUE(opt_dcel.has_value());
+		ASSERT_TRUE(opt_info.has_value());
+		auto& dcel = opt_dcel.value();
+		auto& info = opt_info.value();
+
+		const std::size_t vertex_count = dcel.vertices.size();
+		const std::size_t half_edge_count = dcel.half_edges.size();
+		const std::size_t face_count = dcel.faces.size();
+		dcel.Compact_And_Reorder(info);
+		ASSERT_EQ(dcel.vertices.size(), vertex_count);
+		ASSERT_EQ(dcel.half_edges.size(), half_edge_count);
+		ASSERT_EQ(dcel.faces.size(), face_count);
+
+		// the features read the same
+		EXPECT_EQ(Test_Utils::Serialize(Test_Utils::Test_Exporter<>::Convert(info)), Exemple::expected_write);
+
+		// vertices follow the Hilbert curve
+		double min_x = dcel.vertices[0].x, max_x = min_x, min_y = dcel.vertices[0].y, max_y = min_y;
+		for (const Reorder_Vertex& vertex : dcel.vertices)
+		{
+			min_x = std::min(min_x, vertex.x);
+			max_x = std::max(max_x, vertex.x);
+			min_y = std::min(min_y, vertex.y);
+			max_y = std::max(max_y, vertex.y);
+		}
+		auto hilbert = [&](const Reorder_Vertex& vertex) {
+			auto x = static_cast<std::uint32_t>(std::floor(O::GeoJSON::HILBERT_MAX * (vertex.x - min_x) / (max_x - min_x)));
+			auto y = static_cast<std::uint32_t>(std::floor(O::GeoJSON::HILBERT_MAX * (vertex.y - min_y) / (max_y - min_y)));
+			return O::GeoJSON::Hilbert(x, y);
+		};
+		for (std::size_t i = 1; i < dcel.vertices.size(); ++i)
+			EXPECT_LE(hilbert(dcel.vertices[i - 1]), hilbert(dcel.vertices[i]));
+
+		// the first face is the outer ring of the first feature and its cycle comes first
+		EXPECT_EQ(info.faces[0][0][0], &dcel.faces[0]);
+		EXPECT_EQ(dcel.faces[0].edge, &dcel.half_edges[0]);
+		std::size_t i = 0;
+		O::Unowned_Ptr<Reorder_Half_Edge> edge = dcel.faces[0].edge;
+		do {
+			EXPECT_EQ(edge, &dcel.half_edges[i++]);
+			edge = edge->next;
+		} while (edge != dcel.faces[0].edge);
+
+		// links and lookups point inside the new containers
+		std::set<const void*> elements;
+		for (const auto& vertex : dcel.vertices) elements.insert(&vertex);
+		for (const auto& half_edge : dcel.half_edges) elements.insert(&half_edge);
+		for (const auto& face : dcel.faces) elements.insert(&face);
+		for (Reorder_Half_Edge& half_edge : dcel.half_edges)
+		{
+			EXPECT_TRUE(elements.contains(half_edge.tail));
+			EXPECT_TRUE(elements.contains(half_edge.head));
+			EXPECT_TRUE(elements.contains(half_edge.face));
+			EXPECT_EQ(half_edge.twin->twin, &half_edge);
+			EXPECT_EQ(half_edge.next->prev, &half_edge);
+			EXPECT_EQ(half_edge.next->tail, half_edge.head);
+			EXPECT_EQ(&dcel.Get_Or_Create_Half_Edge(*half_edge.tail, *half_edge.head), &half_edge);
+		}
+		for (Reorder_Vertex& vertex : dcel.vertices)
+		{
+			EXPECT_EQ(&dcel.Get_Or_Create_Vertex(vertex.x, vertex.y), &vertex);
+			for (auto& out_edge : vertex.outgoing_edges)
+				EXPECT_EQ(out_edge->tail, &vertex);
+		}
+		EXPECT_EQ(dcel.vertices.size(), vertex_count);
+		EXPECT_EQ(dcel.half_edges.size(), half_edge_count);
+	}
+}
+
+TYPED_TEST_SUITE_P(DCEL_Reorder_Test);
+
+TYPED_TEST_P(DCEL_Reorder_Test, Vector_Storage)
+{
+	Check_Reorder<TypeParam, O::DCEL::Vector_Policy<>>();
+}
+
+TYPED_TEST_P(DCEL_Reorder_Test, Arena_Star_Lookup)
+{
+	Check_Reorder<TypeParam, O::DCEL::Arena_Policy<4, O::DCEL::Star_Lookup<>>>();
+}
+
+REGISTER_TYPED_TEST_SUITE_P(
+	DCEL_Reorder_Test,
+	Vector_Storage,
+	Arena_Star_Lookup
+);
+
+using All_Reorder_Test_Sets = ::testing::Types<
+	Simple_Exemple,
+	Reverse_Exemple,
+	Hole_Exemple,
+	Multi_Polygon_Exemple
+>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(DCEL, DCEL_Reorder_Test, All_Reorder_Test_Sets);
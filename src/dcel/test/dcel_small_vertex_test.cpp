@@ -0,0 +1,111 @@
+#include "dcel_small_vertex_test.h"
+
+// STL
+#include <memory>
+#include <string>
+
+// DCEL
+#include "dcel/small_vector.h"
+
+// EXEMPLE
+#include "dcel_exemple/hole_exemple.h"
+#include "dcel_exemple/multi_polygon_exemple.h"
+#include "dcel_exemple/reverse_exemple.h"
+#include "dcel_exemple/simple_exemple.h"
+
+// UTILS
+#include <utils/zip.h>
+
+// TEST UTILS
+#include "dcel_test_utils.h"
+
+namespace
+{
+	using Small_Builder = Test_Utils::Test_Builder<O::DCEL::Vector_Policy<>, O::DCEL::Small_Vertex>;
+	using Small_Exporter = Test_Utils::Test_Exporter<O::DCEL::Small_Vertex>;
+}
+
+TEST(DCEL_Small_Vector, Inline_Then_Heap)
+{
+	O::DCEL::Small_Vector<std::unique_ptr<int>, 2> values;
+	values.push_back(std::make_unique<int>(1));
+	values.push_back(std::make_unique<int>(3));
+	EXPECT_TRUE(values.is_inline());
+
+	values.insert(values.begin() + 1, std::make_unique<int>(2));
+	EXPECT_FALSE(values.is_inline());
+	ASSERT_EQ(values.size(), 3u);
+	EXPECT_EQ(*values[0], 1);
+	EXPECT_EQ(*values[1], 2);
+	EXPECT_EQ(*values[2], 3);
+
+	values.erase(values.begin());
+	EXPECT_EQ(*values.front(), 2);
+	EXPECT_EQ(*values.back(), 3);
+
+	O::DCEL::Small_Vector<std::unique_ptr<int>, 2> moved = std::move(values);
+	EXPECT_TRUE(values.empty());
+	EXPECT_EQ(*moved[1], 3);
+
+	values.push_back(std::make_unique<int>(4));
+	O::DCEL::Small_Vector<std::unique_ptr<int>, 2> moved_inline = std::move(values);
+	EXPECT_TRUE(moved_inline.is_inline());
+	EXPECT_EQ(*moved_inline.front(), 4);
+}
+
+TEST(DCEL_Small_Vector, Copy)
+{
+	O::DCEL::Small_Vector<std::string, 4> values{ "a", "b", "c", "d", "e" };
+	O::DCEL::Small_Vector<std::string, 4> copy = values;
+	EXPECT_EQ(copy, values);
+	copy.clear();
+	EXPECT_TRUE(copy.is_inline());
+	copy = values;
+	EXPECT_EQ(copy, values);
+	EXPECT_EQ(copy[4], "e");
+}
+
+TYPED_TEST_SUITE_P(DCEL_Small_Vertex_Test);
+
+TYPED_TEST_P(DCEL_Small_Vertex_Test, Same_DCEL_As_Vector_Vertex)
+{
+	Test_Utils::Auto_Builder<Small_Builder> auto_builder(Test_Utils::g_config);
+	ASSERT_TRUE(Test_Utils::Parse(TypeParam::json, auto_builder));
+	auto opt_dcel = auto_builder.Get_Dcel();
+	ASSERT_TRUE(opt_dcel.has_value());
+	auto& dcel = opt_dcel.value();
+
+	ASSERT_EQ(dcel.vertices.size(), TypeParam::expected_out_edges.size());
+	for (auto&& [vertex, expected_out_edge] : O::Zip(dcel.vertices, TypeParam::expected_out_edges))
+	{
+		EXPECT_EQ(vertex.outgoing_edges.is_inline(), expected_out_edge.size() <= 4);
+		ASSERT_EQ(vertex.outgoing_edges.size(), expected_out_edge.size());
+		for (auto&& [out_edge, expected_out_edge_index] : O::Zip(vertex.outgoing_edges, expected_out_edge))
+			EXPECT_EQ(out_edge, &dcel.half_edges[expected_out_edge_index]);
+	}
+
+	ASSERT_EQ(dcel.half_edges.size(), TypeParam::expected_nexts.size());
+	for (std::size_t i = 0; i < dcel.half_edges.size(); ++i)
+	{
+		EXPECT_EQ(dcel.half_edges[i].next, &dcel.half_edges[TypeParam::expected_nexts[i]]);
+		EXPECT_EQ(dcel.half_edges[i].prev, &dcel.half_edges[TypeParam::expected_prevs[i]]);
+	}
+
+	auto info = auto_builder.Get_Feature_Info();
+	ASSERT_TRUE(info.has_value());
+	EXPECT_EQ(Test_Utils::Serialize(Small_Exporter::Convert(info.value())), TypeParam::expected_write);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(
+	DCEL_Small_Vertex_Test,
+	Same_DCEL_As_Vector_Vertex
+);
+
+using All_Small_Vertex_Test_Sets = ::testing::Types<
+	Simple_Exemple,
+	Reverse_Exemple,
+	Hole_Exemple,
+	Multi_Polygon_Exemple
+>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(DCEL, DCEL_Small_Vertex_Test, All_Small_Vertex_Test_Sets);
@@ -0,0 +1,90 @@
+#ifndef SRC_DCEL_TEST_DCEL_TEST_UTILS_H
+#define SRC_DCEL_TEST_DCEL_TEST_UTILS_H
+
+// STL
+#include <string>
+#include <utility>
+
+// DCEL
+#include "dcel/builder.h"
+#include "dcel/exporter.h"
+#include "dcel/face.h"
+#include "dcel/vertex.h"
+#include "dcel/half_edge.h"
+
+// IO
+#include "io/feature_parser.h"
+#include "io/writer.h"
+
+// RAPIDJSON
+#include <rapidjson/reader.h>
+#include <rapidjson/stringbuffer.h>
+
+// CONFIGURATION
+#include "configuration/dcel.h"
+
+/// @brief scaffolding shared by the DCEL tests building the ``dcel_exemple/`` GeoJSON
+namespace Test_Utils
+{
+	/// @brief configuration of the test builds, the max_* values fit every exemple (the index storage and the arena ignore them)
+	inline const O::Configuration::DCEL g_config{
+		1000,
+		1000,
+		1000,
+		1e-9,
+		O::Configuration::DCEL::Merge_Strategy::AT_FIRST
+	};
+
+	/// @brief pointer half edge closing the CRTP loop of ``O::DCEL::Half_Edge`` on a vertex template (``O::DCEL::Vertex``, ``O::DCEL::Small_Vertex``...)
+	template<template<class...> class Vertex_Type = O::DCEL::Vertex>
+	struct Test_Half_Edge : public O::DCEL::Half_Edge<Vertex_Type<Test_Half_Edge<Vertex_Type>>, Test_Half_Edge<Vertex_Type>, O::DCEL::Face<Test_Half_Edge<Vertex_Type>>> {
+		using O::DCEL::Half_Edge<Vertex_Type<Test_Half_Edge<Vertex_Type>>, Test_Half_Edge<Vertex_Type>, O::DCEL::Face<Test_Half_Edge<Vertex_Type>>>::Half_Edge;
+	};
+
+	template<template<class...> class Vertex_Type = O::DCEL::Vertex>
+	using Test_Vertex = Vertex_Type<Test_Half_Edge<Vertex_Type>>;
+
+	template<template<class...> class Vertex_Type = O::DCEL::Vertex>
+	using Test_Face = O::DCEL::Face<Test_Half_Edge<Vertex_Type>>;
+
+	template<class Policy = O::DCEL::Vector_Policy<>, template<class...> class Vertex_Type = O::DCEL::Vertex>
+	using Test_Builder = O::DCEL::Builder::From_GeoJSON<Test_Vertex<Vertex_Type>, Test_Half_Edge<Vertex_Type>, Test_Face<Vertex_Type>, Policy>;
+
+	template<template<class...> class Vertex_Type = O::DCEL::Vertex>
+	using Test_Exporter = O::DCEL::Exporter::To_GeoJSON<Test_Vertex<Vertex_Type>, Test_Half_Edge<Vertex_Type>, Test_Face<Vertex_Type>>;
+
+	/// @brief any builder fed by ``O::GeoJSON::IO::Feature_Parser``, the constructor arguments are forwarded to the builder
+	template<class Builder>
+	class Auto_Builder : public Builder, public O::GeoJSON::IO::Feature_Parser<Auto_Builder<Builder>> {
+	public:
+		using Builder::On_Full_Feature;
+		using Builder::On_Root;
+		template<class... Args>
+		Auto_Builder(Args&&... args) :
+			Builder(std::forward<Args>(args)...),
+			O::GeoJSON::IO::Feature_Parser<Auto_Builder<Builder>>()
+		{
+
+		}
+	};
+
+	/// @brief parse a GeoJSON string into a builder
+	template<class Builder>
+	bool Parse(const std::string& json, Auto_Builder<Builder>& auto_builder)
+	{
+		rapidjson::StringStream ss(json.c_str());
+		rapidjson::Reader reader;
+		return reader.Parse(ss, auto_builder);
+	}
+
+	/// @brief GeoJSON text written by ``O::GeoJSON::IO::Writer``
+	inline std::string Serialize(const O::GeoJSON::Root& root)
+	{
+		rapidjson::StringBuffer buffer;
+		O::GeoJSON::IO::Writer<rapidjson::StringBuffer> writer(buffer);
+		writer.Write_GeoJSON_Object(root);
+		return buffer.GetString();
+	}
+} // namespace Test_Utils
+
+#endif //SRC_DCEL_TEST_DCEL_TEST_UTILS_H
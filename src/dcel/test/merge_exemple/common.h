@@ -3,6 +3,7 @@
 
 // STL
 #include <ranges>
+#include <type_traits>
 
 // DCEL
 #include "dcel/storage.h"
@@ -49,9 +50,12 @@ namespace Merge_Exemple
 	};
 
 	using Classifier_Storage = O::DCEL::Storage<O::DCEL::Vertex<Half_Edge_Impl>, Half_Edge_Impl, O::DCEL::Face<Half_Edge_Impl>>;
-	Classifier_Storage From_Vertex(const std::vector<Vertex>& v, const std::vector<Half_Edge>& e)
+	using Star_Storage = O::DCEL::Storage<O::DCEL::Vertex<Half_Edge_Impl>, Half_Edge_Impl, O::DCEL::Face<Half_Edge_Impl>, O::DCEL::Vector_Policy<O::DCEL::Star_Lookup<>>>;
+
+	template<class Storage = Classifier_Storage>
+	Storage From_Vertex(const std::vector<Vertex>& v, const std::vector<Half_Edge>& e)
 	{
-		Classifier_Storage storage(dcel_config);
+		Storage storage(dcel_config);
 		// initialize vertex and edges
 		for (size_t _ : std::views::iota(0ul, v.size()))
 		{
@@ -87,7 +91,8 @@ namespace Merge_Exemple
 			storage.half_edges[i].prev = &storage.half_edges[e[i].prev];
 			storage.half_edges[i].face = (O::DCEL::Face<Half_Edge_Impl>*)e[i].face;
 
-			storage.edge_lookup[Half_Edge_Impl::Hash(*storage.half_edges[i].tail, *storage.half_edges[i].head)] = &storage.half_edges[i];
+			if constexpr (!std::is_same_v<decltype(storage.edge_lookup), O::DCEL::No_Edge_Lookup>)
+				storage.edge_lookup[Half_Edge_Impl::Hash(*storage.half_edges[i].tail, *storage.half_edges[i].head)] = &storage.half_edges[i];
 		}
 		return storage;
 	}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include "deferred_feature_test.h"
+
+#include <rapidjson/reader.h>
+
+#include <string>
+#include <vector>
+
+#include "filter/deferred_feature.h"
+#include "io/deferred_stream.h"
+
+using namespace O::GeoJSON;
+
+namespace
+{
+	// Predicate keeping features whose "name" property is "keep"
+	struct Keep_Name
+	{
+		int calls = 0;
+		bool saw_geometry = false;
+
+		bool operator()(const Feature& f) noexcept
+		{
+			++calls;
+			saw_geometry |= f.geometry.has_value();
+			const auto& obj = f.properties.Get_Object();
+			auto it = obj.find("name");
+			return it != obj.end() && it->second.Is_String() && it->second.Get_String() == "keep";
+		}
+	};
+
+	struct Deferred_Collector : public Filter::Deferred_Feature<Deferred_Collector, Keep_Name>
+	{
+		using Filter::Deferred_Feature<Deferred_Collector, Keep_Name>::Deferred_Feature;
+
+		std::vector<Feature> features;
+		int root_calls = 0;
+
+		bool On_Full_Feature(Feature&& f)
+		{
+			features.push_back(std::move(f));
+			return true;
+		}
+
+		bool On_Root(std::optional<Bbox>&&, O::GeoJSON::Id&&)
+		{
+			++root_calls;
+			return true;
+		}
+	};
+
+	const char* SAMPLE = R"({
+	"type":"FeatureCollection",
+	"features":[
+		{"type":"Feature","id":"f1","geometry":{"type":"Point","coordinates":[0.5,1.5]},"properties":{"name":"keep"}},
+		{"type":"Feature","id":"f2","properties":{"name":"drop"},"geometry":{"type":"LineString","coordinates":[[0,0],"not a number"]}},
+		{"type":"Feature","id":"f3","properties":{"name":"keep","note":"} ] \" {"},"geometry" : {"type":"Polygon","coordinates":[[[0,0],[1,0],[1,1],[0,0]]]}},
+		{"type":"Feature","id":"f4","geometry":null,"properties":{"name":"keep"}}
+	]
+})";
+}
+
+TEST_F(Deferred_Feature_Test, Skip_Value_Returns_Raw_Span)
+{
+	std::string json = R"("geometry" : {"a":"}]\"","b":[1,[2]]}, "next":1)";
+	IO::Deferred_Stream stream(json);
+	while (stream.Tell() < 10) stream.Take();
+
+	auto span = stream.Skip_Value();
+	ASSERT_TRUE(span.has_value());
+	EXPECT_EQ(*span, R"({"a":"}]\"","b":[1,[2]]})");
+
+	std::string rest;
+	while (stream.Peek() != '\0') rest.push_back(stream.Take());
+	EXPECT_EQ(rest, R"(:null, "next":1)");
+}
+
+TEST_F(Deferred_Feature_Test, Only_Kept_Features_Are_Decoded)
+{
+	// f2 carries an invalid geometry: it must never be decoded since the predicate drops it
+	IO::Deferred_Stream stream(SAMPLE);
+	Deferred_Collector collector(stream);
+	rapidjson::Reader reader;
+
+	ASSERT_TRUE(reader.Parse(stream, collector));
+	EXPECT_EQ(collector.Get_Predicator().calls, 4);
+	EXPECT_FALSE(collector.Get_Predicator().saw_geometry);
+	EXPECT_EQ(collector.root_calls, 1);
+	ASSERT_EQ(collector.features.size(), 3u);
+
+	EXPECT_EQ(collector.features[0].id.Get_String(), "f1");
+	ASSERT_TRUE(collector.features[0].geometry.has_value());
+	ASSERT_TRUE(collector.features[0].geometry->Is_Point());
+	EXPECT_DOUBLE_EQ(collector.features[0].geometry->Get_Point().position.longitude, 0.5);
+	EXPECT_DOUBLE_EQ(collector.features[0].geometry->Get_Point().position.latitude, 1.5);
+}
+
+TEST_F(Deferred_Feature_Test, Geometry_Before_Or_After_Properties)
+{
+	IO::Deferred_Stream stream(SAMPLE);
+	Deferred_Collector collector(stream);
+	rapidjson::Reader reader;
+
+	ASSERT_TRUE(reader.Parse(stream, collector));
+	ASSERT_EQ(collector.features.size(), 3u);
+	EXPECT_EQ(collector.features[1].id.Get_String(), "f3");
+	ASSERT_TRUE(collector.features[1].geometry.has_value());
+	ASSERT_TRUE(collector.features[1].geometry->Is_Polygon());
+	EXPECT_EQ(collector.features[1].geometry->Get_Polygon().rings[0].size(), 4u);
+	EXPECT_EQ(collector.features[1].properties.Get_Object().at("note").Get_String(), "} ] \" {");
+}
+
+TEST_F(Deferred_Feature_Test, Null_Geometry_Is_Forwarded)
+{
+	IO::Deferred_Stream stream(SAMPLE);
+	Deferred_Collector collector(stream);
+	rapidjson::Reader reader;
+
+	ASSERT_TRUE(reader.Parse(stream, collector));
+	ASSERT_EQ(collector.features.size(), 3u);
+	EXPECT_EQ(collector.features[2].id.Get_String(), "f4");
+	EXPECT_FALSE(collector.features[2].geometry.has_value());
+}
+
+TEST_F(Deferred_Feature_Test, Invalid_Kept_Geometry_Stops_Parsing)
+{
+	std::string json = R"({"type":"Feature","properties":{"name":"keep"},"geometry":{"type":"Polygon","coordinates":[[[0,0],[1,0],[1,1]]]}})";
+	IO::Deferred_Stream stream(json);
+	Deferred_Collector collector(stream);
+	rapidjson::Reader reader;
+
+	EXPECT_FALSE(reader.Parse(stream, collector));
+	EXPECT_EQ(collector.Get_Error(), IO::Error::NEED_AT_LEAST_FOUR_POSITION_FOR_POLYGON);
+	EXPECT_TRUE(collector.features.empty());
+}
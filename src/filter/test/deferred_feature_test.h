@@ -0,0 +1,18 @@
+#ifndef SRC_FILTER_TEST_DEFERRED_FEATURE_TEST_H
+#define SRC_FILTER_TEST_DEFERRED_FEATURE_TEST_H
+
+#include <gtest/gtest.h>
+
+class Deferred_Feature_Test : public ::testing::Test {};
+
+//////////////////////////////////////////////
+/// Nominal tests:
+/// 	- Skip_Value_Returns_Raw_Span
+/// 	- Only_Kept_Features_Are_Decoded
+/// 	- Geometry_Before_Or_After_Properties
+/// 	- Null_Geometry_Is_Forwarded
+/// Error tests:
+/// 	- Invalid_Kept_Geometry_Stops_Parsing
+//////////////////////////////////////////////
+
+#endif //SRC_FILTER_TEST_DEFERRED_FEATURE_TEST_H
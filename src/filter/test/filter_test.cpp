@@ -27,6 +27,8 @@
 #include <sstream>
 
 #include "filter/feature.h"
+#include "io/parser.h"
+#include "io/writer.h"
 #include "geojson/object/feature.h"
 #include "geojson/object/feature_collection.h"
 #include "geojson/object/geometry.h"
@@ -60,7 +62,7 @@ struct FeatureCollector : public Filter::Feature<FeatureCollector<Pred>, Pred >
 {
 	std::vector<Feature> features;
 	std::optional<Bbox> root_bbox;
-	std::optional<std::string> root_id;
+	O::GeoJSON::Id root_id;
 	int root_calls = 0;
 
 	bool On_Full_Feature(Feature&& f)
@@ -69,7 +71,7 @@ struct FeatureCollector : public Filter::Feature<FeatureCollector<Pred>, Pred >
 		return true; // continue parsing
 	}
 
-	bool On_Root(std::optional<Bbox>&& bbox, std::optional<std::string>&& id)
+	bool On_Root(std::optional<Bbox>&& bbox, O::GeoJSON::Id&& id)
 	{
 		++root_calls;
 		root_bbox = std::move(bbox);
@@ -125,10 +127,10 @@ TEST(Feature_Filter_Test, FiltersAndForwardsCorrectly)
 
 	// Collector should have received only the two "keep" features (f1 and f3)
 	ASSERT_EQ(filter.features.size(), 2u);
-	EXPECT_TRUE(filter.features[0].id.has_value());
-	EXPECT_TRUE(filter.features[1].id.has_value());
-	EXPECT_EQ(filter.features[0].id.value(), "f1");
-	EXPECT_EQ(filter.features[1].id.value(), "f3");
+	EXPECT_TRUE(filter.features[0].id.Has_Value());
+	EXPECT_TRUE(filter.features[1].id.Has_Value());
+	EXPECT_EQ(filter.features[0].id.Get_String(), "f1");
+	EXPECT_EQ(filter.features[1].id.Get_String(), "f3");
 
 	// Verify the properties of the forwarded features are intact
 	const auto& f1_props = filter.features[0].properties.Get_Object();
@@ -158,4 +160,37 @@ TEST(Feature_Filter_Test, DropsAllWhenPredicateFalse)
 
 	EXPECT_EQ(filter.Get_Predicator().calls, 3);          // predicate was called for each feature
 	EXPECT_EQ(filter.features.size(), 0u); // nothing forwarded
-}
\ No newline at end of file
+}
+// Filter forwarding its kept features to a streaming writer: nothing but the current feature is held in memory.
+struct Keep_Writer : public Filter::Feature<Keep_Writer, PredCountAndMatch>
+{
+	Keep_Writer(IO::Writer<rapidjson::OStreamWrapper>& writer) : writer(writer) {}
+
+	IO::Writer<rapidjson::OStreamWrapper>& writer;
+
+	bool On_Full_Feature(O::GeoJSON::Feature&& f) { return writer.On_Full_Feature(std::move(f)); }
+	bool On_Root(std::optional<Bbox>&& bbox, O::GeoJSON::Id&& id) { return writer.On_Root(std::move(bbox), std::move(id)); }
+};
+
+TEST(Feature_Filter_Test, Streams_Kept_Features_To_Writer)
+{
+	rapidjson::StringStream ss(kSampleFeatureCollection);
+	rapidjson::Reader reader;
+
+	std::stringstream out;
+	rapidjson::OStreamWrapper osw(out);
+	IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+	Keep_Writer filter(writer);
+
+	ASSERT_TRUE(reader.Parse(ss, filter));
+	EXPECT_FALSE(writer.Is_Streaming());
+
+	auto result = IO::Parse_Geojson_String(out.str());
+	ASSERT_TRUE(result.Has_Value());
+	const auto& fc = result.Value().Get_Feature_Collection();
+	ASSERT_EQ(fc.features.size(), 2u);
+	EXPECT_EQ(fc.features[0].id, O::GeoJSON::Id("f1"));
+	EXPECT_EQ(fc.features[1].id, O::GeoJSON::Id("f3"));
+	ASSERT_TRUE(fc.features[1].geometry.has_value());
+	EXPECT_DOUBLE_EQ(fc.features[1].geometry->Get_Point().position.longitude, 2.0);
+}
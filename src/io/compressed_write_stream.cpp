@@ -0,0 +1,379 @@
+#include "io/compressed_write_stream.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef OGEOFLOW_HAS_ZLIB
+#include <zlib.h>
+#endif
+#ifdef OGEOFLOW_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+#include "io/fd_write_stream.h"
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	/// one slot of the block ring
+	struct Block
+	{
+		enum class State { FREE, QUEUED, DONE };
+
+		std::vector<char> input;       ///< uncompressed bytes, sized to the block size
+		std::size_t size = 0;          ///< number of filled bytes in input
+		std::vector<char> output;      ///< compressed bytes
+		std::uint32_t crc = 0;         ///< crc32 of the filled input (gzip only)
+		bool last = false;             ///< final block of the stream
+		bool failed = false;           ///< compression failed
+		State state = State::FREE;     ///< guarded by the pipeline mutex
+	};
+
+	/// per worker compression context, reused for every block the worker compresses
+	class Block_Compressor
+	{
+	public:
+		Block_Compressor(Compression compression, int level) :
+			m_compression(compression),
+			m_level(level)
+		{
+
+		}
+
+		~Block_Compressor()
+		{
+#ifdef OGEOFLOW_HAS_ZLIB
+			if (m_deflate_ready)
+				deflateEnd(&m_deflate);
+#endif
+#ifdef OGEOFLOW_HAS_ZSTD
+			ZSTD_freeCCtx(m_zstd);
+#endif
+		}
+
+		Block_Compressor(const Block_Compressor&) = delete;
+		Block_Compressor& operator=(const Block_Compressor&) = delete;
+
+		bool Compress(Block& block)
+		{
+			switch (m_compression)
+			{
+			case Compression::GZIP: return Deflate(block);
+			case Compression::ZSTD: return Zstd(block);
+			}
+			return false;
+		}
+
+	private:
+		bool Deflate(Block& block)
+		{
+#ifdef OGEOFLOW_HAS_ZLIB
+			if (!m_deflate_ready)
+			{
+				if (deflateInit2(&m_deflate, m_level < 0 ? Z_DEFAULT_COMPRESSION : m_level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+					return false;
+				m_deflate_ready = true;
+			}
+			else if (deflateReset(&m_deflate) != Z_OK)
+				return false;
+
+			// raw deflate segment: a sync flush ends it on a byte boundary so the next segment can follow, the last block carries the final deflate block
+			block.output.resize(deflateBound(&m_deflate, static_cast<uLong>(block.size)) + 16);
+			m_deflate.next_in = reinterpret_cast<Bytef*>(block.input.data());
+			m_deflate.avail_in = static_cast<uInt>(block.size);
+			m_deflate.next_out = reinterpret_cast<Bytef*>(block.output.data());
+			m_deflate.avail_out = static_cast<uInt>(block.output.size());
+			const int result = deflate(&m_deflate, block.last ? Z_FINISH : Z_SYNC_FLUSH);
+			if (block.last ? result != Z_STREAM_END : (result != Z_OK || m_deflate.avail_in != 0 || m_deflate.avail_out == 0))
+				return false;
+			block.output.resize(block.output.size() - m_deflate.avail_out);
+			block.crc = static_cast<std::uint32_t>(crc32(0L, reinterpret_cast<const Bytef*>(block.input.data()), static_cast<uInt>(block.size)));
+			return true;
+#else
+			(void)block;
+			return false;
+#endif
+		}
+
+		bool Zstd(Block& block)
+		{
+#ifdef OGEOFLOW_HAS_ZSTD
+			if (!m_zstd && !(m_zstd = ZSTD_createCCtx()))
+				return false;
+			block.output.resize(ZSTD_compressBound(block.size));
+			const std::size_t result = ZSTD_compressCCtx(m_zstd, block.output.data(), block.output.size(), block.input.data(), block.size, m_level < 0 ? ZSTD_CLEVEL_DEFAULT : m_level);
+			if (ZSTD_isError(result))
+				return false;
+			block.output.resize(result);
+			return true;
+#else
+			(void)block;
+			return false;
+#endif
+		}
+
+		Compression m_compression;
+		int m_level;
+#ifdef OGEOFLOW_HAS_ZLIB
+		z_stream m_deflate = {};
+		bool m_deflate_ready = false;
+#endif
+#ifdef OGEOFLOW_HAS_ZSTD
+		ZSTD_CCtx* m_zstd = nullptr;
+#endif
+	};
+
+	void Put_Le32(Fd_Write_Stream& file, std::uint32_t value)
+	{
+		const char bytes[4] = { char(value & 0xff), char((value >> 8) & 0xff), char((value >> 16) & 0xff), char((value >> 24) & 0xff) };
+		file.Write(bytes, sizeof(bytes));
+	}
+}
+
+struct Compressed_Write_Stream::Pipeline
+{
+	Fd_Write_Stream file;                 ///< compressed output
+	Compression compression;              ///< output format
+	int level;                            ///< compression level
+	std::vector<Block> ring;              ///< block buffers, block n uses ring[n % ring.size()]
+	std::uint64_t submitted = 0;          ///< blocks handed to the workers
+	std::uint64_t written = 0;            ///< blocks written to the file
+	std::uint64_t submitted_bytes = 0;    ///< uncompressed bytes handed to the workers
+	std::uint32_t crc = 0;                ///< crc32 of the written uncompressed bytes
+	std::uint64_t total = 0;              ///< number of written uncompressed bytes
+	Error error = Error::NO_ERROR;        ///< first error
+	bool closed = false;                  ///< Close has been called
+
+	std::mutex mutex;
+	std::condition_variable work;         ///< a block has been queued or the workers must stop
+	std::condition_variable done;         ///< a block has been compressed
+	std::deque<Block*> queue;             ///< blocks waiting for a worker
+	bool stop = false;
+	std::vector<std::thread> workers;
+
+	~Pipeline() { Stop(); }
+
+	/// worker loop: compress queued blocks until stopped
+	void Work()
+	{
+		Block_Compressor compressor(compression, level);
+		for (;;)
+		{
+			Block* block;
+			{
+				std::unique_lock lock(mutex);
+				work.wait(lock, [&] { return stop || !queue.empty(); });
+				if (queue.empty())
+					return;
+				block = queue.front();
+				queue.pop_front();
+			}
+			const bool ok = compressor.Compress(*block);
+			{
+				std::lock_guard lock(mutex);
+				block->failed = !ok;
+				block->state = Block::State::DONE;
+			}
+			done.notify_all();
+		}
+	}
+
+	/**
+	 * @brief write the oldest unwritten block and free its buffer
+	 * @param wait wait for the block to be compressed
+	 * @return false if the block is not compressed yet (only when not waiting)
+	 */
+	bool Write_Next(bool wait)
+	{
+		Block& block = ring[written % ring.size()];
+		{
+			std::unique_lock lock(mutex);
+			if (wait)
+				done.wait(lock, [&] { return block.state == Block::State::DONE; });
+			else if (block.state != Block::State::DONE)
+				return false;
+		}
+		if (block.failed && error == Error::NO_ERROR)
+			error = Error::COMPRESSION_FAILED;
+		if (error == Error::NO_ERROR)
+		{
+			file.Write(block.output.data(), block.output.size());
+#ifdef OGEOFLOW_HAS_ZLIB
+			if (compression == Compression::GZIP)
+				crc = static_cast<std::uint32_t>(crc32_combine(crc, block.crc, static_cast<z_off_t>(block.size)));
+#endif
+			total += block.size;
+		}
+		{
+			std::lock_guard lock(mutex);
+			block.state = Block::State::FREE;
+		}
+		++written;
+		return true;
+	}
+
+	void Stop()
+	{
+		{
+			std::lock_guard lock(mutex);
+			stop = true;
+		}
+		work.notify_all();
+		for (std::thread& worker : workers)
+			worker.join();
+		workers.clear();
+	}
+};
+
+bool Compressed_Write_Stream::Is_Available(Compression compression) noexcept
+{
+	switch (compression)
+	{
+#ifdef OGEOFLOW_HAS_ZLIB
+	case Compression::GZIP: return true;
+#endif
+#ifdef OGEOFLOW_HAS_ZSTD
+	case Compression::ZSTD: return true;
+#endif
+	default: return false;
+	}
+}
+
+O::Expected<Compressed_Write_Stream, Error> Compressed_Write_Stream::Open(const std::filesystem::path& path, Compression compression, int level, std::size_t thread_count, std::size_t block_size)
+{
+	if (!Is_Available(compression))
+		return O::Expected<Compressed_Write_Stream, Error>::Make_Error(Error::COMPRESSION_UNAVAILABLE);
+	auto file = Fd_Write_Stream::Open(path);
+	if (!file.Has_Value())
+		return O::Expected<Compressed_Write_Stream, Error>::Make_Error(file.Error());
+
+	if (thread_count == 0)
+		thread_count = std::max(1u, std::thread::hardware_concurrency());
+	block_size = std::max<std::size_t>(block_size, 1);
+
+	Compressed_Write_Stream stream;
+	stream.m_pipeline = std::make_unique<Pipeline>();
+	Pipeline& pipeline = *stream.m_pipeline;
+	pipeline.file = std::move(file.Value());
+	pipeline.compression = compression;
+	pipeline.level = level;
+	pipeline.ring.resize(2 * thread_count + 1);
+	for (Block& block : pipeline.ring)
+		block.input.resize(block_size);
+
+	if (compression == Compression::GZIP)
+	{
+		// fixed gzip member header: magic, deflate, no flag, no mtime, no extra flag, unknown OS
+		const char header[10] = { '\x1f', '\x8b', 8, 0, 0, 0, 0, 0, 0, '\xff' };
+		pipeline.file.Write(header, sizeof(header));
+	}
+
+	for (std::size_t i = 0; i < thread_count; ++i)
+		pipeline.workers.emplace_back([&pipeline] { pipeline.Work(); });
+
+	stream.m_cursor = pipeline.ring.front().input.data();
+	stream.m_end = stream.m_cursor + block_size;
+	return O::Expected<Compressed_Write_Stream, Error>::Make_Value(std::move(stream));
+}
+
+Compressed_Write_Stream::Compressed_Write_Stream() = default;
+
+Compressed_Write_Stream::Compressed_Write_Stream(Compressed_Write_Stream&& other) noexcept :
+	m_pipeline(std::move(other.m_pipeline)),
+	m_cursor(std::exchange(other.m_cursor, nullptr)),
+	m_end(std::exchange(other.m_end, nullptr))
+{
+
+}
+
+Compressed_Write_Stream& Compressed_Write_Stream::operator=(Compressed_Write_Stream&& other) noexcept
+{
+	if (this != &other)
+	{
+		Close();
+		m_pipeline = std::move(other.m_pipeline);
+		m_cursor = std::exchange(other.m_cursor, nullptr);
+		m_end = std::exchange(other.m_end, nullptr);
+	}
+	return *this;
+}
+
+Compressed_Write_Stream::~Compressed_Write_Stream()
+{
+	Close();
+}
+
+void Compressed_Write_Stream::Submit_Block(bool last)
+{
+	Pipeline& pipeline = *m_pipeline;
+	const std::size_t ring_size = pipeline.ring.size();
+	Block& block = pipeline.ring[pipeline.submitted % ring_size];
+	block.size = static_cast<std::size_t>(m_cursor - block.input.data());
+	block.last = last;
+	{
+		std::lock_guard lock(pipeline.mutex);
+		block.state = Block::State::QUEUED;
+		pipeline.queue.push_back(&block);
+	}
+	pipeline.work.notify_one();
+	++pipeline.submitted;
+	pipeline.submitted_bytes += block.size;
+
+	// write every block already compressed, then wait until the buffer of the next block is free
+	while (pipeline.written < pipeline.submitted && pipeline.Write_Next(false)) {}
+	if (last)
+	{
+		m_cursor = m_end = nullptr;
+		return;
+	}
+	while (pipeline.written + ring_size <= pipeline.submitted)
+		pipeline.Write_Next(true);
+
+	Block& next = pipeline.ring[pipeline.submitted % ring_size];
+	m_cursor = next.input.data();
+	m_end = m_cursor + next.input.size();
+}
+
+Error Compressed_Write_Stream::Close()
+{
+	if (!m_pipeline || m_pipeline->closed)
+		return Get_Error();
+	Pipeline& pipeline = *m_pipeline;
+	Submit_Block(true);
+	while (pipeline.written < pipeline.submitted)
+		pipeline.Write_Next(true);
+	pipeline.Stop();
+
+	if (pipeline.compression == Compression::GZIP && pipeline.error == Error::NO_ERROR)
+	{
+		Put_Le32(pipeline.file, pipeline.crc);
+		Put_Le32(pipeline.file, static_cast<std::uint32_t>(pipeline.total));
+	}
+	const Error file_error = pipeline.file.Close();
+	if (pipeline.error == Error::NO_ERROR)
+		pipeline.error = file_error;
+	pipeline.closed = true;
+	return pipeline.error;
+}
+
+Error Compressed_Write_Stream::Get_Error() const noexcept
+{
+	if (!m_pipeline)
+		return Error::NO_ERROR;
+	return m_pipeline->error != Error::NO_ERROR ? m_pipeline->error : m_pipeline->file.Get_Error();
+}
+
+std::uint64_t Compressed_Write_Stream::Tell() const noexcept
+{
+	if (!m_pipeline)
+		return 0;
+	const Pipeline& pipeline = *m_pipeline;
+	const char* start = pipeline.closed ? m_cursor : pipeline.ring[pipeline.submitted % pipeline.ring.size()].input.data();
+	return pipeline.submitted_bytes + static_cast<std::uint64_t>(m_cursor - start);
+}
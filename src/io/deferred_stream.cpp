@@ -0,0 +1,76 @@
+#include "io/deferred_stream.h"
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	constexpr const char* NULL_VALUE = ":null";
+
+	bool Is_Whitespace(char c)
+	{
+		return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+	}
+}
+
+Deferred_Stream::Deferred_Stream(std::string_view buffer) :
+	m_begin(buffer.data()),
+	m_current(buffer.data()),
+	m_end(buffer.data() + buffer.size())
+{
+
+}
+
+std::optional<std::string_view> Deferred_Stream::Skip_Value()
+{
+	if (m_injected)
+		return std::nullopt;
+
+	const Ch* cursor = m_current;
+	while (cursor != m_end && Is_Whitespace(*cursor)) ++cursor;
+	if (cursor == m_end || *cursor != ':')
+		return std::nullopt;
+	++cursor;
+	while (cursor != m_end && Is_Whitespace(*cursor)) ++cursor;
+	if (cursor == m_end || (*cursor != '{' && *cursor != '['))
+		return std::nullopt;
+
+	const Ch* value_begin = cursor;
+	std::size_t depth = 0;
+	bool in_string = false;
+	while (cursor != m_end)
+	{
+		Ch c = *cursor++;
+		if (in_string)
+		{
+			if (c == '\\')
+			{
+				if (cursor == m_end) break;
+				++cursor;
+			}
+			else if (c == '"')
+				in_string = false;
+			continue;
+		}
+		switch (c)
+		{
+			case '"':
+				in_string = true;
+				break;
+			case '{':
+			case '[':
+				++depth;
+				break;
+			case '}':
+			case ']':
+				if (--depth == 0)
+				{
+					m_current = cursor;
+					m_injected = NULL_VALUE;
+					return std::string_view(value_begin, static_cast<std::size_t>(cursor - value_begin));
+				}
+				break;
+		}
+	}
+	// unbalanced value: leave the stream untouched so the reader reports the error
+	return std::nullopt;
+}
@@ -0,0 +1,206 @@
+#include "io/fd_write_stream.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	int Open_File(const std::filesystem::path& path, bool direct_io)
+	{
+#ifdef _WIN32
+		(void)direct_io;
+		return _wopen(path.wstring().c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+		int flags = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef O_DIRECT
+		if (direct_io)
+			flags |= O_DIRECT;
+#endif
+		return open(path.c_str(), flags, 0644);
+#endif
+	}
+
+	/// write the whole range, retrying on partial writes and interruptions
+	bool Write_All(int fd, const char* data, std::size_t size)
+	{
+		while (size)
+		{
+#ifdef _WIN32
+			const unsigned chunk = size > (1u << 30) ? (1u << 30) : static_cast<unsigned>(size);
+			const int result = _write(fd, data, chunk);
+#else
+			const ssize_t result = write(fd, data, size);
+#endif
+			if (result < 0)
+			{
+				if (errno == EINTR)
+					continue;
+				return false;
+			}
+			data += result;
+			size -= static_cast<std::size_t>(result);
+		}
+		return true;
+	}
+
+	/// stop bypassing the page cache so that an unaligned tail can be written
+	void Disable_Direct_IO(int fd)
+	{
+#if !defined(_WIN32) && defined(O_DIRECT)
+		int flags = fcntl(fd, F_GETFL);
+		if (flags >= 0)
+			fcntl(fd, F_SETFL, flags & ~O_DIRECT);
+#elif defined(__APPLE__)
+		fcntl(fd, F_NOCACHE, 0);
+#else
+		(void)fd;
+#endif
+	}
+}
+
+O::Expected<Fd_Write_Stream, Error> Fd_Write_Stream::Open(const std::filesystem::path& path, bool direct_io, std::size_t buffer_size)
+{
+	Fd_Write_Stream stream;
+	stream.m_fd = Open_File(path, direct_io);
+	stream.m_direct = direct_io && stream.m_fd >= 0;
+	if (stream.m_fd < 0 && direct_io)
+		stream.m_fd = Open_File(path, false); // the file system refuses O_DIRECT (tmpfs, ...)
+	if (stream.m_fd < 0)
+		return O::Expected<Fd_Write_Stream, Error>::Make_Error(Error::FILE_OPENNING_FAILED);
+#if defined(__APPLE__)
+	if (direct_io)
+		stream.m_direct = fcntl(stream.m_fd, F_NOCACHE, 1) == 0;
+#elif !defined(O_DIRECT)
+	stream.m_direct = false;
+#endif
+
+	buffer_size = (std::max(buffer_size, ALIGNMENT) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+	stream.m_buffer = static_cast<char*>(::operator new[](buffer_size, std::align_val_t(ALIGNMENT)));
+	stream.m_cursor = stream.m_buffer;
+	stream.m_end = stream.m_buffer + buffer_size;
+	return O::Expected<Fd_Write_Stream, Error>::Make_Value(std::move(stream));
+}
+
+Fd_Write_Stream::Fd_Write_Stream(Fd_Write_Stream&& other) noexcept :
+	m_fd(std::exchange(other.m_fd, -1)),
+	m_direct(std::exchange(other.m_direct, false)),
+	m_buffer(std::exchange(other.m_buffer, nullptr)),
+	m_cursor(std::exchange(other.m_cursor, nullptr)),
+	m_end(std::exchange(other.m_end, nullptr)),
+	m_written(std::exchange(other.m_written, 0)),
+	m_error(std::exchange(other.m_error, Error::NO_ERROR))
+{
+
+}
+
+Fd_Write_Stream& Fd_Write_Stream::operator=(Fd_Write_Stream&& other) noexcept
+{
+	if (this != &other)
+	{
+		Close();
+		m_fd = std::exchange(other.m_fd, -1);
+		m_direct = std::exchange(other.m_direct, false);
+		m_buffer = std::exchange(other.m_buffer, nullptr);
+		m_cursor = std::exchange(other.m_cursor, nullptr);
+		m_end = std::exchange(other.m_end, nullptr);
+		m_written = std::exchange(other.m_written, 0);
+		m_error = std::exchange(other.m_error, Error::NO_ERROR);
+	}
+	return *this;
+}
+
+Fd_Write_Stream::~Fd_Write_Stream()
+{
+	Close();
+}
+
+void Fd_Write_Stream::Flush()
+{
+	if (!m_buffer)
+		return;
+	std::size_t size = static_cast<std::size_t>(m_cursor - m_buffer);
+	if (m_direct)
+		size -= size % ALIGNMENT;
+	if (size)
+		Write_Block(size);
+}
+
+void Fd_Write_Stream::Write(const Ch* data, std::size_t size)
+{
+	while (size)
+	{
+		if (m_cursor == m_end && !Make_Room())
+			return;
+		const std::size_t chunk = std::min(size, static_cast<std::size_t>(m_end - m_cursor));
+		std::memcpy(m_cursor, data, chunk);
+		m_cursor += chunk;
+		data += chunk;
+		size -= chunk;
+	}
+}
+
+Error Fd_Write_Stream::Close()
+{
+	if (m_fd < 0)
+		return m_error;
+	Flush();
+	if (m_cursor != m_buffer)
+	{
+		Disable_Direct_IO(m_fd);
+		m_direct = false;
+		Write_Block(static_cast<std::size_t>(m_cursor - m_buffer));
+	}
+#ifdef _WIN32
+	if (_close(m_fd) != 0 && m_error == Error::NO_ERROR)
+#else
+	if (close(m_fd) != 0 && m_error == Error::NO_ERROR)
+#endif
+		m_error = Error::FILE_WRITE_FAILED;
+	m_fd = -1;
+	Release();
+	return m_error;
+}
+
+bool Fd_Write_Stream::Make_Room()
+{
+	if (!m_buffer)
+	{
+		if (m_error == Error::NO_ERROR)
+			m_error = Error::FILE_WRITE_FAILED;
+		return false;
+	}
+	Write_Block(static_cast<std::size_t>(m_cursor - m_buffer));
+	return true;
+}
+
+void Fd_Write_Stream::Write_Block(std::size_t size)
+{
+	if (m_error == Error::NO_ERROR && !Write_All(m_fd, m_buffer, size))
+		m_error = Error::FILE_WRITE_FAILED;
+	const std::size_t remaining = static_cast<std::size_t>(m_cursor - m_buffer) - size;
+	std::memmove(m_buffer, m_buffer + size, remaining);
+	m_cursor = m_buffer + remaining;
+	m_written += size;
+}
+
+void Fd_Write_Stream::Release() noexcept
+{
+	if (m_buffer)
+		::operator delete[](m_buffer, std::align_val_t(ALIGNMENT));
+	m_buffer = m_cursor = m_end = nullptr;
+	m_direct = false;
+}
@@ -0,0 +1,252 @@
+#include "io/feature_index.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include <rapidjson/filereadstream.h>
+
+#include "io/sax_parser.h"
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	constexpr char INDEX_MAGIC[4] = { 'O', 'G', 'F', 'I' };
+	constexpr std::uint32_t INDEX_VERSION = 1;
+
+	struct Index_Header
+	{
+		char magic[4];
+		std::uint32_t version;
+		std::uint64_t source_size;
+		std::uint64_t count;
+	};
+
+	constexpr std::array<double, 4> EMPTY_ENVELOPE = {
+		std::numeric_limits<double>::infinity(),
+		std::numeric_limits<double>::infinity(),
+		-std::numeric_limits<double>::infinity(),
+		-std::numeric_limits<double>::infinity()
+	};
+
+	void Expand(std::array<double, 4>& envelope, const O::GeoJSON::Position& position)
+	{
+		envelope[0] = std::min(envelope[0], position.longitude);
+		envelope[1] = std::min(envelope[1], position.latitude);
+		envelope[2] = std::max(envelope[2], position.longitude);
+		envelope[3] = std::max(envelope[3], position.latitude);
+	}
+
+	void Expand(std::array<double, 4>& envelope, const std::vector<O::GeoJSON::Position>& positions)
+	{
+		for (const auto& position : positions)
+			Expand(envelope, position);
+	}
+
+	void Expand(std::array<double, 4>& envelope, const O::GeoJSON::Polygon& polygon)
+	{
+		for (const auto& ring : polygon.rings)
+			Expand(envelope, ring);
+	}
+
+	/// geometry collection children are expanded by their own ``On_Geometry`` call
+	void Expand(std::array<double, 4>& envelope, const O::GeoJSON::Geometry& geometry)
+	{
+		if (geometry.Is_Point())                  Expand(envelope, geometry.Get_Point().position);
+		else if (geometry.Is_Multi_Point())       Expand(envelope, geometry.Get_Multi_Point().points);
+		else if (geometry.Is_Line_String())       Expand(envelope, geometry.Get_Line_String().positions);
+		else if (geometry.Is_Multi_Line_String())
+			for (const auto& line : geometry.Get_Multi_Line_String().line_strings)
+				Expand(envelope, line.positions);
+		else if (geometry.Is_Polygon())           Expand(envelope, geometry.Get_Polygon());
+		else if (geometry.Is_Multi_Polygon())
+			for (const auto& polygon : geometry.Get_Multi_Polygon().polygons)
+				Expand(envelope, polygon);
+	}
+
+	/**
+	 * @brief SAX handler recording the byte span, envelope and id hash of every feature of a FeatureCollection
+	 */
+	class Index_Builder : public SAX_Parser<Index_Builder>
+	{
+	public:
+		Index_Builder(const rapidjson::FileReadStream& stream) :
+			m_stream(stream)
+		{
+
+		}
+
+		bool StartObject()
+		{
+			// the reader has already taken the opening brace
+			if (Current_State() == Parse_State::FEATURE_COLLECTION)
+			{
+				m_offset = m_stream.Tell() - 1;
+				m_envelope = EMPTY_ENVELOPE;
+			}
+			return SAX_Parser<Index_Builder>::StartObject();
+		}
+
+		bool EndObject(rapidjson::SizeType element_count)
+		{
+			bool is_feature = Current_State() == Parse_State::FEATURE;
+			if (!SAX_Parser<Index_Builder>::EndObject(element_count))
+				return false;
+			if (is_feature)
+				m_entries.back().length = m_stream.Tell() - m_entries.back().offset;
+			return true;
+		}
+
+		bool On_Geometry(O::GeoJSON::Geometry&& geometry, std::size_t /*element_number*/)
+		{
+			Expand(m_envelope, geometry);
+			return true;
+		}
+
+		bool On_Feature(O::GeoJSON::Feature&& feature)
+		{
+			m_entries.push_back(Feature_Index_Entry{ m_offset, 0, m_envelope, feature.id ? Feature_Index::Hash_Id(feature.id.To_String()) : 0 });
+			return true;
+		}
+
+		bool On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& /*bbox*/, O::GeoJSON::Id&& /*id*/)
+		{
+			m_is_feature_collection = true;
+			return true;
+		}
+
+		bool Is_Feature_Collection() const { return m_is_feature_collection; }
+		std::vector<Feature_Index_Entry>& Get_Entries() { return m_entries; }
+
+	private:
+		const rapidjson::FileReadStream& m_stream;   ///< stream being parsed, used for byte offsets
+		std::vector<Feature_Index_Entry> m_entries;  ///< entries of the already parsed features
+		std::uint64_t m_offset = 0;                  ///< offset of the feature being parsed
+		std::array<double, 4> m_envelope = EMPTY_ENVELOPE; ///< envelope of the feature being parsed
+		bool m_is_feature_collection = false;        ///< root object was a FeatureCollection
+	};
+}
+
+O::Expected<Feature_Index, Error> Feature_Index::Build(const std::filesystem::path& geojson_file)
+{
+	auto fp = std::unique_ptr<FILE, decltype(&fclose)>(fopen(geojson_file.string().c_str(), "rb"), fclose);
+	if (!fp) return O::Expected<Feature_Index, Error>::Make_Error(Error::FILE_OPENNING_FAILED);
+
+	char readBuffer[65536];
+	rapidjson::FileReadStream is(fp.get(), readBuffer, sizeof(readBuffer));
+
+	rapidjson::Reader reader;
+	Index_Builder handler(is);
+
+	if (!reader.Parse(is, handler))
+	{
+		if (handler.Get_Error() != Error::NO_ERROR)
+			return O::Expected<Feature_Index, Error>::Make_Error(handler.Get_Error());
+		else
+			return O::Expected<Feature_Index, Error>::Make_Error(Error::PARSING_ERROR);
+	}
+	if (!handler.Is_Feature_Collection())
+		return O::Expected<Feature_Index, Error>::Make_Error(Error::UNKNOWN_ROOT_OBJECT);
+
+	Feature_Index index;
+	index.m_entries = std::move(handler.Get_Entries());
+	index.m_source_size = static_cast<std::uint64_t>(std::filesystem::file_size(geojson_file));
+	return O::Expected<Feature_Index, Error>::Make_Value(std::move(index));
+}
+
+O::Expected<Feature_Index, Error> Feature_Index::Load(const std::filesystem::path& index_file)
+{
+	auto fp = std::unique_ptr<FILE, decltype(&fclose)>(fopen(index_file.string().c_str(), "rb"), fclose);
+	if (!fp) return O::Expected<Feature_Index, Error>::Make_Error(Error::FILE_OPENNING_FAILED);
+
+	Index_Header header;
+	if (fread(&header, sizeof(header), 1, fp.get()) != 1
+		|| std::memcmp(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0
+		|| header.version != INDEX_VERSION)
+		return O::Expected<Feature_Index, Error>::Make_Error(Error::INVALID_INDEX_FILE);
+
+	// the count comes from the file, check it against the bytes left before allocating
+	std::error_code error;
+	const std::uintmax_t file_size = std::filesystem::file_size(index_file, error);
+	if (error || file_size < sizeof(header) || header.count > (file_size - sizeof(header)) / sizeof(Feature_Index_Entry))
+		return O::Expected<Feature_Index, Error>::Make_Error(Error::INVALID_INDEX_FILE);
+
+	Feature_Index index;
+	index.m_source_size = header.source_size;
+	index.m_entries.resize(static_cast<std::size_t>(header.count));
+	if (fread(index.m_entries.data(), sizeof(Feature_Index_Entry), index.m_entries.size(), fp.get()) != index.m_entries.size())
+		return O::Expected<Feature_Index, Error>::Make_Error(Error::INVALID_INDEX_FILE);
+	return O::Expected<Feature_Index, Error>::Make_Value(std::move(index));
+}
+
+Error Feature_Index::Save(const std::filesystem::path& index_file) const
+{
+	auto fp = std::unique_ptr<FILE, decltype(&fclose)>(fopen(index_file.string().c_str(), "wb"), fclose);
+	if (!fp) return Error::FILE_OPENNING_FAILED;
+
+	Index_Header header;
+	std::memcpy(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+	header.version = INDEX_VERSION;
+	header.source_size = m_source_size;
+	header.count = m_entries.size();
+	if (fwrite(&header, sizeof(header), 1, fp.get()) != 1
+		|| fwrite(m_entries.data(), sizeof(Feature_Index_Entry), m_entries.size(), fp.get()) != m_entries.size())
+		return Error::FILE_OPENNING_FAILED;
+	return Error::NO_ERROR;
+}
+
+std::uint64_t Feature_Index::Hash_Id(std::string_view id)
+{
+	std::uint64_t hash = 14695981039346656037ull;
+	for (char c : id)
+	{
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 1099511628211ull;
+	}
+	return hash ? hash : 1;
+}
+
+std::vector<std::size_t> Feature_Index::Query(const std::array<double, 4>& bbox) const
+{
+	std::vector<std::size_t> indices;
+	for (std::size_t i = 0; i < m_entries.size(); ++i)
+	{
+		const auto& envelope = m_entries[i].envelope;
+		if (envelope[0] <= bbox[2] && envelope[2] >= bbox[0] && envelope[1] <= bbox[3] && envelope[3] >= bbox[1])
+			indices.push_back(i);
+	}
+	return indices;
+}
+
+std::vector<std::size_t> Feature_Index::Find(std::string_view id) const
+{
+	std::uint64_t hash = Hash_Id(id);
+	std::vector<std::size_t> indices;
+	for (std::size_t i = 0; i < m_entries.size(); ++i)
+		if (m_entries[i].id_hash == hash)
+			indices.push_back(i);
+	return indices;
+}
+
+O::Expected<Indexed_Reader, Error> Indexed_Reader::Open(const std::filesystem::path& geojson_file, Feature_Index index)
+{
+	auto file = Mapped_File::Open(geojson_file);
+	if (!file.Has_Value())
+		return O::Expected<Indexed_Reader, Error>::Make_Error(file.Error());
+	if (file.Value().View().size() != index.Get_Source_Size())
+		return O::Expected<Indexed_Reader, Error>::Make_Error(Error::INVALID_INDEX_FILE);
+
+	Indexed_Reader reader;
+	reader.m_file = std::move(file.Value());
+	reader.m_index = std::move(index);
+	return O::Expected<Indexed_Reader, Error>::Make_Value(std::move(reader));
+}
+
+std::string_view Indexed_Reader::Feature_Text(std::size_t i) const
+{
+	const auto& entry = m_index[i];
+	return m_file.View().substr(entry.offset, entry.length);
+}
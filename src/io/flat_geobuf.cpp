@@ -0,0 +1,1020 @@
+#include "io/flat_geobuf.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <numeric>
+
+#include <rapidjson/stringbuffer.h>
+
+#include "io/property_builder.h"
+#include "io/writer.h"
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	/// @brief "fgb", major version 3, "fgb", patch version (ignored on read)
+	constexpr std::array<char, 8> MAGIC = { 'f', 'g', 'b', 3, 'f', 'g', 'b', 0 };
+	constexpr std::size_t MAGIC_CHECKED_SIZE = 7;
+	constexpr std::size_t PREFIX_SIZE = MAGIC.size() + sizeof(std::uint32_t);
+
+	/// @name FlatBuffers field ids of the FlatGeobuf schema
+	/// @{
+	enum Header_Field : std::uint16_t
+	{
+		HEADER_NAME = 0,
+		HEADER_ENVELOPE = 1,
+		HEADER_GEOMETRY_TYPE = 2,
+		HEADER_HAS_Z = 3,
+		HEADER_COLUMNS = 7,
+		HEADER_FEATURES_COUNT = 8,
+		HEADER_INDEX_NODE_SIZE = 9,
+	};
+
+	enum Column_Field : std::uint16_t
+	{
+		COLUMN_NAME = 0,
+		COLUMN_TYPE = 1,
+	};
+
+	enum Feature_Field : std::uint16_t
+	{
+		FEATURE_GEOMETRY = 0,
+		FEATURE_PROPERTIES = 1,
+	};
+
+	enum Geometry_Field : std::uint16_t
+	{
+		GEOMETRY_ENDS = 0,
+		GEOMETRY_XY = 1,
+		GEOMETRY_Z = 2,
+		GEOMETRY_TYPE = 6,
+		GEOMETRY_PARTS = 7,
+	};
+	/// @}
+
+	/**
+	 * @brief Minimal FlatBuffers builder writing front to back.
+	 *        Tables are written before the objects they reference, offsets are reserved then patched once the target is written.
+	 *        Alignment is relative to the start of the buffer, which starts with the root offset.
+	 */
+	class Flat_Builder
+	{
+	public:
+		/// @brief one field of a table, ``slot`` receives its position once the table is written
+		struct Field
+		{
+			std::uint16_t id;
+			std::uint8_t size;
+			std::uint64_t bits = 0;
+			std::size_t slot = 0;
+		};
+
+		template<class T>
+		static Field Scalar(std::uint16_t id, T value)
+		{
+			Field field{ id, static_cast<std::uint8_t>(sizeof(T)) };
+			std::memcpy(&field.bits, &value, sizeof(T));
+			return field;
+		}
+
+		static Field Offset(std::uint16_t id) { return Field{ id, static_cast<std::uint8_t>(sizeof(std::uint32_t)) }; }
+
+		static std::size_t Slot(const std::vector<Field>& fields, std::uint16_t id)
+		{
+			for (const Field& field : fields)
+				if (field.id == id)
+					return field.slot;
+			return 0;
+		}
+
+		Flat_Builder() { Put<std::uint32_t>(0); }
+
+		/// @brief write a vtable then its table, fields are laid out by decreasing size so that each one is naturally aligned
+		std::size_t Table(std::vector<Field>& fields)
+		{
+			std::vector<std::size_t> order(fields.size());
+			std::iota(order.begin(), order.end(), std::size_t(0));
+			std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) { return fields[lhs].size > fields[rhs].size; });
+
+			std::vector<std::uint16_t> field_offsets(fields.size());
+			std::size_t table_size = sizeof(std::int32_t);
+			std::size_t alignment = sizeof(std::int32_t);
+			std::uint16_t field_count = 0;
+			for (std::size_t i : order)
+			{
+				table_size = (table_size + fields[i].size - 1) / fields[i].size * fields[i].size;
+				field_offsets[i] = static_cast<std::uint16_t>(table_size);
+				table_size += fields[i].size;
+				alignment = std::max<std::size_t>(alignment, fields[i].size);
+				field_count = std::max<std::uint16_t>(field_count, fields[i].id + 1);
+			}
+
+			const std::size_t vtable_size = sizeof(std::uint16_t) * (2 + field_count);
+			Pad_To(alignment, vtable_size);
+			const std::size_t vtable = m_data.size();
+			Put<std::uint16_t>(static_cast<std::uint16_t>(vtable_size));
+			Put<std::uint16_t>(static_cast<std::uint16_t>(table_size));
+			for (std::uint16_t id = 0; id < field_count; ++id)
+			{
+				std::uint16_t offset = 0;
+				for (std::size_t i = 0; i < fields.size(); ++i)
+					if (fields[i].id == id)
+						offset = field_offsets[i];
+				Put<std::uint16_t>(offset);
+			}
+
+			const std::size_t table = m_data.size();
+			Put<std::int32_t>(static_cast<std::int32_t>(table - vtable));
+			m_data.resize(table + table_size, '\0');
+			for (std::size_t i = 0; i < fields.size(); ++i)
+			{
+				fields[i].slot = table + field_offsets[i];
+				std::memcpy(m_data.data() + fields[i].slot, &fields[i].bits, fields[i].size);
+			}
+			return table;
+		}
+
+		template<class T>
+		std::size_t Vector(std::span<const T> values)
+		{
+			Pad_To(std::max<std::size_t>(sizeof(std::uint32_t), alignof(T)), sizeof(std::uint32_t));
+			const std::size_t position = Put<std::uint32_t>(static_cast<std::uint32_t>(values.size()));
+			m_data.append(reinterpret_cast<const char*>(values.data()), values.size_bytes());
+			return position;
+		}
+
+		std::size_t String(std::string_view value)
+		{
+			Pad_To(sizeof(std::uint32_t));
+			const std::size_t position = Put<std::uint32_t>(static_cast<std::uint32_t>(value.size()));
+			m_data.append(value);
+			m_data.push_back('\0');
+			return position;
+		}
+
+		/// @brief reserve a vector of offsets, element ``i`` lives at ``position + 4 + 4 * i``
+		std::size_t Offset_Vector(std::size_t count)
+		{
+			Pad_To(sizeof(std::uint32_t));
+			const std::size_t position = Put<std::uint32_t>(static_cast<std::uint32_t>(count));
+			m_data.resize(m_data.size() + count * sizeof(std::uint32_t), '\0');
+			return position;
+		}
+
+		/// @brief make the offset stored at ``slot`` point to ``target``
+		void Patch(std::size_t slot, std::size_t target)
+		{
+			const std::uint32_t offset = static_cast<std::uint32_t>(target - slot);
+			std::memcpy(m_data.data() + slot, &offset, sizeof(offset));
+		}
+
+		void Finish(std::size_t root) { Patch(0, root); }
+
+		std::string& Data() { return m_data; }
+
+	private:
+		template<class T>
+		std::size_t Put(T value)
+		{
+			const std::size_t position = m_data.size();
+			m_data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+			return position;
+		}
+
+		/// @brief pad so that ``size + extra`` is a multiple of ``alignment``
+		void Pad_To(std::size_t alignment, std::size_t extra = 0)
+		{
+			while ((m_data.size() + extra) % alignment != 0)
+				m_data.push_back('\0');
+		}
+
+		std::string m_data;
+	};
+
+	/**
+	 * @brief Bounds checked FlatBuffers reader.
+	 *        Out of range reads give zeros and mark the reader invalid, so a corrupted buffer is reported once decoding ends.
+	 */
+	class Flat_Reader
+	{
+	public:
+		explicit Flat_Reader(std::string_view buffer) : m_buffer(buffer) {}
+
+		bool Is_Valid() const { return m_valid; }
+		void Fail() { m_valid = false; }
+
+		template<class T>
+		T Read(std::size_t position)
+		{
+			T value{};
+			if (position > m_buffer.size() || m_buffer.size() - position < sizeof(T))
+				m_valid = false;
+			else
+				std::memcpy(&value, m_buffer.data() + position, sizeof(T));
+			return value;
+		}
+
+		std::size_t Root() { return Deref(0); }
+
+		/// @brief follow the offset stored at ``position``
+		std::size_t Deref(std::size_t position) { return position + Read<std::uint32_t>(position); }
+
+		/// @brief position of a field inside a table, 0 when absent
+		std::size_t Field(std::size_t table, std::uint16_t id)
+		{
+			const std::int64_t vtable = static_cast<std::int64_t>(table) - Read<std::int32_t>(table);
+			if (vtable < 0 || !m_valid)
+			{
+				m_valid = false;
+				return 0;
+			}
+			const std::uint16_t vtable_size = Read<std::uint16_t>(static_cast<std::size_t>(vtable));
+			const std::size_t entry = sizeof(std::uint16_t) * (2 + std::size_t(id));
+			if (entry >= vtable_size)
+				return 0;
+			const std::uint16_t offset = Read<std::uint16_t>(static_cast<std::size_t>(vtable) + entry);
+			return offset == 0 ? 0 : table + offset;
+		}
+
+		template<class T>
+		T Scalar(std::size_t table, std::uint16_t id, T fallback)
+		{
+			const std::size_t position = Field(table, id);
+			return position == 0 ? fallback : Read<T>(position);
+		}
+
+		/// @brief target of an offset field, 0 when absent
+		std::size_t Offset(std::size_t table, std::uint16_t id)
+		{
+			const std::size_t position = Field(table, id);
+			return position == 0 ? 0 : Deref(position);
+		}
+
+		/// @brief number of elements of the vector at ``position``, 0 (and invalid) if it overflows the buffer
+		std::size_t Vector_Size(std::size_t position, std::size_t element_size)
+		{
+			const std::size_t count = Read<std::uint32_t>(position);
+			if (!m_valid || (m_buffer.size() - position - sizeof(std::uint32_t)) / element_size < count)
+			{
+				m_valid = false;
+				return 0;
+			}
+			return count;
+		}
+
+		/// @brief ``size`` raw bytes starting at ``position``
+		std::string_view Bytes(std::size_t position, std::size_t size)
+		{
+			if (position > m_buffer.size() || m_buffer.size() - position < size)
+			{
+				m_valid = false;
+				return std::string_view();
+			}
+			return m_buffer.substr(position, size);
+		}
+
+		std::string_view String(std::size_t position)
+		{
+			const std::size_t size = Vector_Size(position, 1);
+			return m_valid ? m_buffer.substr(position + sizeof(std::uint32_t), size) : std::string_view();
+		}
+
+	private:
+		std::string_view m_buffer;
+		bool m_valid = true;
+	};
+
+	/// @brief FlatGeobuf type of each alternative of ``Geometry::value``
+	constexpr std::array<Flat_Geobuf_Geometry_Type, 7> GEOMETRY_TYPES = {
+		Flat_Geobuf_Geometry_Type::POINT,
+		Flat_Geobuf_Geometry_Type::MULTI_POINT,
+		Flat_Geobuf_Geometry_Type::LINE_STRING,
+		Flat_Geobuf_Geometry_Type::MULTI_LINE_STRING,
+		Flat_Geobuf_Geometry_Type::POLYGON,
+		Flat_Geobuf_Geometry_Type::MULTI_POLYGON,
+		Flat_Geobuf_Geometry_Type::GEOMETRY_COLLECTION,
+	};
+
+	//------------------------------------------------------------------
+	// geometry scan
+
+	void Expand(Node_Item& node, const O::GeoJSON::Position& position, bool& has_z)
+	{
+		node.min_x = std::min(node.min_x, position.longitude);
+		node.min_y = std::min(node.min_y, position.latitude);
+		node.max_x = std::max(node.max_x, position.longitude);
+		node.max_y = std::max(node.max_y, position.latitude);
+		has_z = has_z || position.altitude.has_value();
+	}
+
+	void Expand(Node_Item& node, const std::vector<O::GeoJSON::Position>& positions, bool& has_z)
+	{
+		for (const auto& position : positions)
+			Expand(node, position, has_z);
+	}
+
+	void Expand(Node_Item& node, const O::GeoJSON::Polygon& polygon, bool& has_z)
+	{
+		for (const auto& ring : polygon.rings)
+			Expand(node, ring, has_z);
+	}
+
+	void Expand(Node_Item& node, const O::GeoJSON::Geometry& geometry, bool& has_z)
+	{
+		if (geometry.Is_Point())                  Expand(node, geometry.Get_Point().position, has_z);
+		else if (geometry.Is_Multi_Point())       Expand(node, geometry.Get_Multi_Point().points, has_z);
+		else if (geometry.Is_Line_String())       Expand(node, geometry.Get_Line_String().positions, has_z);
+		else if (geometry.Is_Multi_Line_String())
+			for (const auto& line : geometry.Get_Multi_Line_String().line_strings)
+				Expand(node, line.positions, has_z);
+		else if (geometry.Is_Polygon())           Expand(node, geometry.Get_Polygon(), has_z);
+		else if (geometry.Is_Multi_Polygon())
+			for (const auto& polygon : geometry.Get_Multi_Polygon().polygons)
+				Expand(node, polygon, has_z);
+		else if (geometry.Is_Geometry_Collection())
+			for (const auto& child : geometry.Get_Geometry_Collection().geometries)
+				if (child)
+					Expand(node, *child, has_z);
+	}
+
+	//------------------------------------------------------------------
+	// columns
+
+	/**
+	 * @brief Columns of the written file, in order of first appearance, with the kinds of values seen for each one.
+	 */
+	class Column_Set
+	{
+	public:
+		void Add(const std::string& name, const O::GeoJSON::Property& value)
+		{
+			if (value.Is_Null())
+				return;
+			auto [it, inserted] = m_indices.try_emplace(name, static_cast<std::uint16_t>(m_columns.size()));
+			if (inserted)
+				m_columns.push_back(Column{ name });
+			Column& column = m_columns[it->second];
+			if (value.Is_Bool())         column.kinds |= BOOL_KIND;
+			else if (value.Is_Integer()) column.kinds |= INTEGER_KIND;
+			else if (value.Is_Double())  column.kinds |= DOUBLE_KIND;
+			else if (value.Is_String())  column.kinds |= STRING_KIND;
+			else                         column.kinds |= OTHER_KIND;
+		}
+
+		std::vector<Flat_Geobuf_Column> Resolve() const
+		{
+			std::vector<Flat_Geobuf_Column> columns;
+			columns.reserve(m_columns.size());
+			for (const Column& column : m_columns)
+			{
+				Flat_Geobuf_Column_Type type = Flat_Geobuf_Column_Type::JSON;
+				if (column.kinds == BOOL_KIND)                                type = Flat_Geobuf_Column_Type::BOOL;
+				else if (column.kinds == INTEGER_KIND)                        type = Flat_Geobuf_Column_Type::LONG;
+				else if ((column.kinds & ~(INTEGER_KIND | DOUBLE_KIND)) == 0) type = Flat_Geobuf_Column_Type::DOUBLE;
+				else if (column.kinds == STRING_KIND)                         type = Flat_Geobuf_Column_Type::STRING;
+				columns.push_back(Flat_Geobuf_Column{ column.name, type });
+			}
+			return columns;
+		}
+
+		std::uint16_t Index(const std::string& name) const { return m_indices.find(name)->second; }
+
+		bool Is_Full() const { return m_columns.size() > std::numeric_limits<std::uint16_t>::max(); }
+
+	private:
+		static constexpr unsigned BOOL_KIND = 1;
+		static constexpr unsigned INTEGER_KIND = 2;
+		static constexpr unsigned DOUBLE_KIND = 4;
+		static constexpr unsigned STRING_KIND = 8;
+		static constexpr unsigned OTHER_KIND = 16;
+
+		struct Column
+		{
+			std::string name;
+			unsigned kinds = 0;
+		};
+
+		std::vector<Column> m_columns;
+		std::map<std::string, std::uint16_t, std::less<>> m_indices;
+	};
+
+	//------------------------------------------------------------------
+	// encoding
+
+	template<class T>
+	void Append(std::string& bytes, T value)
+	{
+		bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	void Append_Text(std::string& bytes, std::string_view text)
+	{
+		Append<std::uint32_t>(bytes, static_cast<std::uint32_t>(text.size()));
+		bytes.append(text);
+	}
+
+	/// @brief flattened coordinates of a simple geometry
+	struct Coordinates
+	{
+		std::vector<double> xy;
+		std::vector<double> z;
+		std::vector<std::uint32_t> ends;
+
+		void Add(const O::GeoJSON::Position& position)
+		{
+			xy.push_back(position.longitude);
+			xy.push_back(position.latitude);
+			z.push_back(position.altitude.value_or(std::numeric_limits<double>::quiet_NaN()));
+		}
+
+		void Add_Part(const std::vector<O::GeoJSON::Position>& positions)
+		{
+			for (const auto& position : positions)
+				Add(position);
+			ends.push_back(static_cast<std::uint32_t>(xy.size() / 2));
+		}
+	};
+
+	std::size_t Encode_Coordinates(Flat_Builder& builder, Flat_Geobuf_Geometry_Type type, const Coordinates& coordinates, bool has_z)
+	{
+		std::vector<Flat_Builder::Field> fields = { Flat_Builder::Scalar<std::uint8_t>(GEOMETRY_TYPE, static_cast<std::uint8_t>(type)) };
+		if (!coordinates.xy.empty())
+			fields.push_back(Flat_Builder::Offset(GEOMETRY_XY));
+		if (has_z && !coordinates.z.empty())
+			fields.push_back(Flat_Builder::Offset(GEOMETRY_Z));
+		if (coordinates.ends.size() > 1)
+			fields.push_back(Flat_Builder::Offset(GEOMETRY_ENDS));
+
+		const std::size_t table = builder.Table(fields);
+		if (std::size_t slot = Flat_Builder::Slot(fields, GEOMETRY_XY))
+			builder.Patch(slot, builder.Vector(std::span<const double>(coordinates.xy)));
+		if (std::size_t slot = Flat_Builder::Slot(fields, GEOMETRY_Z))
+			builder.Patch(slot, builder.Vector(std::span<const double>(coordinates.z)));
+		if (std::size_t slot = Flat_Builder::Slot(fields, GEOMETRY_ENDS))
+			builder.Patch(slot, builder.Vector(std::span<const std::uint32_t>(coordinates.ends)));
+		return table;
+	}
+
+	std::size_t Encode_Polygon(Flat_Builder& builder, const O::GeoJSON::Polygon& polygon, bool has_z)
+	{
+		Coordinates coordinates;
+		for (const auto& ring : polygon.rings)
+			coordinates.Add_Part(ring);
+		return Encode_Coordinates(builder, Flat_Geobuf_Geometry_Type::POLYGON, coordinates, has_z);
+	}
+
+	/// @brief write a geometry whose members are stored as ``parts``
+	template<class Part_Encoder>
+	std::size_t Encode_Parts(Flat_Builder& builder, Flat_Geobuf_Geometry_Type type, std::size_t count, Part_Encoder&& encode_part)
+	{
+		std::vector<Flat_Builder::Field> fields = {
+			Flat_Builder::Scalar<std::uint8_t>(GEOMETRY_TYPE, static_cast<std::uint8_t>(type)),
+			Flat_Builder::Offset(GEOMETRY_PARTS),
+		};
+		const std::size_t table = builder.Table(fields);
+		const std::size_t parts = builder.Offset_Vector(count);
+		builder.Patch(fields[1].slot, parts);
+		for (std::size_t i = 0; i < count; ++i)
+			builder.Patch(parts + sizeof(std::uint32_t) * (i + 1), encode_part(i));
+		return table;
+	}
+
+	std::size_t Encode_Geometry(Flat_Builder& builder, const O::GeoJSON::Geometry& geometry, bool has_z)
+	{
+		const Flat_Geobuf_Geometry_Type type = GEOMETRY_TYPES[geometry.value.index()];
+		if (geometry.Is_Multi_Polygon())
+		{
+			const auto& polygons = geometry.Get_Multi_Polygon().polygons;
+			return Encode_Parts(builder, type, polygons.size(), [&](std::size_t i) { return Encode_Polygon(builder, polygons[i], has_z); });
+		}
+		if (geometry.Is_Geometry_Collection())
+		{
+			const auto& geometries = geometry.Get_Geometry_Collection().geometries;
+			return Encode_Parts(builder, type, geometries.size(), [&](std::size_t i)
+			{
+				// a missing member is stored as an empty collection
+				return geometries[i] ? Encode_Geometry(builder, *geometries[i], has_z) : Encode_Parts(builder, type, 0, [](std::size_t) { return std::size_t(0); });
+			});
+		}
+		if (geometry.Is_Polygon())
+			return Encode_Polygon(builder, geometry.Get_Polygon(), has_z);
+
+		Coordinates coordinates;
+		if (geometry.Is_Point())                  coordinates.Add(geometry.Get_Point().position);
+		else if (geometry.Is_Multi_Point())       coordinates.Add_Part(geometry.Get_Multi_Point().points);
+		else if (geometry.Is_Line_String())       coordinates.Add_Part(geometry.Get_Line_String().positions);
+		else if (geometry.Is_Multi_Line_String())
+			for (const auto& line : geometry.Get_Multi_Line_String().line_strings)
+				coordinates.Add_Part(line.positions);
+		return Encode_Coordinates(builder, type, coordinates, has_z);
+	}
+
+	std::string Encode_Properties(const O::GeoJSON::Property::Object& properties, const Column_Set& column_set, const std::vector<Flat_Geobuf_Column>& columns)
+	{
+		std::string bytes;
+		for (const auto& [key, value] : properties)
+		{
+			if (value.Is_Null())
+				continue;
+			const std::uint16_t index = column_set.Index(key);
+			Append<std::uint16_t>(bytes, index);
+			switch (columns[index].type)
+			{
+			case Flat_Geobuf_Column_Type::BOOL:
+				Append<std::uint8_t>(bytes, value.Get_Bool() ? 1 : 0);
+				break;
+			case Flat_Geobuf_Column_Type::LONG:
+				Append<std::int64_t>(bytes, value.Get_Int());
+				break;
+			case Flat_Geobuf_Column_Type::DOUBLE:
+				Append<double>(bytes, value.Is_Integer() ? static_cast<double>(value.Get_Int()) : value.Get_Double());
+				break;
+			case Flat_Geobuf_Column_Type::STRING:
+				Append_Text(bytes, value.Get_String());
+				break;
+			default:
+			{
+				rapidjson::StringBuffer buffer;
+				Writer<rapidjson::StringBuffer> writer(buffer);
+				writer.Write_Property_Value(value);
+				Append_Text(bytes, std::string_view(buffer.GetString(), buffer.GetSize()));
+				break;
+			}
+			}
+		}
+		return bytes;
+	}
+
+	std::string Encode_Feature(const O::GeoJSON::Feature& feature, bool has_z, const Column_Set& column_set, const std::vector<Flat_Geobuf_Column>& columns)
+	{
+		Flat_Builder builder;
+		std::vector<Flat_Builder::Field> fields;
+		if (feature.geometry)
+			fields.push_back(Flat_Builder::Offset(FEATURE_GEOMETRY));
+		if (feature.properties.Is_Object())
+			fields.push_back(Flat_Builder::Offset(FEATURE_PROPERTIES));
+
+		builder.Finish(builder.Table(fields));
+		if (std::size_t slot = Flat_Builder::Slot(fields, FEATURE_GEOMETRY))
+			builder.Patch(slot, Encode_Geometry(builder, *feature.geometry, has_z));
+		if (std::size_t slot = Flat_Builder::Slot(fields, FEATURE_PROPERTIES))
+		{
+			const std::string bytes = Encode_Properties(feature.properties.Get_Object(), column_set, columns);
+			builder.Patch(slot, builder.Vector(std::span<const char>(bytes)));
+		}
+		return std::move(builder.Data());
+	}
+
+	std::string Encode_Header(std::string_view name, const Node_Item& extent, Flat_Geobuf_Geometry_Type type, bool has_z, const std::vector<Flat_Geobuf_Column>& columns, std::uint64_t count, std::uint16_t node_size)
+	{
+		Flat_Builder builder;
+		std::vector<Flat_Builder::Field> fields = {
+			Flat_Builder::Scalar<std::uint8_t>(HEADER_GEOMETRY_TYPE, static_cast<std::uint8_t>(type)),
+			Flat_Builder::Scalar<std::uint8_t>(HEADER_HAS_Z, has_z ? 1 : 0),
+			Flat_Builder::Scalar<std::uint64_t>(HEADER_FEATURES_COUNT, count),
+			Flat_Builder::Scalar<std::uint16_t>(HEADER_INDEX_NODE_SIZE, node_size),
+		};
+		if (!name.empty())
+			fields.push_back(Flat_Builder::Offset(HEADER_NAME));
+		if (!extent.Is_Empty())
+			fields.push_back(Flat_Builder::Offset(HEADER_ENVELOPE));
+		if (!columns.empty())
+			fields.push_back(Flat_Builder::Offset(HEADER_COLUMNS));
+
+		builder.Finish(builder.Table(fields));
+		if (std::size_t slot = Flat_Builder::Slot(fields, HEADER_NAME))
+			builder.Patch(slot, builder.String(name));
+		if (std::size_t slot = Flat_Builder::Slot(fields, HEADER_ENVELOPE))
+		{
+			const std::array<double, 4> envelope = { extent.min_x, extent.min_y, extent.max_x, extent.max_y };
+			builder.Patch(slot, builder.Vector(std::span<const double>(envelope)));
+		}
+		if (std::size_t slot = Flat_Builder::Slot(fields, HEADER_COLUMNS))
+		{
+			const std::size_t vector = builder.Offset_Vector(columns.size());
+			builder.Patch(slot, vector);
+			for (std::size_t i = 0; i < columns.size(); ++i)
+			{
+				std::vector<Flat_Builder::Field> column_fields = {
+					Flat_Builder::Offset(COLUMN_NAME),
+					Flat_Builder::Scalar<std::uint8_t>(COLUMN_TYPE, static_cast<std::uint8_t>(columns[i].type)),
+				};
+				builder.Patch(vector + sizeof(std::uint32_t) * (i + 1), builder.Table(column_fields));
+				builder.Patch(column_fields[0].slot, builder.String(columns[i].name));
+			}
+		}
+		return std::move(builder.Data());
+	}
+
+	//------------------------------------------------------------------
+	// decoding
+
+	std::vector<O::GeoJSON::Position> Read_Positions(Flat_Reader& reader, std::size_t table)
+	{
+		std::vector<O::GeoJSON::Position> positions;
+		const std::size_t xy = reader.Offset(table, GEOMETRY_XY);
+		if (xy == 0)
+			return positions;
+		const std::size_t count = reader.Vector_Size(xy, sizeof(double)) / 2;
+		const std::size_t z = reader.Offset(table, GEOMETRY_Z);
+		const bool has_z = z != 0 && reader.Vector_Size(z, sizeof(double)) >= count;
+		positions.resize(count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			positions[i].longitude = reader.Read<double>(xy + sizeof(std::uint32_t) + 2 * sizeof(double) * i);
+			positions[i].latitude = reader.Read<double>(xy + sizeof(std::uint32_t) + 2 * sizeof(double) * i + sizeof(double));
+			if (has_z)
+				if (double altitude = reader.Read<double>(z + sizeof(std::uint32_t) + sizeof(double) * i); !std::isnan(altitude))
+					positions[i].altitude = altitude;
+		}
+		return positions;
+	}
+
+	/// @brief split positions along the ``ends`` vector (a single part when absent)
+	std::vector<std::vector<O::GeoJSON::Position>> Read_Parts(Flat_Reader& reader, std::size_t table, std::vector<O::GeoJSON::Position>&& positions)
+	{
+		std::vector<std::vector<O::GeoJSON::Position>> parts;
+		const std::size_t ends = reader.Offset(table, GEOMETRY_ENDS);
+		if (ends == 0)
+		{
+			if (!positions.empty())
+				parts.push_back(std::move(positions));
+			return parts;
+		}
+		const std::size_t count = reader.Vector_Size(ends, sizeof(std::uint32_t));
+		std::size_t first = 0;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const std::size_t last = reader.Read<std::uint32_t>(ends + sizeof(std::uint32_t) * (i + 1));
+			if (last < first || last > positions.size())
+			{
+				reader.Fail();
+				break;
+			}
+			parts.emplace_back(std::make_move_iterator(positions.begin() + first), std::make_move_iterator(positions.begin() + last));
+			first = last;
+		}
+		return parts;
+	}
+
+	O::GeoJSON::Geometry Decode_Geometry(Flat_Reader& reader, std::size_t table, Flat_Geobuf_Geometry_Type fallback)
+	{
+		O::GeoJSON::Geometry geometry;
+		auto type = static_cast<Flat_Geobuf_Geometry_Type>(reader.Scalar<std::uint8_t>(table, GEOMETRY_TYPE, 0));
+		if (type == Flat_Geobuf_Geometry_Type::UNKNOWN)
+			type = fallback;
+
+		auto for_each_part = [&](auto&& decode_part)
+		{
+			const std::size_t parts = reader.Offset(table, GEOMETRY_PARTS);
+			const std::size_t count = parts == 0 ? 0 : reader.Vector_Size(parts, sizeof(std::uint32_t));
+			for (std::size_t i = 0; i < count && reader.Is_Valid(); ++i)
+				decode_part(reader.Deref(parts + sizeof(std::uint32_t) * (i + 1)));
+		};
+
+		switch (type)
+		{
+		case Flat_Geobuf_Geometry_Type::POINT:
+		{
+			auto positions = Read_Positions(reader, table);
+			if (positions.empty())
+				reader.Fail();
+			else
+				geometry.value = O::GeoJSON::Point{ positions.front() };
+			break;
+		}
+		case Flat_Geobuf_Geometry_Type::MULTI_POINT:
+			geometry.value = O::GeoJSON::Multi_Point{ Read_Positions(reader, table) };
+			break;
+		case Flat_Geobuf_Geometry_Type::LINE_STRING:
+			geometry.value = O::GeoJSON::Line_String{ Read_Positions(reader, table) };
+			break;
+		case Flat_Geobuf_Geometry_Type::MULTI_LINE_STRING:
+		{
+			O::GeoJSON::Multi_Line_String lines;
+			for (auto& part : Read_Parts(reader, table, Read_Positions(reader, table)))
+				lines.line_strings.push_back(O::GeoJSON::Line_String{ std::move(part) });
+			geometry.value = std::move(lines);
+			break;
+		}
+		case Flat_Geobuf_Geometry_Type::POLYGON:
+			geometry.value = O::GeoJSON::Polygon{ Read_Parts(reader, table, Read_Positions(reader, table)) };
+			break;
+		case Flat_Geobuf_Geometry_Type::MULTI_POLYGON:
+		{
+			O::GeoJSON::Multi_Polygon polygons;
+			for_each_part([&](std::size_t part)
+			{
+				O::GeoJSON::Geometry polygon = Decode_Geometry(reader, part, Flat_Geobuf_Geometry_Type::POLYGON);
+				if (polygon.Is_Polygon())
+					polygons.polygons.push_back(std::move(polygon.Get_Polygon()));
+				else
+					reader.Fail();
+			});
+			geometry.value = std::move(polygons);
+			break;
+		}
+		case Flat_Geobuf_Geometry_Type::GEOMETRY_COLLECTION:
+		{
+			O::GeoJSON::Geometry_Collection collection;
+			for_each_part([&](std::size_t part)
+			{
+				collection.geometries.push_back(std::make_shared<O::GeoJSON::Geometry>(Decode_Geometry(reader, part, Flat_Geobuf_Geometry_Type::UNKNOWN)));
+			});
+			geometry.value = std::move(collection);
+			break;
+		}
+		default:
+			reader.Fail();
+			break;
+		}
+		return geometry;
+	}
+
+	O::GeoJSON::Property Decode_Properties(Flat_Reader& reader, std::size_t vector, const std::vector<Flat_Geobuf_Column>& columns)
+	{
+		O::GeoJSON::Property::Object properties;
+		const std::size_t size = reader.Vector_Size(vector, 1);
+		std::size_t position = vector + sizeof(std::uint32_t);
+		const std::size_t end = position + size;
+
+		auto read_text = [&]()
+		{
+			const std::size_t length = reader.Read<std::uint32_t>(position);
+			std::string text(reader.Bytes(position + sizeof(std::uint32_t), length));
+			position += sizeof(std::uint32_t) + length;
+			return text;
+		};
+		auto read = [&]<class T>(T) { T value = reader.Read<T>(position); position += sizeof(T); return value; };
+
+		while (position < end && reader.Is_Valid())
+		{
+			const std::uint16_t index = read(std::uint16_t());
+			if (index >= columns.size())
+			{
+				reader.Fail();
+				break;
+			}
+			O::GeoJSON::Property value;
+			switch (columns[index].type)
+			{
+			case Flat_Geobuf_Column_Type::BYTE:      value = O::GeoJSON::Property(static_cast<std::int64_t>(read(std::int8_t()))); break;
+			case Flat_Geobuf_Column_Type::UBYTE:     value = O::GeoJSON::Property(static_cast<std::int64_t>(read(std::uint8_t()))); break;
+			case Flat_Geobuf_Column_Type::BOOL:      value = O::GeoJSON::Property(read(std::uint8_t()) != 0); break;
+			case Flat_Geobuf_Column_Type::SHORT:     value = O::GeoJSON::Property(static_cast<std::int64_t>(read(std::int16_t()))); break;
+			case Flat_Geobuf_Column_Type::USHORT:    value = O::GeoJSON::Property(static_cast<std::int64_t>(read(std::uint16_t()))); break;
+			case Flat_Geobuf_Column_Type::INT:       value = O::GeoJSON::Property(static_cast<std::int64_t>(read(std::int32_t()))); break;
+			case Flat_Geobuf_Column_Type::UINT:      value = O::GeoJSON::Property(static_cast<std::int64_t>(read(std::uint32_t()))); break;
+			case Flat_Geobuf_Column_Type::LONG:      value = O::GeoJSON::Property(read(std::int64_t())); break;
+			case Flat_Geobuf_Column_Type::ULONG:
+			{
+				const std::uint64_t u = read(std::uint64_t());
+				if (u <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+					value = O::GeoJSON::Property(static_cast<std::int64_t>(u));
+				else
+					value = O::GeoJSON::Property(static_cast<double>(u));
+				break;
+			}
+			case Flat_Geobuf_Column_Type::FLOAT:     value = O::GeoJSON::Property(static_cast<double>(read(float()))); break;
+			case Flat_Geobuf_Column_Type::DOUBLE:    value = O::GeoJSON::Property(read(double())); break;
+			case Flat_Geobuf_Column_Type::STRING:
+			case Flat_Geobuf_Column_Type::DATE_TIME:
+			case Flat_Geobuf_Column_Type::BINARY:    value = O::GeoJSON::Property(read_text()); break;
+			case Flat_Geobuf_Column_Type::JSON:
+			{
+				if (auto parsed = Property_Builder::Parse(read_text()))
+					value = std::move(*parsed);
+				else
+					reader.Fail();
+				break;
+			}
+			default:
+				reader.Fail();
+				break;
+			}
+			properties.insert_or_assign(columns[index].name, std::move(value));
+		}
+		if (position != end)
+			reader.Fail();
+		return O::GeoJSON::Property(std::move(properties));
+	}
+}
+
+O::GeoJSON::IO::Error Flat_Geobuf_Writer::Save(std::span<const O::GeoJSON::Feature> features, const std::filesystem::path& path, std::string_view name, std::uint16_t node_size)
+{
+	if (node_size == 1)
+		node_size = 2;
+
+	// first pass: envelopes, dimension, common geometry type and property columns
+	std::vector<Node_Item> items(features.size());
+	Node_Item extent;
+	bool has_z = false;
+	std::optional<Flat_Geobuf_Geometry_Type> common_type;
+	bool mixed_types = false;
+	Column_Set column_set;
+	for (std::size_t i = 0; i < features.size(); ++i)
+	{
+		const O::GeoJSON::Feature& feature = features[i];
+		items[i].offset = i;
+		if (feature.geometry)
+		{
+			Expand(items[i], *feature.geometry, has_z);
+			extent.Expand(items[i]);
+			const Flat_Geobuf_Geometry_Type type = GEOMETRY_TYPES[feature.geometry->value.index()];
+			mixed_types = mixed_types || (common_type && *common_type != type);
+			common_type = type;
+		}
+		if (feature.properties.Is_Object())
+			for (const auto& [key, value] : feature.properties.Get_Object())
+				column_set.Add(key, value);
+	}
+	if (column_set.Is_Full())
+		return Error::TOO_MANY_PROPERTY_COLUMNS;
+	const std::vector<Flat_Geobuf_Column> columns = column_set.Resolve();
+	const Flat_Geobuf_Geometry_Type header_type = mixed_types || !common_type ? Flat_Geobuf_Geometry_Type::UNKNOWN : *common_type;
+
+	// indexed files store the features along the Hilbert curve so that close features are close in the file
+	const std::uint64_t index_size = node_size == 0 ? 0 : Packed_RTree::Size(items.size(), node_size);
+	if (index_size != 0)
+		Packed_RTree::Hilbert_Sort(items, extent);
+
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	if (!out)
+		return Error::FILE_OPENNING_FAILED;
+
+	const std::string header = Encode_Header(name, extent, header_type, has_z, columns, items.size(), node_size);
+	const std::uint32_t header_size = static_cast<std::uint32_t>(header.size());
+	out.write(MAGIC.data(), MAGIC.size());
+	out.write(reinterpret_cast<const char*>(&header_size), sizeof(header_size));
+	out.write(header.data(), header.size());
+
+	// the index depends on the feature offsets: reserve it, write the features then come back
+	const std::streampos index_position = out.tellp();
+	const std::string zeros(64 * 1024, '\0');
+	for (std::uint64_t remaining = index_size; remaining != 0;)
+	{
+		const std::size_t chunk = static_cast<std::size_t>(std::min<std::uint64_t>(remaining, zeros.size()));
+		out.write(zeros.data(), chunk);
+		remaining -= chunk;
+	}
+
+	std::uint64_t offset = 0;
+	for (Node_Item& item : items)
+	{
+		const std::string buffer = Encode_Feature(features[item.offset], has_z, column_set, columns);
+		const std::uint32_t size = static_cast<std::uint32_t>(buffer.size());
+		out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+		out.write(buffer.data(), buffer.size());
+		item.offset = offset;
+		offset += sizeof(size) + buffer.size();
+	}
+
+	if (index_size != 0)
+	{
+		const std::vector<Node_Item> nodes = Packed_RTree::Build(items, node_size);
+		out.seekp(index_position);
+		out.write(reinterpret_cast<const char*>(nodes.data()), static_cast<std::streamsize>(nodes.size() * sizeof(Node_Item)));
+	}
+
+	out.flush();
+	return out ? Error::NO_ERROR : Error::FILE_WRITE_FAILED;
+}
+
+O::GeoJSON::IO::Error Flat_Geobuf_Writer::Save(const O::GeoJSON::Root& root, const std::filesystem::path& path, std::string_view name, std::uint16_t node_size)
+{
+	if (root.Is_Feature_Collection())
+		return Save(std::span<const O::GeoJSON::Feature>(root.Get_Feature_Collection().features), path, name, node_size);
+	if (root.Is_Feature())
+		return Save(std::span<const O::GeoJSON::Feature>(&root.Get_Feature(), 1), path, name, node_size);
+
+	O::GeoJSON::Feature feature;
+	feature.geometry = root.Get_Geometry();
+	return Save(std::span<const O::GeoJSON::Feature>(&feature, 1), path, name, node_size);
+}
+
+O::Expected<Flat_Geobuf_Reader, O::GeoJSON::IO::Error> Flat_Geobuf_Reader::Open(const std::filesystem::path& path)
+{
+	using Expected = O::Expected<Flat_Geobuf_Reader, Error>;
+	auto file = Mapped_File::Open(path);
+	if (!file.Has_Value())
+		return Expected::Make_Error(file.Error());
+
+	Flat_Geobuf_Reader reader;
+	reader.m_file = std::move(file.Value());
+	const std::string_view view = reader.m_file.View();
+	if (view.size() < PREFIX_SIZE || view.compare(0, MAGIC_CHECKED_SIZE, std::string_view(MAGIC.data(), MAGIC_CHECKED_SIZE)) != 0)
+		return Expected::Make_Error(Error::INVALID_FLAT_GEOBUF);
+
+	std::uint32_t header_size = 0;
+	std::memcpy(&header_size, view.data() + MAGIC.size(), sizeof(header_size));
+	if (view.size() - PREFIX_SIZE < header_size)
+		return Expected::Make_Error(Error::INVALID_FLAT_GEOBUF);
+
+	Flat_Reader header(view.substr(PREFIX_SIZE, header_size));
+	const std::size_t root = header.Root();
+	Flat_Geobuf_Header& decoded = reader.m_header;
+	if (std::size_t name = header.Offset(root, HEADER_NAME))
+		decoded.name = header.String(name);
+	if (std::size_t envelope = header.Offset(root, HEADER_ENVELOPE); envelope != 0 && header.Vector_Size(envelope, sizeof(double)) >= 4)
+	{
+		decoded.envelope.emplace();
+		for (std::size_t i = 0; i < 4; ++i)
+			(*decoded.envelope)[i] = header.Read<double>(envelope + sizeof(std::uint32_t) + sizeof(double) * i);
+	}
+	decoded.geometry_type = static_cast<Flat_Geobuf_Geometry_Type>(header.Scalar<std::uint8_t>(root, HEADER_GEOMETRY_TYPE, 0));
+	decoded.has_z = header.Scalar<std::uint8_t>(root, HEADER_HAS_Z, 0) != 0;
+	if (std::size_t columns = header.Offset(root, HEADER_COLUMNS))
+	{
+		const std::size_t count = header.Vector_Size(columns, sizeof(std::uint32_t));
+		for (std::size_t i = 0; i < count && header.Is_Valid(); ++i)
+		{
+			const std::size_t column = header.Deref(columns + sizeof(std::uint32_t) * (i + 1));
+			Flat_Geobuf_Column decoded_column{ {}, static_cast<Flat_Geobuf_Column_Type>(header.Scalar<std::uint8_t>(column, COLUMN_TYPE, 0)) };
+			if (std::size_t column_name = header.Offset(column, COLUMN_NAME))
+				decoded_column.name = header.String(column_name);
+			decoded.columns.push_back(std::move(decoded_column));
+		}
+	}
+	decoded.features_count = header.Scalar<std::uint64_t>(root, HEADER_FEATURES_COUNT, 0);
+	decoded.index_node_size = header.Scalar<std::uint16_t>(root, HEADER_INDEX_NODE_SIZE, Packed_RTree::DEFAULT_NODE_SIZE);
+	if (!header.Is_Valid() || decoded.index_node_size == 1)
+		return Expected::Make_Error(Error::INVALID_FLAT_GEOBUF);
+
+	reader.m_index_offset = PREFIX_SIZE + header_size;
+	const std::uint64_t index_size = reader.Has_Index() ? Packed_RTree::Size(decoded.features_count, decoded.index_node_size) : 0;
+	if (view.size() - reader.m_index_offset < index_size)
+		return Expected::Make_Error(Error::INVALID_FLAT_GEOBUF);
+	reader.m_feature_offset = reader.m_index_offset + index_size;
+	return Expected::Make_Value(std::move(reader));
+}
+
+std::vector<std::uint64_t> Flat_Geobuf_Reader::Query(const std::array<double, 4>& bbox) const
+{
+	std::vector<std::uint64_t> offsets;
+	const Node_Item box{ bbox[0], bbox[1], bbox[2], bbox[3], 0 };
+	if (Has_Index())
+	{
+		const std::string_view index = m_file.View().substr(m_index_offset, m_feature_offset - m_index_offset);
+		for (const auto& result : Packed_RTree::Search(index, m_header.features_count, m_header.index_node_size, box))
+			offsets.push_back(result.offset);
+		return offsets;
+	}
+
+	// no index: decode every feature and test its envelope
+	std::uint64_t offset = 0;
+	for (std::uint64_t i = 0; i < m_header.features_count; ++i)
+	{
+		const std::uint64_t current = offset;
+		auto feature = Read_Feature(current, &offset);
+		if (!feature.Has_Value())
+			break;
+		if (!feature.Value().geometry)
+			continue;
+		Node_Item envelope;
+		bool has_z = false;
+		Expand(envelope, *feature.Value().geometry, has_z);
+		if (box.Intersects(envelope))
+			offsets.push_back(current);
+	}
+	return offsets;
+}
+
+O::Expected<O::GeoJSON::Feature, O::GeoJSON::IO::Error> Flat_Geobuf_Reader::Read_Feature(std::uint64_t offset, std::uint64_t* next) const
+{
+	using Expected = O::Expected<O::GeoJSON::Feature, Error>;
+	const std::string_view view = m_file.View();
+	const std::uint64_t available = view.size() - m_feature_offset;
+	if (offset > available || available - offset < sizeof(std::uint32_t))
+		return Expected::Make_Error(Error::INVALID_FLAT_GEOBUF);
+
+	const std::size_t position = static_cast<std::size_t>(m_feature_offset + offset);
+	std::uint32_t size = 0;
+	std::memcpy(&size, view.data() + position, sizeof(size));
+	if (available - offset - sizeof(size) < size)
+		return Expected::Make_Error(Error::INVALID_FLAT_GEOBUF);
+	if (next)
+		*next = offset + sizeof(size) + size;
+
+	Flat_Reader reader(view.substr(position + sizeof(size), size));
+	const std::size_t root = reader.Root();
+	O::GeoJSON::Feature feature;
+	if (std::size_t geometry = reader.Offset(root, FEATURE_GEOMETRY))
+		feature.geometry = Decode_Geometry(reader, geometry, m_header.geometry_type);
+	if (std::size_t properties = reader.Offset(root, FEATURE_PROPERTIES))
+		feature.properties = Decode_Properties(reader, properties, m_header.columns);
+	if (!reader.Is_Valid())
+		return Expected::Make_Error(Error::INVALID_FLAT_GEOBUF);
+	return Expected::Make_Value(std::move(feature));
+}
+
+std::optional<O::GeoJSON::Bbox> Flat_Geobuf_Reader::Root_Bbox() const
+{
+	if (!m_header.envelope)
+		return std::nullopt;
+	return O::GeoJSON::Bbox{ *m_header.envelope };
+}
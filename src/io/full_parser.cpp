@@ -46,7 +46,7 @@ bool Full_Parser::On_Feature(O::GeoJSON::Feature&& feature)
 	return true;
 }
 
-bool Full_Parser::On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, std::optional<std::string>&& id)
+bool Full_Parser::On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id)
 {
 	m_bbox = std::move(bbox);
 	m_id   = std::move(id);
@@ -0,0 +1,83 @@
+#include "io/hyper_log_log.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	/// splitmix64 finalizer, spreads every input bit over the whole word
+	std::uint64_t Mix(std::uint64_t x)
+	{
+		x ^= x >> 30;
+		x *= 0xbf58476d1ce4e5b9ull;
+		x ^= x >> 27;
+		x *= 0x94d049bb133111ebull;
+		x ^= x >> 31;
+		return x;
+	}
+
+	constexpr std::uint64_t STRING_SEED = 0x9e3779b97f4a7c15ull;
+	constexpr std::uint64_t NUMBER_SEED = 0xc2b2ae3d27d4eb4full;
+	constexpr std::uint64_t BOOL_SEED = 0x165667b19e3779f9ull;
+}
+
+void Hyper_Log_Log::Add(std::string_view value)
+{
+	std::uint64_t hash = 14695981039346656037ull ^ STRING_SEED;
+	for (char c : value)
+	{
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 1099511628211ull;
+	}
+	Add_Hash(Mix(hash));
+}
+
+void Hyper_Log_Log::Add(double value)
+{
+	if (value == 0.0) value = 0.0; // -0.0 and 0.0 are the same value
+	std::uint64_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	Add_Hash(Mix(bits ^ NUMBER_SEED));
+}
+
+void Hyper_Log_Log::Add(bool value)
+{
+	Add_Hash(Mix(BOOL_SEED + static_cast<std::uint64_t>(value)));
+}
+
+void Hyper_Log_Log::Add_Hash(std::uint64_t hash)
+{
+	std::size_t bucket = static_cast<std::size_t>(hash >> (64 - PRECISION));
+	std::uint64_t rest = hash << PRECISION;
+	std::uint8_t rank = rest ? static_cast<std::uint8_t>(std::countl_zero(rest) + 1) : static_cast<std::uint8_t>(64 - PRECISION + 1);
+	m_registers[bucket] = std::max(m_registers[bucket], rank);
+}
+
+void Hyper_Log_Log::Merge(const Hyper_Log_Log& other)
+{
+	for (std::size_t i = 0; i < REGISTER_COUNT; ++i)
+		m_registers[i] = std::max(m_registers[i], other.m_registers[i]);
+}
+
+double Hyper_Log_Log::Estimate() const
+{
+	constexpr double m = static_cast<double>(REGISTER_COUNT);
+	constexpr double alpha = 0.7213 / (1.0 + 1.079 / m);
+
+	double sum = 0.0;
+	std::size_t zeros = 0;
+	for (std::uint8_t r : m_registers)
+	{
+		sum += std::ldexp(1.0, -static_cast<int>(r));
+		zeros += (r == 0);
+	}
+	double estimate = alpha * m * m / sum;
+	// small range correction (linear counting)
+	if (estimate <= 2.5 * m && zeros)
+		return m * std::log(m / static_cast<double>(zeros));
+	return estimate;
+}
@@ -0,0 +1,100 @@
+#include "io/mapped_file.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace O::GeoJSON::IO;
+
+O::Expected<Mapped_File, Error> Mapped_File::Open(const std::filesystem::path& path)
+{
+	Mapped_File file;
+#ifdef _WIN32
+	HANDLE handle = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (handle == INVALID_HANDLE_VALUE)
+		return O::Expected<Mapped_File, Error>::Make_Error(Error::FILE_OPENNING_FAILED);
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(handle, &size))
+	{
+		CloseHandle(handle);
+		return O::Expected<Mapped_File, Error>::Make_Error(Error::FILE_OPENNING_FAILED);
+	}
+	file.m_size = static_cast<std::size_t>(size.QuadPart);
+	if (file.m_size)
+	{
+		HANDLE mapping = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping)
+		{
+			file.m_data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+			CloseHandle(mapping);
+		}
+	}
+	CloseHandle(handle);
+#else
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return O::Expected<Mapped_File, Error>::Make_Error(Error::FILE_OPENNING_FAILED);
+	struct stat info;
+	if (fstat(fd, &info) != 0)
+	{
+		close(fd);
+		return O::Expected<Mapped_File, Error>::Make_Error(Error::FILE_OPENNING_FAILED);
+	}
+	file.m_size = static_cast<std::size_t>(info.st_size);
+	if (file.m_size)
+	{
+		void* data = mmap(nullptr, file.m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data != MAP_FAILED)
+			file.m_data = static_cast<const char*>(data);
+	}
+	close(fd);
+#endif
+	if (file.m_size && !file.m_data)
+		return O::Expected<Mapped_File, Error>::Make_Error(Error::FILE_OPENNING_FAILED);
+	return O::Expected<Mapped_File, Error>::Make_Value(std::move(file));
+}
+
+Mapped_File::Mapped_File(Mapped_File&& other) noexcept :
+	m_data(std::exchange(other.m_data, nullptr)),
+	m_size(std::exchange(other.m_size, 0))
+{
+
+}
+
+Mapped_File& Mapped_File::operator=(Mapped_File&& other) noexcept
+{
+	if (this != &other)
+	{
+		Release();
+		m_data = std::exchange(other.m_data, nullptr);
+		m_size = std::exchange(other.m_size, 0);
+	}
+	return *this;
+}
+
+Mapped_File::~Mapped_File()
+{
+	Release();
+}
+
+void Mapped_File::Release()
+{
+	if (!m_data)
+		return;
+#ifdef _WIN32
+	UnmapViewOfFile(m_data);
+#else
+	munmap(const_cast<char*>(m_data), m_size);
+#endif
+	m_data = nullptr;
+	m_size = 0;
+}
@@ -0,0 +1,86 @@
+#include "io/number_format.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	constexpr std::uint64_t POW10[MAX_FIXED_DECIMALS + 1] = {
+		1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+		10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull,
+		1000000000000000ull, 10000000000000000ull, 100000000000000000ull
+	};
+
+	constexpr char DIGIT_PAIRS[] =
+		"00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839" "40414243444546474849"
+		"50515253545556575859" "60616263646566676869" "70717273747576777879" "80818283848586878889" "90919293949596979899";
+
+	/// write exactly ``count`` digits of ``value`` (left padded with zeros) ending at ``end``
+	void Write_Digits(std::uint64_t value, int count, char* end)
+	{
+		while (count >= 2)
+		{
+			std::memcpy(end - 2, DIGIT_PAIRS + 2 * (value % 100), 2);
+			value /= 100;
+			end -= 2;
+			count -= 2;
+		}
+		if (count)
+			*--end = char('0' + value % 10);
+	}
+
+	/// number of decimal digits of ``value`` (1 for 0)
+	int Digit_Count(std::uint64_t value)
+	{
+		int count = 1;
+		while (value >= 10)
+		{
+			value /= 10;
+			++count;
+		}
+		return count;
+	}
+}
+
+std::size_t O::GeoJSON::IO::Format_Fixed(double value, int decimals, bool trim_trailing_zeros, char* buffer)
+{
+	if (!std::isfinite(value))
+		return 0;
+	decimals = std::clamp(decimals, 0, MAX_FIXED_DECIMALS);
+	const double scaled = std::round(std::fabs(value) * double(POW10[decimals]));
+	if (!std::isfinite(scaled) || scaled >= 9007199254740992.0) // 2^53: above that the scaled value is no longer exact
+		return static_cast<std::size_t>(std::to_chars(buffer, buffer + FIXED_BUFFER_SIZE, value).ptr - buffer);
+
+	const std::uint64_t units = static_cast<std::uint64_t>(scaled);
+	const std::uint64_t integer = units / POW10[decimals];
+	std::uint64_t fraction = units % POW10[decimals];
+
+	char* out = buffer;
+	if (value < 0 && units != 0)
+		*out++ = '-';
+	const int integer_digits = Digit_Count(integer);
+	Write_Digits(integer, integer_digits, out + integer_digits);
+	out += integer_digits;
+	*out++ = '.';
+
+	int fraction_digits = decimals;
+	if (trim_trailing_zeros)
+		while (fraction_digits > 1 && fraction % 10 == 0)
+		{
+			fraction /= 10;
+			--fraction_digits;
+		}
+	if (fraction_digits == 0)
+	{
+		*out++ = '0';
+		return static_cast<std::size_t>(out - buffer);
+	}
+	Write_Digits(fraction, fraction_digits, out + fraction_digits);
+	out += fraction_digits;
+	return static_cast<std::size_t>(out - buffer);
+}
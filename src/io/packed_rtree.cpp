@@ -0,0 +1,137 @@
+#include "io/packed_rtree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace O::GeoJSON::IO;
+
+void Node_Item::Expand(const Node_Item& other) noexcept
+{
+	min_x = std::min(min_x, other.min_x);
+	min_y = std::min(min_y, other.min_y);
+	max_x = std::max(max_x, other.max_x);
+	max_y = std::max(max_y, other.max_y);
+}
+
+void Packed_RTree::Hilbert_Sort(std::vector<Node_Item>& items, const Node_Item& extent)
+{
+	const double width = extent.max_x - extent.min_x;
+	const double height = extent.max_y - extent.min_y;
+	auto value = [&](const Node_Item& item) -> std::uint32_t
+	{
+		if (item.Is_Empty())
+			return 0;
+		std::uint32_t x = 0;
+		std::uint32_t y = 0;
+		if (width != 0.0)
+			x = static_cast<std::uint32_t>(std::floor(O::GeoJSON::HILBERT_MAX * ((item.min_x + item.max_x) / 2 - extent.min_x) / width));
+		if (height != 0.0)
+			y = static_cast<std::uint32_t>(std::floor(O::GeoJSON::HILBERT_MAX * ((item.min_y + item.max_y) / 2 - extent.min_y) / height));
+		return O::GeoJSON::Hilbert(x, y);
+	};
+
+	std::vector<std::pair<std::uint32_t, Node_Item>> keyed;
+	keyed.reserve(items.size());
+	for (const Node_Item& item : items)
+		keyed.emplace_back(value(item), item);
+	std::stable_sort(keyed.begin(), keyed.end(), [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+	for (std::size_t i = 0; i < items.size(); ++i)
+		items[i] = keyed[i].second;
+}
+
+std::vector<std::pair<std::uint64_t, std::uint64_t>> Packed_RTree::Level_Bounds(std::uint64_t item_count, std::uint16_t node_size)
+{
+	// number of nodes per level, leaves first
+	std::vector<std::uint64_t> level_node_count;
+	std::uint64_t n = item_count;
+	std::uint64_t node_count = n;
+	level_node_count.push_back(n);
+	do
+	{
+		n = (n + node_size - 1) / node_size;
+		node_count += n;
+		level_node_count.push_back(n);
+	}
+	while (n != 1);
+
+	// levels are stored top-down, the leaves at the end
+	std::vector<std::pair<std::uint64_t, std::uint64_t>> bounds;
+	n = node_count;
+	for (std::uint64_t count : level_node_count)
+	{
+		n -= count;
+		bounds.emplace_back(n, n + count);
+	}
+	return bounds;
+}
+
+std::uint64_t Packed_RTree::Size(std::uint64_t item_count, std::uint16_t node_size)
+{
+	if (item_count == 0 || node_size < 2)
+		return 0;
+	return Level_Bounds(item_count, node_size).front().second * sizeof(Node_Item);
+}
+
+std::vector<Node_Item> Packed_RTree::Build(const std::vector<Node_Item>& leaves, std::uint16_t node_size)
+{
+	if (leaves.empty() || node_size < 2)
+		return {};
+	const auto bounds = Level_Bounds(leaves.size(), node_size);
+	std::vector<Node_Item> nodes(bounds.front().second);
+	std::copy(leaves.begin(), leaves.end(), nodes.begin() + static_cast<std::ptrdiff_t>(bounds.front().first));
+
+	for (std::size_t level = 0; level + 1 < bounds.size(); ++level)
+	{
+		std::uint64_t pos = bounds[level].first;
+		const std::uint64_t end = bounds[level].second;
+		std::uint64_t parent = bounds[level + 1].first;
+		while (pos < end)
+		{
+			Node_Item node;
+			node.offset = pos;
+			for (std::uint16_t i = 0; i < node_size && pos < end; ++i)
+				node.Expand(nodes[pos++]);
+			nodes[parent++] = node;
+		}
+	}
+	return nodes;
+}
+
+std::vector<Packed_RTree::Search_Result> Packed_RTree::Search(std::string_view index, std::uint64_t item_count, std::uint16_t node_size, const Node_Item& box)
+{
+	std::vector<Search_Result> results;
+	if (item_count == 0 || node_size < 2 || index.size() < Size(item_count, node_size))
+		return results;
+
+	const auto bounds = Level_Bounds(item_count, node_size);
+	const std::uint64_t leaves_start = bounds.front().first;
+	auto node_at = [&](std::uint64_t i)
+	{
+		Node_Item node;
+		std::memcpy(&node, index.data() + i * sizeof(Node_Item), sizeof(Node_Item));
+		return node;
+	};
+
+	// depth first walk from the root, (node position, level)
+	std::vector<std::pair<std::uint64_t, std::size_t>> stack;
+	stack.emplace_back(0, bounds.size() - 1);
+	while (!stack.empty())
+	{
+		const auto [first, level] = stack.back();
+		stack.pop_back();
+		const std::uint64_t end = std::min<std::uint64_t>(first + node_size, bounds[level].second);
+		for (std::uint64_t pos = first; pos < end; ++pos)
+		{
+			const Node_Item node = node_at(pos);
+			if (!box.Intersects(node))
+				continue;
+			if (level == 0)
+				results.push_back(Search_Result{ node.offset, pos - leaves_start });
+			else
+				stack.emplace_back(node.offset, level - 1);
+		}
+	}
+	std::sort(results.begin(), results.end(), [](const Search_Result& lhs, const Search_Result& rhs) { return lhs.offset < rhs.offset; });
+	return results;
+}
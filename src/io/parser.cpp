@@ -1,5 +1,6 @@
 #include <rapidjson/document.h>
 #include <rapidjson/filereadstream.h>
+#include <rapidjson/memorystream.h>
 
 
 #include "io/parser.h"
@@ -53,4 +54,30 @@ O::Expected<O::GeoJSON::Root, O::GeoJSON::IO::Error> O::GeoJSON::IO::Parse_Geojs
 		return O::Expected<Root, Error>::Make_Error(handler.Get_Error());
 	else
 		return O::Expected<Root, Error>::Make_Error(Error::PARSING_ERROR);
-}
\ No newline at end of file
+}
+
+O::Expected<O::GeoJSON::Geometry, O::GeoJSON::IO::Error> O::GeoJSON::IO::Parse_Geometry_Span(std::string_view json_span)
+{
+	rapidjson::Reader reader;
+	Full_Parser handler;
+
+	rapidjson::MemoryStream ms(json_span.data(), json_span.size());
+
+	if (!reader.Parse(ms, handler))
+	{
+		if (handler.Get_Error() != Error::NO_ERROR)
+			return O::Expected<Geometry, Error>::Make_Error(handler.Get_Error());
+		else
+			return O::Expected<Geometry, Error>::Make_Error(Error::PARSING_ERROR);
+	}
+	if (auto geojson = handler.Get_Geojson())
+	{
+		if (geojson->Is_Geometry())
+			return O::Expected<Geometry, Error>::Make_Value(std::move(geojson->Get_Geometry()));
+		return O::Expected<Geometry, Error>::Make_Error(Error::UNKNOWN_ROOT_OBJECT);
+	}
+	if (handler.Get_Error() != Error::NO_ERROR)
+		return O::Expected<Geometry, Error>::Make_Error(handler.Get_Error());
+	else
+		return O::Expected<Geometry, Error>::Make_Error(Error::PARSING_ERROR);
+}
@@ -0,0 +1,220 @@
+#include "io/schema.h"
+
+#include <algorithm>
+#include <memory>
+
+#include <rapidjson/reader.h>
+#include <rapidjson/filereadstream.h>
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	void Add_Type(Property_Schema& schema, Property_Type type)
+	{
+		schema.types |= static_cast<std::uint8_t>(type);
+	}
+}
+
+bool Schema_Scanner::StartObject()
+{
+	if (m_depth)
+	{
+		if (m_depth++ == 1 && m_current)
+			Add_Type(*m_current, Property_Type::OBJECT);
+		return true;
+	}
+	if (Current_State() == Parse_State::PROPERTIES_OBJECT)
+		m_depth = 1;
+	return Base::StartObject();
+}
+
+bool Schema_Scanner::EndObject(rapidjson::SizeType element_count)
+{
+	if (m_depth)
+	{
+		if (--m_depth)
+			return true;
+		m_current = nullptr;
+	}
+	return Base::EndObject(element_count);
+}
+
+bool Schema_Scanner::StartArray()
+{
+	if (!m_depth)
+		return Base::StartArray();
+	if (m_depth++ == 1 && m_current)
+		Add_Type(*m_current, Property_Type::ARRAY);
+	return true;
+}
+
+bool Schema_Scanner::EndArray(rapidjson::SizeType element_count)
+{
+	if (!m_depth)
+		return Base::EndArray(element_count);
+	--m_depth;
+	return true;
+}
+
+bool Schema_Scanner::Key(const char* str, rapidjson::SizeType length, bool copy)
+{
+	if (!m_depth)
+		return Base::Key(str, length, copy);
+	if (m_depth == 1)
+	{
+		std::string_view key(str, length);
+		auto it = m_schema.properties.find(key);
+		if (it == m_schema.properties.end())
+			it = m_schema.properties.emplace(std::string(key), Property_Schema()).first;
+		m_current = &it->second;
+		++m_current->present_count;
+	}
+	return true;
+}
+
+bool Schema_Scanner::String(const char* str, rapidjson::SizeType length, bool copy)
+{
+	if (!m_depth)
+		return Base::String(str, length, copy);
+	if (m_depth == 1 && m_current)
+	{
+		std::string_view value(str, length);
+		Add_Type(*m_current, Property_Type::STRING);
+		m_current->cardinality.Add(value);
+		m_current->max_string_length = std::max<std::size_t>(m_current->max_string_length, length);
+		if (!m_current->min_string || value < *m_current->min_string)
+			m_current->min_string = std::string(value);
+		if (!m_current->max_string || value > *m_current->max_string)
+			m_current->max_string = std::string(value);
+	}
+	return true;
+}
+
+bool Schema_Scanner::Bool(bool value)
+{
+	if (!m_depth)
+		return Base::Bool(value);
+	if (m_depth == 1 && m_current)
+	{
+		Add_Type(*m_current, Property_Type::BOOL);
+		m_current->cardinality.Add(value);
+	}
+	return true;
+}
+
+bool Schema_Scanner::Int(int value)
+{
+	if (!m_depth)
+		return Base::Int(value);
+	Record_Number(static_cast<double>(value), Property_Type::INTEGER);
+	return true;
+}
+
+bool Schema_Scanner::Uint(unsigned value)
+{
+	if (!m_depth)
+		return Base::Uint(value);
+	Record_Number(static_cast<double>(value), Property_Type::INTEGER);
+	return true;
+}
+
+bool Schema_Scanner::Int64(int64_t value)
+{
+	if (!m_depth)
+		return Base::Int64(value);
+	Record_Number(static_cast<double>(value), Property_Type::INTEGER);
+	return true;
+}
+
+bool Schema_Scanner::Uint64(uint64_t value)
+{
+	if (!m_depth)
+		return Base::Uint64(value);
+	Record_Number(static_cast<double>(value), Property_Type::INTEGER);
+	return true;
+}
+
+bool Schema_Scanner::Double(double value)
+{
+	if (!m_depth)
+		return Base::Double(value);
+	Record_Number(value, Property_Type::DOUBLE);
+	return true;
+}
+
+bool Schema_Scanner::Null()
+{
+	if (!m_depth)
+		return Base::Null();
+	if (m_depth == 1 && m_current)
+	{
+		Add_Type(*m_current, Property_Type::NULL_VALUE);
+		++m_current->null_count;
+	}
+	return true;
+}
+
+void Schema_Scanner::Record_Number(double value, Property_Type type)
+{
+	if (m_depth != 1 || !m_current)
+		return;
+	Add_Type(*m_current, type);
+	m_current->cardinality.Add(value);
+	m_current->min_number = std::min(m_current->min_number, value);
+	m_current->max_number = std::max(m_current->max_number, value);
+}
+
+bool Schema_Scanner::On_Geometry(O::GeoJSON::Geometry&& /*geometry*/, std::size_t /*element_number*/)
+{
+	return true;
+}
+
+bool Schema_Scanner::On_Feature(O::GeoJSON::Feature&& /*feature*/)
+{
+	++m_schema.feature_count;
+	return true;
+}
+
+bool Schema_Scanner::On_Feature_Collection(std::optional<O::GeoJSON::Bbox>&& /*bbox*/, O::GeoJSON::Id&& /*id*/)
+{
+	return true;
+}
+
+O::Expected<Schema, Error> O::GeoJSON::IO::Infer_Schema_String(const std::string& json_string)
+{
+	rapidjson::Reader reader;
+	Schema_Scanner handler;
+
+	rapidjson::StringStream ss(json_string.c_str());
+
+	if (!reader.Parse(ss, handler))
+	{
+		if (handler.Get_Error() != Error::NO_ERROR)
+			return O::Expected<Schema, Error>::Make_Error(handler.Get_Error());
+		else
+			return O::Expected<Schema, Error>::Make_Error(Error::PARSING_ERROR);
+	}
+	return O::Expected<Schema, Error>::Make_Value(handler.Get_Schema());
+}
+
+O::Expected<Schema, Error> O::GeoJSON::IO::Infer_Schema_File(const std::filesystem::path& filename)
+{
+	auto fp = std::unique_ptr<FILE, decltype(&fclose)>(fopen(filename.string().c_str(), "rb"), fclose);
+	if (!fp) return O::Expected<Schema, Error>::Make_Error(Error::FILE_OPENNING_FAILED);
+
+	char readBuffer[65536];
+	rapidjson::FileReadStream is(fp.get(), readBuffer, sizeof(readBuffer));
+
+	rapidjson::Reader reader;
+	Schema_Scanner handler;
+
+	if (!reader.Parse(is, handler))
+	{
+		if (handler.Get_Error() != Error::NO_ERROR)
+			return O::Expected<Schema, Error>::Make_Error(handler.Get_Error());
+		else
+			return O::Expected<Schema, Error>::Make_Error(Error::PARSING_ERROR);
+	}
+	return O::Expected<Schema, Error>::Make_Value(handler.Get_Schema());
+}
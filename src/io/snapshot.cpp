@@ -0,0 +1,731 @@
+#include "io/snapshot.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <rapidjson/stringbuffer.h>
+
+#include "io/property_builder.h"
+#include "io/writer.h"
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	constexpr char SNAPSHOT_MAGIC[8] = { 'O', 'G', 'F', 'S', 'N', 'A', 'P', 0 };
+	constexpr std::uint32_t SNAPSHOT_VERSION = 2;
+
+	/// @brief nested GeometryCollection limit accepted by the reader
+	constexpr std::size_t MAX_DEPTH = 32;
+
+	/// @name bytes of a column entry, a sparse entry also stores its row
+	/// @{
+	constexpr std::size_t DENSE_ENTRY_SIZE = sizeof(Snapshot_Value) + sizeof(std::uint64_t);
+	constexpr std::size_t SPARSE_ENTRY_SIZE = DENSE_ENTRY_SIZE + sizeof(std::uint64_t);
+	/// @}
+
+	enum class Section_Index
+	{
+		XY,
+		ALTITUDES,
+		RINGS,
+		POLYGONS,
+		GEOMETRIES,
+		FEATURES,
+		BBOXES,
+		COLUMNS,
+		TAGS,
+		VALUES,
+		ROWS,
+		STRING_OFFSETS,
+		STRING_BYTES,
+		SECTION_COUNT,
+	};
+
+	struct Section
+	{
+		std::uint64_t offset;
+		std::uint64_t size;
+	};
+
+	/// @brief first bytes of a snapshot
+	struct File_Header
+	{
+		char magic[8];
+		std::uint32_t version;
+		std::uint8_t root_kind;
+		std::uint8_t root_id_type;
+		std::uint8_t padding[2];
+		std::uint64_t root_geometry;
+		std::uint64_t root_bbox;
+		std::uint64_t root_id;
+		Section sections[static_cast<std::size_t>(Section_Index::SECTION_COUNT)];
+	};
+
+	/// @brief id type and payload of a GeoJSON id
+	template<class Intern>
+	std::pair<Snapshot_Id, std::uint64_t> Encode_Id(const O::GeoJSON::Id& id, Intern&& intern)
+	{
+		if (id.Is_Integer()) return { Snapshot_Id::INTEGER, static_cast<std::uint64_t>(id.Get_Integer()) };
+		if (id.Is_Double())  return { Snapshot_Id::DOUBLE, std::bit_cast<std::uint64_t>(id.Get_Double()) };
+		if (id.Is_String())  return { Snapshot_Id::STRING, intern(id.Get_String()) };
+		return { Snapshot_Id::NONE, 0 };
+	}
+
+	std::string To_Json(const O::GeoJSON::Property& property)
+	{
+		rapidjson::StringBuffer buffer;
+		Writer<rapidjson::StringBuffer> writer(buffer);
+		writer.Write_Property_Value(property);
+		return std::string(buffer.GetString(), buffer.GetSize());
+	}
+
+	/**
+	 * @brief in-memory tables of a snapshot being written
+	 */
+	class Snapshot_Builder
+	{
+	public:
+		explicit Snapshot_Builder(std::size_t feature_count) : m_feature_count(feature_count) {}
+
+		std::uint64_t Intern(std::string_view text)
+		{
+			auto it = m_string_ids.find(std::string(text));
+			if (it != m_string_ids.end())
+				return it->second;
+			const std::uint64_t index = m_string_offsets.size() - 1;
+			m_string_ids.emplace(std::string(text), index);
+			m_string_bytes.append(text);
+			m_string_offsets.push_back(m_string_bytes.size());
+			return index;
+		}
+
+		std::uint64_t Add_Bbox(const std::optional<O::GeoJSON::Bbox>& bbox)
+		{
+			if (!bbox)
+				return SNAPSHOT_NONE;
+			Snapshot_Bbox record{};
+			if (bbox->Has_Altitude())
+			{
+				record.dimensions = 6;
+				std::copy(bbox->Get_With_Altitudes().begin(), bbox->Get_With_Altitudes().end(), record.coordinates);
+			}
+			else
+			{
+				record.dimensions = 4;
+				std::copy(bbox->Get().begin(), bbox->Get().end(), record.coordinates);
+			}
+			m_bboxes.push_back(record);
+			return m_bboxes.size() - 1;
+		}
+
+		std::uint64_t Add_Geometry(const O::GeoJSON::Geometry& geometry)
+		{
+			const std::uint64_t index = m_geometries.size();
+			m_geometries.emplace_back();
+			Fill_Geometry(index, geometry);
+			return index;
+		}
+
+		void Add_Feature(const O::GeoJSON::Feature& feature)
+		{
+			const std::size_t feature_index = m_features.size();
+			Snapshot_Feature record{};
+			record.geometry = feature.geometry ? Add_Geometry(*feature.geometry) : SNAPSHOT_NONE;
+			record.bbox = Add_Bbox(feature.bbox);
+			std::tie(record.id_type, record.id) = Encode_Id(feature.id, [this](std::string_view text) { return Intern(text); });
+			record.properties = SNAPSHOT_NONE;
+			if (!feature.properties.Is_Object())
+				record.properties = Intern(To_Json(feature.properties));
+			else
+				for (const auto& [key, value] : feature.properties.Get_Object())
+				{
+					Column_Entries& column = m_entries[Column(key)];
+					column.rows.push_back(feature_index);
+					Snapshot_Value& tag = column.tags.emplace_back(Snapshot_Value::ABSENT);
+					std::uint64_t& payload = column.values.emplace_back(0);
+					if (value.Is_Null())         tag = Snapshot_Value::NULL_VALUE;
+					else if (value.Is_Bool())    { tag = Snapshot_Value::BOOL; payload = value.Get_Bool() ? 1 : 0; }
+					else if (value.Is_Integer()) { tag = Snapshot_Value::INTEGER; payload = static_cast<std::uint64_t>(value.Get_Int()); }
+					else if (value.Is_Double())  { tag = Snapshot_Value::DOUBLE; payload = std::bit_cast<std::uint64_t>(value.Get_Double()); }
+					else if (value.Is_String())  { tag = Snapshot_Value::STRING; payload = Intern(value.Get_String()); }
+					else                         { tag = Snapshot_Value::JSON; payload = Intern(To_Json(value)); }
+				}
+			m_features.push_back(record);
+		}
+
+		/// @brief write the header and every section
+		Error Write(const std::filesystem::path& path, File_Header header)
+		{
+			std::ofstream out(path, std::ios::binary | std::ios::trunc);
+			if (!out)
+				return Error::FILE_OPENNING_FAILED;
+
+			std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+			header.version = SNAPSHOT_VERSION;
+			out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			std::uint64_t offset = sizeof(header);
+			auto section = [&](Section_Index index, const void* data, std::size_t size)
+			{
+				static const char zeros[8] = {};
+				const std::size_t padding = (8 - offset % 8) % 8;
+				out.write(zeros, static_cast<std::streamsize>(padding));
+				offset += padding;
+				header.sections[static_cast<std::size_t>(index)] = { offset, size };
+				out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+				offset += size;
+			};
+
+			if (!m_has_altitude)
+				m_altitudes.clear();
+			std::vector<Snapshot_Column> columns(m_keys.size());
+			std::vector<Snapshot_Value> tags;
+			std::vector<std::uint64_t> values;
+			std::vector<std::uint64_t> rows;
+			for (std::size_t c = 0; c < m_keys.size(); ++c)
+			{
+				const Column_Entries& entries = m_entries[c];
+				Snapshot_Column& column = columns[c];
+				column.name = m_keys[c];
+				column.type = Snapshot_Value::ABSENT;
+				for (Snapshot_Value tag : entries.tags)
+					if (tag != column.type)
+						column.type = column.type == Snapshot_Value::ABSENT ? tag : Snapshot_Value::MIXED;
+
+				column.begin = tags.size();
+				if (entries.rows.size() * SPARSE_ENTRY_SIZE >= m_feature_count * DENSE_ENTRY_SIZE)
+				{
+					column.count = m_feature_count;
+					column.rows = SNAPSHOT_NONE;
+					tags.resize(tags.size() + m_feature_count, Snapshot_Value::ABSENT);
+					values.resize(values.size() + m_feature_count, 0);
+					for (std::size_t i = 0; i < entries.rows.size(); ++i)
+					{
+						tags[column.begin + entries.rows[i]] = entries.tags[i];
+						values[column.begin + entries.rows[i]] = entries.values[i];
+					}
+				}
+				else
+				{
+					column.count = entries.rows.size();
+					column.rows = rows.size();
+					rows.insert(rows.end(), entries.rows.begin(), entries.rows.end());
+					tags.insert(tags.end(), entries.tags.begin(), entries.tags.end());
+					values.insert(values.end(), entries.values.begin(), entries.values.end());
+				}
+			}
+
+			section(Section_Index::XY, m_xy.data(), m_xy.size() * sizeof(double));
+			section(Section_Index::ALTITUDES, m_altitudes.data(), m_altitudes.size() * sizeof(double));
+			section(Section_Index::RINGS, m_rings.data(), m_rings.size() * sizeof(std::uint64_t));
+			section(Section_Index::POLYGONS, m_polygons.data(), m_polygons.size() * sizeof(std::uint64_t));
+			section(Section_Index::GEOMETRIES, m_geometries.data(), m_geometries.size() * sizeof(Snapshot_Geometry));
+			section(Section_Index::FEATURES, m_features.data(), m_features.size() * sizeof(Snapshot_Feature));
+			section(Section_Index::BBOXES, m_bboxes.data(), m_bboxes.size() * sizeof(Snapshot_Bbox));
+			section(Section_Index::COLUMNS, columns.data(), columns.size() * sizeof(Snapshot_Column));
+			section(Section_Index::TAGS, tags.data(), tags.size());
+			section(Section_Index::VALUES, values.data(), values.size() * sizeof(std::uint64_t));
+			section(Section_Index::ROWS, rows.data(), rows.size() * sizeof(std::uint64_t));
+			section(Section_Index::STRING_OFFSETS, m_string_offsets.data(), m_string_offsets.size() * sizeof(std::uint64_t));
+			section(Section_Index::STRING_BYTES, m_string_bytes.data(), m_string_bytes.size());
+
+			out.seekp(0);
+			out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			return out ? Error::NO_ERROR : Error::FILE_WRITE_FAILED;
+		}
+
+	private:
+		/// @brief values of a key in the order of the features holding it
+		struct Column_Entries
+		{
+			std::vector<std::uint64_t> rows;
+			std::vector<Snapshot_Value> tags;
+			std::vector<std::uint64_t> values;
+		};
+
+		std::size_t Column(const std::string& key)
+		{
+			auto [it, inserted] = m_columns.try_emplace(key, m_keys.size());
+			if (inserted)
+			{
+				m_keys.push_back(Intern(key));
+				m_entries.emplace_back();
+			}
+			return it->second;
+		}
+
+		void Add_Positions(const std::vector<O::GeoJSON::Position>& positions)
+		{
+			for (const auto& position : positions)
+			{
+				m_xy.push_back(position.longitude);
+				m_xy.push_back(position.latitude);
+				m_altitudes.push_back(position.altitude.value_or(std::numeric_limits<double>::quiet_NaN()));
+				m_has_altitude |= position.altitude.has_value();
+			}
+		}
+
+		/// @brief positions (or rings) added since the last offset become an unreferenced entry, so the next one starts at ``count``
+		static void Close_Gap(std::vector<std::uint64_t>& offsets, std::uint64_t count)
+		{
+			if (offsets.back() != count)
+				offsets.push_back(count);
+		}
+
+		void Add_Rings(const std::vector<std::vector<O::GeoJSON::Position>>& rings)
+		{
+			for (const auto& ring : rings)
+			{
+				Add_Positions(ring);
+				m_rings.push_back(m_xy.size() / 2);
+			}
+		}
+
+		void Fill_Geometry(std::uint64_t index, const O::GeoJSON::Geometry& geometry)
+		{
+			Snapshot_Geometry record{};
+			record.type = static_cast<std::uint8_t>(geometry.value.index());
+			record.bbox = Add_Bbox(geometry.bbox);
+			if (geometry.Is_Point() || geometry.Is_Multi_Point() || geometry.Is_Line_String())
+			{
+				record.begin = m_xy.size() / 2;
+				if (geometry.Is_Point())
+					Add_Positions({ geometry.Get_Point().position });
+				else
+					Add_Positions(geometry.Is_Multi_Point() ? geometry.Get_Multi_Point().points : geometry.Get_Line_String().positions);
+				record.end = m_xy.size() / 2;
+			}
+			else if (geometry.Is_Polygon() || geometry.Is_Multi_Line_String())
+			{
+				Close_Gap(m_rings, m_xy.size() / 2);
+				record.begin = m_rings.size() - 1;
+				if (geometry.Is_Polygon())
+					Add_Rings(geometry.Get_Polygon().rings);
+				else
+					for (const auto& line : geometry.Get_Multi_Line_String().line_strings)
+						Add_Rings({ line.positions });
+				record.end = m_rings.size() - 1;
+			}
+			else if (geometry.Is_Multi_Polygon())
+			{
+				Close_Gap(m_rings, m_xy.size() / 2);
+				Close_Gap(m_polygons, m_rings.size() - 1);
+				record.begin = m_polygons.size() - 1;
+				for (const auto& polygon : geometry.Get_Multi_Polygon().polygons)
+				{
+					Add_Rings(polygon.rings);
+					m_polygons.push_back(m_rings.size() - 1);
+				}
+				record.end = m_polygons.size() - 1;
+			}
+			else
+			{
+				// the members are contiguous records following the ones already allocated
+				const auto& members = geometry.Get_Geometry_Collection().geometries;
+				record.begin = m_geometries.size();
+				for (const auto& member : members)
+					if (member)
+						m_geometries.emplace_back();
+				record.end = m_geometries.size();
+				std::uint64_t next = record.begin;
+				for (const auto& member : members)
+					if (member)
+						Fill_Geometry(next++, *member);
+			}
+			m_geometries[index] = record;
+		}
+
+		std::size_t m_feature_count;
+		std::vector<double> m_xy;
+		std::vector<double> m_altitudes;
+		bool m_has_altitude = false;
+		std::vector<std::uint64_t> m_rings = { 0 };
+		std::vector<std::uint64_t> m_polygons = { 0 };
+		std::vector<Snapshot_Geometry> m_geometries;
+		std::vector<Snapshot_Feature> m_features;
+		std::vector<Snapshot_Bbox> m_bboxes;
+		std::unordered_map<std::string, std::size_t> m_columns;
+		std::vector<std::uint64_t> m_keys;
+		std::vector<Column_Entries> m_entries;
+		std::unordered_map<std::string, std::uint64_t> m_string_ids;
+		std::vector<std::uint64_t> m_string_offsets = { 0 };
+		std::string m_string_bytes;
+	};
+
+	/// @brief view a section as an array of T, false when it does not fit in the file
+	template<class T>
+	bool View(const File_Header& header, Section_Index index, std::string_view file, std::span<const T>& view)
+	{
+		const Section& section = header.sections[static_cast<std::size_t>(index)];
+		if (section.offset % 8 != 0 || section.offset > file.size() || section.size > file.size() - section.offset || section.size % sizeof(T) != 0)
+			return false;
+		view = std::span<const T>(reinterpret_cast<const T*>(file.data() + section.offset), section.size / sizeof(T));
+		return true;
+	}
+
+	/// @brief offsets starting at 0, never decreasing and ending at most at ``limit``
+	bool Valid_Offsets(std::span<const std::uint64_t> offsets, std::uint64_t limit)
+	{
+		if (offsets.empty() || offsets.front() != 0)
+			return false;
+		for (std::size_t i = 1; i < offsets.size(); ++i)
+			if (offsets[i] < offsets[i - 1])
+				return false;
+		return offsets.back() <= limit;
+	}
+}
+
+O::GeoJSON::IO::Error Snapshot_Writer::Save(const O::GeoJSON::Root& root, const std::filesystem::path& path)
+{
+	File_Header header{};
+	header.root_geometry = SNAPSHOT_NONE;
+	header.root_bbox = SNAPSHOT_NONE;
+	if (root.Is_Feature_Collection())
+	{
+		const auto& collection = root.Get_Feature_Collection();
+		Snapshot_Builder builder(collection.features.size());
+		header.root_kind = static_cast<std::uint8_t>(Snapshot_Root::FEATURE_COLLECTION);
+		header.root_bbox = builder.Add_Bbox(collection.bbox);
+		auto [id_type, id] = Encode_Id(collection.id, [&builder](std::string_view text) { return builder.Intern(text); });
+		header.root_id_type = static_cast<std::uint8_t>(id_type);
+		header.root_id = id;
+		for (const auto& feature : collection.features)
+			builder.Add_Feature(feature);
+		return builder.Write(path, header);
+	}
+	if (root.Is_Feature())
+	{
+		Snapshot_Builder builder(1);
+		header.root_kind = static_cast<std::uint8_t>(Snapshot_Root::FEATURE);
+		builder.Add_Feature(root.Get_Feature());
+		return builder.Write(path, header);
+	}
+	Snapshot_Builder builder(0);
+	header.root_kind = static_cast<std::uint8_t>(Snapshot_Root::GEOMETRY);
+	header.root_geometry = builder.Add_Geometry(root.Get_Geometry());
+	return builder.Write(path, header);
+}
+
+O::Expected<Snapshot_Reader, O::GeoJSON::IO::Error> Snapshot_Reader::Open(const std::filesystem::path& path)
+{
+	using Expected = O::Expected<Snapshot_Reader, Error>;
+	auto file = Mapped_File::Open(path);
+	if (!file.Has_Value())
+		return Expected::Make_Error(file.Error());
+
+	Snapshot_Reader reader;
+	reader.m_file = std::move(file.Value());
+	const std::string_view bytes = reader.m_file.View();
+	auto invalid = []() { return Expected::Make_Error(Error::INVALID_SNAPSHOT); };
+
+	File_Header header;
+	if constexpr (std::endian::native != std::endian::little)
+		return invalid();
+	if (bytes.size() < sizeof(header))
+		return invalid();
+	std::memcpy(&header, bytes.data(), sizeof(header));
+	if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 || header.version != SNAPSHOT_VERSION || header.root_kind > static_cast<std::uint8_t>(Snapshot_Root::GEOMETRY))
+		return invalid();
+
+	std::span<const char> string_bytes;
+	if (!View(header, Section_Index::XY, bytes, reader.m_xy)
+		|| !View(header, Section_Index::ALTITUDES, bytes, reader.m_altitudes)
+		|| !View(header, Section_Index::RINGS, bytes, reader.m_rings)
+		|| !View(header, Section_Index::POLYGONS, bytes, reader.m_polygons)
+		|| !View(header, Section_Index::GEOMETRIES, bytes, reader.m_geometries)
+		|| !View(header, Section_Index::FEATURES, bytes, reader.m_features)
+		|| !View(header, Section_Index::BBOXES, bytes, reader.m_bboxes)
+		|| !View(header, Section_Index::COLUMNS, bytes, reader.m_columns)
+		|| !View(header, Section_Index::TAGS, bytes, reader.m_tags)
+		|| !View(header, Section_Index::VALUES, bytes, reader.m_values)
+		|| !View(header, Section_Index::ROWS, bytes, reader.m_rows)
+		|| !View(header, Section_Index::STRING_OFFSETS, bytes, reader.m_string_offsets)
+		|| !View(header, Section_Index::STRING_BYTES, bytes, string_bytes))
+		return invalid();
+	reader.m_string_bytes = std::string_view(string_bytes.data(), string_bytes.size());
+
+	const std::uint64_t position_count = reader.m_xy.size() / 2;
+	const std::uint64_t string_count = reader.m_string_offsets.empty() ? 0 : reader.m_string_offsets.size() - 1;
+	const std::uint64_t ring_count = reader.m_rings.empty() ? 0 : reader.m_rings.size() - 1;
+	const std::uint64_t polygon_count = reader.m_polygons.empty() ? 0 : reader.m_polygons.size() - 1;
+	const std::uint64_t geometry_count = reader.m_geometries.size();
+	if (reader.m_xy.size() % 2 != 0 || (!reader.m_altitudes.empty() && reader.m_altitudes.size() != position_count)
+		|| !Valid_Offsets(reader.m_rings, position_count) || !Valid_Offsets(reader.m_polygons, ring_count)
+		|| !Valid_Offsets(reader.m_string_offsets, reader.m_string_bytes.size()) || reader.m_string_offsets.back() != reader.m_string_bytes.size())
+		return invalid();
+
+	auto valid_bbox = [&](std::uint64_t index) { return index == SNAPSHOT_NONE || index < reader.m_bboxes.size(); };
+	auto valid_geometry = [&](std::uint64_t index) { return index == SNAPSHOT_NONE || index < geometry_count; };
+	auto valid_id = [&](std::uint8_t type, std::uint64_t value) { return type <= static_cast<std::uint8_t>(Snapshot_Id::STRING) && (type != static_cast<std::uint8_t>(Snapshot_Id::STRING) || value < string_count); };
+
+	for (const Snapshot_Bbox& bbox : reader.m_bboxes)
+		if (bbox.dimensions != 4 && bbox.dimensions != 6)
+			return invalid();
+
+	// members are stored after their collection, so the depth of every record is known when it is reached
+	std::vector<std::uint8_t> depth(geometry_count, 0);
+	for (std::uint64_t i = 0; i < geometry_count; ++i)
+	{
+		const Snapshot_Geometry& geometry = reader.m_geometries[i];
+		const auto type = static_cast<O::GeoJSON::Type>(geometry.type);
+		std::uint64_t limit = 0;
+		switch (type)
+		{
+		case O::GeoJSON::Type::POINT:
+		case O::GeoJSON::Type::MULTI_POINT:
+		case O::GeoJSON::Type::LINE_STRING:       limit = position_count; break;
+		case O::GeoJSON::Type::POLYGON:
+		case O::GeoJSON::Type::MULTI_LINE_STRING: limit = ring_count; break;
+		case O::GeoJSON::Type::MULTI_POLYGON:     limit = polygon_count; break;
+		case O::GeoJSON::Type::GEOMETRY_COLLECTION:
+			limit = geometry_count;
+			if (geometry.begin <= i && geometry.begin != geometry.end)
+				return invalid();
+			break;
+		default:
+			return invalid();
+		}
+		if (geometry.begin > geometry.end || geometry.end > limit || !valid_bbox(geometry.bbox) || (type == O::GeoJSON::Type::POINT && geometry.end != geometry.begin + 1))
+			return invalid();
+		if (type == O::GeoJSON::Type::GEOMETRY_COLLECTION)
+			for (std::uint64_t member = geometry.begin; member < geometry.end; ++member)
+			{
+				depth[member] = std::max<std::uint8_t>(depth[member], depth[i] + 1);
+				if (depth[member] > MAX_DEPTH)
+					return invalid();
+			}
+	}
+
+	for (const Snapshot_Feature& feature : reader.m_features)
+		if (!valid_geometry(feature.geometry) || !valid_bbox(feature.bbox) || !valid_id(static_cast<std::uint8_t>(feature.id_type), feature.id)
+			|| (feature.properties != SNAPSHOT_NONE && feature.properties >= string_count))
+			return invalid();
+
+	// every range is checked by subtraction, the counts come from the file and a product of them could wrap
+	const std::uint64_t feature_count = reader.m_features.size();
+	const std::uint64_t entry_count = reader.m_tags.size();
+	if (reader.m_values.size() != entry_count)
+		return invalid();
+	for (const Snapshot_Column& column : reader.m_columns)
+	{
+		if (column.name >= string_count || column.type > Snapshot_Value::MIXED || column.begin > entry_count || column.count > entry_count - column.begin)
+			return invalid();
+		if (column.rows == SNAPSHOT_NONE)
+		{
+			if (column.count != feature_count)
+				return invalid();
+			continue;
+		}
+		if (column.rows > reader.m_rows.size() || column.count > reader.m_rows.size() - column.rows)
+			return invalid();
+		for (std::uint64_t i = 0; i < column.count; ++i)
+		{
+			const std::uint64_t row = reader.m_rows[column.rows + i];
+			if (row >= feature_count || (i != 0 && row <= reader.m_rows[column.rows + i - 1]))
+				return invalid();
+		}
+	}
+	for (std::size_t i = 0; i < entry_count; ++i)
+	{
+		const auto tag = static_cast<Snapshot_Value>(reader.m_tags[i]);
+		if (tag > Snapshot_Value::JSON || ((tag == Snapshot_Value::STRING || tag == Snapshot_Value::JSON) && reader.m_values[i] >= string_count))
+			return invalid();
+	}
+
+	reader.m_root_kind = static_cast<Snapshot_Root>(header.root_kind);
+	reader.m_root_geometry = header.root_geometry;
+	reader.m_root_bbox = header.root_bbox;
+	reader.m_root_id_type = static_cast<Snapshot_Id>(header.root_id_type);
+	reader.m_root_id = header.root_id;
+	if (!valid_geometry(header.root_geometry) || !valid_bbox(header.root_bbox) || !valid_id(header.root_id_type, header.root_id)
+		|| (reader.m_root_kind == Snapshot_Root::GEOMETRY && header.root_geometry == SNAPSHOT_NONE)
+		|| (reader.m_root_kind == Snapshot_Root::FEATURE && reader.m_features.size() != 1))
+		return invalid();
+	return Expected::Make_Value(std::move(reader));
+}
+
+std::string_view Snapshot_Reader::String(std::uint64_t index) const
+{
+	return m_string_bytes.substr(static_cast<std::size_t>(m_string_offsets[index]), static_cast<std::size_t>(m_string_offsets[index + 1] - m_string_offsets[index]));
+}
+
+std::optional<std::size_t> Snapshot_Reader::Find_Column(std::string_view key) const
+{
+	for (std::size_t i = 0; i < m_columns.size(); ++i)
+		if (String(m_columns[i].name) == key)
+			return i;
+	return std::nullopt;
+}
+
+std::uint64_t Snapshot_Reader::Entry(std::size_t column, std::size_t feature) const
+{
+	const Snapshot_Column& record = m_columns[column];
+	if (record.rows == SNAPSHOT_NONE)
+		return record.begin + feature;
+	const auto rows = m_rows.subspan(static_cast<std::size_t>(record.rows), static_cast<std::size_t>(record.count));
+	const auto it = std::lower_bound(rows.begin(), rows.end(), static_cast<std::uint64_t>(feature));
+	if (it == rows.end() || *it != feature)
+		return SNAPSHOT_NONE;
+	return record.begin + static_cast<std::uint64_t>(it - rows.begin());
+}
+
+double Snapshot_Reader::Get_Double(std::size_t column, std::size_t feature) const
+{
+	return std::bit_cast<double>(Raw(column, feature));
+}
+
+std::optional<O::GeoJSON::Bbox> Snapshot_Reader::Read_Bbox(std::uint64_t index) const
+{
+	if (index == SNAPSHOT_NONE)
+		return std::nullopt;
+	const Snapshot_Bbox& record = m_bboxes[index];
+	O::GeoJSON::Bbox bbox;
+	if (record.dimensions == 6)
+		bbox.coordinates = std::array<double, 6>{ record.coordinates[0], record.coordinates[1], record.coordinates[2], record.coordinates[3], record.coordinates[4], record.coordinates[5] };
+	else
+		bbox.coordinates = std::array<double, 4>{ record.coordinates[0], record.coordinates[1], record.coordinates[2], record.coordinates[3] };
+	return bbox;
+}
+
+O::GeoJSON::Id Snapshot_Reader::Read_Id(Snapshot_Id type, std::uint64_t value) const
+{
+	switch (type)
+	{
+	case Snapshot_Id::INTEGER: return O::GeoJSON::Id(static_cast<std::int64_t>(value));
+	case Snapshot_Id::DOUBLE:  return O::GeoJSON::Id(std::bit_cast<double>(value));
+	case Snapshot_Id::STRING:  return O::GeoJSON::Id(String(value));
+	default:                   return O::GeoJSON::Id();
+	}
+}
+
+std::vector<O::GeoJSON::Position> Snapshot_Reader::Read_Positions(std::uint64_t begin, std::uint64_t end) const
+{
+	std::vector<O::GeoJSON::Position> positions(static_cast<std::size_t>(end - begin));
+	for (std::uint64_t i = begin; i < end; ++i)
+	{
+		O::GeoJSON::Position& position = positions[i - begin];
+		position.longitude = m_xy[2 * i];
+		position.latitude = m_xy[2 * i + 1];
+		if (!m_altitudes.empty() && !std::isnan(m_altitudes[i]))
+			position.altitude = m_altitudes[i];
+	}
+	return positions;
+}
+
+std::vector<std::vector<O::GeoJSON::Position>> Snapshot_Reader::Read_Rings(std::uint64_t begin, std::uint64_t end) const
+{
+	std::vector<std::vector<O::GeoJSON::Position>> rings;
+	rings.reserve(static_cast<std::size_t>(end - begin));
+	for (std::uint64_t ring = begin; ring < end; ++ring)
+		rings.push_back(Read_Positions(m_rings[ring], m_rings[ring + 1]));
+	return rings;
+}
+
+O::GeoJSON::Geometry Snapshot_Reader::Read_Geometry(std::uint64_t index) const
+{
+	const Snapshot_Geometry& record = m_geometries[index];
+	O::GeoJSON::Geometry geometry;
+	geometry.bbox = Read_Bbox(record.bbox);
+	switch (static_cast<O::GeoJSON::Type>(record.type))
+	{
+	case O::GeoJSON::Type::POINT:
+		geometry.value = O::GeoJSON::Point{ Read_Positions(record.begin, record.end).front() };
+		break;
+	case O::GeoJSON::Type::MULTI_POINT:
+		geometry.value = O::GeoJSON::Multi_Point{ Read_Positions(record.begin, record.end) };
+		break;
+	case O::GeoJSON::Type::LINE_STRING:
+		geometry.value = O::GeoJSON::Line_String{ Read_Positions(record.begin, record.end) };
+		break;
+	case O::GeoJSON::Type::MULTI_LINE_STRING:
+	{
+		O::GeoJSON::Multi_Line_String lines;
+		for (auto& positions : Read_Rings(record.begin, record.end))
+			lines.line_strings.push_back(O::GeoJSON::Line_String{ std::move(positions) });
+		geometry.value = std::move(lines);
+		break;
+	}
+	case O::GeoJSON::Type::POLYGON:
+		geometry.value = O::GeoJSON::Polygon{ Read_Rings(record.begin, record.end) };
+		break;
+	case O::GeoJSON::Type::MULTI_POLYGON:
+	{
+		O::GeoJSON::Multi_Polygon polygons;
+		for (std::uint64_t polygon = record.begin; polygon < record.end; ++polygon)
+			polygons.polygons.push_back(O::GeoJSON::Polygon{ Read_Rings(m_polygons[polygon], m_polygons[polygon + 1]) });
+		geometry.value = std::move(polygons);
+		break;
+	}
+	default:
+	{
+		O::GeoJSON::Geometry_Collection collection;
+		for (std::uint64_t member = record.begin; member < record.end; ++member)
+			collection.geometries.push_back(std::make_shared<O::GeoJSON::Geometry>(Read_Geometry(member)));
+		geometry.value = std::move(collection);
+		break;
+	}
+	}
+	return geometry;
+}
+
+O::GeoJSON::Property Snapshot_Reader::Read_Value(std::size_t column, std::size_t feature) const
+{
+	switch (Value_Type(column, feature))
+	{
+	case Snapshot_Value::BOOL:    return O::GeoJSON::Property(Get_Bool(column, feature));
+	case Snapshot_Value::INTEGER: return O::GeoJSON::Property(Get_Integer(column, feature));
+	case Snapshot_Value::DOUBLE:  return O::GeoJSON::Property(Get_Double(column, feature));
+	case Snapshot_Value::STRING:  return O::GeoJSON::Property(std::string(Get_String(column, feature)));
+	case Snapshot_Value::JSON:    return Property_Builder::Parse(Get_String(column, feature)).value_or(O::GeoJSON::Property(nullptr));
+	default:                      return O::GeoJSON::Property(nullptr);
+	}
+}
+
+O::GeoJSON::Feature Snapshot_Reader::Read_Feature(std::size_t index) const
+{
+	const Snapshot_Feature& record = m_features[index];
+	O::GeoJSON::Feature feature;
+	if (record.geometry != SNAPSHOT_NONE)
+		feature.geometry = Read_Geometry(record.geometry);
+	feature.bbox = Read_Bbox(record.bbox);
+	feature.id = Read_Id(record.id_type, record.id);
+	if (record.properties != SNAPSHOT_NONE)
+		feature.properties = Property_Builder::Parse(String(record.properties)).value_or(O::GeoJSON::Property(nullptr));
+	else
+	{
+		O::GeoJSON::Property::Object properties;
+		for (std::size_t column = 0; column < m_columns.size(); ++column)
+			if (Value_Type(column, index) != Snapshot_Value::ABSENT)
+				properties.emplace(String(m_columns[column].name), Read_Value(column, index));
+		feature.properties = O::GeoJSON::Property(std::move(properties));
+	}
+	return feature;
+}
+
+O::GeoJSON::Root Snapshot_Reader::To_Root() const
+{
+	O::GeoJSON::Root root;
+	if (m_root_kind == Snapshot_Root::GEOMETRY)
+		root.object = Read_Geometry(m_root_geometry);
+	else if (m_root_kind == Snapshot_Root::FEATURE)
+		root.object = Read_Feature(0);
+	else
+	{
+		O::GeoJSON::Feature_Collection collection;
+		collection.features.reserve(m_features.size());
+		for (std::size_t i = 0; i < m_features.size(); ++i)
+			collection.features.push_back(Read_Feature(i));
+		collection.bbox = Read_Bbox(m_root_bbox);
+		collection.id = Read_Id(m_root_id_type, m_root_id);
+		root.object = std::move(collection);
+	}
+	return root;
+}
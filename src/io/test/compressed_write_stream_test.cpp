@@ -0,0 +1,179 @@
+#include "compressed_write_stream_test.h"
+
+// STL
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+// RAPIDJSON
+#include <rapidjson/ostreamwrapper.h>
+
+#ifdef OGEOFLOW_HAS_ZLIB
+#include <zlib.h>
+#endif
+#ifdef OGEOFLOW_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+// IO
+#include "io/compressed_write_stream.h"
+#include "io/writer.h"
+
+using namespace O::GeoJSON;
+
+namespace
+{
+	Root Make_Root(std::size_t feature_count)
+	{
+		Feature_Collection fc;
+		for (std::size_t i = 0; i < feature_count; ++i)
+		{
+			Feature f;
+			f.id = static_cast<std::int64_t>(i);
+			Point p;
+			p.position.longitude = i * 0.125;
+			p.position.latitude = -(i * 0.75);
+			f.geometry = Geometry{};
+			f.geometry->value = p;
+			f.properties = Property(Property::Object{{"name", Property(std::string("feature ") + std::to_string(i * 7919 % 1000))}});
+			fc.features.push_back(std::move(f));
+		}
+		Root root;
+		root.object = std::move(fc);
+		return root;
+	}
+
+	std::string Write_Ostream(const Root& root)
+	{
+		std::stringstream ss;
+		rapidjson::OStreamWrapper osw(ss);
+		IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+		writer.Write_GeoJSON_Object(root);
+		return ss.str();
+	}
+
+	std::string Read_File(const std::filesystem::path& path)
+	{
+		std::ifstream in(path, std::ios::binary);
+		return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	}
+
+	/// write the root compressed with small blocks and several workers, give back the compressed bytes
+	std::string Write_Compressed(const Root& root, IO::Compression compression, const std::string& name)
+	{
+		auto path = std::filesystem::temp_directory_path() / name;
+		auto stream = IO::Compressed_Write_Stream::Open(path, compression, -1, 3, 4096);
+		EXPECT_TRUE(stream.Has_Value());
+		IO::Writer<IO::Compressed_Write_Stream> writer(stream.Value());
+		writer.Write_GeoJSON_Object(root);
+		const std::uint64_t size = stream.Value().Tell();
+		EXPECT_EQ(stream.Value().Close(), IO::Error::NO_ERROR);
+		EXPECT_EQ(stream.Value().Tell(), size);
+		std::string content = Read_File(path);
+		std::filesystem::remove(path);
+		return content;
+	}
+
+#ifdef OGEOFLOW_HAS_ZLIB
+	/// inflate exactly one gzip member, as strict readers do
+	std::string Gunzip_First_Member(const std::string& data, bool& stream_end, std::size_t& consumed)
+	{
+		z_stream stream = {};
+		EXPECT_EQ(inflateInit2(&stream, 16 + MAX_WBITS), Z_OK);
+		std::string out(1 << 16, '\0');
+		std::string result;
+		stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+		stream.avail_in = static_cast<uInt>(data.size());
+		int status = Z_OK;
+		while (status == Z_OK)
+		{
+			stream.next_out = reinterpret_cast<Bytef*>(out.data());
+			stream.avail_out = static_cast<uInt>(out.size());
+			status = inflate(&stream, Z_NO_FLUSH);
+			result.append(out.data(), out.size() - stream.avail_out);
+		}
+		stream_end = status == Z_STREAM_END;
+		consumed = data.size() - stream.avail_in;
+		inflateEnd(&stream);
+		return result;
+	}
+#endif
+}
+
+TEST_F(Compressed_Write_Stream_Test, Gzip_Is_A_Single_Member)
+{
+#ifdef OGEOFLOW_HAS_ZLIB
+	Root root = Make_Root(2000);
+	std::string expected = Write_Ostream(root);
+	std::string compressed = Write_Compressed(root, IO::Compression::GZIP, "ogeoflow_compressed.geojson.gz");
+	ASSERT_GT(expected.size(), 10 * 4096u);
+	EXPECT_LT(compressed.size(), expected.size() / 2);
+
+	bool stream_end = false;
+	std::size_t consumed = 0;
+	EXPECT_EQ(Gunzip_First_Member(compressed, stream_end, consumed), expected);
+	EXPECT_TRUE(stream_end);
+	EXPECT_EQ(consumed, compressed.size());
+#else
+	EXPECT_FALSE(IO::Compressed_Write_Stream::Is_Available(IO::Compression::GZIP));
+	GTEST_SKIP() << "built without zlib";
+#endif
+}
+
+TEST_F(Compressed_Write_Stream_Test, Zstd_Round_Trip)
+{
+#ifdef OGEOFLOW_HAS_ZSTD
+	Root root = Make_Root(2000);
+	std::string expected = Write_Ostream(root);
+	std::string compressed = Write_Compressed(root, IO::Compression::ZSTD, "ogeoflow_compressed.geojson.zst");
+	EXPECT_LT(compressed.size(), expected.size() / 2);
+
+	ZSTD_DStream* stream = ZSTD_createDStream();
+	ZSTD_initDStream(stream);
+	std::string result;
+	std::string out(ZSTD_DStreamOutSize(), '\0');
+	ZSTD_inBuffer input = { compressed.data(), compressed.size(), 0 };
+	while (input.pos < input.size)
+	{
+		ZSTD_outBuffer output = { out.data(), out.size(), 0 };
+		ASSERT_FALSE(ZSTD_isError(ZSTD_decompressStream(stream, &output, &input)));
+		result.append(out.data(), output.pos);
+	}
+	ZSTD_freeDStream(stream);
+	EXPECT_EQ(result, expected);
+#else
+	EXPECT_FALSE(IO::Compressed_Write_Stream::Is_Available(IO::Compression::ZSTD));
+	GTEST_SKIP() << "built without zstd";
+#endif
+}
+
+TEST_F(Compressed_Write_Stream_Test, Empty_Stream)
+{
+#ifdef OGEOFLOW_HAS_ZLIB
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_empty.gz";
+	{
+		auto stream = IO::Compressed_Write_Stream::Open(path, IO::Compression::GZIP);
+		ASSERT_TRUE(stream.Has_Value());
+		EXPECT_EQ(stream.Value().Close(), IO::Error::NO_ERROR);
+	}
+	bool stream_end = false;
+	std::size_t consumed = 0;
+	EXPECT_EQ(Gunzip_First_Member(Read_File(path), stream_end, consumed), "");
+	EXPECT_TRUE(stream_end);
+	std::filesystem::remove(path);
+#else
+	GTEST_SKIP() << "built without zlib";
+#endif
+}
+
+TEST_F(Compressed_Write_Stream_Test, Open_In_Missing_Directory_Fails)
+{
+	for (IO::Compression compression : { IO::Compression::GZIP, IO::Compression::ZSTD })
+	{
+		auto stream = IO::Compressed_Write_Stream::Open(std::filesystem::temp_directory_path() / "ogeoflow_missing_dir" / "out.gz", compression);
+		ASSERT_FALSE(stream.Has_Value());
+		EXPECT_EQ(stream.Error(), IO::Compressed_Write_Stream::Is_Available(compression) ? IO::Error::FILE_OPENNING_FAILED : IO::Error::COMPRESSION_UNAVAILABLE);
+	}
+}
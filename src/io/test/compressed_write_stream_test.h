@@ -0,0 +1,17 @@
+#ifndef SRC_IO_TEST_COMPRESSED_WRITE_STREAM_TEST_H
+#define SRC_IO_TEST_COMPRESSED_WRITE_STREAM_TEST_H
+
+#include <gtest/gtest.h>
+
+class Compressed_Write_Stream_Test : public ::testing::Test {};
+
+//////////////////////////////////////////////
+/// Nominal tests:
+/// 	- Gzip_Is_A_Single_Member
+/// 	- Zstd_Round_Trip
+/// 	- Empty_Stream
+/// Error tests:
+/// 	- Open_In_Missing_Directory_Fails
+//////////////////////////////////////////////
+
+#endif //SRC_IO_TEST_COMPRESSED_WRITE_STREAM_TEST_H
@@ -0,0 +1,119 @@
+#include "fd_write_stream_test.h"
+
+// STL
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+// RAPIDJSON
+#include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/stringbuffer.h>
+
+// IO
+#include "io/fd_write_stream.h"
+#include "io/writer.h"
+
+using namespace O::GeoJSON;
+
+namespace
+{
+	Root Make_Root(std::size_t feature_count)
+	{
+		Feature_Collection fc;
+		for (std::size_t i = 0; i < feature_count; ++i)
+		{
+			Feature f;
+			f.id = static_cast<std::int64_t>(i);
+			Point p;
+			p.position.longitude = i * 0.25;
+			p.position.latitude = -(i * 0.5);
+			f.geometry = Geometry{};
+			f.geometry->value = p;
+			f.properties = Property(Property::Object{{"name", Property(std::string("feature number ") + std::to_string(i))}});
+			fc.features.push_back(std::move(f));
+		}
+		Root root;
+		root.object = std::move(fc);
+		return root;
+	}
+
+	std::string Write_Ostream(const Root& root)
+	{
+		std::stringstream ss;
+		rapidjson::OStreamWrapper osw(ss);
+		IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+		writer.Write_GeoJSON_Object(root);
+		return ss.str();
+	}
+
+	std::string Read_File(const std::filesystem::path& path)
+	{
+		std::ifstream in(path, std::ios::binary);
+		return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	}
+
+	std::string Write_Fd(const Root& root, const std::filesystem::path& path, bool direct_io)
+	{
+		auto stream = IO::Fd_Write_Stream::Open(path, direct_io, IO::Fd_Write_Stream::ALIGNMENT);
+		EXPECT_TRUE(stream.Has_Value());
+		IO::Writer<IO::Fd_Write_Stream> writer(stream.Value());
+		writer.Write_GeoJSON_Object(root);
+		EXPECT_EQ(stream.Value().Close(), IO::Error::NO_ERROR);
+		std::string content = Read_File(path);
+		std::filesystem::remove(path);
+		return content;
+	}
+}
+
+TEST_F(Fd_Write_Stream_Test, Writer_Output_Matches_Ostream)
+{
+	// one alignment block as buffer so the output spans many blocks
+	Root root = Make_Root(500);
+	std::string expected = Write_Ostream(root);
+	ASSERT_GT(expected.size(), 4 * IO::Fd_Write_Stream::ALIGNMENT);
+	EXPECT_EQ(Write_Fd(root, std::filesystem::temp_directory_path() / "ogeoflow_fd_stream.geojson", false), expected);
+}
+
+TEST_F(Fd_Write_Stream_Test, Direct_IO_Output_Matches)
+{
+	// falls back to buffered I/O when the temporary file system refuses O_DIRECT
+	Root root = Make_Root(777);
+	EXPECT_EQ(Write_Fd(root, std::filesystem::temp_directory_path() / "ogeoflow_fd_stream_direct.geojson", true), Write_Ostream(root));
+}
+
+TEST_F(Fd_Write_Stream_Test, String_Buffer_Writer)
+{
+	Root root = Make_Root(3);
+	rapidjson::StringBuffer buffer;
+	IO::Writer<rapidjson::StringBuffer> writer(buffer);
+	writer.Write_GeoJSON_Object(root);
+	EXPECT_EQ(std::string(buffer.GetString(), buffer.GetSize()), Write_Ostream(root));
+}
+
+TEST_F(Fd_Write_Stream_Test, Open_In_Missing_Directory_Fails)
+{
+	auto stream = IO::Fd_Write_Stream::Open(std::filesystem::temp_directory_path() / "ogeoflow_missing_dir" / "out.geojson");
+	ASSERT_FALSE(stream.Has_Value());
+	EXPECT_EQ(stream.Error(), IO::Error::FILE_OPENNING_FAILED);
+}
+
+TEST_F(Fd_Write_Stream_Test, Put_After_Close_Is_Dropped)
+{
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_fd_closed.geojson";
+	auto stream = IO::Fd_Write_Stream::Open(path);
+	ASSERT_TRUE(stream.Has_Value());
+	stream.Value().Put('{');
+	ASSERT_EQ(stream.Value().Close(), IO::Error::NO_ERROR);
+	stream.Value().Put('}');
+	stream.Value().Write("[]", 2);
+	EXPECT_EQ(stream.Value().Get_Error(), IO::Error::FILE_WRITE_FAILED);
+	EXPECT_EQ(std::filesystem::file_size(path), 1u);
+
+	// a moved-from stream has no buffer either
+	IO::Fd_Write_Stream moved(std::move(stream.Value()));
+	stream.Value().Put('x');
+	EXPECT_EQ(stream.Value().Get_Error(), IO::Error::FILE_WRITE_FAILED);
+	std::filesystem::remove(path);
+}
@@ -0,0 +1,18 @@
+#ifndef SRC_IO_TEST_FD_WRITE_STREAM_TEST_H
+#define SRC_IO_TEST_FD_WRITE_STREAM_TEST_H
+
+#include <gtest/gtest.h>
+
+class Fd_Write_Stream_Test : public ::testing::Test {};
+
+//////////////////////////////////////////////
+/// Nominal tests:
+/// 	- Writer_Output_Matches_Ostream
+/// 	- Direct_IO_Output_Matches
+/// 	- String_Buffer_Writer
+/// Error tests:
+/// 	- Open_In_Missing_Directory_Fails
+/// 	- Put_After_Close_Is_Dropped
+//////////////////////////////////////////////
+
+#endif //SRC_IO_TEST_FD_WRITE_STREAM_TEST_H
@@ -0,0 +1,182 @@
+#include "feature_index_test.h"
+
+// STL
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// IO
+#include "io/feature_index.h"
+#include "io/feature_parser.h"
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	const std::string SAMPLE = R"({"type":"FeatureCollection","features":[
+	{"type":"Feature","id":"a","geometry":{"type":"Point","coordinates":[0,0]},"properties":{"n":0}},
+	{"type":"Feature","id":"b","geometry":{"type":"LineString","coordinates":[[10,10],[12,14]]},"properties":{"n":1}} ,
+	{"type":"Feature","geometry":null,"properties":{"n":2}},
+	{"type":"Feature","id":"d","geometry":{"type":"GeometryCollection","geometries":[{"type":"Point","coordinates":[-5,3]},{"type":"Point","coordinates":[20,-1]}]},"properties":{"n":3}}
+]})";
+
+	std::filesystem::path Write_Temp(const std::string& name, const std::string& content)
+	{
+		auto path = std::filesystem::temp_directory_path() / name;
+		std::ofstream(path, std::ios::binary) << content;
+		return path;
+	}
+
+	class Index_Collector : public Feature_Parser<Index_Collector>
+	{
+	public:
+		bool On_Full_Feature(O::GeoJSON::Feature&& feature)
+		{
+			numbers.push_back(feature.properties.Get_Object().at("n").Get_Int());
+			return true;
+		}
+
+		bool On_Root(std::optional<O::GeoJSON::Bbox>&&, O::GeoJSON::Id&&)
+		{
+			++root_calls;
+			return true;
+		}
+
+		std::vector<int> numbers;
+		int root_calls = 0;
+	};
+
+	Indexed_Reader Open_Sample(const std::filesystem::path& path)
+	{
+		auto index = Feature_Index::Build(path);
+		EXPECT_TRUE(index.Has_Value());
+		auto reader = Indexed_Reader::Open(path, std::move(index.Value()));
+		EXPECT_TRUE(reader.Has_Value());
+		return std::move(reader.Value());
+	}
+}
+
+TEST_F(Feature_Index_Test, Build_Records_Offsets_And_Envelopes)
+{
+	auto path = Write_Temp("ogeoflow_index_build.geojson", SAMPLE);
+	auto index = Feature_Index::Build(path);
+	ASSERT_TRUE(index.Has_Value());
+	ASSERT_EQ(index.Value().Size(), 4u);
+
+	for (const auto& entry : index.Value().Get_Entries())
+	{
+		EXPECT_EQ(SAMPLE[entry.offset], '{');
+		EXPECT_EQ(SAMPLE[entry.offset + entry.length - 1], '}');
+	}
+	EXPECT_EQ(SAMPLE.substr(index.Value()[0].offset, 18), R"({"type":"Feature",)");
+
+	EXPECT_EQ(index.Value()[1].envelope, (std::array<double, 4>{ 10, 10, 12, 14 }));
+	EXPECT_GT(index.Value()[2].envelope[0], index.Value()[2].envelope[2]);
+	EXPECT_EQ(index.Value()[2].id_hash, 0u);
+	EXPECT_EQ(index.Value()[3].envelope, (std::array<double, 4>{ -5, -1, 20, 3 }));
+	EXPECT_EQ(index.Value()[3].id_hash, Feature_Index::Hash_Id("d"));
+	std::filesystem::remove(path);
+}
+
+TEST_F(Feature_Index_Test, Save_And_Load_Round_Trip)
+{
+	auto path = Write_Temp("ogeoflow_index_save.geojson", SAMPLE);
+	auto sidecar = std::filesystem::temp_directory_path() / "ogeoflow_index_save.geojson.ogfi";
+	auto index = Feature_Index::Build(path);
+	ASSERT_TRUE(index.Has_Value());
+	ASSERT_EQ(index.Value().Save(sidecar), Error::NO_ERROR);
+
+	auto loaded = Feature_Index::Load(sidecar);
+	ASSERT_TRUE(loaded.Has_Value());
+	EXPECT_EQ(loaded.Value().Get_Source_Size(), SAMPLE.size());
+	ASSERT_EQ(loaded.Value().Size(), index.Value().Size());
+	for (std::size_t i = 0; i < loaded.Value().Size(); ++i)
+	{
+		EXPECT_EQ(loaded.Value()[i].offset, index.Value()[i].offset);
+		EXPECT_EQ(loaded.Value()[i].length, index.Value()[i].length);
+		EXPECT_EQ(loaded.Value()[i].id_hash, index.Value()[i].id_hash);
+	}
+	std::filesystem::remove(path);
+	std::filesystem::remove(sidecar);
+}
+
+TEST_F(Feature_Index_Test, Parse_Single_Feature_And_Range)
+{
+	auto path = Write_Temp("ogeoflow_index_range.geojson", SAMPLE);
+	auto reader = Open_Sample(path);
+
+	Index_Collector single;
+	ASSERT_EQ(reader.Parse_Feature(2, single), Error::NO_ERROR);
+	EXPECT_EQ(single.numbers, (std::vector<int>{ 2 }));
+	EXPECT_EQ(single.root_calls, 1);
+
+	Index_Collector range;
+	ASSERT_EQ(reader.Parse_Range(1, 4, range), Error::NO_ERROR);
+	EXPECT_EQ(range.numbers, (std::vector<int>{ 1, 2, 3 }));
+	std::filesystem::remove(path);
+}
+
+TEST_F(Feature_Index_Test, Parse_Bbox_And_Find_Id)
+{
+	auto path = Write_Temp("ogeoflow_index_bbox.geojson", SAMPLE);
+	auto reader = Open_Sample(path);
+
+	Index_Collector hits;
+	ASSERT_EQ(reader.Parse_Bbox({ -1, -1, 11, 11 }, hits), Error::NO_ERROR);
+	EXPECT_EQ(hits.numbers, (std::vector<int>{ 0, 1, 3 }));
+
+	auto found = reader.Get_Index().Find("b");
+	ASSERT_EQ(found.size(), 1u);
+	Index_Collector by_id;
+	ASSERT_EQ(reader.Parse_Features(found, by_id), Error::NO_ERROR);
+	EXPECT_EQ(by_id.numbers, (std::vector<int>{ 1 }));
+	std::filesystem::remove(path);
+}
+
+TEST_F(Feature_Index_Test, Build_Rejects_Non_Collection)
+{
+	auto path = Write_Temp("ogeoflow_index_feature.geojson", R"({"type":"Feature","geometry":null,"properties":{}})");
+	auto index = Feature_Index::Build(path);
+	ASSERT_FALSE(index.Has_Value());
+	EXPECT_EQ(index.Error(), Error::UNKNOWN_ROOT_OBJECT);
+	std::filesystem::remove(path);
+}
+
+TEST_F(Feature_Index_Test, Out_Of_Range_And_Stale_Index)
+{
+	auto path = Write_Temp("ogeoflow_index_stale.geojson", SAMPLE);
+	auto reader = Open_Sample(path);
+	Index_Collector collector;
+	EXPECT_EQ(reader.Parse_Feature(4, collector), Error::FEATURE_INDEX_OUT_OF_RANGE);
+
+	auto index = Feature_Index::Build(path);
+	ASSERT_TRUE(index.Has_Value());
+	Write_Temp("ogeoflow_index_stale.geojson", SAMPLE + "\n");
+	auto stale = Indexed_Reader::Open(path, std::move(index.Value()));
+	ASSERT_FALSE(stale.Has_Value());
+	EXPECT_EQ(stale.Error(), Error::INVALID_INDEX_FILE);
+	std::filesystem::remove(path);
+}
+
+TEST_F(Feature_Index_Test, Load_Rejects_Oversized_Count)
+{
+	auto path = Write_Temp("ogeoflow_index_count.geojson", SAMPLE);
+	auto sidecar = std::filesystem::temp_directory_path() / "ogeoflow_index_count.geojson.ogfi";
+	auto index = Feature_Index::Build(path);
+	ASSERT_TRUE(index.Has_Value());
+	ASSERT_EQ(index.Value().Save(sidecar), Error::NO_ERROR);
+
+	// the feature count follows the magic, the version and the source size
+	{
+		std::fstream file(sidecar, std::ios::in | std::ios::out | std::ios::binary);
+		const std::uint64_t count = std::uint64_t(1) << 60;
+		file.seekp(16);
+		file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+	}
+	auto loaded = Feature_Index::Load(sidecar);
+	ASSERT_FALSE(loaded.Has_Value());
+	EXPECT_EQ(loaded.Error(), Error::INVALID_INDEX_FILE);
+	std::filesystem::remove(path);
+	std::filesystem::remove(sidecar);
+}
@@ -0,0 +1,20 @@
+#ifndef SRC_IO_TEST_FEATURE_INDEX_TEST_H
+#define SRC_IO_TEST_FEATURE_INDEX_TEST_H
+
+#include <gtest/gtest.h>
+
+class Feature_Index_Test : public ::testing::Test {};
+
+//////////////////////////////////////////////
+/// Nominal tests:
+/// 	- Build_Records_Offsets_And_Envelopes
+/// 	- Save_And_Load_Round_Trip
+/// 	- Parse_Single_Feature_And_Range
+/// 	- Parse_Bbox_And_Find_Id
+/// Error tests:
+/// 	- Build_Rejects_Non_Collection
+/// 	- Out_Of_Range_And_Stale_Index
+/// 	- Load_Rejects_Oversized_Count
+//////////////////////////////////////////////
+
+#endif //SRC_IO_TEST_FEATURE_INDEX_TEST_H
@@ -33,8 +33,8 @@ TEST_F(Feature_Test, Feature_Collection_Features_Basic) {
 
 	// Feature 0 checks
 	const auto& f0 = fc.features[0];
-	ASSERT_TRUE(f0.id.has_value());
-	EXPECT_EQ(*f0.id, "f-1");
+	ASSERT_TRUE(f0.id.Has_Value());
+	EXPECT_EQ(f0.id.Get_String(), "f-1");
 
 	ASSERT_TRUE(f0.bbox.has_value());
 	ASSERT_FALSE(f0.bbox->Has_Altitude());
@@ -70,8 +70,8 @@ TEST_F(Feature_Test, Feature_Collection_Features_Basic) {
 	}
 
 	const auto& f1 = fc.features[1];
-	ASSERT_TRUE(f1.id.has_value());
-	EXPECT_EQ(*f1.id, "f-2");
+	ASSERT_TRUE(f1.id.Has_Value());
+	EXPECT_EQ(f1.id.Get_String(), "f-2");
 
 	ASSERT_FALSE(f1.bbox.has_value());
 	ASSERT_TRUE(f1.geometry.has_value());
@@ -89,7 +89,7 @@ TEST_F(Feature_Test, Feature_Collection_Features_Basic) {
 	}
 }
 
-TEST_F(Feature_Test, Feature_Id_As_Number_Should_Be_Stringified) {
+TEST_F(Feature_Test, Feature_Id_As_Number_Should_Stay_Integer) {
 	std::string json = R"({
 		"type": "FeatureCollection",
 		"features": [
@@ -109,8 +109,8 @@ TEST_F(Feature_Test, Feature_Id_As_Number_Should_Be_Stringified) {
 	ASSERT_EQ(g.Get_Feature_Collection().features.size(), 1u);
 
 	const auto& f = g.Get_Feature_Collection().features[0];
-	ASSERT_TRUE(f.id.has_value());
-	EXPECT_EQ(*f.id, "42");
+	ASSERT_TRUE(f.id.Is_Integer());
+	EXPECT_EQ(f.id.Get_Integer(), 42);
 }
 
 TEST_F(Feature_Test, Feature_Missing_Geometry_Should_Fail) {
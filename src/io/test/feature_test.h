@@ -8,7 +8,7 @@ class Feature_Test : public ::testing::Test {};
 //////////////////////////////////////////////
 /// Nominal tests:
 /// 	- Feature_Collection_Features_Basic
-/// 	- Feature_Id_As_Number_Should_Be_Stringified
+/// 	- Feature_Id_As_Number_Should_Stay_Integer
 /// 	- Feature_Missing_Geometry_Should_Fail
 /// 	- Feature_Properties_Null_Accepted
 /// Error tests:
@@ -0,0 +1,435 @@
+#include "flat_geobuf_test.h"
+
+// STL
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// RAPIDJSON
+#include <rapidjson/reader.h>
+#include <rapidjson/stringbuffer.h>
+
+// IO
+#include "io/feature_parser.h"
+#include "io/flat_geobuf.h"
+#include "io/parser.h"
+#include "io/writer.h"
+
+using namespace O::GeoJSON;
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	struct Collector
+	{
+		std::vector<Feature> features;
+		std::optional<Bbox> bbox;
+		bool root = false;
+
+		bool On_Full_Feature(Feature&& feature) { features.push_back(std::move(feature)); return true; }
+		bool On_Root(std::optional<Bbox>&& root_bbox, Id&&) { bbox = std::move(root_bbox); root = true; return true; }
+	};
+
+	/// GeoJSON parser converting straight to FlatGeobuf
+	struct Geobuf_Sink : public Flat_Geobuf_Writer, public Feature_Parser<Geobuf_Sink>
+	{
+		using Flat_Geobuf_Writer::On_Full_Feature;
+		using Flat_Geobuf_Writer::On_Root;
+	};
+
+	/// handler refusing every feature after the first ``limit``
+	struct Limited_Collector : public Collector
+	{
+		std::size_t limit = 0;
+
+		bool On_Full_Feature(Feature&& feature) { return features.size() < limit && Collector::On_Full_Feature(std::move(feature)); }
+	};
+
+	Geometry Make_Point(double x, double y)
+	{
+		Geometry geometry;
+		geometry.value = Point{ Position{ x, y } };
+		return geometry;
+	}
+
+	Polygon Make_Square(double x, double y, double size)
+	{
+		return Polygon{ { { { x, y }, { x + size, y }, { x + size, y + size }, { x, y + size }, { x, y } } } };
+	}
+
+	/// features on a 40 x 25 grid, the number property gives back the creation order
+	std::vector<Feature> Make_Grid()
+	{
+		std::vector<Feature> features;
+		for (int i = 0; i < 1000; ++i)
+		{
+			Feature feature;
+			feature.geometry = Make_Point(i % 40, i / 40);
+			feature.properties = Property(Property::Object{ { "number", Property(i) } });
+			features.push_back(std::move(feature));
+		}
+		return features;
+	}
+
+	Flat_Geobuf_Reader Open(const std::filesystem::path& path)
+	{
+		auto reader = Flat_Geobuf_Reader::Open(path);
+		EXPECT_TRUE(reader.Has_Value());
+		return std::move(reader.Value());
+	}
+
+	std::vector<std::int64_t> Numbers(const std::vector<Feature>& features)
+	{
+		std::vector<std::int64_t> numbers;
+		for (const Feature& feature : features)
+			numbers.push_back(feature.properties.Get_Object().at("number").Get_Int());
+		std::sort(numbers.begin(), numbers.end());
+		return numbers;
+	}
+
+	void Expect_Same_Positions(const std::vector<Position>& lhs, const std::vector<Position>& rhs)
+	{
+		ASSERT_EQ(lhs.size(), rhs.size());
+		for (std::size_t i = 0; i < lhs.size(); ++i)
+		{
+			EXPECT_EQ(lhs[i].longitude, rhs[i].longitude);
+			EXPECT_EQ(lhs[i].latitude, rhs[i].latitude);
+			EXPECT_EQ(lhs[i].altitude, rhs[i].altitude);
+		}
+	}
+}
+
+TEST_F(Flat_Geobuf_Test, Round_Trip_Every_Geometry)
+{
+	std::vector<Feature> features(7);
+	features[0].geometry = Make_Point(1.5, -2.25);
+	features[1].geometry = Geometry{ Multi_Point{ { { 0, 0 }, { 1, 1 } } } };
+	features[2].geometry = Geometry{ Line_String{ { { 0, 0, 10.0 }, { 2, 1 }, { 3, 5, -1.0 } } } };
+	features[3].geometry = Geometry{ Multi_Line_String{ { Line_String{ { { 0, 0 }, { 1, 0 } } }, Line_String{ { { 5, 5 }, { 6, 6 }, { 7, 5 } } } } } };
+	Polygon holed = Make_Square(0, 0, 10);
+	holed.rings.push_back(Make_Square(2, 2, 1).rings.front());
+	features[4].geometry = Geometry{ holed };
+	features[5].geometry = Geometry{ Multi_Polygon{ { Make_Square(20, 20, 1), holed } } };
+	Geometry_Collection collection;
+	collection.geometries.push_back(std::make_shared<Geometry>(Make_Point(8, 9)));
+	collection.geometries.push_back(std::make_shared<Geometry>(Geometry{ Polygon{ Make_Square(-5, -5, 2) } }));
+	features[6].geometry = Geometry{ collection };
+	for (std::size_t i = 0; i < features.size(); ++i)
+		features[i].properties = Property(Property::Object{ { "number", Property(static_cast<std::int64_t>(i)) } });
+
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_every_geometry.fgb";
+	ASSERT_EQ(Flat_Geobuf_Writer::Save(features, path, "geometries"), Error::NO_ERROR);
+	auto reader = Open(path);
+	EXPECT_EQ(reader.Get_Header().name, "geometries");
+	EXPECT_EQ(reader.Get_Header().features_count, 7u);
+	EXPECT_TRUE(reader.Get_Header().has_z);
+	EXPECT_EQ(reader.Get_Header().geometry_type, Flat_Geobuf_Geometry_Type::UNKNOWN);
+
+	Collector collector;
+	ASSERT_EQ(reader.Parse(collector), Error::NO_ERROR);
+	ASSERT_TRUE(collector.root);
+	ASSERT_TRUE(collector.bbox);
+	const std::array<double, 4> envelope = { -5, -5, 21, 21 };
+	EXPECT_EQ((std::get<std::array<double, 4>>(collector.bbox->coordinates)), envelope);
+	ASSERT_EQ(Numbers(collector.features), (std::vector<std::int64_t>{ 0, 1, 2, 3, 4, 5, 6 }));
+
+	for (Feature& read : collector.features)
+	{
+		const Feature& written = features[read.properties.Get_Object().at("number").Get_Int()];
+		ASSERT_TRUE(read.geometry);
+		ASSERT_EQ(read.geometry->value.index(), written.geometry->value.index());
+		const Geometry& g = *read.geometry;
+		const Geometry& e = *written.geometry;
+		if (g.Is_Point())
+			Expect_Same_Positions({ g.Get_Point().position }, { e.Get_Point().position });
+		else if (g.Is_Multi_Point())
+			Expect_Same_Positions(g.Get_Multi_Point().points, e.Get_Multi_Point().points);
+		else if (g.Is_Line_String())
+			Expect_Same_Positions(g.Get_Line_String().positions, e.Get_Line_String().positions);
+		else if (g.Is_Multi_Line_String())
+		{
+			ASSERT_EQ(g.Get_Multi_Line_String().line_strings.size(), 2u);
+			for (std::size_t i = 0; i < 2; ++i)
+				Expect_Same_Positions(g.Get_Multi_Line_String().line_strings[i].positions, e.Get_Multi_Line_String().line_strings[i].positions);
+		}
+		else if (g.Is_Polygon())
+		{
+			ASSERT_EQ(g.Get_Polygon().rings.size(), 2u);
+			for (std::size_t i = 0; i < 2; ++i)
+				Expect_Same_Positions(g.Get_Polygon().rings[i], e.Get_Polygon().rings[i]);
+		}
+		else if (g.Is_Multi_Polygon())
+		{
+			ASSERT_EQ(g.Get_Multi_Polygon().polygons.size(), 2u);
+			EXPECT_EQ(g.Get_Multi_Polygon().polygons[0].rings.size(), 1u);
+			ASSERT_EQ(g.Get_Multi_Polygon().polygons[1].rings.size(), 2u);
+			Expect_Same_Positions(g.Get_Multi_Polygon().polygons[1].rings[1], holed.rings[1]);
+		}
+		else
+		{
+			const auto& geometries = g.Get_Geometry_Collection().geometries;
+			ASSERT_EQ(geometries.size(), 2u);
+			EXPECT_TRUE(geometries[0]->Is_Point());
+			ASSERT_TRUE(geometries[1]->Is_Polygon());
+			Expect_Same_Positions(geometries[1]->Get_Polygon().rings[0], Make_Square(-5, -5, 2).rings[0]);
+		}
+	}
+	std::filesystem::remove(path);
+}
+
+TEST_F(Flat_Geobuf_Test, Column_Types_Are_Inferred)
+{
+	std::vector<Feature> features(2);
+	features[0].geometry = Make_Point(0, 0);
+	features[0].properties = Property(Property::Object{
+		{ "flag", Property(true) },
+		{ "count", Property(3) },
+		{ "ratio", Property(1) },
+		{ "name", Property("first") },
+		{ "mixed", Property(2) },
+		{ "nested", Property(Property::Object{ { "a", Property(Property::Array{ Property(1), Property(nullptr), Property("x") }) } }) },
+		{ "missing", Property(nullptr) },
+	});
+	features[1].geometry = Make_Point(1, 1);
+	features[1].properties = Property(Property::Object{
+		{ "flag", Property(false) },
+		{ "count", Property(std::int64_t(1) << 40) },
+		{ "ratio", Property(0.5) },
+		{ "name", Property("second") },
+		{ "mixed", Property("two") },
+	});
+
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_columns.fgb";
+	ASSERT_EQ(Flat_Geobuf_Writer::Save(features, path, {}, 0), Error::NO_ERROR);
+	auto reader = Open(path);
+	const auto& columns = reader.Get_Header().columns;
+	ASSERT_EQ(columns.size(), 6u);
+	std::map<std::string, Flat_Geobuf_Column_Type> types;
+	for (const auto& column : columns)
+		types[column.name] = column.type;
+	EXPECT_EQ(types["flag"], Flat_Geobuf_Column_Type::BOOL);
+	EXPECT_EQ(types["count"], Flat_Geobuf_Column_Type::LONG);
+	EXPECT_EQ(types["ratio"], Flat_Geobuf_Column_Type::DOUBLE);
+	EXPECT_EQ(types["name"], Flat_Geobuf_Column_Type::STRING);
+	EXPECT_EQ(types["mixed"], Flat_Geobuf_Column_Type::JSON);
+	EXPECT_EQ(types["nested"], Flat_Geobuf_Column_Type::JSON);
+
+	Collector collector;
+	ASSERT_EQ(reader.Parse(collector), Error::NO_ERROR);
+	ASSERT_EQ(collector.features.size(), 2u);
+	const auto& first = collector.features[0].properties.Get_Object();
+	EXPECT_EQ(first.count("missing"), 0u);
+	EXPECT_TRUE(first.at("flag").Get_Bool());
+	EXPECT_EQ(first.at("count").Get_Int(), 3);
+	EXPECT_EQ(first.at("ratio").Get_Double(), 1.0);
+	EXPECT_EQ(first.at("name").Get_String(), "first");
+	EXPECT_EQ(first.at("mixed").Get_Int(), 2);
+	const auto& nested = first.at("nested").Get_Object().at("a").Get_Array();
+	ASSERT_EQ(nested.size(), 3u);
+	EXPECT_EQ(nested[0].Get_Int(), 1);
+	EXPECT_TRUE(nested[1].Is_Null());
+	EXPECT_EQ(nested[2].Get_String(), "x");
+
+	const auto& second = collector.features[1].properties.Get_Object();
+	EXPECT_FALSE(second.at("flag").Get_Bool());
+	EXPECT_EQ(second.at("count").Get_Int(), std::int64_t(1) << 40);
+	EXPECT_EQ(second.at("ratio").Get_Double(), 0.5);
+	EXPECT_EQ(second.at("mixed").Get_String(), "two");
+	EXPECT_EQ(second.count("nested"), 0u);
+	std::filesystem::remove(path);
+}
+
+TEST_F(Flat_Geobuf_Test, Bbox_Query_Matches_Scan)
+{
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_grid.fgb";
+	Flat_Geobuf_Writer writer;
+	for (Feature& feature : Make_Grid())
+		ASSERT_TRUE(writer.On_Full_Feature(std::move(feature)));
+	ASSERT_TRUE(writer.On_Root(std::nullopt, Id()));
+	ASSERT_EQ(writer.Save(path, "grid", 8), Error::NO_ERROR);
+
+	auto reader = Open(path);
+	ASSERT_TRUE(reader.Has_Index());
+	EXPECT_EQ(reader.Get_Header().index_node_size, 8);
+	EXPECT_EQ(reader.Get_Header().geometry_type, Flat_Geobuf_Geometry_Type::POINT);
+
+	Collector collector;
+	ASSERT_EQ(reader.Parse_Bbox({ 9.5, 3, 12, 4.5 }, collector), Error::NO_ERROR);
+	EXPECT_EQ(Numbers(collector.features), (std::vector<std::int64_t>{ 130, 131, 132, 170, 171, 172 }));
+	EXPECT_TRUE(collector.root);
+
+	Collector outside;
+	ASSERT_EQ(reader.Parse_Bbox({ 100, 100, 200, 200 }, outside), Error::NO_ERROR);
+	EXPECT_TRUE(outside.features.empty());
+
+	Collector all;
+	ASSERT_EQ(reader.Parse_Bbox({ -1, -1, 40, 25 }, all), Error::NO_ERROR);
+	EXPECT_EQ(all.features.size(), 1000u);
+	std::filesystem::remove(path);
+}
+
+TEST_F(Flat_Geobuf_Test, Without_Index)
+{
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_no_index.fgb";
+	auto features = Make_Grid();
+	ASSERT_EQ(Flat_Geobuf_Writer::Save(features, path, {}, 0), Error::NO_ERROR);
+	auto reader = Open(path);
+	EXPECT_FALSE(reader.Has_Index());
+
+	// without index the features keep their order
+	Collector collector;
+	ASSERT_EQ(reader.Parse(collector), Error::NO_ERROR);
+	ASSERT_EQ(collector.features.size(), 1000u);
+	EXPECT_EQ(collector.features[999].properties.Get_Object().at("number").Get_Int(), 999);
+
+	Collector selected;
+	ASSERT_EQ(reader.Parse_Bbox({ 9.5, 3, 12, 4.5 }, selected), Error::NO_ERROR);
+	EXPECT_EQ(Numbers(selected.features), (std::vector<std::int64_t>{ 130, 131, 132, 170, 171, 172 }));
+	std::filesystem::remove(path);
+}
+
+TEST_F(Flat_Geobuf_Test, Empty_Collection)
+{
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_empty.fgb";
+	Root root;
+	root.object = Feature_Collection{};
+	ASSERT_EQ(Flat_Geobuf_Writer::Save(root, path), Error::NO_ERROR);
+	auto reader = Open(path);
+	EXPECT_EQ(reader.Get_Header().features_count, 0u);
+	EXPECT_FALSE(reader.Get_Header().envelope);
+
+	Collector collector;
+	ASSERT_EQ(reader.Parse(collector), Error::NO_ERROR);
+	EXPECT_TRUE(collector.features.empty());
+	EXPECT_TRUE(collector.root);
+	EXPECT_FALSE(collector.bbox);
+	EXPECT_TRUE(reader.Query({ -1, -1, 1, 1 }).empty());
+	std::filesystem::remove(path);
+}
+
+TEST_F(Flat_Geobuf_Test, Feature_Parser_To_Writer)
+{
+	// GeoJSON -> FlatGeobuf through the parser sink, then FlatGeobuf -> GeoJSON through IO::Writer
+	const std::string input = R"({"type":"FeatureCollection","features":[
+		{"type":"Feature","geometry":{"type":"Point","coordinates":[1.5,2.5]},"properties":{"number":0}},
+		{"type":"Feature","geometry":{"type":"Polygon","coordinates":[[[0,0],[4,0],[4,4],[0,4],[0,0]]]},"properties":{"number":1}}
+	]})";
+	Geobuf_Sink sink;
+	rapidjson::StringStream in(input.c_str());
+	ASSERT_TRUE(rapidjson::Reader().Parse(in, sink));
+	ASSERT_EQ(sink.Size(), 2u);
+
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_to_writer.fgb";
+	ASSERT_EQ(sink.Save(path, {}, 0), Error::NO_ERROR);
+	auto reader = Open(path);
+
+	rapidjson::StringBuffer buffer;
+	{
+		Writer<rapidjson::StringBuffer> writer(buffer);
+		ASSERT_EQ(reader.Parse(writer), Error::NO_ERROR);
+		EXPECT_FALSE(writer.Is_Streaming());
+	}
+	auto result = Parse_Geojson_String(buffer.GetString());
+	ASSERT_TRUE(result.Has_Value());
+	const auto& fc = result.Value().Get_Feature_Collection();
+	ASSERT_EQ(fc.features.size(), 2u);
+	EXPECT_EQ(fc.features[0].geometry->Get_Point().position.longitude, 1.5);
+	EXPECT_EQ(fc.features[1].geometry->Get_Polygon().rings.front().size(), 5u);
+	EXPECT_EQ(fc.features[1].properties.Get_Object().at("number").Get_Int(), 1);
+	ASSERT_TRUE(fc.bbox);
+	std::filesystem::remove(path);
+}
+
+TEST_F(Flat_Geobuf_Test, Packed_RTree_Search)
+{
+	std::vector<Node_Item> leaves;
+	Node_Item extent;
+	for (std::uint64_t i = 0; i < 777; ++i)
+	{
+		const double x = static_cast<double>((i * 37) % 101);
+		const double y = static_cast<double>((i * 53) % 97);
+		leaves.push_back(Node_Item{ x, y, x + 2, y + 1, i });
+		extent.Expand(leaves.back());
+	}
+	Packed_RTree::Hilbert_Sort(leaves, extent);
+	const auto nodes = Packed_RTree::Build(leaves, 5);
+	ASSERT_EQ(nodes.size() * sizeof(Node_Item), Packed_RTree::Size(leaves.size(), 5));
+	EXPECT_EQ(nodes.front().min_x, extent.min_x);
+	EXPECT_EQ(nodes.front().max_y, extent.max_y);
+
+	const std::string_view index(reinterpret_cast<const char*>(nodes.data()), nodes.size() * sizeof(Node_Item));
+	const Node_Item box{ 10, 20, 30, 25, 0 };
+	std::vector<std::uint64_t> expected;
+	for (const Node_Item& leaf : leaves)
+		if (box.Intersects(leaf))
+			expected.push_back(leaf.offset);
+	std::sort(expected.begin(), expected.end());
+
+	std::vector<std::uint64_t> found;
+	for (const auto& result : Packed_RTree::Search(index, leaves.size(), 5, box))
+	{
+		EXPECT_EQ(leaves[result.index].offset, result.offset);
+		found.push_back(result.offset);
+	}
+	EXPECT_FALSE(expected.empty());
+	EXPECT_EQ(found, expected);
+}
+
+TEST_F(Flat_Geobuf_Test, Invalid_Magic)
+{
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_not_fgb.fgb";
+	{
+		std::ofstream out(path, std::ios::binary);
+		out << R"({"type":"FeatureCollection","features":[]})";
+	}
+	auto reader = Flat_Geobuf_Reader::Open(path);
+	ASSERT_FALSE(reader.Has_Value());
+	EXPECT_EQ(reader.Error(), Error::INVALID_FLAT_GEOBUF);
+	std::filesystem::remove(path);
+
+	auto missing = Flat_Geobuf_Reader::Open(std::filesystem::temp_directory_path() / "ogeoflow_missing.fgb");
+	ASSERT_FALSE(missing.Has_Value());
+	EXPECT_EQ(missing.Error(), Error::FILE_OPENNING_FAILED);
+}
+
+TEST_F(Flat_Geobuf_Test, Truncated_Feature)
+{
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_truncated.fgb";
+	auto features = Make_Grid();
+	ASSERT_EQ(Flat_Geobuf_Writer::Save(features, path), Error::NO_ERROR);
+	std::filesystem::resize_file(path, std::filesystem::file_size(path) - 10);
+
+	auto reader = Open(path);
+	Collector collector;
+	EXPECT_EQ(reader.Parse(collector), Error::INVALID_FLAT_GEOBUF);
+	EXPECT_FALSE(collector.root);
+	std::filesystem::remove(path);
+}
+
+TEST_F(Flat_Geobuf_Test, Handler_Aborts)
+{
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_abort.fgb";
+	ASSERT_EQ(Flat_Geobuf_Writer::Save(Make_Grid(), path), Error::NO_ERROR);
+
+	auto reader = Open(path);
+	Limited_Collector collector;
+	collector.limit = 3;
+	EXPECT_EQ(reader.Parse(collector), Error::HANDLER_ABORTED);
+	EXPECT_EQ(collector.features.size(), 3u);
+	EXPECT_FALSE(collector.root);
+	std::filesystem::remove(path);
+}
+
+TEST_F(Flat_Geobuf_Test, Too_Many_Columns)
+{
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_too_many_columns.fgb";
+	std::filesystem::remove(path);
+	std::vector<Feature> features(1);
+	Property::Object properties;
+	for (std::size_t i = 0; i <= 0xFFFF; ++i)
+		properties.emplace("k" + std::to_string(i), Property(true));
+	features[0].properties = Property(std::move(properties));
+	EXPECT_EQ(Flat_Geobuf_Writer::Save(features, path), Error::TOO_MANY_PROPERTY_COLUMNS);
+	EXPECT_FALSE(std::filesystem::exists(path));
+}
@@ -0,0 +1,24 @@
+#ifndef SRC_IO_TEST_FLAT_GEOBUF_TEST_H
+#define SRC_IO_TEST_FLAT_GEOBUF_TEST_H
+
+#include <gtest/gtest.h>
+
+class Flat_Geobuf_Test : public ::testing::Test {};
+
+//////////////////////////////////////////////
+/// Nominal tests:
+/// 	- Round_Trip_Every_Geometry
+/// 	- Column_Types_Are_Inferred
+/// 	- Bbox_Query_Matches_Scan
+/// 	- Without_Index
+/// 	- Empty_Collection
+/// 	- Feature_Parser_To_Writer
+/// 	- Packed_RTree_Search
+/// Error tests:
+/// 	- Invalid_Magic
+/// 	- Truncated_Feature
+/// 	- Handler_Aborts
+/// 	- Too_Many_Columns
+//////////////////////////////////////////////
+
+#endif //SRC_IO_TEST_FLAT_GEOBUF_TEST_H
@@ -56,8 +56,8 @@ TEST_F(Foreign_Test, Feature_Level_Foreign_Key_Mixed_Types) {
 	ASSERT_TRUE(g.Is_Feature());
 	const auto& feature = g.Get_Feature();
 	// core fields unaffected:
-	ASSERT_TRUE(feature.id.has_value());
-	EXPECT_EQ(*feature.id, "f0");
+	ASSERT_TRUE(feature.id.Has_Value());
+	EXPECT_EQ(feature.id.Get_String(), "f0");
 	EXPECT_TRUE(feature.geometry.has_value());
 	EXPECT_TRUE(feature.geometry->Is_Point());
 	AssertPositionEquals(feature.geometry->Get_Point().position, ExpectedPos{7.0, 8.0, std::nullopt});
@@ -167,7 +167,7 @@ TEST_F(Foreign_Test, Duplicate_Foreign_Keys_At_Different_Levels) {
 	ASSERT_TRUE(result.Has_Value()) << "Parser failed on duplicate foreign keys";
 	ASSERT_TRUE(result.Value().Is_Feature());
 	const auto& f = result.Value().Get_Feature();
-	EXPECT_EQ(*f.id, "dup");
+	EXPECT_EQ(f.id.Get_String(), "dup");
 	ASSERT_TRUE(f.geometry.has_value());
 	AssertPositionEquals(f.geometry->Get_Point().position, ExpectedPos{9.0, 9.0, std::nullopt});
 	// properties unaffected:
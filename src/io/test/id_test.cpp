@@ -0,0 +1,118 @@
+#include "id_test.h"
+
+// STL
+#include <sstream>
+#include <string>
+
+// RAPIDJSON
+#include <rapidjson/ostreamwrapper.h>
+
+// IO
+#include "io/parser.h"
+#include "io/writer.h"
+
+using namespace O::GeoJSON;
+
+namespace
+{
+	const std::string SAMPLE = R"({"type":"FeatureCollection","id":"root","features":[
+		{"type":"Feature","id":7,"geometry":null,"properties":null},
+		{"type":"Feature","id":12.0,"geometry":null,"properties":null},
+		{"type":"Feature","id":2.5,"geometry":null,"properties":null},
+		{"type":"Feature","id":"f-1","geometry":null,"properties":null},
+		{"type":"Feature","geometry":null,"properties":null}
+	]})";
+
+	Feature_Collection Parse_Sample(const std::string& json)
+	{
+		auto result = IO::Parse_Geojson_String(json);
+		EXPECT_TRUE(result.Has_Value());
+		return std::move(result.Value().Get_Feature_Collection());
+	}
+}
+
+TEST_F(Id_Test, Numeric_Id_Stays_Numeric)
+{
+	Feature_Collection fc = Parse_Sample(SAMPLE);
+	ASSERT_EQ(fc.features.size(), 5u);
+	ASSERT_TRUE(fc.features[0].id.Is_Integer());
+	EXPECT_EQ(fc.features[0].id.Get_Integer(), 7);
+	ASSERT_TRUE(fc.features[2].id.Is_Double());
+	EXPECT_DOUBLE_EQ(fc.features[2].id.Get_Double(), 2.5);
+	ASSERT_TRUE(fc.id.Is_String());
+	EXPECT_EQ(fc.id.Get_String(), "root");
+}
+
+TEST_F(Id_Test, Integral_Double_Is_Integer)
+{
+	Feature_Collection fc = Parse_Sample(SAMPLE);
+	ASSERT_TRUE(fc.features[1].id.Is_Integer());
+	EXPECT_EQ(fc.features[1].id, Id(12));
+	EXPECT_EQ(Id(12.0).Hash(), Id(12).Hash());
+}
+
+TEST_F(Id_Test, String_Ids_Are_Owned)
+{
+	std::string a = "f-1";
+	std::string b = std::string("f-") + "1";
+	Id id_a(a);
+	Id id_b(b);
+	EXPECT_EQ(id_a, id_b);
+	EXPECT_EQ(id_a.Hash(), id_b.Hash());
+	EXPECT_NE(id_a.Get_String().data(), a.data());
+	EXPECT_FALSE(Id("1") == Id(1));
+	EXPECT_EQ(Id(1).To_String(), "1");
+
+	// longer than the inline buffer: copies share the heap string and outlive the source
+	std::string uuid = "123e4567-e89b-12d3-a456-426614174000";
+	Id id_uuid(uuid);
+	Id copy = id_uuid;
+	uuid.assign(uuid.size(), 'x');
+	EXPECT_EQ(copy.Get_String(), "123e4567-e89b-12d3-a456-426614174000");
+	EXPECT_EQ(copy.Get_String().data(), id_uuid.Get_String().data());
+	EXPECT_EQ(copy, Id("123e4567-e89b-12d3-a456-426614174000"));
+	EXPECT_EQ(Id(std::string(Id_String::INLINE_SIZE, 'a')).Get_String().size(), Id_String::INLINE_SIZE);
+	EXPECT_TRUE(Id_String(std::string(Id_String::INLINE_SIZE, 'a')).Is_Inline());
+	EXPECT_FALSE(Id_String(std::string(Id_String::INLINE_SIZE + 1, 'a')).Is_Inline());
+}
+
+TEST_F(Id_Test, Id_Index_Lookup)
+{
+	Feature_Collection fc = Parse_Sample(SAMPLE);
+	auto index = fc.Create_Id_Index();
+	EXPECT_EQ(index.size(), 4u);
+	EXPECT_EQ(index.at(Id("f-1")), 3u);
+	EXPECT_EQ(index.at(Id(7)), 0u);
+	EXPECT_EQ(index.at(Id(12)), 1u);
+	EXPECT_EQ(index.count(Id("7")), 0u);
+}
+
+TEST_F(Id_Test, Writer_Round_Trip_Keeps_Type)
+{
+	Root root;
+	root.object = Parse_Sample(SAMPLE);
+
+	std::stringstream ss;
+	rapidjson::OStreamWrapper osw(ss);
+	IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+	writer.Write_GeoJSON_Object(root);
+	std::string text = ss.str();
+	EXPECT_NE(text.find("\"id\":7"), std::string::npos);
+	EXPECT_NE(text.find("\"id\":\"f-1\""), std::string::npos);
+
+	Feature_Collection fc = Parse_Sample(text);
+	ASSERT_EQ(fc.features.size(), 5u);
+	EXPECT_EQ(fc.features[0].id, Id(7));
+	EXPECT_EQ(fc.features[1].id, Id(12));
+	EXPECT_EQ(fc.features[2].id, Id(2.5));
+	EXPECT_EQ(fc.features[3].id, Id("f-1"));
+	EXPECT_EQ(fc.id, Id("root"));
+}
+
+TEST_F(Id_Test, Missing_Id_Is_Empty)
+{
+	Feature_Collection fc = Parse_Sample(SAMPLE);
+	EXPECT_FALSE(fc.features[4].id.Has_Value());
+	EXPECT_FALSE(static_cast<bool>(fc.features[4].id));
+	EXPECT_EQ(fc.features[4].id.To_String(), "");
+}
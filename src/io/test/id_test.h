@@ -0,0 +1,19 @@
+#ifndef SRC_IO_TEST_ID_TEST_H
+#define SRC_IO_TEST_ID_TEST_H
+
+#include <gtest/gtest.h>
+
+class Id_Test : public ::testing::Test {};
+
+//////////////////////////////////////////////
+/// Nominal tests:
+/// 	- Numeric_Id_Stays_Numeric
+/// 	- Integral_Double_Is_Integer
+/// 	- String_Ids_Are_Owned
+/// 	- Id_Index_Lookup
+/// 	- Writer_Round_Trip_Keeps_Type
+/// Error tests:
+/// 	- Missing_Id_Is_Empty
+//////////////////////////////////////////////
+
+#endif //SRC_IO_TEST_ID_TEST_H
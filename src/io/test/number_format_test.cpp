@@ -0,0 +1,111 @@
+#include "number_format_test.h"
+
+// STL
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+
+// RAPIDJSON
+#include <rapidjson/ostreamwrapper.h>
+
+// IO
+#include "io/number_format.h"
+#include "io/writer.h"
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	std::string Fixed(double value, int decimals, bool trim = true)
+	{
+		char buffer[FIXED_BUFFER_SIZE];
+		return std::string(buffer, Format_Fixed(value, decimals, trim, buffer));
+	}
+}
+
+TEST_F(Number_Format_Test, Fixed_Rounding)
+{
+	EXPECT_EQ(Fixed(2.2945123456, 6), "2.294512");
+	EXPECT_EQ(Fixed(48.85845, 4), "48.8585");
+	EXPECT_EQ(Fixed(-0.1276, 3), "-0.128");
+	EXPECT_EQ(Fixed(-0.00001, 3), "0.0");
+	EXPECT_EQ(Fixed(9.9999999, 6), "10.0");
+	EXPECT_EQ(Fixed(-179.123456789, 7), "-179.1234568");
+	EXPECT_EQ(Fixed(0.05, 1), "0.1");
+}
+
+TEST_F(Number_Format_Test, Trailing_Zeros)
+{
+	EXPECT_EQ(Fixed(1.5, 6), "1.5");
+	EXPECT_EQ(Fixed(1.5, 6, false), "1.500000");
+	EXPECT_EQ(Fixed(2.0, 3), "2.0");
+	EXPECT_EQ(Fixed(2.0, 0), "2.0");
+	EXPECT_EQ(Fixed(0.000105, 6), "0.000105");
+}
+
+TEST_F(Number_Format_Test, Writer_Coordinate_Precision)
+{
+	O::GeoJSON::Feature feat;
+	O::GeoJSON::Point p;
+	p.position.longitude = 2.29451234567;
+	p.position.latitude = 48.858;
+	feat.geometry = O::GeoJSON::Geometry{};
+	feat.geometry->value = p;
+	feat.properties = O::GeoJSON::Property(O::GeoJSON::Property::Object{{"ratio", O::GeoJSON::Property(0.123456789)}});
+	O::GeoJSON::Root root;
+	root.object = feat;
+
+	std::stringstream ss;
+	rapidjson::OStreamWrapper osw(ss);
+	Writer<rapidjson::OStreamWrapper> writer(osw);
+	writer.Set_Coordinate_Precision(6);
+	EXPECT_EQ(writer.Get_Coordinate_Precision(), 6);
+	writer.Write_GeoJSON_Object(root);
+
+	EXPECT_EQ(ss.str(), R"({"type":"Feature","geometry":{"type":"Point","coordinates":[2.294512,48.858]},"properties":{"ratio":0.123456789}})");
+}
+
+TEST_F(Number_Format_Test, Round_Trip_Error_Is_Bounded)
+{
+	for (int i = 0; i < 10000; ++i)
+	{
+		double value = -180.0 + 360.0 * (i * 0.6180339887 - std::floor(i * 0.6180339887));
+		std::string text = Fixed(value, 7);
+		EXPECT_NEAR(std::stod(text), value, 0.5e-7 + 1e-12) << text;
+	}
+}
+
+TEST_F(Number_Format_Test, Out_Of_Range_Falls_Back)
+{
+	EXPECT_EQ(Fixed(1e300, 6), "1e+300");
+	EXPECT_EQ(Fixed(123.25, 17), "123.25");
+	EXPECT_EQ(Fixed(1.5, -3), "2.0");
+	EXPECT_EQ(Fixed(1.25, 99), "1.25");
+}
+
+TEST_F(Number_Format_Test, Non_Finite_Is_Rejected)
+{
+	EXPECT_EQ(Fixed(std::numeric_limits<double>::quiet_NaN(), 6), "");
+	EXPECT_EQ(Fixed(std::numeric_limits<double>::infinity(), 6), "");
+	EXPECT_EQ(Fixed(-std::numeric_limits<double>::infinity(), 0), "");
+
+	// POINT EMPTY decodes to a NaN position: the fixed and the full precision paths both leave it out
+	O::GeoJSON::Point p;
+	p.position.longitude = std::numeric_limits<double>::quiet_NaN();
+	p.position.latitude = std::numeric_limits<double>::quiet_NaN();
+	O::GeoJSON::Feature feat;
+	feat.geometry = O::GeoJSON::Geometry{};
+	feat.geometry->value = p;
+	O::GeoJSON::Root root;
+	root.object = feat;
+	for (int precision : {-1, 6})
+	{
+		std::stringstream ss;
+		rapidjson::OStreamWrapper osw(ss);
+		Writer<rapidjson::OStreamWrapper> writer(osw);
+		writer.Set_Coordinate_Precision(precision);
+		writer.Write_GeoJSON_Object(root);
+		EXPECT_EQ(ss.str(), R"({"type":"Feature","geometry":{"type":"Point","coordinates":[]},"properties":null})") << precision;
+	}
+}
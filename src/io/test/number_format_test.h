@@ -0,0 +1,19 @@
+#ifndef SRC_IO_TEST_NUMBER_FORMAT_TEST_H
+#define SRC_IO_TEST_NUMBER_FORMAT_TEST_H
+
+#include <gtest/gtest.h>
+
+class Number_Format_Test : public ::testing::Test {};
+
+//////////////////////////////////////////////
+/// Nominal tests:
+/// 	- Fixed_Rounding
+/// 	- Trailing_Zeros
+/// 	- Writer_Coordinate_Precision
+/// 	- Round_Trip_Error_Is_Bounded
+/// Error tests:
+/// 	- Out_Of_Range_Falls_Back
+/// 	- Non_Finite_Is_Rejected
+//////////////////////////////////////////////
+
+#endif //SRC_IO_TEST_NUMBER_FORMAT_TEST_H
@@ -0,0 +1,100 @@
+#include "parallel_writer_test.h"
+
+// STL
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+// RAPIDJSON
+#include <rapidjson/ostreamwrapper.h>
+
+// IO
+#include "io/parallel_writer.h"
+
+using namespace O::GeoJSON;
+
+namespace
+{
+	Feature_Collection Make_Collection(std::size_t feature_count)
+	{
+		Feature_Collection fc;
+		fc.id = "root";
+		fc.bbox = Bbox{std::array<double, 4>{-1.0, -2.0, 3.0, 4.0}};
+		for (std::size_t i = 0; i < feature_count; ++i)
+		{
+			Feature f;
+			f.id = static_cast<std::int64_t>(i);
+			Line_String line;
+			for (int j = 0; j < 4; ++j)
+				line.positions.emplace_back(i * 0.001 + j / 3.0, -(i * 0.002) - j / 7.0);
+			f.geometry = Geometry{};
+			f.geometry->value = std::move(line);
+			f.properties = Property(Property::Object{{"rank", Property(static_cast<std::int64_t>(i))}});
+			fc.features.push_back(std::move(f));
+		}
+		return fc;
+	}
+
+	std::string Write_Serial(const Feature_Collection& fc, int precision)
+	{
+		std::stringstream ss;
+		rapidjson::OStreamWrapper osw(ss);
+		IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+		writer.Set_Coordinate_Precision(precision);
+		Root root;
+		root.object = fc;
+		writer.Write_GeoJSON_Object(root);
+		return ss.str();
+	}
+
+	std::string Write_Parallel(const Feature_Collection& fc, int precision, std::size_t thread_count)
+	{
+		std::stringstream ss;
+		rapidjson::OStreamWrapper osw(ss);
+		IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+		writer.Set_Coordinate_Precision(precision);
+		IO::Write_Feature_Collection_Parallel(writer, fc, thread_count);
+		return ss.str();
+	}
+}
+
+TEST_F(Parallel_Writer_Test, Same_Output_As_Serial)
+{
+	// 40 tasks with 3 workers: slots of the 12 tasks window are reused several times
+	Feature_Collection fc = Make_Collection(40 * IO::PARALLEL_TASK_SIZE - 17);
+	std::string serial = Write_Serial(fc, -1);
+	EXPECT_EQ(Write_Parallel(fc, -1, 3), serial);
+	EXPECT_EQ(Write_Parallel(fc, -1, 0), serial);
+}
+
+TEST_F(Parallel_Writer_Test, Keeps_Coordinate_Precision)
+{
+	Feature_Collection fc = Make_Collection(3 * IO::PARALLEL_TASK_SIZE);
+	std::string parallel = Write_Parallel(fc, 5, 2);
+	EXPECT_EQ(parallel, Write_Serial(fc, 5));
+	EXPECT_NE(parallel.find("[0.33333,-0.14286]"), std::string::npos);
+}
+
+TEST_F(Parallel_Writer_Test, Small_Collection_Is_Serial)
+{
+	Feature_Collection fc = Make_Collection(3);
+	EXPECT_EQ(Write_Parallel(fc, -1, 8), Write_Serial(fc, -1));
+	Feature_Collection empty = Make_Collection(0);
+	EXPECT_EQ(Write_Parallel(empty, -1, 8), Write_Serial(empty, -1));
+}
+
+TEST_F(Parallel_Writer_Test, Source_Exception_Is_Rethrown)
+{
+	Feature_Collection fc = Make_Collection(10 * IO::PARALLEL_TASK_SIZE);
+	std::stringstream ss;
+	rapidjson::OStreamWrapper osw(ss);
+	IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+	writer.Begin_Feature_Collection();
+	auto source = [&fc](std::size_t i) -> const Feature&
+	{
+		if (i == 5 * IO::PARALLEL_TASK_SIZE + 3)
+			throw std::runtime_error("broken feature");
+		return fc.features[i];
+	};
+	EXPECT_THROW(IO::Write_Features_Parallel(writer, fc.features.size(), source, 4), std::runtime_error);
+}
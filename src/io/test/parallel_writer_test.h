@@ -0,0 +1,17 @@
+#ifndef SRC_IO_TEST_PARALLEL_WRITER_TEST_H
+#define SRC_IO_TEST_PARALLEL_WRITER_TEST_H
+
+#include <gtest/gtest.h>
+
+class Parallel_Writer_Test : public ::testing::Test {};
+
+//////////////////////////////////////////////
+/// Nominal tests:
+/// 	- Same_Output_As_Serial
+/// 	- Keeps_Coordinate_Precision
+/// 	- Small_Collection_Is_Serial
+/// Error tests:
+/// 	- Source_Exception_Is_Rethrown
+//////////////////////////////////////////////
+
+#endif //SRC_IO_TEST_PARALLEL_WRITER_TEST_H
@@ -0,0 +1,108 @@
+#include "policy_test.h"
+
+// STL
+#include <vector>
+#include <string>
+
+// RAPIDJSON
+#include <rapidjson/reader.h>
+
+// IO
+#include "io/feature_parser.h"
+#include "io/policy.h"
+
+
+template<class Policy>
+class Policy_Collector : public O::GeoJSON::IO::Feature_Parser<Policy_Collector<Policy>, Policy>
+{
+public:
+	bool On_Full_Feature(O::GeoJSON::Feature&& feature)
+	{
+		features.emplace_back(std::move(feature));
+		return true;
+	}
+
+	bool On_Root(std::optional<O::GeoJSON::Bbox>&&, O::GeoJSON::Id&&)
+	{
+		return true;
+	}
+
+	bool Parse(const std::string& json)
+	{
+		rapidjson::Reader reader;
+		rapidjson::StringStream ss(json.c_str());
+		return static_cast<bool>(reader.Parse(ss, *this));
+	}
+
+	std::vector<O::GeoJSON::Feature> features;
+};
+
+using Trusted_Collector = Policy_Collector<O::GeoJSON::IO::Trusted_Polygon_2D_Policy>;
+using Default_Collector = Policy_Collector<O::GeoJSON::IO::Default_Policy>;
+
+TEST_F(Policy_Test, Trusted_Polygon_2D_Parse_Polygon)
+{
+	Trusted_Collector parser;
+	ASSERT_TRUE(parser.Parse(R"({"type":"FeatureCollection","features":[
+		{"type":"Feature","properties":{"name":"a"},"geometry":{"type":"Polygon","coordinates":[[[0,0],[1,0],[1,1],[0,0]]]}},
+		{"type":"Feature","properties":{"name":"b"},"geometry":{"type":"MultiPolygon","coordinates":[[[[0,0],[1,0],[1,1],[0,0]]],[[[2,2],[3,2],[3,3],[2,2]]]]}}
+	]})"));
+	ASSERT_EQ(parser.features.size(), 2u);
+	ASSERT_TRUE(parser.features[0].geometry->Is_Polygon());
+	const auto& ring = parser.features[0].geometry->Get_Polygon().rings.front();
+	ASSERT_EQ(ring.size(), 4u);
+	EXPECT_DOUBLE_EQ(ring[1].longitude, 1.0);
+	EXPECT_FALSE(ring[1].altitude.has_value());
+	ASSERT_TRUE(parser.features[1].geometry->Is_Multi_Polygon());
+	EXPECT_EQ(parser.features[1].geometry->Get_Multi_Polygon().polygons.size(), 2u);
+}
+
+TEST_F(Policy_Test, Trusted_Polygon_2D_Accept_Open_Ring)
+{
+	Trusted_Collector parser;
+	ASSERT_TRUE(parser.Parse(R"({"type":"Feature","properties":{},"geometry":{"type":"Polygon","coordinates":[[[0,0],[1,0],[1,1]]]}})"));
+	ASSERT_EQ(parser.features.size(), 1u);
+	EXPECT_EQ(parser.features[0].geometry->Get_Polygon().rings.front().size(), 3u);
+
+	Default_Collector default_parser;
+	EXPECT_FALSE(default_parser.Parse(R"({"type":"Feature","properties":{},"geometry":{"type":"Polygon","coordinates":[[[0,0],[1,0],[1,1]]]}})"));
+	EXPECT_EQ(default_parser.Get_Error(), O::GeoJSON::IO::Error::NEED_AT_LEAST_FOUR_POSITION_FOR_POLYGON);
+}
+
+TEST_F(Policy_Test, Trusted_Polygon_2D_Overwrite_Duplicated_Key)
+{
+	Trusted_Collector parser;
+	ASSERT_TRUE(parser.Parse(R"({"type":"Feature","properties":{"name":"a","name":"b"},"geometry":{"type":"Polygon","coordinates":[[[0,0],[1,0],[1,1],[0,0]]]}})"));
+	ASSERT_EQ(parser.features.size(), 1u);
+	EXPECT_EQ(parser.features[0].properties.Get_Object().at("name").Get_String(), "b");
+}
+
+TEST_F(Policy_Test, Default_Policy_Keep_Altitude)
+{
+	Default_Collector parser;
+	ASSERT_TRUE(parser.Parse(R"({"type":"Feature","properties":{},"geometry":{"type":"Point","coordinates":[1,2,3]}})"));
+	ASSERT_EQ(parser.features.size(), 1u);
+	ASSERT_TRUE(parser.features[0].geometry->Get_Point().position.altitude.has_value());
+	EXPECT_DOUBLE_EQ(*parser.features[0].geometry->Get_Point().position.altitude, 3.0);
+}
+
+TEST_F(Policy_Test, Trusted_Polygon_2D_Reject_Point)
+{
+	Trusted_Collector parser;
+	EXPECT_FALSE(parser.Parse(R"({"type":"Feature","properties":{},"geometry":{"type":"Point","coordinates":[1,2]}})"));
+	EXPECT_EQ(parser.Get_Error(), O::GeoJSON::IO::Error::GEOMETRY_TYPE_DISABLED_BY_POLICY);
+}
+
+TEST_F(Policy_Test, Trusted_Polygon_2D_Reject_Geometry_Collection)
+{
+	Trusted_Collector parser;
+	EXPECT_FALSE(parser.Parse(R"({"type":"Feature","properties":{},"geometry":{"geometries":[],"type":"GeometryCollection"}})"));
+	EXPECT_EQ(parser.Get_Error(), O::GeoJSON::IO::Error::GEOMETRY_TYPE_DISABLED_BY_POLICY);
+}
+
+TEST_F(Policy_Test, Trusted_Polygon_2D_Reject_Altitude)
+{
+	Trusted_Collector parser;
+	EXPECT_FALSE(parser.Parse(R"({"type":"Feature","properties":{},"geometry":{"type":"Polygon","coordinates":[[[0,0,1],[1,0,1],[1,1,1],[0,0,1]]]}})"));
+	EXPECT_EQ(parser.Get_Error(), O::GeoJSON::IO::Error::COORDINATE_OVERSIZED);
+}
@@ -0,0 +1,20 @@
+#ifndef SRC_IO_TEST_POLICY_TEST_H
+#define SRC_IO_TEST_POLICY_TEST_H
+
+#include <gtest/gtest.h>
+
+class Policy_Test : public ::testing::Test {};
+
+//////////////////////////////////////////////
+/// Nominal tests:
+/// 	- Trusted_Polygon_2D_Parse_Polygon
+/// 	- Trusted_Polygon_2D_Accept_Open_Ring
+/// 	- Trusted_Polygon_2D_Overwrite_Duplicated_Key
+/// 	- Default_Policy_Keep_Altitude
+/// Error tests:
+/// 	- Trusted_Polygon_2D_Reject_Point
+/// 	- Trusted_Polygon_2D_Reject_Geometry_Collection
+/// 	- Trusted_Polygon_2D_Reject_Altitude
+//////////////////////////////////////////////
+
+#endif //SRC_IO_TEST_POLICY_TEST_H
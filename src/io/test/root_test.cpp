@@ -73,8 +73,8 @@ TEST_F(Root_Test, Feature_With_Id_And_BBox) {
 	ASSERT_TRUE(g.Is_Feature());
 	auto& feature = g.Get_Feature();
 
-	ASSERT_TRUE(feature.id.has_value());
-	EXPECT_EQ(*feature.id, "feature-42");
+	ASSERT_TRUE(feature.id.Has_Value());
+	EXPECT_EQ(feature.id.Get_String(), "feature-42");
 
 	ASSERT_TRUE(feature.bbox.has_value());
 	if (std::holds_alternative<std::array<double,4>>(feature.bbox->coordinates)) {
@@ -0,0 +1,95 @@
+#include "schema_test.h"
+
+// STL
+#include <string>
+
+// IO
+#include "io/schema.h"
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	const std::string SAMPLE = R"({"type":"FeatureCollection","features":[
+		{"type":"Feature","geometry":{"type":"Point","coordinates":[0,0]},"properties":{"code":"75056","pop":2133111,"area":105.4,"capital":true,"tags":["a",{"b":1}],"meta":{"source":"ign"}}},
+		{"type":"Feature","geometry":null,"properties":{"code":"13055","pop":870731,"area":null}},
+		{"type":"Feature","geometry":null,"properties":{"code":"69123","pop":-5,"area":47}},
+		{"type":"Feature","geometry":null,"properties":null}
+	]})";
+}
+
+TEST_F(Schema_Test, Types_And_Null_Ratio)
+{
+	auto result = Infer_Schema_String(SAMPLE);
+	ASSERT_TRUE(result.Has_Value());
+	const auto& schema = result.Value();
+	EXPECT_EQ(schema.feature_count, 4u);
+	ASSERT_EQ(schema.properties.size(), 6u);
+
+	const auto& code = schema.properties.at("code");
+	EXPECT_TRUE(code.Is_Only(Property_Type::STRING));
+	EXPECT_DOUBLE_EQ(code.Null_Ratio(schema.feature_count), 0.25);
+
+	const auto& area = schema.properties.at("area");
+	EXPECT_TRUE(area.Has_Type(Property_Type::DOUBLE));
+	EXPECT_TRUE(area.Has_Type(Property_Type::INTEGER));
+	EXPECT_TRUE(area.Has_Type(Property_Type::NULL_VALUE));
+	EXPECT_EQ(area.present_count, 3u);
+	EXPECT_EQ(area.null_count, 1u);
+	EXPECT_DOUBLE_EQ(area.Null_Ratio(schema.feature_count), 0.5);
+
+	const auto& capital = schema.properties.at("capital");
+	EXPECT_TRUE(capital.Is_Only(Property_Type::BOOL));
+	EXPECT_DOUBLE_EQ(capital.Null_Ratio(schema.feature_count), 0.75);
+}
+
+TEST_F(Schema_Test, Min_Max)
+{
+	auto result = Infer_Schema_String(SAMPLE);
+	ASSERT_TRUE(result.Has_Value());
+	const auto& pop = result.Value().properties.at("pop");
+	EXPECT_TRUE(pop.Is_Only(Property_Type::INTEGER));
+	EXPECT_DOUBLE_EQ(pop.min_number, -5);
+	EXPECT_DOUBLE_EQ(pop.max_number, 2133111);
+
+	const auto& code = result.Value().properties.at("code");
+	EXPECT_EQ(code.min_string.value(), "13055");
+	EXPECT_EQ(code.max_string.value(), "75056");
+	EXPECT_EQ(code.max_string_length, 5u);
+}
+
+TEST_F(Schema_Test, Nested_Values_Only_Give_Their_Type)
+{
+	auto result = Infer_Schema_String(SAMPLE);
+	ASSERT_TRUE(result.Has_Value());
+	const auto& properties = result.Value().properties;
+	EXPECT_TRUE(properties.at("tags").Is_Only(Property_Type::ARRAY));
+	EXPECT_TRUE(properties.at("meta").Is_Only(Property_Type::OBJECT));
+	EXPECT_EQ(properties.count("b"), 0u);
+	EXPECT_EQ(properties.count("source"), 0u);
+}
+
+TEST_F(Schema_Test, Cardinality_Estimate)
+{
+	std::string json = R"({"type":"FeatureCollection","features":[)";
+	for (int i = 0; i < 20000; ++i)
+	{
+		if (i) json += ',';
+		json += R"({"type":"Feature","geometry":null,"properties":{"id":)" + std::to_string(i) + R"(,"parity":)" + std::to_string(i % 2) + R"(,"name":"n)" + std::to_string(i % 1000) + R"("}})";
+	}
+	json += "]}";
+
+	auto result = Infer_Schema_String(json);
+	ASSERT_TRUE(result.Has_Value());
+	const auto& properties = result.Value().properties;
+	EXPECT_NEAR(properties.at("id").cardinality.Estimate(), 20000, 20000 * 0.05);
+	EXPECT_NEAR(properties.at("name").cardinality.Estimate(), 1000, 1000 * 0.05);
+	EXPECT_NEAR(properties.at("parity").cardinality.Estimate(), 2, 0.5);
+}
+
+TEST_F(Schema_Test, Invalid_Geometry_Is_Reported)
+{
+	auto result = Infer_Schema_String(R"({"type":"FeatureCollection","features":[{"type":"Feature","properties":{"a":1},"geometry":{"type":"Point","coordinates":[0]}}]})");
+	ASSERT_FALSE(result.Has_Value());
+	EXPECT_EQ(result.Error(), Error::COORDINATE_UNDERSIZED);
+}
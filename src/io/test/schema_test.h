@@ -0,0 +1,18 @@
+#ifndef SRC_IO_TEST_SCHEMA_TEST_H
+#define SRC_IO_TEST_SCHEMA_TEST_H
+
+#include <gtest/gtest.h>
+
+class Schema_Test : public ::testing::Test {};
+
+//////////////////////////////////////////////
+/// Nominal tests:
+/// 	- Types_And_Null_Ratio
+/// 	- Min_Max
+/// 	- Nested_Values_Only_Give_Their_Type
+/// 	- Cardinality_Estimate
+/// Error tests:
+/// 	- Invalid_Geometry_Is_Reported
+//////////////////////////////////////////////
+
+#endif //SRC_IO_TEST_SCHEMA_TEST_H
@@ -0,0 +1,308 @@
+#include "snapshot_test.h"
+
+// STL
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+// RAPIDJSON
+#include <rapidjson/stringbuffer.h>
+
+// IO
+#include "io/parser.h"
+#include "io/snapshot.h"
+#include "io/writer.h"
+
+using namespace O::GeoJSON;
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	struct Collector
+	{
+		std::vector<Feature> features;
+		Id id;
+		bool root = false;
+
+		bool On_Full_Feature(Feature&& feature) { features.push_back(std::move(feature)); return true; }
+		bool On_Root(std::optional<Bbox>&&, Id&& root_id) { id = std::move(root_id); root = true; return true; }
+	};
+
+	/// handler refusing every feature after the first ``limit``
+	struct Limited_Collector : public Collector
+	{
+		std::size_t limit = 0;
+
+		bool On_Full_Feature(Feature&& feature) { return features.size() < limit && Collector::On_Full_Feature(std::move(feature)); }
+	};
+
+	Polygon Make_Square(double x, double y, double size)
+	{
+		return Polygon{ { { { x, y }, { x + size, y }, { x + size, y + size }, { x, y + size }, { x, y } } } };
+	}
+
+	std::string To_Json(const Root& root)
+	{
+		rapidjson::StringBuffer buffer;
+		Writer<rapidjson::StringBuffer> writer(buffer);
+		writer.Write_GeoJSON_Object(root);
+		return buffer.GetString();
+	}
+
+	/// every geometry type, altitudes, bboxes, every id type and properties of every kind
+	Root Make_Collection()
+	{
+		std::vector<Feature> features(8);
+		features[0].geometry = Geometry{ Point{ { 1.5, -2.25 } } };
+		features[1].geometry = Geometry{ Multi_Point{ { { 0, 0 }, { 1, 1 } } } };
+		features[2].geometry = Geometry{ Line_String{ { { 0, 0, 10.0 }, { 2, 1 }, { 3, 5, -1.0 } } } };
+		features[3].geometry = Geometry{ Multi_Line_String{ { Line_String{ { { 0, 0 }, { 1, 0 } } }, Line_String{ { { 5, 5 }, { 6, 6 }, { 7, 5 } } } } } };
+		Polygon holed = Make_Square(0, 0, 10);
+		holed.rings.push_back(Make_Square(2, 2, 1).rings.front());
+		features[4].geometry = Geometry{ holed };
+		features[5].geometry = Geometry{ Multi_Polygon{ { Make_Square(20, 20, 1), holed } } };
+		Geometry_Collection inner;
+		inner.geometries.push_back(std::make_shared<Geometry>(Geometry{ Point{ { 3, 4 } } }));
+		Geometry_Collection collection;
+		collection.geometries.push_back(std::make_shared<Geometry>(Geometry{ Point{ { 8, 9 } } }));
+		collection.geometries.push_back(std::make_shared<Geometry>(Geometry{ inner }));
+		collection.geometries.push_back(std::make_shared<Geometry>(Geometry{ Make_Square(-5, -5, 2) }));
+		features[6].geometry = Geometry{ collection };
+		features[6].geometry->bbox = Bbox{ std::array<double, 4>{ -5, -5, 8, 9 } };
+		features[5].bbox = Bbox{ std::array<double, 6>{ 0, 0, 0, 21, 21, 0 } };
+
+		for (std::size_t i = 0; i < 7; ++i)
+			features[i].properties = Property(Property::Object{
+				{ "number", Property(static_cast<std::int64_t>(i)) },
+				{ "value", i % 2 ? Property(std::string("odd")) : Property(0.5 * i) },
+			});
+		features[0].properties.Get_Object().emplace("tags", Property(Property::Array{ Property(1), Property(std::string("a")) }));
+		features[1].properties.Get_Object().emplace("nested", Property(Property::Object{ { "flag", Property(true) }, { "none", Property(nullptr) } }));
+		features[2].properties.Get_Object().emplace("none", Property(nullptr));
+		features[7].properties = Property(nullptr);
+
+		features[0].id = Id(7);
+		features[1].id = Id(2.5);
+		features[2].id = Id(std::string_view("road"));
+
+		Feature_Collection feature_collection;
+		feature_collection.features = std::move(features);
+		feature_collection.bbox = Bbox{ std::array<double, 4>{ -5, -5, 21, 21 } };
+		feature_collection.id = Id(std::string_view("collection"));
+		return Root{ std::move(feature_collection) };
+	}
+
+	Snapshot_Reader Save_And_Open(const Root& root, const std::string& name)
+	{
+		auto path = std::filesystem::temp_directory_path() / name;
+		EXPECT_EQ(Snapshot_Writer::Save(root, path), Error::NO_ERROR);
+		auto reader = Snapshot_Reader::Open(path);
+		EXPECT_TRUE(reader.Has_Value());
+		return std::move(reader.Value());
+	}
+}
+
+TEST_F(Snapshot_Test, Round_Trip_Feature_Collection)
+{
+	const Root root = Make_Collection();
+	auto reader = Save_And_Open(root, "ogeoflow_collection.snapshot");
+	EXPECT_EQ(reader.Get_Root_Kind(), Snapshot_Root::FEATURE_COLLECTION);
+	EXPECT_EQ(reader.Features().size(), 8u);
+	EXPECT_EQ(To_Json(reader.To_Root()), To_Json(root));
+
+	// missing altitudes stay missing
+	Feature line = reader.Read_Feature(2);
+	const auto& positions = line.geometry->Get_Line_String().positions;
+	EXPECT_EQ(positions[0].altitude, 10.0);
+	EXPECT_FALSE(positions[1].altitude.has_value());
+	EXPECT_TRUE(std::isnan(reader.Altitudes()[reader.Geometries()[reader.Features()[2].geometry].begin + 1]));
+}
+
+TEST_F(Snapshot_Test, Zero_Copy_Columns)
+{
+	auto reader = Save_And_Open(Make_Collection(), "ogeoflow_columns.snapshot");
+
+	auto number = reader.Find_Column("number");
+	ASSERT_TRUE(number);
+	EXPECT_EQ(reader.Columns()[*number].type, Snapshot_Value::INTEGER);
+	for (std::size_t i = 0; i < 7; ++i)
+	{
+		ASSERT_EQ(reader.Value_Type(*number, i), Snapshot_Value::INTEGER);
+		EXPECT_EQ(reader.Get_Integer(*number, i), static_cast<std::int64_t>(i));
+	}
+	EXPECT_EQ(reader.Value_Type(*number, 7), Snapshot_Value::ABSENT);
+
+	auto value = reader.Find_Column("value");
+	ASSERT_TRUE(value);
+	EXPECT_EQ(reader.Columns()[*value].type, Snapshot_Value::MIXED);
+	EXPECT_EQ(reader.Get_Double(*value, 4), 2.0);
+	EXPECT_EQ(reader.Get_String(*value, 3), "odd");
+
+	auto tags = reader.Find_Column("tags");
+	ASSERT_TRUE(tags);
+	EXPECT_EQ(reader.Value_Type(*tags, 0), Snapshot_Value::JSON);
+	EXPECT_EQ(reader.Get_String(*tags, 0), "[1,\"a\"]");
+	EXPECT_FALSE(reader.Find_Column("missing"));
+
+	// the first feature point is the first position of the coordinate table
+	const Snapshot_Geometry& point = reader.Geometries()[reader.Features()[0].geometry];
+	EXPECT_EQ(point.type, static_cast<std::uint8_t>(Type::POINT));
+	EXPECT_EQ(reader.XY()[2 * point.begin], 1.5);
+	EXPECT_EQ(reader.XY()[2 * point.begin + 1], -2.25);
+
+	// holed polygon: two rings of five positions
+	const Snapshot_Geometry& polygon = reader.Geometries()[reader.Features()[4].geometry];
+	ASSERT_EQ(polygon.end - polygon.begin, 2u);
+	EXPECT_EQ(reader.Ring_Offsets()[polygon.begin + 1] - reader.Ring_Offsets()[polygon.begin], 5u);
+	EXPECT_EQ(reader.Features()[2].id_type, Snapshot_Id::STRING);
+	EXPECT_EQ(reader.String(reader.Features()[2].id), "road");
+}
+
+TEST_F(Snapshot_Test, Sparse_Columns)
+{
+	// every feature has its own key: dense columns would hold 1001 x 1000 entries
+	Feature_Collection collection;
+	collection.features.resize(1000);
+	for (std::size_t i = 0; i < collection.features.size(); ++i)
+		collection.features[i].properties = Property(Property::Object{
+			{ "number", Property(static_cast<std::int64_t>(i)) },
+			{ "key_" + std::to_string(i), Property(std::string("value ") + std::to_string(i)) },
+		});
+	const Root root{ collection };
+	const auto path = std::filesystem::temp_directory_path() / "ogeoflow_sparse.snapshot";
+	auto reader = Save_And_Open(root, "ogeoflow_sparse.snapshot");
+	EXPECT_LT(std::filesystem::file_size(path), 200000u);
+	ASSERT_EQ(reader.Columns().size(), 1001u);
+
+	auto number = reader.Find_Column("number");
+	ASSERT_TRUE(number);
+	EXPECT_EQ(reader.Columns()[*number].rows, SNAPSHOT_NONE);
+	EXPECT_EQ(reader.Get_Integer(*number, 999), 999);
+
+	auto key = reader.Find_Column("key_500");
+	ASSERT_TRUE(key);
+	EXPECT_EQ(reader.Columns()[*key].count, 1u);
+	EXPECT_NE(reader.Columns()[*key].rows, SNAPSHOT_NONE);
+	EXPECT_EQ(reader.Columns()[*key].type, Snapshot_Value::STRING);
+	EXPECT_EQ(reader.Value_Type(*key, 499), Snapshot_Value::ABSENT);
+	ASSERT_EQ(reader.Value_Type(*key, 500), Snapshot_Value::STRING);
+	EXPECT_EQ(reader.Get_String(*key, 500), "value 500");
+	EXPECT_EQ(reader.Value_Type(*key, 501), Snapshot_Value::ABSENT);
+
+	EXPECT_EQ(To_Json(reader.To_Root()), To_Json(root));
+}
+
+TEST_F(Snapshot_Test, Feature_And_Geometry_Roots)
+{
+	Feature feature;
+	feature.geometry = Geometry{ Make_Square(0, 0, 1) };
+	feature.properties = Property(Property::Object{ { "name", Property(std::string("square")) } });
+	feature.id = Id(3);
+	const Root feature_root{ feature };
+	auto feature_reader = Save_And_Open(feature_root, "ogeoflow_feature.snapshot");
+	EXPECT_EQ(feature_reader.Get_Root_Kind(), Snapshot_Root::FEATURE);
+	EXPECT_EQ(To_Json(feature_reader.To_Root()), To_Json(feature_root));
+	EXPECT_TRUE(feature_reader.Altitudes().empty());
+
+	const Root geometry_root{ Geometry{ Multi_Polygon{ { Make_Square(0, 0, 1), Make_Square(2, 2, 1) } } } };
+	auto geometry_reader = Save_And_Open(geometry_root, "ogeoflow_geometry.snapshot");
+	EXPECT_EQ(geometry_reader.Get_Root_Kind(), Snapshot_Root::GEOMETRY);
+	EXPECT_NE(geometry_reader.Root_Geometry(), SNAPSHOT_NONE);
+	EXPECT_TRUE(geometry_reader.Features().empty());
+	EXPECT_EQ(geometry_reader.Polygon_Offsets().size(), 3u);
+	EXPECT_EQ(To_Json(geometry_reader.To_Root()), To_Json(geometry_root));
+}
+
+TEST_F(Snapshot_Test, Parse_To_Handler)
+{
+	const Root root = Make_Collection();
+	auto reader = Save_And_Open(root, "ogeoflow_parse.snapshot");
+	Collector collector;
+	ASSERT_EQ(reader.Parse(collector), Error::NO_ERROR);
+	ASSERT_TRUE(collector.root);
+	EXPECT_EQ(collector.id.Get_String(), "collection");
+	ASSERT_EQ(collector.features.size(), 8u);
+	EXPECT_EQ(collector.features[0].id.Get_Integer(), 7);
+	EXPECT_TRUE(collector.features[7].properties.Is_Null());
+	EXPECT_FALSE(collector.features[7].geometry.has_value());
+}
+
+TEST_F(Snapshot_Test, Parse_To_Writer)
+{
+	Feature_Collection collection;
+	collection.id = Id("cities");
+	collection.features.resize(2);
+	collection.features[0].geometry = Geometry{ Point{ { 2.35, 48.85 } } };
+	collection.features[0].properties = Property(Property::Object{ { "name", Property("Paris") } });
+	collection.features[1].geometry = Geometry{ Make_Square(0, 0, 2) };
+	collection.features[1].id = Id(2);
+	collection.features[1].properties = Property(Property::Object{ { "rank", Property(2) } });
+	auto reader = Save_And_Open(Root{ collection }, "ogeoflow_to_writer.snapshot");
+
+	rapidjson::StringBuffer buffer;
+	{
+		Writer<rapidjson::StringBuffer> writer(buffer);
+		ASSERT_EQ(reader.Parse(writer), Error::NO_ERROR);
+		EXPECT_FALSE(writer.Is_Streaming());
+	}
+	auto result = Parse_Geojson_String(buffer.GetString());
+	ASSERT_TRUE(result.Has_Value());
+	EXPECT_EQ(To_Json(result.Value()), To_Json(Root{ collection }));
+}
+
+TEST_F(Snapshot_Test, Missing_File)
+{
+	auto reader = Snapshot_Reader::Open(std::filesystem::temp_directory_path() / "ogeoflow_missing.snapshot");
+	ASSERT_FALSE(reader.Has_Value());
+	EXPECT_EQ(reader.Error(), Error::FILE_OPENNING_FAILED);
+}
+
+TEST_F(Snapshot_Test, Corrupted_File)
+{
+	auto path = std::filesystem::temp_directory_path() / "ogeoflow_corrupted.snapshot";
+	ASSERT_EQ(Snapshot_Writer::Save(Make_Collection(), path), Error::NO_ERROR);
+	std::string bytes;
+	{
+		std::ifstream in(path, std::ios::binary);
+		bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	}
+	auto write = [&path](const std::string& content)
+	{
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		out.write(content.data(), static_cast<std::streamsize>(content.size()));
+	};
+	auto expect_invalid = [&path]()
+	{
+		auto reader = Snapshot_Reader::Open(path);
+		ASSERT_FALSE(reader.Has_Value());
+		EXPECT_EQ(reader.Error(), Error::INVALID_SNAPSHOT);
+	};
+
+	write(bytes.substr(0, bytes.size() / 2));
+	expect_invalid();
+
+	std::string bad_magic = bytes;
+	bad_magic[0] = 'X';
+	write(bad_magic);
+	expect_invalid();
+
+	// the last 8 bytes are string bytes, the string offsets before them no longer match
+	write(bytes.substr(0, bytes.size() - 1));
+	expect_invalid();
+
+	write("OGFSNAP");
+	expect_invalid();
+}
+
+TEST_F(Snapshot_Test, Handler_Aborts)
+{
+	auto reader = Save_And_Open(Make_Collection(), "ogeoflow_abort.snapshot");
+	Limited_Collector collector;
+	collector.limit = 2;
+	EXPECT_EQ(reader.Parse(collector), Error::HANDLER_ABORTED);
+	EXPECT_EQ(collector.features.size(), 2u);
+	EXPECT_FALSE(collector.root);
+}
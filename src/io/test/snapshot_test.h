@@ -0,0 +1,22 @@
+#ifndef SRC_IO_TEST_SNAPSHOT_TEST_H
+#define SRC_IO_TEST_SNAPSHOT_TEST_H
+
+#include <gtest/gtest.h>
+
+class Snapshot_Test : public ::testing::Test {};
+
+//////////////////////////////////////////////
+/// Nominal tests:
+/// 	- Round_Trip_Feature_Collection
+/// 	- Zero_Copy_Columns
+/// 	- Sparse_Columns
+/// 	- Feature_And_Geometry_Roots
+/// 	- Parse_To_Handler
+/// 	- Parse_To_Writer
+/// Error tests:
+/// 	- Missing_File
+/// 	- Corrupted_File
+/// 	- Handler_Aborts
+//////////////////////////////////////////////
+
+#endif //SRC_IO_TEST_SNAPSHOT_TEST_H
@@ -0,0 +1,415 @@
+#include "vector_tile_test.h"
+
+// STL
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// RAPIDJSON
+#include <rapidjson/reader.h>
+
+// IO
+#include "io/feature_parser.h"
+#include "io/vector_tile.h"
+
+using namespace O::GeoJSON;
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	/// minimal protobuf reader for the fields of the vector tile schema
+	struct Proto_Reader
+	{
+		std::string_view bytes;
+		std::size_t position = 0;
+
+		bool Next(std::uint32_t& field, std::uint32_t& wire_type)
+		{
+			if (position >= bytes.size())
+				return false;
+			const std::uint64_t key = Varint();
+			field = static_cast<std::uint32_t>(key >> 3);
+			wire_type = static_cast<std::uint32_t>(key & 7);
+			return true;
+		}
+
+		std::uint64_t Varint()
+		{
+			std::uint64_t value = 0;
+			for (int shift = 0; position < bytes.size(); shift += 7)
+			{
+				const auto byte = static_cast<std::uint8_t>(bytes[position++]);
+				value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0)
+					break;
+			}
+			return value;
+		}
+
+		std::string_view Bytes()
+		{
+			const std::size_t size = static_cast<std::size_t>(Varint());
+			std::string_view value = bytes.substr(position, size);
+			position += size;
+			return value;
+		}
+
+		std::vector<std::uint32_t> Packed()
+		{
+			Proto_Reader packed{ Bytes() };
+			std::vector<std::uint32_t> values;
+			while (packed.position < packed.bytes.size())
+				values.push_back(static_cast<std::uint32_t>(packed.Varint()));
+			return values;
+		}
+	};
+
+	using Ring = std::vector<std::array<std::int64_t, 2>>;
+
+	struct Decoded_Feature
+	{
+		std::optional<std::uint64_t> id;
+		std::vector<std::uint32_t> tags;
+		std::uint32_t type = 0;
+		std::vector<Ring> parts; ///< geometry split at every MoveTo
+	};
+
+	struct Decoded_Layer
+	{
+		std::uint32_t version = 0;
+		std::string name;
+		std::uint32_t extent = 0;
+		std::vector<Decoded_Feature> features;
+		std::vector<std::string> keys;
+		std::vector<std::string> values; ///< raw Value messages
+	};
+
+	std::vector<Ring> Decode_Geometry(const std::vector<std::uint32_t>& commands)
+	{
+		std::vector<Ring> parts;
+		std::int64_t x = 0, y = 0;
+		for (std::size_t i = 0; i < commands.size();)
+		{
+			const std::uint32_t id = commands[i] & 7;
+			const std::uint32_t count = commands[i] >> 3;
+			++i;
+			if (id == 7)
+				continue;
+			for (std::uint32_t c = 0; c < count; ++c, i += 2)
+			{
+				x += static_cast<std::int64_t>(commands[i] >> 1) ^ -static_cast<std::int64_t>(commands[i] & 1);
+				y += static_cast<std::int64_t>(commands[i + 1] >> 1) ^ -static_cast<std::int64_t>(commands[i + 1] & 1);
+				if (id == 1)
+					parts.emplace_back();
+				parts.back().push_back({ x, y });
+			}
+		}
+		return parts;
+	}
+
+	Decoded_Layer Decode_Tile(std::string_view bytes)
+	{
+		Decoded_Layer layer;
+		Proto_Reader tile{ bytes };
+		std::uint32_t field, wire_type;
+		while (tile.Next(field, wire_type))
+		{
+			EXPECT_EQ(field, 3u);
+			Proto_Reader reader{ tile.Bytes() };
+			while (reader.Next(field, wire_type))
+			{
+				switch (field)
+				{
+				case 15: layer.version = static_cast<std::uint32_t>(reader.Varint()); break;
+				case 1:  layer.name = reader.Bytes(); break;
+				case 3:  layer.keys.emplace_back(reader.Bytes()); break;
+				case 4:  layer.values.emplace_back(reader.Bytes()); break;
+				case 5:  layer.extent = static_cast<std::uint32_t>(reader.Varint()); break;
+				case 2:
+				{
+					Decoded_Feature feature;
+					Proto_Reader feature_reader{ reader.Bytes() };
+					while (feature_reader.Next(field, wire_type))
+					{
+						if (field == 1)      feature.id = feature_reader.Varint();
+						else if (field == 2) feature.tags = feature_reader.Packed();
+						else if (field == 3) feature.type = static_cast<std::uint32_t>(feature_reader.Varint());
+						else if (field == 4) feature.parts = Decode_Geometry(feature_reader.Packed());
+					}
+					layer.features.push_back(std::move(feature));
+					break;
+				}
+				default: ADD_FAILURE() << "unexpected layer field " << field;
+				}
+			}
+		}
+		return layer;
+	}
+
+	std::int64_t Double_Area(const Ring& ring)
+	{
+		std::int64_t area = 0;
+		for (std::size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++)
+			area += ring[j][0] * ring[i][1] - ring[i][0] * ring[j][1];
+		return area;
+	}
+
+	Polygon Make_Square(double x, double y, double size)
+	{
+		return Polygon{ { { { x, y }, { x + size, y }, { x + size, y + size }, { x, y + size }, { x, y } } } };
+	}
+
+	Tiler_Options Planar_Options(std::uint8_t min_zoom, std::uint8_t max_zoom)
+	{
+		Tiler_Options options;
+		options.min_zoom = min_zoom;
+		options.max_zoom = max_zoom;
+		options.bounds = std::array<double, 4>{ 0, 0, 100, 100 };
+		options.thread_count = 4;
+		return options;
+	}
+
+	Feature Make_Feature(Geometry geometry)
+	{
+		Feature feature;
+		feature.geometry = std::move(geometry);
+		return feature;
+	}
+
+	/// GeoJSON parser streaming its features to the tiler
+	struct Tiler_Sink : public Vector_Tiler, public Feature_Parser<Tiler_Sink>
+	{
+		using Vector_Tiler::Vector_Tiler;
+		using Vector_Tiler::On_Full_Feature;
+		using Vector_Tiler::On_Root;
+	};
+}
+
+TEST_F(Vector_Tile_Test, Point_Encoding)
+{
+	Vector_Tiler tiler;
+	Feature feature = Make_Feature(Geometry{ Point{ { 0, 0 } } });
+	feature.id = Id(42);
+	feature.properties = Property(Property::Object{ { "name", Property("origin") }, { "rank", Property(-3) }, { "tags", Property(Property::Array{ Property(1), Property(2) }) }, { "none", Property(nullptr) } });
+	tiler.Add_Feature(feature);
+	ASSERT_EQ(tiler.Size(), 1u);
+
+	const Decoded_Layer layer = Decode_Tile(tiler.Encode_Tile({ 0, 0, 0 }));
+	EXPECT_EQ(layer.version, 2u);
+	EXPECT_EQ(layer.name, "features");
+	EXPECT_EQ(layer.extent, 4096u);
+	ASSERT_EQ(layer.features.size(), 1u);
+	const Decoded_Feature& point = layer.features.front();
+	EXPECT_EQ(point.id, 42u);
+	EXPECT_EQ(point.type, 1u);
+	ASSERT_EQ(point.parts.size(), 1u);
+	EXPECT_EQ(point.parts[0], (Ring{ { 2048, 2048 } }));
+
+	EXPECT_EQ(layer.keys, (std::vector<std::string>{ "name", "rank", "tags" }));
+	EXPECT_EQ(point.tags, (std::vector<std::uint32_t>{ 0, 0, 1, 1, 2, 2 }));
+	EXPECT_EQ(layer.values[0], std::string("\x0A\x06origin"));
+	EXPECT_EQ(layer.values[1], std::string("\x30\x05"));
+	EXPECT_EQ(layer.values[2], std::string("\x0A\x05[1,2]"));
+
+	// at zoom 1 the origin is the corner of the four tiles, the buffer puts it in all of them
+	EXPECT_FALSE(tiler.Encode_Tile({ 1, 0, 0 }).empty());
+	EXPECT_FALSE(tiler.Encode_Tile({ 1, 1, 1 }).empty());
+	EXPECT_TRUE(tiler.Encode_Tile({ 2, 0, 0 }).empty());
+}
+
+TEST_F(Vector_Tile_Test, Polygon_Clipping_And_Winding)
+{
+	Vector_Tiler tiler(Planar_Options(1, 1));
+	Polygon holed = Make_Square(10, 10, 80);
+	holed.rings.push_back(Make_Square(20, 20, 10).rings.front());
+	tiler.Add_Feature(Make_Feature(Geometry{ holed }));
+
+	// north west tile: the square covers x, y in [10, 50] of the data, y is flipped
+	const Decoded_Layer layer = Decode_Tile(tiler.Encode_Tile({ 1, 0, 0 }));
+	ASSERT_EQ(layer.features.size(), 1u);
+	EXPECT_EQ(layer.features[0].type, 3u);
+	const auto& rings = layer.features[0].parts;
+	ASSERT_EQ(rings.size(), 1u);
+	EXPECT_GT(Double_Area(rings[0]), 0);
+	for (const auto& point : rings[0])
+	{
+		EXPECT_GE(point[0], 819);
+		EXPECT_LE(point[0], 4096 + 64);
+		EXPECT_GE(point[1], 819);
+		EXPECT_LE(point[1], 4096 + 64);
+	}
+
+	// south west tile holds the hole, wound the other way
+	const Decoded_Layer south = Decode_Tile(tiler.Encode_Tile({ 1, 0, 1 }));
+	ASSERT_EQ(south.features.size(), 1u);
+	ASSERT_EQ(south.features[0].parts.size(), 2u);
+	EXPECT_GT(Double_Area(south.features[0].parts[0]), 0);
+	EXPECT_LT(Double_Area(south.features[0].parts[1]), 0);
+}
+
+TEST_F(Vector_Tile_Test, Line_Split_By_Clipping)
+{
+	Vector_Tiler tiler(Planar_Options(1, 1));
+	// goes out of the north west tile to the east then comes back
+	tiler.Add_Feature(Make_Feature(Geometry{ Line_String{ { { 10, 90 }, { 90, 90 }, { 90, 80 }, { 10, 80 } } } }));
+
+	const Decoded_Layer layer = Decode_Tile(tiler.Encode_Tile({ 1, 0, 0 }));
+	ASSERT_EQ(layer.features.size(), 1u);
+	EXPECT_EQ(layer.features[0].type, 2u);
+	const auto& parts = layer.features[0].parts;
+	ASSERT_EQ(parts.size(), 2u);
+	EXPECT_EQ(parts[0].front(), (std::array<std::int64_t, 2>{ 819, 819 }));
+	EXPECT_EQ(parts[0].back(), (std::array<std::int64_t, 2>{ 4160, 819 }));
+	EXPECT_EQ(parts[1].front(), (std::array<std::int64_t, 2>{ 4160, 1638 }));
+	EXPECT_EQ(parts[1].back(), (std::array<std::int64_t, 2>{ 819, 1638 }));
+}
+
+TEST_F(Vector_Tile_Test, Simplification_Per_Zoom)
+{
+	std::vector<Position> zigzag;
+	for (int i = 0; i <= 1000; ++i)
+		zigzag.push_back({ i * 0.001, 50 + (i % 2) * 0.01 });
+	Tiler_Options options = Planar_Options(0, 8);
+	Vector_Tiler tiler(options);
+	tiler.Add_Feature(Make_Feature(Geometry{ Line_String{ zigzag } }));
+
+	auto vertices = [](const Decoded_Layer& layer)
+	{
+		std::size_t count = 0;
+		for (const auto& feature : layer.features)
+			for (const auto& part : feature.parts)
+				count += part.size();
+		return count;
+	};
+	EXPECT_EQ(vertices(Decode_Tile(tiler.Encode_Tile({ 0, 0, 0 }))), 2u);
+	EXPECT_GT(vertices(Decode_Tile(tiler.Encode_Tile({ 8, 0, 128 }))), 100u);
+
+	options.tolerance = 0;
+	Vector_Tiler exact(options);
+	exact.Add_Feature(Make_Feature(Geometry{ Line_String{ zigzag } }));
+	EXPECT_GT(vertices(Decode_Tile(exact.Encode_Tile({ 0, 0, 0 }))), 2u);
+}
+
+TEST_F(Vector_Tile_Test, Generate_Zoom_Range)
+{
+	Vector_Tiler tiler(Planar_Options(0, 3));
+	tiler.Add_Feature(Make_Feature(Geometry{ Make_Square(1, 1, 10) }));
+	tiler.Add_Feature(Make_Feature(Geometry{ Point{ { 80, 20 } } }));
+
+	std::vector<Tile_Id> tiles;
+	ASSERT_EQ(tiler.Generate([&](const Tile_Id& tile, std::string_view bytes)
+	{
+		EXPECT_EQ(bytes, tiler.Encode_Tile(tile));
+		tiles.push_back(tile);
+		return Error::NO_ERROR;
+	}), Error::NO_ERROR);
+
+	EXPECT_TRUE(std::is_sorted(tiles.begin(), tiles.end()));
+	ASSERT_FALSE(tiles.empty());
+	EXPECT_EQ(tiles.front(), (Tile_Id{ 0, 0, 0 }));
+	EXPECT_EQ(tiles.back().z, 3);
+	EXPECT_NE(std::find(tiles.begin(), tiles.end(), Tile_Id{ 3, 0, 7 }), tiles.end()); // square, south west corner
+	EXPECT_NE(std::find(tiles.begin(), tiles.end(), Tile_Id{ 3, 6, 6 }), tiles.end()); // point
+	EXPECT_EQ(std::find(tiles.begin(), tiles.end(), Tile_Id{ 3, 4, 2 }), tiles.end());
+
+	std::size_t calls = 0;
+	EXPECT_EQ(tiler.Generate([&](const Tile_Id&, std::string_view) { ++calls; return Error::FILE_WRITE_FAILED; }), Error::FILE_WRITE_FAILED);
+	EXPECT_EQ(calls, 1u);
+}
+
+TEST_F(Vector_Tile_Test, Generate_Follows_Geometry)
+{
+	// the bbox of the diagonal covers the 2^24 tiles of zoom 12, the line itself crosses about 2^12 of them
+	Vector_Tiler tiler(Planar_Options(12, 12));
+	tiler.Add_Feature(Make_Feature(Geometry{ Line_String{ { { 0, 0 }, { 100, 100 } } } }));
+
+	std::vector<Tile_Id> tiles;
+	ASSERT_EQ(tiler.Generate([&](const Tile_Id& tile, std::string_view bytes)
+	{
+		if (tiles.size() < 16)
+			EXPECT_EQ(bytes, tiler.Encode_Tile(tile));
+		tiles.push_back(tile);
+		return Error::NO_ERROR;
+	}), Error::NO_ERROR);
+
+	EXPECT_GE(tiles.size(), 4096u);
+	EXPECT_LE(tiles.size(), 3u * 4096u);
+	EXPECT_NE(std::find(tiles.begin(), tiles.end(), Tile_Id{ 12, 0, 4095 }), tiles.end());
+	EXPECT_NE(std::find(tiles.begin(), tiles.end(), Tile_Id{ 12, 2048, 2047 }), tiles.end());
+	EXPECT_EQ(std::find(tiles.begin(), tiles.end(), Tile_Id{ 12, 0, 0 }), tiles.end());
+	EXPECT_EQ(std::find(tiles.begin(), tiles.end(), Tile_Id{ 12, 4095, 4095 }), tiles.end());
+}
+
+TEST_F(Vector_Tile_Test, Feature_Parser_Sink)
+{
+	const std::string input = R"({"type":"FeatureCollection","features":[
+		{"type":"Feature","id":3,"geometry":{"type":"Point","coordinates":[80,20]},"properties":null},
+		{"type":"Feature","geometry":{"type":"Polygon","coordinates":[[[1,1],[11,1],[11,11],[1,11],[1,1]]]},"properties":{"name":"square"}}
+	]})";
+	Tiler_Sink sink(Planar_Options(0, 0));
+	rapidjson::StringStream in(input.c_str());
+	ASSERT_TRUE(rapidjson::Reader().Parse(in, sink));
+	ASSERT_EQ(sink.Size(), 2u);
+
+	const Decoded_Layer layer = Decode_Tile(sink.Encode_Tile({ 0, 0, 0 }));
+	ASSERT_EQ(layer.features.size(), 2u);
+	EXPECT_EQ(layer.features[0].id, 3u);
+	EXPECT_EQ(layer.features[0].type, 1u);
+	EXPECT_EQ(layer.features[1].type, 3u);
+	EXPECT_EQ(layer.keys, (std::vector<std::string>{ "name" }));
+}
+
+TEST_F(Vector_Tile_Test, Directory_And_Archive)
+{
+	Vector_Tiler tiler(Planar_Options(0, 4));
+	for (int i = 0; i < 50; ++i)
+	{
+		Feature feature = Make_Feature(Geometry{ Make_Square((i % 10) * 10 + 1, (i / 10) * 10 + 1, 8) });
+		feature.properties = Property(Property::Object{ { "number", Property(i) } });
+		tiler.Add_Feature(feature);
+	}
+
+	const auto directory = std::filesystem::temp_directory_path() / "ogeoflow_tiles";
+	std::filesystem::remove_all(directory);
+	ASSERT_EQ(tiler.Write_Directory(directory), Error::NO_ERROR);
+	auto read_file = [](const std::filesystem::path& path)
+	{
+		std::ifstream in(path, std::ios::binary);
+		return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	};
+	EXPECT_EQ(read_file(directory / "2" / "1" / "3.mvt"), tiler.Encode_Tile({ 2, 1, 3 }));
+
+	const auto path = std::filesystem::temp_directory_path() / "ogeoflow_tiles.ogftiles";
+	ASSERT_EQ(tiler.Write_Archive(path), Error::NO_ERROR);
+	auto reader = Tile_Archive_Reader::Open(path);
+	ASSERT_TRUE(reader.Has_Value());
+
+	std::size_t files = 0;
+	for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+		files += entry.is_regular_file();
+	ASSERT_EQ(reader.Value().Size(), files);
+	for (std::size_t i = 0; i < reader.Value().Size(); ++i)
+	{
+		const Tile_Id tile = reader.Value().Get_Tile_Id(i);
+		EXPECT_EQ(reader.Value().Get_Tile(tile), read_file(directory / std::to_string(tile.z) / std::to_string(tile.x) / (std::to_string(tile.y) + ".mvt")));
+	}
+	EXPECT_TRUE(reader.Value().Get_Tile({ 4, 15, 0 }).empty());
+	EXPECT_TRUE(reader.Value().Get_Tile({ 5, 0, 0 }).empty());
+}
+
+TEST_F(Vector_Tile_Test, Invalid_Archive)
+{
+	auto missing = Tile_Archive_Reader::Open(std::filesystem::temp_directory_path() / "ogeoflow_missing.ogftiles");
+	ASSERT_FALSE(missing.Has_Value());
+	EXPECT_EQ(missing.Error(), Error::FILE_OPENNING_FAILED);
+
+	const auto path = std::filesystem::temp_directory_path() / "ogeoflow_invalid.ogftiles";
+	{
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		out << "OGFTILES this is not an archive OGFTILES";
+	}
+	auto invalid = Tile_Archive_Reader::Open(path);
+	ASSERT_FALSE(invalid.Has_Value());
+	EXPECT_EQ(invalid.Error(), Error::INVALID_TILE_ARCHIVE);
+}
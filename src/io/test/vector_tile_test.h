@@ -0,0 +1,22 @@
+#ifndef SRC_IO_TEST_VECTOR_TILE_TEST_H
+#define SRC_IO_TEST_VECTOR_TILE_TEST_H
+
+#include <gtest/gtest.h>
+
+class Vector_Tile_Test : public ::testing::Test {};
+
+//////////////////////////////////////////////
+/// Nominal tests:
+/// 	- Point_Encoding
+/// 	- Polygon_Clipping_And_Winding
+/// 	- Line_Split_By_Clipping
+/// 	- Simplification_Per_Zoom
+/// 	- Generate_Zoom_Range
+/// 	- Generate_Follows_Geometry
+/// 	- Feature_Parser_Sink
+/// 	- Directory_And_Archive
+/// Error tests:
+/// 	- Invalid_Archive
+//////////////////////////////////////////////
+
+#endif //SRC_IO_TEST_VECTOR_TILE_TEST_H
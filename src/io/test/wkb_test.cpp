@@ -0,0 +1,188 @@
+#include "wkb_test.h"
+
+// STL
+#include <cmath>
+#include <memory>
+#include <string>
+
+// IO
+#include "io/wkb.h"
+
+using namespace O::GeoJSON;
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	std::string From_Hex(std::string_view hex)
+	{
+		std::string bytes;
+		for (std::size_t i = 0; i + 1 < hex.size(); i += 2)
+			bytes.push_back(static_cast<char>(std::stoi(std::string(hex.substr(i, 2)), nullptr, 16)));
+		return bytes;
+	}
+
+	Polygon Make_Square(double x, double y, double size)
+	{
+		return Polygon{ { { { x, y }, { x + size, y }, { x + size, y + size }, { x, y + size }, { x, y } } } };
+	}
+
+	std::vector<Geometry> Every_Geometry()
+	{
+		std::vector<Geometry> geometries;
+		geometries.push_back(Geometry{ Point{ { 1.5, -2.25 } } });
+		geometries.push_back(Geometry{ Multi_Point{ { { 0, 0 }, { 1, 1 } } } });
+		geometries.push_back(Geometry{ Line_String{ { { 0, 0 }, { 2, 1 }, { 3, 5 } } } });
+		geometries.push_back(Geometry{ Multi_Line_String{ { Line_String{ { { 0, 0 }, { 1, 0 } } }, Line_String{ { { 5, 5 }, { 6, 6 }, { 7, 5 } } } } } });
+		Polygon holed = Make_Square(0, 0, 10);
+		holed.rings.push_back(Make_Square(2, 2, 1).rings.front());
+		geometries.push_back(Geometry{ holed });
+		geometries.push_back(Geometry{ Multi_Polygon{ { Make_Square(20, 20, 1), holed } } });
+		Geometry_Collection collection;
+		collection.geometries.push_back(std::make_shared<Geometry>(Geometry{ Point{ { 8, 9 } } }));
+		collection.geometries.push_back(std::make_shared<Geometry>(Geometry{ Make_Square(-5, -5, 2) }));
+		geometries.push_back(Geometry{ collection });
+		return geometries;
+	}
+
+	Geometry Decode_WKB(std::string_view bytes)
+	{
+		std::size_t consumed = 0;
+		auto geometry = From_WKB(bytes, &consumed);
+		EXPECT_TRUE(geometry.Has_Value());
+		EXPECT_EQ(consumed, bytes.size());
+		return std::move(geometry.Value());
+	}
+}
+
+TEST_F(WKB_Test, Point_Bytes)
+{
+	EXPECT_EQ(To_WKB(Geometry{ Point{ { 1, 2 } } }), From_Hex("0101000000000000000000F03F0000000000000040"));
+	EXPECT_EQ(To_WKB(Geometry{ Point{ { 1, 2, 3.0 } } }), From_Hex("01E9030000000000000000F03F00000000000000400000000000000840"));
+}
+
+TEST_F(WKB_Test, Round_Trip_Every_Geometry)
+{
+	for (const Geometry& geometry : Every_Geometry())
+	{
+		const std::string bytes = To_WKB(geometry);
+		const Geometry decoded = Decode_WKB(bytes);
+		EXPECT_EQ(decoded.value.index(), geometry.value.index());
+		EXPECT_EQ(To_WKB(decoded), bytes);
+	}
+	const Geometry polygon = Decode_WKB(To_WKB(Every_Geometry()[4]));
+	ASSERT_EQ(polygon.Get_Polygon().rings.size(), 2u);
+	EXPECT_EQ(polygon.Get_Polygon().rings[1][2].longitude, 3);
+	EXPECT_EQ(polygon.Get_Polygon().rings[1][2].latitude, 3);
+}
+
+TEST_F(WKB_Test, Altitude_Round_Trip)
+{
+	const Geometry line{ Line_String{ { { 0, 0, 10.0 }, { 2, 1 }, { 3, 5, -1.0 } } } };
+	const std::string bytes = To_WKB(line);
+	EXPECT_EQ(static_cast<unsigned char>(bytes[1]), 0xEA); // 1002, LineString Z
+	const Geometry decoded = Decode_WKB(bytes);
+	const auto& positions = decoded.Get_Line_String().positions;
+	ASSERT_EQ(positions.size(), 3u);
+	EXPECT_EQ(positions[0].altitude, 10.0);
+	EXPECT_FALSE(positions[1].altitude);
+	EXPECT_EQ(positions[2].altitude, -1.0);
+}
+
+TEST_F(WKB_Test, Big_Endian_And_EWKB)
+{
+	const Geometry big_endian = Decode_WKB(From_Hex("00000000013FF00000000000004000000000000000"));
+	EXPECT_EQ(big_endian.Get_Point().position.longitude, 1);
+	EXPECT_EQ(big_endian.Get_Point().position.latitude, 2);
+
+	// SRID=4326;POINT ZM(1 2 3 4), the measure is dropped
+	const Geometry ewkb = Decode_WKB(From_Hex("01010000E0E6100000000000000000F03F000000000000004000000000000008400000000000001040"));
+	EXPECT_EQ(ewkb.Get_Point().position.longitude, 1);
+	EXPECT_EQ(ewkb.Get_Point().position.latitude, 2);
+	EXPECT_EQ(ewkb.Get_Point().position.altitude, 3.0);
+}
+
+TEST_F(WKB_Test, TWKB_Point_Bytes)
+{
+	// POINT(1 2) at precision 0: header, metadata and the zigzag varint of each coordinate
+	EXPECT_EQ(To_TWKB(Geometry{ Point{ { 1, 2 } } }, 0), From_Hex("01000204"));
+	// LINESTRING(0 0,1 1,3 1) at precision 1, deltas of the previous point
+	EXPECT_EQ(To_TWKB(Geometry{ Line_String{ { { 0, 0 }, { 1, 1 }, { 3, 1 } } } }, 1), From_Hex("220003000014142800"));
+}
+
+TEST_F(WKB_Test, TWKB_Round_Trip_At_Precision)
+{
+	for (const Geometry& geometry : Every_Geometry())
+	{
+		const std::string bytes = To_TWKB(geometry, 2);
+		std::size_t consumed = 0;
+		auto decoded = From_TWKB(bytes, &consumed);
+		ASSERT_TRUE(decoded.Has_Value());
+		EXPECT_EQ(consumed, bytes.size());
+		EXPECT_EQ(To_WKB(decoded.Value()), To_WKB(geometry));
+	}
+
+	const Geometry line{ Line_String{ { { 0.123456, 10.987654, 1.25 }, { -3.5, 4.0, 2.5 } } } };
+	auto decoded = From_TWKB(To_TWKB(line, 3));
+	ASSERT_TRUE(decoded.Has_Value());
+	const auto& positions = decoded.Value().Get_Line_String().positions;
+	ASSERT_EQ(positions.size(), 2u);
+	EXPECT_DOUBLE_EQ(positions[0].longitude, 0.123);
+	EXPECT_DOUBLE_EQ(positions[0].latitude, 10.988);
+	EXPECT_DOUBLE_EQ(*positions[0].altitude, 1.25);
+	EXPECT_DOUBLE_EQ(positions[1].longitude, -3.5);
+}
+
+TEST_F(WKB_Test, Collection_Buffer_Offsets)
+{
+	Feature_Collection collection;
+	for (Geometry& geometry : Every_Geometry())
+	{
+		Feature feature;
+		feature.geometry = std::move(geometry);
+		collection.features.push_back(std::move(feature));
+	}
+	collection.features.insert(collection.features.begin() + 2, Feature{});
+
+	const Geometry_Buffer buffer = Encode_WKB(collection);
+	ASSERT_EQ(buffer.Size(), collection.features.size());
+	EXPECT_EQ(buffer.offsets.front(), 0u);
+	EXPECT_EQ(buffer.offsets.back(), buffer.data.size());
+	EXPECT_TRUE(buffer[2].empty());
+	for (std::size_t i = 0; i < collection.features.size(); ++i)
+	{
+		if (collection.features[i].geometry)
+		{
+			EXPECT_EQ(buffer[i], To_WKB(*collection.features[i].geometry));
+		}
+	}
+
+	const Geometry_Buffer tiny = Encode_TWKB(collection, 0);
+	ASSERT_EQ(tiny.Size(), collection.features.size());
+	EXPECT_LT(tiny.data.size(), buffer.data.size());
+	EXPECT_EQ(tiny[0], To_TWKB(*collection.features[0].geometry, 0));
+}
+
+TEST_F(WKB_Test, Truncated_Input)
+{
+	const std::string bytes = To_WKB(Every_Geometry()[5]);
+	for (std::size_t size = 0; size < bytes.size(); ++size)
+	{
+		auto geometry = From_WKB(std::string_view(bytes).substr(0, size));
+		ASSERT_FALSE(geometry.Has_Value());
+		EXPECT_EQ(geometry.Error(), Error::INVALID_WKB);
+	}
+	const std::string tiny = To_TWKB(Every_Geometry()[5]);
+	for (std::size_t size = 0; size < tiny.size(); ++size)
+		EXPECT_FALSE(From_TWKB(std::string_view(tiny).substr(0, size)).Has_Value());
+}
+
+TEST_F(WKB_Test, Unknown_Type)
+{
+	auto geometry = From_WKB(From_Hex("0108000000000000000000F03F0000000000000040"));
+	ASSERT_FALSE(geometry.Has_Value());
+	EXPECT_EQ(geometry.Error(), Error::INVALID_WKB);
+
+	// a multi point holding a line string
+	auto mixed = From_WKB(From_Hex("01040000000100000001020000000000000000000000"));
+	EXPECT_FALSE(mixed.Has_Value());
+}
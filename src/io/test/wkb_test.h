@@ -0,0 +1,22 @@
+#ifndef SRC_IO_TEST_WKB_TEST_H
+#define SRC_IO_TEST_WKB_TEST_H
+
+#include <gtest/gtest.h>
+
+class WKB_Test : public ::testing::Test {};
+
+//////////////////////////////////////////////
+/// Nominal tests:
+/// 	- Point_Bytes
+/// 	- Round_Trip_Every_Geometry
+/// 	- Altitude_Round_Trip
+/// 	- Big_Endian_And_EWKB
+/// 	- TWKB_Point_Bytes
+/// 	- TWKB_Round_Trip_At_Precision
+/// 	- Collection_Buffer_Offsets
+/// Error tests:
+/// 	- Truncated_Input
+/// 	- Unknown_Type
+//////////////////////////////////////////////
+
+#endif //SRC_IO_TEST_WKB_TEST_H
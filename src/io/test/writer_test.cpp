@@ -8,6 +8,8 @@
 
 #include <rapidjson/ostreamwrapper.h>
 
+#include "io/feature_parser.h"
+#include "io/parser.h"
 #include "io/writer.h"
 #include "geojson/root.h"
 #include "geojson/object/feature.h"
@@ -26,6 +28,17 @@ static std::string SerializeToString(const O::GeoJSON::Root& obj)
 	return ss.str();
 }
 
+// parser forwarding every feature to a streaming writer
+struct Feature_Sink : public O::GeoJSON::IO::Feature_Parser<Feature_Sink>
+{
+	Feature_Sink(O::GeoJSON::IO::Writer<rapidjson::OStreamWrapper>& writer) : writer(writer) {}
+
+	O::GeoJSON::IO::Writer<rapidjson::OStreamWrapper>& writer;
+
+	bool On_Full_Feature(O::GeoJSON::Feature&& f) { return writer.On_Full_Feature(std::move(f)); }
+	bool On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id) { return writer.On_Root(std::move(bbox), std::move(id)); }
+};
+
 TEST(Writer_Test, FeaturePointSimple)
 {
 	// Build Feature with Point + properties + id
@@ -85,4 +98,104 @@ TEST(Writer_Test, FeatureCollectionSingleFeature)
 		R"({"type":"FeatureCollection","features":[{"type":"Feature","id":"london-1","geometry":{"type":"Point","coordinates":[-0.1276,51.5074]},"properties":{"city":"London"}}]})";
 
 	ASSERT_EQ(out, expected);
-}
\ No newline at end of file
+}
+
+TEST(Writer_Test, Streaming_Feature_Collection)
+{
+	std::stringstream ss;
+	rapidjson::OStreamWrapper osw(ss);
+	O::GeoJSON::IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+
+	writer.Begin_Feature_Collection(std::nullopt, O::GeoJSON::Id("root"));
+	EXPECT_TRUE(writer.Is_Streaming());
+	for (int i = 0; i < 2; ++i)
+	{
+		O::GeoJSON::Feature feat;
+		feat.id = i;
+		feat.properties = O::GeoJSON::Property(O::GeoJSON::Property::Object{});
+		writer.Append_Feature(feat);
+	}
+	writer.End_Feature_Collection(O::GeoJSON::Bbox{std::array<double, 4>{0.0, 1.0, 2.0, 3.0}});
+	EXPECT_FALSE(writer.Is_Streaming());
+
+	const std::string expected =
+		R"({"type":"FeatureCollection","id":"root","features":[{"type":"Feature","id":0,"geometry":null,"properties":{}},{"type":"Feature","id":1,"geometry":null,"properties":{}}],"bbox":[0.0,1.0,2.0,3.0]})";
+	ASSERT_EQ(ss.str(), expected);
+	EXPECT_TRUE(writer.IsComplete());
+}
+
+TEST(Writer_Test, Streaming_Empty_Sink_Writes_Empty_Collection)
+{
+	std::stringstream ss;
+	rapidjson::OStreamWrapper osw(ss);
+	O::GeoJSON::IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+
+	EXPECT_TRUE(writer.On_Root(std::nullopt, O::GeoJSON::Id()));
+	ASSERT_EQ(ss.str(), R"({"type":"FeatureCollection","features":[]})");
+}
+
+TEST(Writer_Test, Streaming_Bbox_After_Features_Round_Trip)
+{
+	std::stringstream ss;
+	rapidjson::OStreamWrapper osw(ss);
+	O::GeoJSON::IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+
+	O::GeoJSON::Feature feat;
+	feat.geometry = O::GeoJSON::Geometry{};
+	feat.geometry->value = O::GeoJSON::Polygon{ { { { 0, 0 }, { 4, 0 }, { 4, 4 }, { 0, 0 } } } };
+	writer.Begin_Feature_Collection();
+	writer.Append_Feature(feat);
+	writer.End_Feature_Collection(O::GeoJSON::Bbox{std::array<double, 4>{0.0, 0.0, 4.0, 4.0}});
+
+	auto result = O::GeoJSON::IO::Parse_Geojson_String(ss.str());
+	ASSERT_TRUE(result.Has_Value());
+	const auto& fc = result.Value().Get_Feature_Collection();
+	ASSERT_EQ(fc.features.size(), 1u);
+	ASSERT_TRUE(fc.bbox.has_value());
+	EXPECT_EQ(fc.bbox->Get()[2], 4.0);
+}
+
+TEST(Writer_Test, Streaming_Single_Feature_Root)
+{
+	const std::string input = R"({"type":"Feature","id":"solo","geometry":{"type":"Point","coordinates":[1.0,2.0]},"properties":null})";
+
+	std::stringstream ss;
+	rapidjson::OStreamWrapper osw(ss);
+	O::GeoJSON::IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+	Feature_Sink sink(writer);
+	rapidjson::StringStream in(input.c_str());
+	ASSERT_TRUE(rapidjson::Reader().Parse(in, sink));
+
+	// a Feature root never reaches On_Root, the collection stays open until Finish is called
+	EXPECT_TRUE(writer.Is_Streaming());
+	EXPECT_FALSE(writer.IsComplete());
+	EXPECT_FALSE(O::GeoJSON::IO::Parse_Geojson_String(ss.str()).Has_Value());
+	writer.Finish();
+	EXPECT_FALSE(writer.Is_Streaming());
+	EXPECT_TRUE(writer.IsComplete());
+
+	auto result = O::GeoJSON::IO::Parse_Geojson_String(ss.str());
+	ASSERT_TRUE(result.Has_Value());
+	const auto& fc = result.Value().Get_Feature_Collection();
+	ASSERT_EQ(fc.features.size(), 1u);
+	EXPECT_EQ(fc.features[0].id, O::GeoJSON::Id("solo"));
+	EXPECT_DOUBLE_EQ(fc.features[0].geometry->Get_Point().position.latitude, 2.0);
+
+	// nothing more is written once closed
+	writer.Finish();
+	EXPECT_EQ(ss.str().back(), '}');
+}
+
+TEST(Writer_Test, Streaming_Destructor_Does_Not_Close)
+{
+	std::stringstream ss;
+	{
+		rapidjson::OStreamWrapper osw(ss);
+		O::GeoJSON::IO::Writer<rapidjson::OStreamWrapper> writer(osw);
+		writer.Begin_Feature_Collection();
+		O::GeoJSON::Feature feature;
+		writer.Append_Feature(feature);
+	}
+	// an interrupted stream is left truncated instead of being closed as a valid collection
+	EXPECT_FALSE(O::GeoJSON::IO::Parse_Geojson_String(ss.str()).Has_Value());
+}
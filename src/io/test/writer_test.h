@@ -11,6 +11,11 @@ class Writer_Test : public ::testing::Test {};
 /// 	- Root_Is_Feature_Basic
 /// 	- Feature_With_Id_And_BBox
 /// 	- Feature_Collection_With_BBox
+/// 	- Streaming_Feature_Collection
+/// 	- Streaming_Empty_Sink_Writes_Empty_Collection
+/// 	- Streaming_Bbox_After_Features_Round_Trip
+/// 	- Streaming_Single_Feature_Root
+/// 	- Streaming_Destructor_Does_Not_Close
 /// Error tests:
 /// 	- Root_With_Wrong_Type_String_Fails
 //////////////////////////////////////////////
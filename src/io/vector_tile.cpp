@@ -0,0 +1,910 @@
+#include "io/vector_tile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <numbers>
+#include <numeric>
+#include <thread>
+
+#include <rapidjson/stringbuffer.h>
+
+#include "io/writer.h"
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	/// @brief Web Mercator latitude limit, the pyramid is then square
+	constexpr double MAX_LATITUDE = 85.05112877980659;
+
+	/// @brief first and last bytes of a tile archive
+	constexpr char ARCHIVE_MAGIC[8] = { 'O', 'G', 'F', 'T', 'I', 'L', 'E', 'S' };
+	constexpr std::size_t ARCHIVE_ENTRY_SIZE = 3 * sizeof(std::uint64_t);
+	constexpr std::size_t ARCHIVE_FOOTER_SIZE = 2 * sizeof(std::uint64_t) + sizeof(ARCHIVE_MAGIC);
+
+	/// @name MVT geometry commands
+	/// @{
+	constexpr std::uint32_t MOVE_TO = 1;
+	constexpr std::uint32_t LINE_TO = 2;
+	constexpr std::uint32_t CLOSE_PATH = 7;
+	/// @}
+
+	/// @name protobuf wire types
+	/// @{
+	constexpr std::uint32_t WIRE_VARINT = 0;
+	constexpr std::uint32_t WIRE_FIXED64 = 1;
+	constexpr std::uint32_t WIRE_BYTES = 2;
+	/// @}
+
+	using World_Point = std::array<double, 2>;
+	using Tile_Point = std::array<std::int64_t, 2>;
+
+	std::uint64_t Tile_Key(const Tile_Id& tile)
+	{
+		return (static_cast<std::uint64_t>(tile.z) << 58) | (static_cast<std::uint64_t>(tile.x) << 29) | tile.y;
+	}
+
+	/**
+	 * @brief call ``function(i)`` for every ``i < count`` on several threads
+	 * @note the first exception stops the workers and is rethrown
+	 */
+	template<class Function>
+	void Parallel_For(std::size_t count, std::size_t thread_count, Function&& function)
+	{
+		if (thread_count == 0)
+			thread_count = std::max(1u, std::thread::hardware_concurrency());
+		thread_count = std::min(thread_count, count);
+		if (thread_count <= 1)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+				function(i);
+			return;
+		}
+
+		std::atomic<std::size_t> next = 0;
+		std::mutex mutex;
+		std::exception_ptr error;
+		auto worker = [&]()
+		{
+			for (std::size_t i = next++; i < count; i = next++)
+			{
+				try
+				{
+					function(i);
+				}
+				catch (...)
+				{
+					std::lock_guard lock(mutex);
+					if (!error)
+						error = std::current_exception();
+					next = count;
+					return;
+				}
+			}
+		};
+
+		std::vector<std::thread> workers;
+		workers.reserve(thread_count);
+		for (std::size_t i = 0; i < thread_count; ++i)
+			workers.emplace_back(worker);
+		for (std::thread& thread : workers)
+			thread.join();
+		if (error)
+			std::rethrow_exception(error);
+	}
+
+	//------------------------------------------------------------------
+	// Geometry processing
+
+	double Square_Segment_Distance(const World_Point& p, const World_Point& a, const World_Point& b)
+	{
+		double x = a[0], y = a[1];
+		const double dx = b[0] - x, dy = b[1] - y;
+		if (dx != 0 || dy != 0)
+		{
+			const double t = ((p[0] - x) * dx + (p[1] - y) * dy) / (dx * dx + dy * dy);
+			if (t > 1)      { x = b[0]; y = b[1]; }
+			else if (t > 0) { x += dx * t; y += dy * t; }
+		}
+		return (p[0] - x) * (p[0] - x) + (p[1] - y) * (p[1] - y);
+	}
+
+	/// @brief Douglas-Peucker simplification keeping both ends
+	std::vector<World_Point> Douglas_Peucker(const std::vector<World_Point>& points, double square_tolerance)
+	{
+		if (points.size() <= 2 || square_tolerance <= 0)
+			return points;
+
+		std::vector<bool> keep(points.size(), false);
+		keep.front() = keep.back() = true;
+		std::vector<std::pair<std::size_t, std::size_t>> stack = { { 0, points.size() - 1 } };
+		while (!stack.empty())
+		{
+			const auto [first, last] = stack.back();
+			stack.pop_back();
+			double max_distance = square_tolerance;
+			std::size_t farthest = first;
+			for (std::size_t i = first + 1; i < last; ++i)
+				if (double distance = Square_Segment_Distance(points[i], points[first], points[last]); distance > max_distance)
+				{
+					max_distance = distance;
+					farthest = i;
+				}
+			if (farthest != first)
+			{
+				keep[farthest] = true;
+				stack.emplace_back(first, farthest);
+				stack.emplace_back(farthest, last);
+			}
+		}
+
+		std::vector<World_Point> simplified;
+		for (std::size_t i = 0; i < points.size(); ++i)
+			if (keep[i])
+				simplified.push_back(points[i]);
+		return simplified;
+	}
+
+	/// @brief Sutherland-Hodgman clipping of an open ring against one side of the clip box
+	template<class Inside, class Intersect>
+	std::vector<World_Point> Clip_Side(const std::vector<World_Point>& ring, Inside&& inside, Intersect&& intersect)
+	{
+		std::vector<World_Point> clipped;
+		if (ring.empty())
+			return clipped;
+		World_Point previous = ring.back();
+		bool previous_inside = inside(previous);
+		for (const World_Point& point : ring)
+		{
+			const bool point_inside = inside(point);
+			if (point_inside != previous_inside)
+				clipped.push_back(intersect(previous, point));
+			if (point_inside)
+				clipped.push_back(point);
+			previous = point;
+			previous_inside = point_inside;
+		}
+		return clipped;
+	}
+
+	/// @brief clip an open ring to ``[low, high]²``
+	std::vector<World_Point> Clip_Ring(std::vector<World_Point> ring, double low, double high)
+	{
+		auto at_x = [](double x) { return [x](const World_Point& a, const World_Point& b) { return World_Point{ x, a[1] + (b[1] - a[1]) * (x - a[0]) / (b[0] - a[0]) }; }; };
+		auto at_y = [](double y) { return [y](const World_Point& a, const World_Point& b) { return World_Point{ a[0] + (b[0] - a[0]) * (y - a[1]) / (b[1] - a[1]), y }; }; };
+		ring = Clip_Side(ring, [low](const World_Point& p) { return p[0] >= low; }, at_x(low));
+		ring = Clip_Side(ring, [high](const World_Point& p) { return p[0] <= high; }, at_x(high));
+		ring = Clip_Side(ring, [low](const World_Point& p) { return p[1] >= low; }, at_y(low));
+		ring = Clip_Side(ring, [high](const World_Point& p) { return p[1] <= high; }, at_y(high));
+		return ring;
+	}
+
+	/// @brief clip a line to ``[low, high]²``, a line leaving and entering the box again is split
+	std::vector<std::vector<World_Point>> Clip_Line(const std::vector<World_Point>& line, double low, double high)
+	{
+		std::vector<std::vector<World_Point>> parts;
+		std::vector<World_Point> current;
+		for (std::size_t i = 1; i < line.size(); ++i)
+		{
+			// Liang-Barsky
+			const World_Point& a = line[i - 1];
+			const World_Point& b = line[i];
+			const double d[2] = { b[0] - a[0], b[1] - a[1] };
+			double t0 = 0, t1 = 1;
+			bool visible = true;
+			for (int axis = 0; axis < 2 && visible; ++axis)
+			{
+				const double p[2] = { -d[axis], d[axis] };
+				const double q[2] = { a[axis] - low, high - a[axis] };
+				for (int side = 0; side < 2 && visible; ++side)
+				{
+					if (p[side] == 0)
+						visible = q[side] >= 0;
+					else if (const double t = q[side] / p[side]; p[side] < 0)
+						t0 = std::max(t0, t);
+					else
+						t1 = std::min(t1, t);
+				}
+			}
+			if (!visible || t0 > t1)
+			{
+				if (current.size() > 1)
+					parts.push_back(std::move(current));
+				current.clear();
+				continue;
+			}
+			if (current.empty())
+				current.push_back({ a[0] + t0 * d[0], a[1] + t0 * d[1] });
+			current.push_back({ a[0] + t1 * d[0], a[1] + t1 * d[1] });
+			if (t1 < 1)
+			{
+				parts.push_back(std::move(current));
+				current.clear();
+			}
+		}
+		if (current.size() > 1)
+			parts.push_back(std::move(current));
+		return parts;
+	}
+
+	/// @brief round to tile units and drop repeated points
+	std::vector<Tile_Point> Quantize(const std::vector<World_Point>& points)
+	{
+		std::vector<Tile_Point> quantized;
+		quantized.reserve(points.size());
+		for (const World_Point& point : points)
+		{
+			const Tile_Point rounded = { std::llround(point[0]), std::llround(point[1]) };
+			if (quantized.empty() || quantized.back() != rounded)
+				quantized.push_back(rounded);
+		}
+		return quantized;
+	}
+
+	/// @brief twice the signed area, positive for the MVT exterior ring winding (clockwise with ``y`` down)
+	std::int64_t Double_Area(const std::vector<Tile_Point>& ring)
+	{
+		std::int64_t area = 0;
+		for (std::size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++)
+			area += ring[j][0] * ring[i][1] - ring[i][0] * ring[j][1];
+		return area;
+	}
+
+	//------------------------------------------------------------------
+	// Protobuf
+
+	void Put_Varint(std::string& out, std::uint64_t value)
+	{
+		while (value >= 0x80)
+		{
+			out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+			value >>= 7;
+		}
+		out.push_back(static_cast<char>(value));
+	}
+
+	void Put_Key(std::string& out, std::uint32_t field, std::uint32_t wire_type)
+	{
+		Put_Varint(out, (field << 3) | wire_type);
+	}
+
+	void Put_Varint_Field(std::string& out, std::uint32_t field, std::uint64_t value)
+	{
+		Put_Key(out, field, WIRE_VARINT);
+		Put_Varint(out, value);
+	}
+
+	void Put_Bytes_Field(std::string& out, std::uint32_t field, std::string_view bytes)
+	{
+		Put_Key(out, field, WIRE_BYTES);
+		Put_Varint(out, bytes.size());
+		out.append(bytes);
+	}
+
+	void Put_Packed_Field(std::string& out, std::uint32_t field, const std::vector<std::uint32_t>& values)
+	{
+		std::string packed;
+		for (std::uint32_t value : values)
+			Put_Varint(packed, value);
+		Put_Bytes_Field(out, field, packed);
+	}
+
+	std::uint32_t Zigzag(std::int64_t value)
+	{
+		return static_cast<std::uint32_t>((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+	}
+
+	/**
+	 * @brief MVT geometry command stream, the cursor is kept across parts
+	 */
+	class Command_Encoder
+	{
+	public:
+		void Move_To(const std::vector<Tile_Point>& points, std::size_t first, std::size_t count)
+		{
+			Command(MOVE_TO, count);
+			for (std::size_t i = first; i < first + count; ++i)
+				Point(points[i]);
+		}
+
+		void Line_To(const std::vector<Tile_Point>& points, std::size_t first)
+		{
+			Command(LINE_TO, points.size() - first);
+			for (std::size_t i = first; i < points.size(); ++i)
+				Point(points[i]);
+		}
+
+		void Close_Path() { Command(CLOSE_PATH, 1); }
+
+		const std::vector<std::uint32_t>& Get_Commands() const { return m_commands; }
+
+	private:
+		void Command(std::uint32_t id, std::size_t count) { m_commands.push_back(id | static_cast<std::uint32_t>(count << 3)); }
+
+		void Point(const Tile_Point& point)
+		{
+			m_commands.push_back(Zigzag(point[0] - m_cursor[0]));
+			m_commands.push_back(Zigzag(point[1] - m_cursor[1]));
+			m_cursor = point;
+		}
+
+		std::vector<std::uint32_t> m_commands;
+		Tile_Point m_cursor = { 0, 0 };
+	};
+
+	std::string Encode_Value(const std::variant<std::string, double, std::int64_t, bool>& value)
+	{
+		std::string out;
+		std::visit([&out](const auto& v)
+		{
+			using T = std::decay_t<decltype(v)>;
+			if constexpr (std::is_same_v<T, std::string>)
+				Put_Bytes_Field(out, 1, v);
+			else if constexpr (std::is_same_v<T, double>)
+			{
+				Put_Key(out, 3, WIRE_FIXED64);
+				char bytes[sizeof(double)];
+				std::memcpy(bytes, &v, sizeof(double));
+				out.append(bytes, sizeof(double));
+			}
+			else if constexpr (std::is_same_v<T, std::int64_t>)
+				Put_Varint_Field(out, 6, (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63));
+			else
+				Put_Varint_Field(out, 7, v ? 1 : 0);
+		}, value);
+		return out;
+	}
+
+	template<class T>
+	void Write_Little_Endian(std::ofstream& out, T value)
+	{
+		out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+}
+
+//------------------------------------------------------------------
+// Vector_Tiler
+
+Vector_Tiler::Vector_Tiler(Tiler_Options options) :
+	m_options(std::move(options))
+{
+	m_options.max_zoom = std::min(m_options.max_zoom, MAX_TILE_ZOOM);
+	m_options.extent = std::max<std::uint32_t>(m_options.extent, 1);
+}
+
+Vector_Tiler::World_Point Vector_Tiler::Project(const O::GeoJSON::Position& position) const
+{
+	if (m_options.bounds)
+	{
+		const auto& bounds = *m_options.bounds;
+		double size = std::max(bounds[2] - bounds[0], bounds[3] - bounds[1]);
+		if (size <= 0)
+			size = 1;
+		return { (position.longitude - bounds[0]) / size, (bounds[3] - position.latitude) / size };
+	}
+	const double sin_latitude = std::sin(std::clamp(position.latitude, -MAX_LATITUDE, MAX_LATITUDE) * std::numbers::pi / 180);
+	return { position.longitude / 360 + 0.5, 0.5 - 0.25 * std::log((1 + sin_latitude) / (1 - sin_latitude)) / std::numbers::pi };
+}
+
+std::uint32_t Vector_Tiler::Key_Index(const std::string& key)
+{
+	auto [it, inserted] = m_key_ids.try_emplace(key, static_cast<std::uint32_t>(m_keys.size()));
+	if (inserted)
+		m_keys.push_back(key);
+	return it->second;
+}
+
+std::uint32_t Vector_Tiler::Value_Index(Value&& value)
+{
+	auto it = m_value_ids.find(value);
+	if (it != m_value_ids.end())
+		return it->second;
+	const auto index = static_cast<std::uint32_t>(m_values.size());
+	m_value_ids.emplace(value, index);
+	m_values.push_back(std::move(value));
+	return index;
+}
+
+void Vector_Tiler::Add_Feature(const O::GeoJSON::Feature& feature)
+{
+	if (!feature.geometry)
+		return;
+
+	std::optional<std::uint64_t> id;
+	if (feature.id.Is_Integer() && feature.id.Get_Integer() >= 0)
+		id = static_cast<std::uint64_t>(feature.id.Get_Integer());
+
+	std::vector<std::uint32_t> tags;
+	if (feature.properties.Is_Object())
+		for (const auto& [key, property] : feature.properties.Get_Object())
+		{
+			Value value;
+			if (property.Is_Null())
+				continue;
+			else if (property.Is_String())
+				value = std::string(property.Get_String());
+			else if (property.Is_Bool())
+				value = property.Get_Bool();
+			else if (property.Is_Integer())
+				value = static_cast<std::int64_t>(property.Get_Int());
+			else if (property.Is_Double())
+				value = property.Get_Double();
+			else
+			{
+				rapidjson::StringBuffer buffer;
+				Writer<rapidjson::StringBuffer> writer(buffer);
+				writer.Write_Property_Value(property);
+				value = std::string(buffer.GetString(), buffer.GetSize());
+			}
+			tags.push_back(Key_Index(key));
+			tags.push_back(Value_Index(std::move(value)));
+		}
+
+	Add_Geometry(*feature.geometry, id, tags);
+}
+
+void Vector_Tiler::Add_Geometry(const O::GeoJSON::Geometry& geometry, const std::optional<std::uint64_t>& id, const std::vector<std::uint32_t>& tags)
+{
+	if (geometry.Is_Geometry_Collection())
+	{
+		for (const auto& child : geometry.Get_Geometry_Collection().geometries)
+			if (child)
+				Add_Geometry(*child, id, tags);
+		return;
+	}
+
+	Tile_Feature feature;
+	auto project = [this](const std::vector<O::GeoJSON::Position>& positions)
+	{
+		std::vector<World_Point> points;
+		points.reserve(positions.size());
+		for (const auto& position : positions)
+			points.push_back(Project(position));
+		return points;
+	};
+	auto add_polygon = [&](const O::GeoJSON::Polygon& polygon)
+	{
+		for (std::size_t i = 0; i < polygon.rings.size(); ++i)
+		{
+			feature.parts.push_back(project(polygon.rings[i]));
+			feature.outer.push_back(i == 0);
+		}
+	};
+
+	if (geometry.Is_Point())
+		feature.parts.push_back({ Project(geometry.Get_Point().position) });
+	else if (geometry.Is_Multi_Point())
+		feature.parts.push_back(project(geometry.Get_Multi_Point().points));
+	else if (geometry.Is_Line_String())
+	{
+		feature.kind = Kind::LINE_STRING;
+		feature.parts.push_back(project(geometry.Get_Line_String().positions));
+	}
+	else if (geometry.Is_Multi_Line_String())
+	{
+		feature.kind = Kind::LINE_STRING;
+		for (const auto& line : geometry.Get_Multi_Line_String().line_strings)
+			feature.parts.push_back(project(line.positions));
+	}
+	else if (geometry.Is_Polygon())
+	{
+		feature.kind = Kind::POLYGON;
+		add_polygon(geometry.Get_Polygon());
+	}
+	else
+	{
+		feature.kind = Kind::POLYGON;
+		for (const auto& polygon : geometry.Get_Multi_Polygon().polygons)
+			add_polygon(polygon);
+	}
+
+	feature.bbox = { std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest() };
+	for (const auto& part : feature.parts)
+		for (const World_Point& point : part)
+		{
+			feature.bbox[0] = std::min(feature.bbox[0], point[0]);
+			feature.bbox[1] = std::min(feature.bbox[1], point[1]);
+			feature.bbox[2] = std::max(feature.bbox[2], point[0]);
+			feature.bbox[3] = std::max(feature.bbox[3], point[1]);
+		}
+	if (feature.bbox[0] > feature.bbox[2])
+		return;
+	feature.id = id;
+	feature.tags = tags;
+	m_features.push_back(std::move(feature));
+}
+
+std::vector<Vector_Tiler::Tile_Feature> Vector_Tiler::Simplify(std::uint8_t z, const std::vector<std::uint32_t>& selection) const
+{
+	const double tolerance = m_options.tolerance / (static_cast<double>(m_options.extent) * std::ldexp(1.0, z));
+	const double square_tolerance = tolerance * tolerance;
+
+	std::vector<Tile_Feature> simplified(selection.size());
+	Parallel_For(selection.size(), m_options.thread_count, [&](std::size_t i)
+	{
+		const Tile_Feature& feature = m_features[selection[i]];
+		Tile_Feature& result = simplified[i];
+		result.kind = feature.kind;
+		result.bbox = feature.bbox;
+		result.id = feature.id;
+		result.tags = feature.tags;
+		if (feature.kind == Kind::POINT)
+		{
+			result.parts = feature.parts;
+			return;
+		}
+
+		// rings of a dropped outer ring are dropped with it
+		bool polygon_kept = false;
+		for (std::size_t part = 0; part < feature.parts.size(); ++part)
+		{
+			const bool outer = feature.kind == Kind::POLYGON && feature.outer[part];
+			if (feature.kind == Kind::POLYGON && !outer && !polygon_kept)
+				continue;
+			std::vector<World_Point> points = Douglas_Peucker(feature.parts[part], square_tolerance);
+			const std::size_t minimum = feature.kind == Kind::POLYGON ? 4 : 2;
+			if (outer)
+				polygon_kept = points.size() >= minimum;
+			if (points.size() < minimum)
+				continue;
+			result.parts.push_back(std::move(points));
+			if (feature.kind == Kind::POLYGON)
+				result.outer.push_back(outer);
+		}
+	});
+	return simplified;
+}
+
+std::string Vector_Tiler::Encode(const Tile_Id& tile, const std::vector<Tile_Feature>& features, const std::vector<std::uint32_t>& selection) const
+{
+	const double scale = static_cast<double>(m_options.extent) * std::ldexp(1.0, tile.z);
+	const double origin[2] = { static_cast<double>(tile.x) * m_options.extent, static_cast<double>(tile.y) * m_options.extent };
+	const double low = -static_cast<double>(m_options.buffer);
+	const double high = static_cast<double>(m_options.extent) + m_options.buffer;
+	auto to_tile = [&](const std::vector<World_Point>& points)
+	{
+		std::vector<World_Point> transformed;
+		transformed.reserve(points.size());
+		for (const World_Point& point : points)
+			transformed.push_back({ point[0] * scale - origin[0], point[1] * scale - origin[1] });
+		return transformed;
+	};
+
+	std::vector<std::string> encoded_features;
+	std::vector<std::uint32_t> local_keys;
+	std::vector<std::uint32_t> local_values;
+	std::unordered_map<std::uint32_t, std::uint32_t> key_map;
+	std::unordered_map<std::uint32_t, std::uint32_t> value_map;
+
+	for (std::uint32_t index : selection)
+	{
+		const Tile_Feature& feature = features[index];
+		Command_Encoder commands;
+
+		if (feature.kind == Kind::POINT)
+		{
+			std::vector<Tile_Point> points;
+			for (const World_Point& point : to_tile(feature.parts.front()))
+				if (point[0] >= low && point[0] <= high && point[1] >= low && point[1] <= high)
+					points.push_back({ std::llround(point[0]), std::llround(point[1]) });
+			if (!points.empty())
+				commands.Move_To(points, 0, points.size());
+		}
+		else if (feature.kind == Kind::LINE_STRING)
+		{
+			for (const auto& part : feature.parts)
+				for (const auto& clipped : Clip_Line(to_tile(part), low, high))
+				{
+					std::vector<Tile_Point> points = Quantize(clipped);
+					if (points.size() < 2)
+						continue;
+					commands.Move_To(points, 0, 1);
+					commands.Line_To(points, 1);
+				}
+		}
+		else
+		{
+			bool polygon_kept = false;
+			for (std::size_t part = 0; part < feature.parts.size(); ++part)
+			{
+				const bool outer = feature.outer[part];
+				if (!outer && !polygon_kept)
+					continue;
+				std::vector<World_Point> open_ring = to_tile(feature.parts[part]);
+				if (!open_ring.empty())
+					open_ring.pop_back();
+				std::vector<Tile_Point> ring = Quantize(Clip_Ring(std::move(open_ring), low, high));
+				if (ring.size() > 1 && ring.front() == ring.back())
+					ring.pop_back();
+				const std::int64_t area = ring.size() < 3 ? 0 : Double_Area(ring);
+				if (outer)
+					polygon_kept = area != 0;
+				if (area == 0)
+					continue;
+				if ((area > 0) != outer)
+					std::reverse(ring.begin(), ring.end());
+				commands.Move_To(ring, 0, 1);
+				commands.Line_To(ring, 1);
+				commands.Close_Path();
+			}
+		}
+
+		if (commands.Get_Commands().empty())
+			continue;
+
+		std::vector<std::uint32_t> tags;
+		tags.reserve(feature.tags.size());
+		for (std::size_t i = 0; i < feature.tags.size(); i += 2)
+		{
+			auto key = key_map.try_emplace(feature.tags[i], static_cast<std::uint32_t>(local_keys.size()));
+			if (key.second)
+				local_keys.push_back(feature.tags[i]);
+			auto value = value_map.try_emplace(feature.tags[i + 1], static_cast<std::uint32_t>(local_values.size()));
+			if (value.second)
+				local_values.push_back(feature.tags[i + 1]);
+			tags.push_back(key.first->second);
+			tags.push_back(value.first->second);
+		}
+
+		std::string encoded;
+		if (feature.id)
+			Put_Varint_Field(encoded, 1, *feature.id);
+		if (!tags.empty())
+			Put_Packed_Field(encoded, 2, tags);
+		Put_Varint_Field(encoded, 3, static_cast<std::uint32_t>(feature.kind));
+		Put_Packed_Field(encoded, 4, commands.Get_Commands());
+		encoded_features.push_back(std::move(encoded));
+	}
+
+	if (encoded_features.empty())
+		return {};
+
+	std::string layer;
+	Put_Varint_Field(layer, 15, 2);
+	Put_Bytes_Field(layer, 1, m_options.layer_name);
+	for (const std::string& feature : encoded_features)
+		Put_Bytes_Field(layer, 2, feature);
+	for (std::uint32_t key : local_keys)
+		Put_Bytes_Field(layer, 3, m_keys[key]);
+	for (std::uint32_t value : local_values)
+		Put_Bytes_Field(layer, 4, Encode_Value(m_values[value]));
+	Put_Varint_Field(layer, 5, m_options.extent);
+
+	std::string tile_bytes;
+	Put_Bytes_Field(tile_bytes, 3, layer);
+	return tile_bytes;
+}
+
+std::string Vector_Tiler::Encode_Tile(const Tile_Id& tile) const
+{
+	const double size = std::ldexp(1.0, -tile.z);
+	const double margin = size * m_options.buffer / m_options.extent;
+	const double box[4] = { tile.x * size - margin, tile.y * size - margin, (tile.x + 1) * size + margin, (tile.y + 1) * size + margin };
+
+	std::vector<std::uint32_t> selection;
+	for (std::size_t i = 0; i < m_features.size(); ++i)
+	{
+		const auto& bbox = m_features[i].bbox;
+		if (bbox[0] <= box[2] && bbox[2] >= box[0] && bbox[1] <= box[3] && bbox[3] >= box[1])
+			selection.push_back(static_cast<std::uint32_t>(i));
+	}
+	std::vector<std::uint32_t> all(selection.size());
+	std::iota(all.begin(), all.end(), 0);
+	return Encode(tile, Simplify(tile.z, selection), all);
+}
+
+std::vector<Vector_Tiler::Tile_Cell> Vector_Tiler::Split(const std::vector<Tile_Cell>& cells) const
+{
+	// a simplified geometry stays within the tolerance of the original one, the margin keeps every tile where it can show up
+	const double margin = (static_cast<double>(m_options.buffer) + m_options.tolerance) / m_options.extent;
+	const double low = -margin;
+	const double high = 1 + margin;
+
+	std::vector<std::vector<Tile_Cell>> children(cells.size());
+	Parallel_For(cells.size(), m_options.thread_count, [&](std::size_t c)
+	{
+		const Tile_Cell& cell = cells[c];
+		for (std::uint32_t dx = 0; dx < 2; ++dx)
+			for (std::uint32_t dy = 0; dy < 2; ++dy)
+			{
+				Tile_Cell child;
+				child.tile = Tile_Id{ static_cast<std::uint8_t>(cell.tile.z + 1), 2 * cell.tile.x + dx, 2 * cell.tile.y + dy };
+				auto to_child = [dx, dy](const std::vector<World_Point>& points)
+				{
+					std::vector<World_Point> transformed;
+					transformed.reserve(points.size());
+					for (const World_Point& point : points)
+						transformed.push_back({ 2 * point[0] - dx, 2 * point[1] - dy });
+					return transformed;
+				};
+
+				for (std::size_t k = 0; k < cell.features.size(); ++k)
+				{
+					const Kind kind = m_features[cell.features[k]].kind;
+					std::vector<std::vector<World_Point>> clipped;
+					for (const auto& part : cell.parts[k])
+					{
+						if (kind == Kind::POINT)
+						{
+							std::vector<World_Point> points;
+							for (const World_Point& point : to_child(part))
+								if (point[0] >= low && point[0] <= high && point[1] >= low && point[1] <= high)
+									points.push_back(point);
+							if (!points.empty())
+								clipped.push_back(std::move(points));
+						}
+						else if (kind == Kind::LINE_STRING)
+						{
+							for (auto& line : Clip_Line(to_child(part), low, high))
+								clipped.push_back(std::move(line));
+						}
+						else if (std::vector<World_Point> ring = Clip_Ring(to_child(part), low, high); ring.size() >= 3)
+							clipped.push_back(std::move(ring));
+					}
+					if (clipped.empty())
+						continue;
+					child.features.push_back(cell.features[k]);
+					child.parts.push_back(std::move(clipped));
+				}
+				if (!child.features.empty())
+					children[c].push_back(std::move(child));
+			}
+	});
+
+	std::vector<Tile_Cell> result;
+	for (std::vector<Tile_Cell>& siblings : children)
+		for (Tile_Cell& child : siblings)
+			result.push_back(std::move(child));
+	std::sort(result.begin(), result.end(), [](const Tile_Cell& a, const Tile_Cell& b) { return a.tile < b.tile; });
+	return result;
+}
+
+Error Vector_Tiler::Generate(const Tile_Sink& sink) const
+{
+	std::vector<std::uint32_t> all(m_features.size());
+	std::iota(all.begin(), all.end(), 0);
+
+	// the whole pyramid holds every feature, the unit square is the world
+	std::vector<Tile_Cell> cells;
+	if (!m_features.empty())
+	{
+		Tile_Cell& root = cells.emplace_back();
+		root.features = all;
+		for (const Tile_Feature& feature : m_features)
+			root.parts.push_back(feature.parts);
+	}
+
+	for (std::uint32_t z = 0; z <= m_options.max_zoom; ++z)
+	{
+		if (z > 0)
+			cells = Split(cells);
+		if (z < m_options.min_zoom)
+			continue;
+
+		const std::vector<Tile_Feature> simplified = Simplify(static_cast<std::uint8_t>(z), all);
+		std::vector<std::string> encoded(cells.size());
+		Parallel_For(cells.size(), m_options.thread_count, [&](std::size_t i) { encoded[i] = Encode(cells[i].tile, simplified, cells[i].features); });
+
+		for (std::size_t i = 0; i < cells.size(); ++i)
+			if (!encoded[i].empty())
+				if (Error error = sink(cells[i].tile, encoded[i]); error != Error::NO_ERROR)
+					return error;
+	}
+	return Error::NO_ERROR;
+}
+
+Error Vector_Tiler::Write_Directory(const std::filesystem::path& directory) const
+{
+	return Generate([&directory](const Tile_Id& tile, std::string_view bytes)
+	{
+		const std::filesystem::path folder = directory / std::to_string(tile.z) / std::to_string(tile.x);
+		std::error_code error;
+		std::filesystem::create_directories(folder, error);
+		std::ofstream out(folder / (std::to_string(tile.y) + ".mvt"), std::ios::binary | std::ios::trunc);
+		if (error || !out)
+			return Error::FILE_OPENNING_FAILED;
+		out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+		return out ? Error::NO_ERROR : Error::FILE_WRITE_FAILED;
+	});
+}
+
+Error Vector_Tiler::Write_Archive(const std::filesystem::path& path) const
+{
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	if (!out)
+		return Error::FILE_OPENNING_FAILED;
+	out.write(ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+
+	std::vector<std::array<std::uint64_t, 3>> index;
+	std::uint64_t offset = sizeof(ARCHIVE_MAGIC);
+	Error error = Generate([&](const Tile_Id& tile, std::string_view bytes)
+	{
+		out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+		if (!out)
+			return Error::FILE_WRITE_FAILED;
+		index.push_back({ Tile_Key(tile), offset, bytes.size() });
+		offset += bytes.size();
+		return Error::NO_ERROR;
+	});
+	if (error != Error::NO_ERROR)
+		return error;
+
+	for (const auto& entry : index)
+		for (std::uint64_t value : entry)
+			Write_Little_Endian(out, value);
+	Write_Little_Endian(out, offset);
+	Write_Little_Endian<std::uint64_t>(out, index.size());
+	out.write(ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+	return out ? Error::NO_ERROR : Error::FILE_WRITE_FAILED;
+}
+
+//------------------------------------------------------------------
+// Tile_Archive_Reader
+
+O::Expected<Tile_Archive_Reader, Error> Tile_Archive_Reader::Open(const std::filesystem::path& path)
+{
+	using Expected = O::Expected<Tile_Archive_Reader, Error>;
+	auto file = Mapped_File::Open(path);
+	if (!file.Has_Value())
+		return Expected::Make_Error(file.Error());
+
+	Tile_Archive_Reader reader;
+	reader.m_file = std::move(file.Value());
+	const std::string_view bytes = reader.m_file.View();
+	if (bytes.size() < sizeof(ARCHIVE_MAGIC) + ARCHIVE_FOOTER_SIZE
+		|| bytes.substr(0, sizeof(ARCHIVE_MAGIC)) != std::string_view(ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC))
+		|| bytes.substr(bytes.size() - sizeof(ARCHIVE_MAGIC)) != std::string_view(ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC)))
+		return Expected::Make_Error(Error::INVALID_TILE_ARCHIVE);
+
+	std::uint64_t footer[2];
+	std::memcpy(footer, bytes.data() + bytes.size() - ARCHIVE_FOOTER_SIZE, sizeof(footer));
+	const std::uint64_t index_end = bytes.size() - ARCHIVE_FOOTER_SIZE;
+	if (footer[0] < sizeof(ARCHIVE_MAGIC) || footer[0] > index_end || footer[1] != (index_end - footer[0]) / ARCHIVE_ENTRY_SIZE || (index_end - footer[0]) % ARCHIVE_ENTRY_SIZE != 0)
+		return Expected::Make_Error(Error::INVALID_TILE_ARCHIVE);
+	reader.m_index = static_cast<std::size_t>(footer[0]);
+	reader.m_count = static_cast<std::size_t>(footer[1]);
+	for (std::size_t i = 0; i < reader.m_count; ++i)
+		if (const auto entry = reader.Entry(i); entry[1] < sizeof(ARCHIVE_MAGIC) || entry[1] > reader.m_index || entry[2] > reader.m_index - entry[1])
+			return Expected::Make_Error(Error::INVALID_TILE_ARCHIVE);
+	return Expected::Make_Value(std::move(reader));
+}
+
+std::array<std::uint64_t, 3> Tile_Archive_Reader::Entry(std::size_t i) const
+{
+	std::array<std::uint64_t, 3> entry;
+	std::memcpy(entry.data(), m_file.View().data() + m_index + i * ARCHIVE_ENTRY_SIZE, ARCHIVE_ENTRY_SIZE);
+	return entry;
+}
+
+Tile_Id Tile_Archive_Reader::Get_Tile_Id(std::size_t i) const
+{
+	const std::uint64_t key = Entry(i)[0];
+	constexpr std::uint64_t MASK = (std::uint64_t(1) << 29) - 1;
+	return Tile_Id{ static_cast<std::uint8_t>(key >> 58), static_cast<std::uint32_t>((key >> 29) & MASK), static_cast<std::uint32_t>(key & MASK) };
+}
+
+std::string_view Tile_Archive_Reader::Get_Tile(const Tile_Id& tile) const
+{
+	const std::uint64_t key = Tile_Key(tile);
+	std::size_t first = 0, last = m_count;
+	while (first < last)
+	{
+		const std::size_t middle = first + (last - first) / 2;
+		if (Entry(middle)[0] < key)
+			first = middle + 1;
+		else
+			last = middle;
+	}
+	if (first == m_count)
+		return {};
+	const auto entry = Entry(first);
+	if (entry[0] != key)
+		return {};
+	return m_file.View().substr(static_cast<std::size_t>(entry[1]), static_cast<std::size_t>(entry[2]));
+}
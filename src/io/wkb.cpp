@@ -0,0 +1,776 @@
+#include "io/wkb.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+using namespace O::GeoJSON::IO;
+
+namespace
+{
+	/// @name WKB type codes
+	/// @{
+	constexpr std::uint32_t WKB_POINT = 1;
+	constexpr std::uint32_t WKB_LINE_STRING = 2;
+	constexpr std::uint32_t WKB_POLYGON = 3;
+	constexpr std::uint32_t WKB_MULTI_POINT = 4;
+	constexpr std::uint32_t WKB_MULTI_LINE_STRING = 5;
+	constexpr std::uint32_t WKB_MULTI_POLYGON = 6;
+	constexpr std::uint32_t WKB_GEOMETRY_COLLECTION = 7;
+	constexpr std::uint32_t ISO_Z_OFFSET = 1000;
+	constexpr std::uint32_t ISO_M_OFFSET = 2000;
+	constexpr std::uint32_t ISO_ZM_OFFSET = 3000;
+	constexpr std::uint32_t EWKB_Z_FLAG = 0x80000000;
+	constexpr std::uint32_t EWKB_M_FLAG = 0x40000000;
+	constexpr std::uint32_t EWKB_SRID_FLAG = 0x20000000;
+	/// @}
+
+	/// @name TWKB header bits
+	/// @{
+	constexpr std::uint8_t TWKB_BBOX = 0x01;
+	constexpr std::uint8_t TWKB_SIZE = 0x02;
+	constexpr std::uint8_t TWKB_ID_LIST = 0x04;
+	constexpr std::uint8_t TWKB_EXTENDED_DIMENSIONS = 0x08;
+	constexpr std::uint8_t TWKB_EMPTY = 0x10;
+	constexpr int TWKB_MAX_PRECISION = 7;
+	/// @}
+
+	/// @brief nested GeometryCollection limit of the decoders, deeper inputs are rejected instead of overflowing the stack
+	constexpr int MAX_DEPTH = 32;
+
+	/// @brief WKB (and TWKB) type code of each alternative of ``Geometry::value``
+	constexpr std::uint32_t TYPE_CODES[] = {
+		WKB_POINT,
+		WKB_MULTI_POINT,
+		WKB_LINE_STRING,
+		WKB_MULTI_LINE_STRING,
+		WKB_POLYGON,
+		WKB_MULTI_POLYGON,
+		WKB_GEOMETRY_COLLECTION,
+	};
+
+	template<class T>
+	T Byte_Swap(T value)
+	{
+		char bytes[sizeof(T)];
+		std::memcpy(bytes, &value, sizeof(T));
+		std::reverse(bytes, bytes + sizeof(T));
+		std::memcpy(&value, bytes, sizeof(T));
+		return value;
+	}
+
+	bool Has_Altitude(const std::vector<O::GeoJSON::Position>& positions)
+	{
+		return std::any_of(positions.begin(), positions.end(), [](const O::GeoJSON::Position& p) { return p.altitude.has_value(); });
+	}
+
+	bool Has_Altitude(const O::GeoJSON::Polygon& polygon)
+	{
+		return std::any_of(polygon.rings.begin(), polygon.rings.end(), [](const auto& ring) { return Has_Altitude(ring); });
+	}
+
+	bool Has_Altitude(const O::GeoJSON::Geometry& geometry)
+	{
+		if (geometry.Is_Point())            return geometry.Get_Point().position.altitude.has_value();
+		if (geometry.Is_Multi_Point())      return Has_Altitude(geometry.Get_Multi_Point().points);
+		if (geometry.Is_Line_String())      return Has_Altitude(geometry.Get_Line_String().positions);
+		if (geometry.Is_Polygon())          return Has_Altitude(geometry.Get_Polygon());
+		if (geometry.Is_Multi_Line_String())
+			return std::any_of(geometry.Get_Multi_Line_String().line_strings.begin(), geometry.Get_Multi_Line_String().line_strings.end(), [](const auto& line) { return Has_Altitude(line.positions); });
+		if (geometry.Is_Multi_Polygon())
+			return std::any_of(geometry.Get_Multi_Polygon().polygons.begin(), geometry.Get_Multi_Polygon().polygons.end(), [](const auto& polygon) { return Has_Altitude(polygon); });
+		const auto& geometries = geometry.Get_Geometry_Collection().geometries;
+		return std::any_of(geometries.begin(), geometries.end(), [](const auto& child) { return child && Has_Altitude(*child); });
+	}
+
+	//------------------------------------------------------------------
+	// WKB
+
+	/**
+	 * @brief little-endian WKB encoder, the dimension is fixed for the whole geometry
+	 */
+	class WKB_Encoder
+	{
+	public:
+		WKB_Encoder(std::string& out, bool has_z) : m_out(out), m_has_z(has_z) {}
+
+		void Geometry(const O::GeoJSON::Geometry& geometry)
+		{
+			Header(TYPE_CODES[geometry.value.index()]);
+			if (geometry.Is_Point())
+				Position(geometry.Get_Point().position);
+			else if (geometry.Is_Line_String())
+				Positions(geometry.Get_Line_String().positions);
+			else if (geometry.Is_Polygon())
+				Polygon(geometry.Get_Polygon());
+			else if (geometry.Is_Multi_Point())
+			{
+				Put<std::uint32_t>(static_cast<std::uint32_t>(geometry.Get_Multi_Point().points.size()));
+				for (const auto& point : geometry.Get_Multi_Point().points)
+				{
+					Header(WKB_POINT);
+					Position(point);
+				}
+			}
+			else if (geometry.Is_Multi_Line_String())
+			{
+				Put<std::uint32_t>(static_cast<std::uint32_t>(geometry.Get_Multi_Line_String().line_strings.size()));
+				for (const auto& line : geometry.Get_Multi_Line_String().line_strings)
+				{
+					Header(WKB_LINE_STRING);
+					Positions(line.positions);
+				}
+			}
+			else if (geometry.Is_Multi_Polygon())
+			{
+				Put<std::uint32_t>(static_cast<std::uint32_t>(geometry.Get_Multi_Polygon().polygons.size()));
+				for (const auto& polygon : geometry.Get_Multi_Polygon().polygons)
+				{
+					Header(WKB_POLYGON);
+					Polygon(polygon);
+				}
+			}
+			else
+			{
+				const auto& geometries = geometry.Get_Geometry_Collection().geometries;
+				Put<std::uint32_t>(static_cast<std::uint32_t>(std::count_if(geometries.begin(), geometries.end(), [](const auto& child) { return child != nullptr; })));
+				for (const auto& child : geometries)
+					if (child)
+						Geometry(*child);
+			}
+		}
+
+	private:
+		template<class T>
+		void Put(T value)
+		{
+			if constexpr (std::endian::native == std::endian::big)
+				value = Byte_Swap(value);
+			m_out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		void Header(std::uint32_t type)
+		{
+			Put<std::uint8_t>(1);
+			Put<std::uint32_t>(m_has_z ? type + ISO_Z_OFFSET : type);
+		}
+
+		void Position(const O::GeoJSON::Position& position)
+		{
+			Put<double>(position.longitude);
+			Put<double>(position.latitude);
+			if (m_has_z)
+				Put<double>(position.altitude.value_or(std::numeric_limits<double>::quiet_NaN()));
+		}
+
+		void Positions(const std::vector<O::GeoJSON::Position>& positions)
+		{
+			Put<std::uint32_t>(static_cast<std::uint32_t>(positions.size()));
+			for (const auto& position : positions)
+				Position(position);
+		}
+
+		void Polygon(const O::GeoJSON::Polygon& polygon)
+		{
+			Put<std::uint32_t>(static_cast<std::uint32_t>(polygon.rings.size()));
+			for (const auto& ring : polygon.rings)
+				Positions(ring);
+		}
+
+		std::string& m_out;
+		bool m_has_z;
+	};
+
+	/**
+	 * @brief bounds checked WKB decoder, any inconsistency makes it invalid
+	 */
+	class WKB_Decoder
+	{
+	public:
+		explicit WKB_Decoder(std::string_view bytes) : m_bytes(bytes) {}
+
+		bool Is_Valid() const { return m_valid; }
+		std::size_t Position_In_Buffer() const { return m_position; }
+
+		O::GeoJSON::Geometry Geometry(int depth)
+		{
+			O::GeoJSON::Geometry geometry;
+			const std::uint32_t type = Header();
+			if (!m_valid || depth > MAX_DEPTH)
+			{
+				m_valid = false;
+				return geometry;
+			}
+
+			switch (type)
+			{
+			case WKB_POINT:
+				geometry.value = O::GeoJSON::Point{ Position() };
+				break;
+			case WKB_LINE_STRING:
+				geometry.value = O::GeoJSON::Line_String{ Positions() };
+				break;
+			case WKB_POLYGON:
+				geometry.value = Polygon();
+				break;
+			case WKB_MULTI_POINT:
+			{
+				O::GeoJSON::Multi_Point multi_point;
+				multi_point.points.resize(Count(5 + 2 * sizeof(double)));
+				for (auto& point : multi_point.points)
+					if (Expect_Header(WKB_POINT))
+						point = Position();
+				geometry.value = std::move(multi_point);
+				break;
+			}
+			case WKB_MULTI_LINE_STRING:
+			{
+				O::GeoJSON::Multi_Line_String multi_line;
+				multi_line.line_strings.resize(Count(5 + sizeof(std::uint32_t)));
+				for (auto& line : multi_line.line_strings)
+					if (Expect_Header(WKB_LINE_STRING))
+						line.positions = Positions();
+				geometry.value = std::move(multi_line);
+				break;
+			}
+			case WKB_MULTI_POLYGON:
+			{
+				O::GeoJSON::Multi_Polygon multi_polygon;
+				multi_polygon.polygons.resize(Count(5 + sizeof(std::uint32_t)));
+				for (auto& polygon : multi_polygon.polygons)
+					if (Expect_Header(WKB_POLYGON))
+						polygon = Polygon();
+				geometry.value = std::move(multi_polygon);
+				break;
+			}
+			case WKB_GEOMETRY_COLLECTION:
+			{
+				O::GeoJSON::Geometry_Collection collection;
+				const std::size_t count = Count(5);
+				for (std::size_t i = 0; i < count && m_valid; ++i)
+					collection.geometries.push_back(std::make_shared<O::GeoJSON::Geometry>(Geometry(depth + 1)));
+				geometry.value = std::move(collection);
+				break;
+			}
+			default:
+				m_valid = false;
+				break;
+			}
+			return geometry;
+		}
+
+	private:
+		template<class T>
+		T Get()
+		{
+			T value{};
+			if (!m_valid || m_bytes.size() - m_position < sizeof(T))
+			{
+				m_valid = false;
+				return value;
+			}
+			std::memcpy(&value, m_bytes.data() + m_position, sizeof(T));
+			m_position += sizeof(T);
+			return m_swap ? Byte_Swap(value) : value;
+		}
+
+		/// @brief read a byte order and a type code, give back the 2D type code
+		std::uint32_t Header()
+		{
+			const std::uint8_t order = Get<std::uint8_t>();
+			if (order > 1)
+				m_valid = false;
+			m_swap = (order == 1) != (std::endian::native == std::endian::little);
+			std::uint32_t type = Get<std::uint32_t>();
+
+			m_has_z = (type & EWKB_Z_FLAG) != 0;
+			m_has_m = (type & EWKB_M_FLAG) != 0;
+			if (type & EWKB_SRID_FLAG)
+				Get<std::uint32_t>();
+			type &= ~(EWKB_Z_FLAG | EWKB_M_FLAG | EWKB_SRID_FLAG);
+			if (type > ISO_ZM_OFFSET)      { type -= ISO_ZM_OFFSET; m_has_z = true; m_has_m = true; }
+			else if (type > ISO_M_OFFSET)  { type -= ISO_M_OFFSET; m_has_m = true; }
+			else if (type > ISO_Z_OFFSET)  { type -= ISO_Z_OFFSET; m_has_z = true; }
+			return type;
+		}
+
+		bool Expect_Header(std::uint32_t expected)
+		{
+			if (Header() != expected)
+				m_valid = false;
+			return m_valid;
+		}
+
+		/// @brief read an element count, rejecting counts that cannot fit in the remaining bytes
+		std::size_t Count(std::size_t min_element_size)
+		{
+			const std::size_t count = Get<std::uint32_t>();
+			if (!m_valid || count > (m_bytes.size() - m_position) / min_element_size)
+			{
+				m_valid = false;
+				return 0;
+			}
+			return count;
+		}
+
+		O::GeoJSON::Position Position()
+		{
+			O::GeoJSON::Position position;
+			position.longitude = Get<double>();
+			position.latitude = Get<double>();
+			if (m_has_z)
+				if (double altitude = Get<double>(); !std::isnan(altitude))
+					position.altitude = altitude;
+			if (m_has_m)
+				Get<double>();
+			return position;
+		}
+
+		std::vector<O::GeoJSON::Position> Positions()
+		{
+			std::vector<O::GeoJSON::Position> positions(Count(2 * sizeof(double)));
+			for (auto& position : positions)
+				position = Position();
+			return positions;
+		}
+
+		O::GeoJSON::Polygon Polygon()
+		{
+			O::GeoJSON::Polygon polygon;
+			polygon.rings.resize(Count(sizeof(std::uint32_t)));
+			for (auto& ring : polygon.rings)
+				ring = Positions();
+			return polygon;
+		}
+
+		std::string_view m_bytes;
+		std::size_t m_position = 0;
+		bool m_valid = true;
+		bool m_swap = false;
+		bool m_has_z = false;
+		bool m_has_m = false;
+	};
+
+	//------------------------------------------------------------------
+	// TWKB
+
+	std::uint64_t Zigzag(std::int64_t value) { return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63); }
+	std::int64_t Unzigzag(std::uint64_t value) { return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1); }
+
+	/**
+	 * @brief TWKB encoder, deltas run across all the parts of a geometry and restart with every header
+	 */
+	class TWKB_Encoder
+	{
+	public:
+		TWKB_Encoder(std::string& out, int precision, bool has_z) :
+			m_out(out),
+			m_precision(std::clamp(precision, -TWKB_MAX_PRECISION, TWKB_MAX_PRECISION)),
+			m_z_precision(std::clamp(precision, 0, TWKB_MAX_PRECISION)),
+			m_scale(std::pow(10.0, m_precision)),
+			m_z_scale(std::pow(10.0, m_z_precision)),
+			m_has_z(has_z)
+		{
+		}
+
+		void Geometry(const O::GeoJSON::Geometry& geometry)
+		{
+			const std::uint32_t type = TYPE_CODES[geometry.value.index()];
+			if (geometry.Is_Point())
+			{
+				Header(type, false);
+				Position(geometry.Get_Point().position);
+			}
+			else if (geometry.Is_Line_String())
+			{
+				const auto& positions = geometry.Get_Line_String().positions;
+				if (Header(type, positions.empty()))
+					Positions(positions);
+			}
+			else if (geometry.Is_Polygon())
+			{
+				const auto& polygon = geometry.Get_Polygon();
+				if (Header(type, polygon.rings.empty()))
+					Polygon(polygon);
+			}
+			else if (geometry.Is_Multi_Point())
+			{
+				const auto& points = geometry.Get_Multi_Point().points;
+				if (Header(type, points.empty()))
+					Positions(points);
+			}
+			else if (geometry.Is_Multi_Line_String())
+			{
+				const auto& lines = geometry.Get_Multi_Line_String().line_strings;
+				if (Header(type, lines.empty()))
+				{
+					Varint(lines.size());
+					for (const auto& line : lines)
+						Positions(line.positions);
+				}
+			}
+			else if (geometry.Is_Multi_Polygon())
+			{
+				const auto& polygons = geometry.Get_Multi_Polygon().polygons;
+				if (Header(type, polygons.empty()))
+				{
+					Varint(polygons.size());
+					for (const auto& polygon : polygons)
+						Polygon(polygon);
+				}
+			}
+			else
+			{
+				const auto& geometries = geometry.Get_Geometry_Collection().geometries;
+				const std::size_t count = std::count_if(geometries.begin(), geometries.end(), [](const auto& child) { return child != nullptr; });
+				if (Header(type, count == 0))
+				{
+					Varint(count);
+					for (const auto& child : geometries)
+						if (child)
+							Geometry(*child);
+				}
+			}
+		}
+
+	private:
+		/// @brief write the header bytes, return true when the body must follow
+		bool Header(std::uint32_t type, bool empty)
+		{
+			m_out.push_back(static_cast<char>((Zigzag(m_precision) << 4) | type));
+			m_out.push_back(static_cast<char>((m_has_z ? TWKB_EXTENDED_DIMENSIONS : 0) | (empty ? TWKB_EMPTY : 0)));
+			if (m_has_z)
+				m_out.push_back(static_cast<char>(1 | (m_z_precision << 2)));
+			m_last = { 0, 0, 0 };
+			return !empty;
+		}
+
+		void Varint(std::uint64_t value)
+		{
+			while (value >= 0x80)
+			{
+				m_out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+				value >>= 7;
+			}
+			m_out.push_back(static_cast<char>(value));
+		}
+
+		void Delta(std::size_t axis, double value, double scale)
+		{
+			const std::int64_t scaled = std::llround(value * scale);
+			Varint(Zigzag(scaled - m_last[axis]));
+			m_last[axis] = scaled;
+		}
+
+		void Position(const O::GeoJSON::Position& position)
+		{
+			Delta(0, position.longitude, m_scale);
+			Delta(1, position.latitude, m_scale);
+			if (m_has_z)
+				Delta(2, position.altitude.value_or(0.0), m_z_scale);
+		}
+
+		void Positions(const std::vector<O::GeoJSON::Position>& positions)
+		{
+			Varint(positions.size());
+			for (const auto& position : positions)
+				Position(position);
+		}
+
+		void Polygon(const O::GeoJSON::Polygon& polygon)
+		{
+			Varint(polygon.rings.size());
+			for (const auto& ring : polygon.rings)
+				Positions(ring);
+		}
+
+		std::string& m_out;
+		int m_precision;
+		int m_z_precision;
+		double m_scale;
+		double m_z_scale;
+		bool m_has_z;
+		std::array<std::int64_t, 3> m_last = { 0, 0, 0 };
+	};
+
+	/**
+	 * @brief bounds checked TWKB decoder, bbox, size and id lists are skipped, ``M`` values are dropped
+	 */
+	class TWKB_Decoder
+	{
+	public:
+		explicit TWKB_Decoder(std::string_view bytes) : m_bytes(bytes) {}
+
+		bool Is_Valid() const { return m_valid; }
+		std::size_t Position_In_Buffer() const { return m_position; }
+
+		O::GeoJSON::Geometry Geometry(int depth)
+		{
+			O::GeoJSON::Geometry geometry;
+			const std::uint8_t type_byte = Byte();
+			const std::uint8_t metadata = Byte();
+			const std::uint32_t type = type_byte & 0x0F;
+			m_scale = std::pow(10.0, -static_cast<double>(Unzigzag(type_byte >> 4)));
+			m_dimensions = 2;
+			m_has_z = false;
+			if (metadata & TWKB_EXTENDED_DIMENSIONS)
+			{
+				const std::uint8_t extended = Byte();
+				m_has_z = (extended & 0x01) != 0;
+				m_dimensions += (extended & 0x01) + ((extended >> 1) & 0x01);
+				m_z_scale = std::pow(10.0, -static_cast<double>((extended >> 2) & 0x07));
+			}
+			if (metadata & TWKB_SIZE)
+				Varint();
+			if (metadata & TWKB_BBOX)
+				for (std::size_t i = 0; i < 2 * m_dimensions; ++i)
+					Varint();
+			m_last = { 0, 0, 0, 0 };
+			const bool empty = (metadata & TWKB_EMPTY) != 0;
+			if (!m_valid || depth > MAX_DEPTH)
+			{
+				m_valid = false;
+				return geometry;
+			}
+
+			auto skip_id_list = [&](std::size_t count)
+			{
+				if (metadata & TWKB_ID_LIST)
+					for (std::size_t i = 0; i < count; ++i)
+						Varint();
+			};
+
+			switch (type)
+			{
+			case WKB_POINT:
+			{
+				O::GeoJSON::Position position{ std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN() };
+				if (!empty)
+					position = Position();
+				geometry.value = O::GeoJSON::Point{ position };
+				break;
+			}
+			case WKB_LINE_STRING:
+				geometry.value = O::GeoJSON::Line_String{ empty ? std::vector<O::GeoJSON::Position>() : Positions() };
+				break;
+			case WKB_POLYGON:
+				geometry.value = empty ? O::GeoJSON::Polygon() : Polygon();
+				break;
+			case WKB_MULTI_POINT:
+			{
+				O::GeoJSON::Multi_Point multi_point;
+				if (!empty)
+				{
+					multi_point.points.resize(Count());
+					skip_id_list(multi_point.points.size());
+					for (auto& point : multi_point.points)
+						point = Position();
+				}
+				geometry.value = std::move(multi_point);
+				break;
+			}
+			case WKB_MULTI_LINE_STRING:
+			{
+				O::GeoJSON::Multi_Line_String multi_line;
+				if (!empty)
+				{
+					multi_line.line_strings.resize(Count());
+					skip_id_list(multi_line.line_strings.size());
+					for (auto& line : multi_line.line_strings)
+						line.positions = Positions();
+				}
+				geometry.value = std::move(multi_line);
+				break;
+			}
+			case WKB_MULTI_POLYGON:
+			{
+				O::GeoJSON::Multi_Polygon multi_polygon;
+				if (!empty)
+				{
+					multi_polygon.polygons.resize(Count());
+					skip_id_list(multi_polygon.polygons.size());
+					for (auto& polygon : multi_polygon.polygons)
+						polygon = Polygon();
+				}
+				geometry.value = std::move(multi_polygon);
+				break;
+			}
+			case WKB_GEOMETRY_COLLECTION:
+			{
+				O::GeoJSON::Geometry_Collection collection;
+				if (!empty)
+				{
+					const std::size_t count = Count();
+					skip_id_list(count);
+					for (std::size_t i = 0; i < count && m_valid; ++i)
+						collection.geometries.push_back(std::make_shared<O::GeoJSON::Geometry>(Geometry(depth + 1)));
+				}
+				geometry.value = std::move(collection);
+				break;
+			}
+			default:
+				m_valid = false;
+				break;
+			}
+			return geometry;
+		}
+
+	private:
+		std::uint8_t Byte()
+		{
+			if (m_position >= m_bytes.size())
+			{
+				m_valid = false;
+				return 0;
+			}
+			return static_cast<std::uint8_t>(m_bytes[m_position++]);
+		}
+
+		std::uint64_t Varint()
+		{
+			std::uint64_t value = 0;
+			for (int shift = 0; shift < 64 && m_valid; shift += 7)
+			{
+				const std::uint8_t byte = Byte();
+				value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0)
+					return value;
+			}
+			m_valid = false;
+			return 0;
+		}
+
+		/// @brief read an element count, every element takes at least one byte
+		std::size_t Count()
+		{
+			const std::uint64_t count = Varint();
+			if (!m_valid || count > m_bytes.size() - m_position)
+			{
+				m_valid = false;
+				return 0;
+			}
+			return static_cast<std::size_t>(count);
+		}
+
+		double Delta(std::size_t axis, double scale)
+		{
+			m_last[axis] += Unzigzag(Varint());
+			return static_cast<double>(m_last[axis]) * scale;
+		}
+
+		O::GeoJSON::Position Position()
+		{
+			O::GeoJSON::Position position;
+			position.longitude = Delta(0, m_scale);
+			position.latitude = Delta(1, m_scale);
+			std::size_t axis = 2;
+			if (m_has_z)
+				position.altitude = Delta(axis++, m_z_scale);
+			for (; axis < m_dimensions; ++axis)
+				Delta(axis, 1.0);
+			return position;
+		}
+
+		std::vector<O::GeoJSON::Position> Positions()
+		{
+			std::vector<O::GeoJSON::Position> positions(Count());
+			for (auto& position : positions)
+				position = Position();
+			return positions;
+		}
+
+		O::GeoJSON::Polygon Polygon()
+		{
+			O::GeoJSON::Polygon polygon;
+			polygon.rings.resize(Count());
+			for (auto& ring : polygon.rings)
+				ring = Positions();
+			return polygon;
+		}
+
+		std::string_view m_bytes;
+		std::size_t m_position = 0;
+		bool m_valid = true;
+		bool m_has_z = false;
+		std::size_t m_dimensions = 2;
+		double m_scale = 1.0;
+		double m_z_scale = 1.0;
+		std::array<std::int64_t, 4> m_last = { 0, 0, 0, 0 };
+	};
+
+	template<class Decoder>
+	O::Expected<O::GeoJSON::Geometry, Error> Decode(std::string_view bytes, std::size_t* consumed)
+	{
+		using Expected = O::Expected<O::GeoJSON::Geometry, Error>;
+		Decoder decoder(bytes);
+		O::GeoJSON::Geometry geometry = decoder.Geometry(0);
+		if (!decoder.Is_Valid())
+			return Expected::Make_Error(Error::INVALID_WKB);
+		if (consumed)
+			*consumed = decoder.Position_In_Buffer();
+		return Expected::Make_Value(std::move(geometry));
+	}
+
+	template<class Encode>
+	Geometry_Buffer Encode_Collection(const O::GeoJSON::Feature_Collection& collection, Encode&& encode)
+	{
+		Geometry_Buffer buffer;
+		buffer.offsets.reserve(collection.features.size() + 1);
+		buffer.offsets.push_back(0);
+		for (const auto& feature : collection.features)
+		{
+			if (feature.geometry)
+				encode(*feature.geometry, buffer.data);
+			buffer.offsets.push_back(buffer.data.size());
+		}
+		return buffer;
+	}
+}
+
+void O::GeoJSON::IO::Write_WKB(const O::GeoJSON::Geometry& geometry, std::string& out)
+{
+	WKB_Encoder(out, Has_Altitude(geometry)).Geometry(geometry);
+}
+
+std::string O::GeoJSON::IO::To_WKB(const O::GeoJSON::Geometry& geometry)
+{
+	std::string out;
+	Write_WKB(geometry, out);
+	return out;
+}
+
+O::Expected<O::GeoJSON::Geometry, Error> O::GeoJSON::IO::From_WKB(std::string_view bytes, std::size_t* consumed)
+{
+	return Decode<WKB_Decoder>(bytes, consumed);
+}
+
+void O::GeoJSON::IO::Write_TWKB(const O::GeoJSON::Geometry& geometry, std::string& out, int precision)
+{
+	TWKB_Encoder(out, precision, Has_Altitude(geometry)).Geometry(geometry);
+}
+
+std::string O::GeoJSON::IO::To_TWKB(const O::GeoJSON::Geometry& geometry, int precision)
+{
+	std::string out;
+	Write_TWKB(geometry, out, precision);
+	return out;
+}
+
+O::Expected<O::GeoJSON::Geometry, Error> O::GeoJSON::IO::From_TWKB(std::string_view bytes, std::size_t* consumed)
+{
+	return Decode<TWKB_Decoder>(bytes, consumed);
+}
+
+Geometry_Buffer O::GeoJSON::IO::Encode_WKB(const O::GeoJSON::Feature_Collection& collection)
+{
+	return Encode_Collection(collection, [](const O::GeoJSON::Geometry& geometry, std::string& out) { Write_WKB(geometry, out); });
+}
+
+Geometry_Buffer O::GeoJSON::IO::Encode_TWKB(const O::GeoJSON::Feature_Collection& collection, int precision)
+{
+	return Encode_Collection(collection, [precision](const O::GeoJSON::Geometry& geometry, std::string& out) { Write_TWKB(geometry, out, precision); });
+}
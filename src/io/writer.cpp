@@ -1,4 +1,7 @@
 #include "io/writer.h"
+#include "io/number_format.h"
+#include "io/fd_write_stream.h"
+#include "io/compressed_write_stream.h"
 
 #include <cstdio>
 #include <ostream>
@@ -8,6 +11,7 @@
 
 #include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/filewritestream.h>
+#include <rapidjson/stringbuffer.h>
 
 using namespace O::GeoJSON::IO;
 
@@ -18,14 +22,26 @@ Writer<Out_Stream>::Writer(Out_Stream& out) :
 
 }
 
+template <class Out_Stream>
+bool Writer<Out_Stream>::Write_Coordinate(double value)
+{
+	if (m_coordinate_precision < 0)
+		return this->Double(value);
+	char buffer[FIXED_BUFFER_SIZE];
+	const std::size_t length = Format_Fixed(value, m_coordinate_precision, m_trim_trailing_zeros, buffer);
+	if (length == 0)
+		return false;
+	return this->RawValue(buffer, length, rapidjson::kNumberType);
+}
+
 template <class Out_Stream>
 void Writer<Out_Stream>::Write_Position(const O::GeoJSON::Position& p)
 {
 	this->StartArray();
-	this->Double(p.longitude);
-	this->Double(p.latitude);
+	Write_Coordinate(p.longitude);
+	Write_Coordinate(p.latitude);
 	if (p.altitude.has_value())
-		this->Double(*p.altitude);
+		Write_Coordinate(*p.altitude);
 	this->EndArray();
 }
 
@@ -37,16 +53,32 @@ void Writer<Out_Stream>::Write_Bbox(const O::GeoJSON::Bbox& bbox)
 	if (bbox.Has_Altitude())
 	{
 		const auto& arr = bbox.Get_With_Altitudes();
-		for (double v : arr) this->Double(v);
+		for (double v : arr) Write_Coordinate(v);
 	}
 	else
 	{
 		const auto& arr = bbox.Get();
-		for (double v : arr) this->Double(v);
+		for (double v : arr) Write_Coordinate(v);
 	}
 	this->EndArray();
 }
 
+template <class Out_Stream>
+void Writer<Out_Stream>::Write_Id(const O::GeoJSON::Id& id)
+{
+	if (id.Is_Integer())
+		this->Int64(id.Get_Integer());
+	else if (id.Is_Double())
+		this->Double(id.Get_Double());
+	else if (id.Is_String())
+	{
+		std::string_view s = id.Get_String();
+		this->String(s.data(), static_cast<rapidjson::SizeType>(s.size()));
+	}
+	else
+		this->Null();
+}
+
 template <class Out_Stream>
 void Writer<Out_Stream>::Write_Property_Value(const O::GeoJSON::Property& prop)
 {
@@ -119,11 +151,10 @@ void Writer<Out_Stream>::Write_Feature(const O::GeoJSON::Feature& f)
 	this->String("Feature");
 	if (f.bbox.has_value())
 		Write_Bbox(*f.bbox);
-	if (f.id.has_value())
+	if (f.id)
 	{
 		this->Key("id");
-		const std::string& s = *f.id;
-		this->String(s.c_str(), static_cast<rapidjson::SizeType>(s.size()));
+		Write_Id(f.id);
 	}
 	if (f.geometry.has_value())
 	{
@@ -257,11 +288,10 @@ void Writer<Out_Stream>::Write_Feature_Collection(const O::GeoJSON::Feature_Coll
 	this->String("FeatureCollection");
 	if (fc.bbox.has_value())
 		Write_Bbox(*fc.bbox);
-	if (fc.id.has_value())
+	if (fc.id)
 	{
 		this->Key("id");
-		const std::string& s = *fc.id;
-		this->String(s.c_str(), static_cast<rapidjson::SizeType>(s.size()));
+		Write_Id(fc.id);
 	}
 
 	this->Key("features");
@@ -275,6 +305,72 @@ void Writer<Out_Stream>::Write_Feature_Collection(const O::GeoJSON::Feature_Coll
 	this->EndArray();
 }
 
+template <class Out_Stream>
+void Writer<Out_Stream>::Begin_Feature_Collection(const std::optional<O::GeoJSON::Bbox>& bbox, const O::GeoJSON::Id& id)
+{
+	this->StartObject();
+	this->Key("type");
+	this->String("FeatureCollection");
+	if (bbox.has_value())
+		Write_Bbox(*bbox);
+	if (id)
+	{
+		this->Key("id");
+		Write_Id(id);
+	}
+	this->Key("features");
+	this->StartArray();
+	m_streaming = true;
+}
+
+template <class Out_Stream>
+void Writer<Out_Stream>::Append_Feature(const O::GeoJSON::Feature& f)
+{
+	this->StartObject();
+	Write_Feature(f);
+	this->EndObject();
+}
+
+template <class Out_Stream>
+void Writer<Out_Stream>::End_Feature_Collection(const std::optional<O::GeoJSON::Bbox>& bbox, const O::GeoJSON::Id& id)
+{
+	this->EndArray();
+	if (bbox.has_value())
+		Write_Bbox(*bbox);
+	if (id)
+	{
+		this->Key("id");
+		Write_Id(id);
+	}
+	this->EndObject();
+	m_streaming = false;
+}
+
+template <class Out_Stream>
+bool Writer<Out_Stream>::On_Full_Feature(O::GeoJSON::Feature&& feature)
+{
+	if (!m_streaming)
+		Begin_Feature_Collection();
+	Append_Feature(feature);
+	return true;
+}
+
+template <class Out_Stream>
+bool Writer<Out_Stream>::On_Root(std::optional<O::GeoJSON::Bbox>&& bbox, O::GeoJSON::Id&& id)
+{
+	if (!m_streaming)
+		Begin_Feature_Collection();
+	End_Feature_Collection(bbox, id);
+	return true;
+}
+
+template <class Out_Stream>
+void Writer<Out_Stream>::Finish()
+{
+	if (m_streaming)
+		End_Feature_Collection();
+}
+
 template <class Out_Stream>
 void Writer<Out_Stream>::Write_GeoJSON_Object(const O::GeoJSON::Root& g)
 {
@@ -296,4 +392,7 @@ void Writer<Out_Stream>::Write_GeoJSON_Object(const O::GeoJSON::Root& g)
 
 
 template class Writer<rapidjson::OStreamWrapper>;
-template class Writer<rapidjson::FileWriteStream>;
\ No newline at end of file
+template class Writer<rapidjson::FileWriteStream>;
+template class Writer<rapidjson::StringBuffer>;
+template class Writer<Fd_Write_Stream>;
+template class Writer<Compressed_Write_Stream>;
\ No newline at end of file
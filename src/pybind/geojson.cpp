@@ -105,6 +105,24 @@ inline Property PyBind_To_Property(pybind11::handle obj)
     throw std::runtime_error("Unsupported pybind11thon type for conversion to GeoJSON::Property");
 }
 
+pybind11::object Id_To_PyBind(const Id& id)
+{
+	if (id.Is_Integer()) return pybind11::int_(id.Get_Integer());
+	if (id.Is_Double())  return pybind11::float_(id.Get_Double());
+	if (id.Is_String())  return pybind11::str(std::string(id.Get_String()));
+	return pybind11::none();
+}
+
+Id PyBind_To_Id(pybind11::handle obj)
+{
+	if (obj.is_none())                            return Id();
+	if (pybind11::isinstance<pybind11::bool_>(obj)) throw std::runtime_error("A GeoJSON id must be a string or a number");
+	if (pybind11::isinstance<pybind11::int_>(obj))  return Id(static_cast<std::int64_t>(obj.cast<long long>()));
+	if (pybind11::isinstance<pybind11::float_>(obj)) return Id(obj.cast<double>());
+	if (pybind11::isinstance<pybind11::str>(obj))    return Id(obj.cast<std::string>());
+	throw std::runtime_error("A GeoJSON id must be a string or a number");
+}
+
 void Init_Geojson_Bindings(pybind11::module_& m)
 {
 	// Position
@@ -243,10 +261,10 @@ void Init_Geojson_Bindings(pybind11::module_& m)
 		.def(pybind11::init<>())
 		.def_readwrite("geometry", &Feature::geometry)
 		.def_readwrite("properties", &Feature::properties)
-		.def_readwrite("id", &Feature::id)
+		.def_property("id", [](const Feature& f) { return Id_To_PyBind(f.id); }, [](Feature& f, pybind11::handle obj) { f.id = PyBind_To_Id(obj); })
 		.def_readwrite("bbox", &Feature::bbox)
 		.def("__repr__", [](const Feature& f) {
-			return "Feature(id=" + (f.id ? *f.id : "none") + ", geometry=" + (f.geometry ? "present" : "none") + ")";
+			return "Feature(id=" + (f.id ? f.id.To_String() : "none") + ", geometry=" + (f.geometry ? "present" : "none") + ")";
 		});
 
 	// FeatureCollection
@@ -254,7 +272,7 @@ void Init_Geojson_Bindings(pybind11::module_& m)
 		.def(pybind11::init<>())
 		.def_readwrite("features", &Feature_Collection::features)
 		.def_readwrite("bbox", &Feature_Collection::bbox)
-		.def_readwrite("id", &Feature_Collection::id)
+		.def_property("id", [](const Feature_Collection& fc) { return Id_To_PyBind(fc.id); }, [](Feature_Collection& fc, pybind11::handle obj) { fc.id = PyBind_To_Id(obj); })
 		.def("__repr__", [](const Feature_Collection& fc) {
 			return "FeatureCollection(features=" + std::to_string(fc.features.size()) + ")";
 		});
@@ -100,6 +100,53 @@ O::GeoJSON::Root Py_Full_Parser::Get_Value()
 	return  m_geojson;
 }
 
+GeoJSON::IO::Error Py_Feature_Index::Build(const std::filesystem::path& path)
+{
+	auto index = GeoJSON::IO::Feature_Index::Build(path);
+	if (!index.Has_Value()) return index.Error();
+	m_index = std::move(index.Value());
+	return GeoJSON::IO::Error::NO_ERROR;
+}
+
+GeoJSON::IO::Error Py_Feature_Index::Load(const std::filesystem::path& path)
+{
+	auto index = GeoJSON::IO::Feature_Index::Load(path);
+	if (!index.Has_Value()) return index.Error();
+	m_index = std::move(index.Value());
+	return GeoJSON::IO::Error::NO_ERROR;
+}
+
+GeoJSON::IO::Error Py_Feature_Index::Save(const std::filesystem::path& path) const
+{
+	return m_index.Save(path);
+}
+
+GeoJSON::IO::Error Py_Indexed_Reader::Open(const std::filesystem::path& path, const Py_Feature_Index& index)
+{
+	auto reader = GeoJSON::IO::Indexed_Reader::Open(path, index.Get_Index());
+	if (!reader.Has_Value()) return reader.Error();
+	m_reader = std::move(reader.Value());
+	return GeoJSON::IO::Error::NO_ERROR;
+}
+
+std::string Py_Indexed_Reader::Feature_Text(std::size_t i) const
+{
+	if (!m_reader || i >= m_reader->Get_Index().Size()) throw pybind11::index_error();
+	return std::string(m_reader->Feature_Text(i));
+}
+
+GeoJSON::IO::Error Py_Indexed_Reader::Parse_Features(Py_Feature_Parser& handler, const std::vector<std::size_t>& indices) const
+{
+	if (!m_reader) return GeoJSON::IO::Error::FILE_OPENNING_FAILED;
+	return m_reader->Parse_Features(indices, handler);
+}
+
+GeoJSON::IO::Error Py_Indexed_Reader::Parse_Bbox(Py_Feature_Parser& handler, const std::array<double, 4>& bbox) const
+{
+	if (!m_reader) return GeoJSON::IO::Error::FILE_OPENNING_FAILED;
+	return m_reader->Parse_Bbox(bbox, handler);
+}
+
 void Init_Io_Bindings(pybind11::module_ &m)
 {
 	// Error Type enum
@@ -127,7 +174,19 @@ void Init_Io_Bindings(pybind11::module_ &m)
 		.value("PROPERTY_KEY_ALREADY_EXIST",                  GeoJSON::IO::Error::PROPERTY_KEY_ALREADY_EXIST)
 		.value("RECURSIVE_GEMETRY_COLLECTION_UNSUPPORTED",    GeoJSON::IO::Error::RECURSIVE_GEMETRY_COLLECTION_UNSUPPORTED)
 		.value("UNKNOWN_ROOT_OBJECT",                         GeoJSON::IO::Error::UNKNOWN_ROOT_OBJECT)
-		.value("GEOMETRY_COLLECTION_ELLEMENT_COUNT_MISMATCH", GeoJSON::IO::Error::GEOMETRY_COLLECTION_ELLEMENT_COUNT_MISMATCH
+		.value("GEOMETRY_COLLECTION_ELLEMENT_COUNT_MISMATCH", GeoJSON::IO::Error::GEOMETRY_COLLECTION_ELLEMENT_COUNT_MISMATCH)
+		.value("GEOMETRY_TYPE_DISABLED_BY_POLICY",            GeoJSON::IO::Error::GEOMETRY_TYPE_DISABLED_BY_POLICY)
+		.value("INVALID_INDEX_FILE",                          GeoJSON::IO::Error::INVALID_INDEX_FILE)
+		.value("FEATURE_INDEX_OUT_OF_RANGE",                  GeoJSON::IO::Error::FEATURE_INDEX_OUT_OF_RANGE)
+		.value("FILE_WRITE_FAILED",                           GeoJSON::IO::Error::FILE_WRITE_FAILED)
+		.value("COMPRESSION_UNAVAILABLE",                     GeoJSON::IO::Error::COMPRESSION_UNAVAILABLE)
+		.value("COMPRESSION_FAILED",                          GeoJSON::IO::Error::COMPRESSION_FAILED)
+		.value("INVALID_FLAT_GEOBUF",                         GeoJSON::IO::Error::INVALID_FLAT_GEOBUF)
+		.value("INVALID_WKB",                                 GeoJSON::IO::Error::INVALID_WKB)
+		.value("INVALID_TILE_ARCHIVE",                        GeoJSON::IO::Error::INVALID_TILE_ARCHIVE)
+		.value("INVALID_SNAPSHOT",                            GeoJSON::IO::Error::INVALID_SNAPSHOT)
+		.value("HANDLER_ABORTED",                             GeoJSON::IO::Error::HANDLER_ABORTED)
+		.value("TOO_MANY_PROPERTY_COLUMNS",                   GeoJSON::IO::Error::TOO_MANY_PROPERTY_COLUMNS
 		).export_values();
 	
 	// FullParser
@@ -150,6 +209,47 @@ void Init_Io_Bindings(pybind11::module_ &m)
 		.def("Parse_From_File", &Py_SAX_Parser::Parse_From_File)
 		.def("Parse_From_String", &Py_SAX_Parser::Parse_From_String);
 
+	// Sidecar feature index and random access reader
+	pybind11::class_<Py_Feature_Index>(m, "Feature_Index")
+		.def(pybind11::init<>())
+		.def("Build", &Py_Feature_Index::Build)
+		.def("Load",  &Py_Feature_Index::Load)
+		.def("Save",  &Py_Feature_Index::Save)
+		.def("Size",  &Py_Feature_Index::Size)
+		.def("Query", &Py_Feature_Index::Query)
+		.def("Find",  &Py_Feature_Index::Find);
+
+	pybind11::class_<Py_Indexed_Reader>(m, "Indexed_Reader")
+		.def(pybind11::init<>())
+		.def("Open",           &Py_Indexed_Reader::Open)
+		.def("Feature_Text",   &Py_Indexed_Reader::Feature_Text)
+		.def("Parse_Features", &Py_Indexed_Reader::Parse_Features)
+		.def("Parse_Bbox",     &Py_Indexed_Reader::Parse_Bbox);
+
+	// Binary geometries, bytes objects readable by shapely.from_wkb
+	auto decode = [](auto from)
+	{
+		return [from](const pybind11::bytes& bytes)
+		{
+			auto geometry = from(std::string_view(bytes), nullptr);
+			if (!geometry.Has_Value())
+				throw pybind11::value_error("invalid binary geometry");
+			return std::move(geometry.Value());
+		};
+	};
+	auto buffer = [](const GeoJSON::IO::Geometry_Buffer& encoded)
+	{
+		return pybind11::make_tuple(pybind11::bytes(encoded.data), pybind11::array_t<std::uint64_t>(encoded.offsets.size(), encoded.offsets.data()));
+	};
+	m.def("To_WKB",  [](const GeoJSON::Geometry& geometry) { return pybind11::bytes(GeoJSON::IO::To_WKB(geometry)); });
+	m.def("To_TWKB", [](const GeoJSON::Geometry& geometry, int precision) { return pybind11::bytes(GeoJSON::IO::To_TWKB(geometry, precision)); },
+		pybind11::arg("geometry"), pybind11::arg("precision") = GeoJSON::IO::DEFAULT_TWKB_PRECISION);
+	m.def("From_WKB",  decode(&GeoJSON::IO::From_WKB));
+	m.def("From_TWKB", decode(&GeoJSON::IO::From_TWKB));
+	m.def("Encode_WKB",  [buffer](const GeoJSON::Feature_Collection& collection) { return buffer(GeoJSON::IO::Encode_WKB(collection)); });
+	m.def("Encode_TWKB", [buffer](const GeoJSON::Feature_Collection& collection, int precision) { return buffer(GeoJSON::IO::Encode_TWKB(collection, precision)); },
+		pybind11::arg("collection"), pybind11::arg("precision") = GeoJSON::IO::DEFAULT_TWKB_PRECISION);
+
 	pybind11::class_<std::filesystem::path>(m, "Path")
 		.def(pybind11::init<std::string>());
 	pybind11::implicitly_convertible<std::string, std::filesystem::path>();